@@ -0,0 +1,705 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/miniconda/lib/cmake/GTest/GTestConfig.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestConfigVersion.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestTargets-release.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestTargets.cmake"
+  "/root/repo/.git/HEAD"
+  "/root/repo/.git/refs/heads/master"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/git-data/grabRef.cmake"
+  "source/scripts/rpc/remote/rpc-remote-config.cmake"
+  "/root/repo/cmake/CheckCCompilerFlagStackSmashing.cmake"
+  "/root/repo/cmake/CheckCXXCompilerFlagStackSmashing.cmake"
+  "/root/repo/cmake/CompileOptions.cmake"
+  "/root/repo/cmake/Custom.cmake"
+  "/root/repo/cmake/FindClangFormat.cmake"
+  "/root/repo/cmake/FindNodeJS.cmake"
+  "/root/repo/cmake/GetGitRevisionDescription.cmake"
+  "/root/repo/cmake/GetGitRevisionDescription.cmake.in"
+  "/root/repo/cmake/Portability.cmake"
+  "/root/repo/cmake/RuntimeDependencies.cmake"
+  "/root/repo/cmake/ScriptProject.cmake"
+  "/root/repo/cmake/SecurityFlags.cmake"
+  "/root/repo/cmake/TestEnvironmentVariables.cmake"
+  "/root/repo/cmake/Warnings.cmake"
+  "/root/repo/deploy/CMakeLists.txt"
+  "/root/repo/deploy/packages/pack-metacall.cmake"
+  "/root/repo/docs/CMakeLists.txt"
+  "/root/repo/metacall-config-version.cmake.in"
+  "/root/repo/metacall-config.cmake.in"
+  "/root/repo/source/CMakeLists.txt"
+  "/root/repo/source/adt/CMakeLists.txt"
+  "/root/repo/source/benchmarks/CMakeLists.txt"
+  "/root/repo/source/cli/CMakeLists.txt"
+  "/root/repo/source/configuration/CMakeLists.txt"
+  "/root/repo/source/detour/CMakeLists.txt"
+  "/root/repo/source/detours/CMakeLists.txt"
+  "/root/repo/source/dynlink/CMakeLists.txt"
+  "/root/repo/source/dynlink/include/dynlink/dynlink_interface.h.in"
+  "/root/repo/source/dynlink/source/dynlink_interface.c.in"
+  "/root/repo/source/environment/CMakeLists.txt"
+  "/root/repo/source/examples/CMakeLists.txt"
+  "/root/repo/source/extensions/CMakeLists.txt"
+  "/root/repo/source/extensions/plugin_extension/CMakeLists.txt"
+  "/root/repo/source/filesystem/CMakeLists.txt"
+  "/root/repo/source/format/CMakeLists.txt"
+  "/root/repo/source/loader/CMakeLists.txt"
+  "/root/repo/source/loaders/CMakeLists.txt"
+  "/root/repo/source/loaders/c_loader/CMakeLists.txt"
+  "/root/repo/source/loaders/cob_loader/CMakeLists.txt"
+  "/root/repo/source/loaders/cr_loader/CMakeLists.txt"
+  "/root/repo/source/loaders/cs_loader/CMakeLists.txt"
+  "/root/repo/source/loaders/dart_loader/CMakeLists.txt"
+  "/root/repo/source/loaders/ext_loader/CMakeLists.txt"
+  "/root/repo/source/loaders/file_loader/CMakeLists.txt"
+  "/root/repo/source/loaders/java_loader/CMakeLists.txt"
+  "/root/repo/source/loaders/jl_loader/CMakeLists.txt"
+  "/root/repo/source/loaders/js_loader/CMakeLists.txt"
+  "/root/repo/source/loaders/jsm_loader/CMakeLists.txt"
+  "/root/repo/source/loaders/llvm_loader/CMakeLists.txt"
+  "/root/repo/source/loaders/loaders.h.in"
+  "/root/repo/source/loaders/lua_loader/CMakeLists.txt"
+  "/root/repo/source/loaders/mock_loader/CMakeLists.txt"
+  "/root/repo/source/loaders/node_loader/CMakeLists.txt"
+  "/root/repo/source/loaders/py_loader/CMakeLists.txt"
+  "/root/repo/source/loaders/rb_loader/CMakeLists.txt"
+  "/root/repo/source/loaders/rpc_loader/CMakeLists.txt"
+  "/root/repo/source/loaders/rs_loader/CMakeLists.txt"
+  "/root/repo/source/loaders/ts_loader/CMakeLists.txt"
+  "/root/repo/source/loaders/wasm_loader/CMakeLists.txt"
+  "/root/repo/source/log/CMakeLists.txt"
+  "/root/repo/source/memory/CMakeLists.txt"
+  "/root/repo/source/metacall/CMakeLists.txt"
+  "/root/repo/source/metacall/metacall_def.h.in"
+  "/root/repo/source/plugin/CMakeLists.txt"
+  "/root/repo/source/plugins/CMakeLists.txt"
+  "/root/repo/source/plugins/backtrace_plugin/CMakeLists.txt"
+  "/root/repo/source/portability/CMakeLists.txt"
+  "/root/repo/source/ports/CMakeLists.txt"
+  "/root/repo/source/preprocessor/CMakeLists.txt"
+  "/root/repo/source/preprocessor/cmake/preprocessor_arguments.cmake"
+  "/root/repo/source/preprocessor/cmake/preprocessor_arithmetic.cmake"
+  "/root/repo/source/preprocessor/cmake/preprocessor_boolean.cmake"
+  "/root/repo/source/preprocessor/cmake/preprocessor_for.cmake"
+  "/root/repo/source/preprocessor/cmake/preprocessor_template.cmake"
+  "/root/repo/source/reflect/CMakeLists.txt"
+  "/root/repo/source/scripts/CMakeLists.txt"
+  "/root/repo/source/scripts/c/CMakeLists.txt"
+  "/root/repo/source/scripts/cobol/CMakeLists.txt"
+  "/root/repo/source/scripts/csharp/CMakeLists.txt"
+  "/root/repo/source/scripts/extension/CMakeLists.txt"
+  "/root/repo/source/scripts/extension/sum_extension/CMakeLists.txt"
+  "/root/repo/source/scripts/file/CMakeLists.txt"
+  "/root/repo/source/scripts/java/CMakeLists.txt"
+  "/root/repo/source/scripts/javascript/CMakeLists.txt"
+  "/root/repo/source/scripts/julia/CMakeLists.txt"
+  "/root/repo/source/scripts/llvm/CMakeLists.txt"
+  "/root/repo/source/scripts/lua/CMakeLists.txt"
+  "/root/repo/source/scripts/node/CMakeLists.txt"
+  "/root/repo/source/scripts/python/CMakeLists.txt"
+  "/root/repo/source/scripts/rpc/CMakeLists.txt"
+  "/root/repo/source/scripts/rpc/cmake/RPCProject.cmake"
+  "/root/repo/source/scripts/rpc/cmake/RPCProject.cmake.in"
+  "/root/repo/source/scripts/rpc/remote/CMakeLists.txt"
+  "/root/repo/source/scripts/ruby/CMakeLists.txt"
+  "/root/repo/source/scripts/rust/CMakeLists.txt"
+  "/root/repo/source/scripts/typescript/CMakeLists.txt"
+  "/root/repo/source/scripts/wasm/CMakeLists.txt"
+  "/root/repo/source/serial/CMakeLists.txt"
+  "/root/repo/source/serials/CMakeLists.txt"
+  "/root/repo/source/serials/metacall_serial/CMakeLists.txt"
+  "/root/repo/source/serials/msgpack_serial/CMakeLists.txt"
+  "/root/repo/source/serials/rapid_json_serial/CMakeLists.txt"
+  "/root/repo/source/tests/CMakeLists.txt"
+  "/root/repo/source/tests/adt_map_test/CMakeLists.txt"
+  "/root/repo/source/tests/adt_set_test/CMakeLists.txt"
+  "/root/repo/source/tests/adt_trie_test/CMakeLists.txt"
+  "/root/repo/source/tests/adt_vector_test/CMakeLists.txt"
+  "/root/repo/source/tests/configuration_test/CMakeLists.txt"
+  "/root/repo/source/tests/configuration_test/data/child_a.json.in"
+  "/root/repo/source/tests/configuration_test/data/child_b.json.in"
+  "/root/repo/source/tests/configuration_test/data/child_c.json.in"
+  "/root/repo/source/tests/configuration_test/data/child_d.json.in"
+  "/root/repo/source/tests/configuration_test/data/global.json.in"
+  "/root/repo/source/tests/detour_test/CMakeLists.txt"
+  "/root/repo/source/tests/dynlink_test/CMakeLists.txt"
+  "/root/repo/source/tests/environment_test/CMakeLists.txt"
+  "/root/repo/source/tests/log_custom_test/CMakeLists.txt"
+  "/root/repo/source/tests/log_socket_test/CMakeLists.txt"
+  "/root/repo/source/tests/log_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_backtrace_plugin_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_c_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_callback_complex_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_cast_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_clear_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_cli_core_plugin_await_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_cli_core_plugin_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_cobol_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_configuration_exec_path_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_cs_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_csharp_static_class_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_depends_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_distributable_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_ducktype_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_duplicated_handle_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_duplicated_symbols_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_dynlink_path_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_ext_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_file_fail_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_file_glob_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_file_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_fork_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_function_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_handle_export_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_handle_get_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_init_fini_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_initialize_destroy_multiple_node_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_initialize_destroy_multiple_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_initialize_ex_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_initialize_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_inspect_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_integration_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_invalid_loader_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_java_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_julia_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_library_path_without_env_vars_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_llvm_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_load_configuration_node_python_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_load_configuration_python_node_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_load_configuration_relative_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_load_configuration_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_load_configuration_test/data/metacall_load_from_configuration_node_test.json.in"
+  "/root/repo/source/tests/metacall_load_configuration_test/data/metacall_load_from_configuration_py_test_a.json.in"
+  "/root/repo/source/tests/metacall_load_configuration_test/data/metacall_load_from_configuration_py_test_b.json.in"
+  "/root/repo/source/tests/metacall_load_configuration_test/data/metacall_load_from_configuration_rb_test.json.in"
+  "/root/repo/source/tests/metacall_load_memory_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_logs_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_lua_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_map_await_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_map_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_node_async_resources_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_node_async_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_node_await_chain_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_node_call_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_node_callback_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_node_clear_mem_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_node_event_loop_signal_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_node_event_loop_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_node_exception_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_node_extension_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_node_fail_env_var_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_node_fail_load_leak_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_node_fail_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_node_inline_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_node_native_code_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_node_port_await_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_node_port_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_node_python_async_after_destroy_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_node_python_await_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_node_python_deadlock_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_node_python_exception_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_node_reentrant_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_node_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_node_typescript_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_plugin_extension_destroy_order_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_plugin_extension_local_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_plugin_extension_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_python_async_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_python_buffer_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_python_builtins_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_python_callback_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_python_dict_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_python_exception_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_python_fail_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_python_gc_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_python_loader_port_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_python_model_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_python_object_class_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_python_open_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_python_pointer_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_python_port_callback_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_python_port_https_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_python_port_import_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_python_port_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_python_reentrant_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_python_relative_path_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_python_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_python_thread_destroy_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_python_varargs_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_python_without_functions_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_reinitialize_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_reload_functions_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_return_monad_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_rpc_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_ruby_fail_empty_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_ruby_fail_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_ruby_object_class_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_ruby_parser_integration_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_ruby_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_rust_class_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_rust_load_from_mem_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_rust_load_from_package_class_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_rust_load_from_package_dep_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_rust_load_from_package_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_rust_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_thread_safe_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_typescript_call_map_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_typescript_jsx_default_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_typescript_node_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_typescript_require_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_typescript_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_typescript_tsx_loop_fail_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_typescript_tsx_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_version_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_wasm_python_port_test/CMakeLists.txt"
+  "/root/repo/source/tests/metacall_wasm_test/CMakeLists.txt"
+  "/root/repo/source/tests/portability_path_test/CMakeLists.txt"
+  "/root/repo/source/tests/preprocessor_test/CMakeLists.txt"
+  "/root/repo/source/tests/rb_loader_parser_test/CMakeLists.txt"
+  "/root/repo/source/tests/reflect_function_test/CMakeLists.txt"
+  "/root/repo/source/tests/reflect_metadata_test/CMakeLists.txt"
+  "/root/repo/source/tests/reflect_object_class_test/CMakeLists.txt"
+  "/root/repo/source/tests/reflect_scope_test/CMakeLists.txt"
+  "/root/repo/source/tests/reflect_value_cast_test/CMakeLists.txt"
+  "/root/repo/source/tests/serial_test/CMakeLists.txt"
+  "/root/repo/source/threading/CMakeLists.txt"
+  "/root/repo/source/version/CMakeLists.txt"
+  "/root/repo/source/version/include/version/version.h.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindDependencyMacro.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/ExternalProject.cmake"
+  "/usr/share/cmake-3.25/Modules/FindCURL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGTest.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GenerateExportHeader.cmake"
+  "/usr/share/cmake-3.25/Modules/GoogleTest.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  "/usr/share/cmake-3.25/Modules/exportheader.cmake.in"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/git-data/HEAD"
+  "CMakeFiles/git-data/grabRef.cmake"
+  "CMakeFiles/git-data/head-ref"
+  "metacall-config.cmake"
+  "metacall-config-version.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/include/metacall/metacall_loaders.h"
+  "source/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/include/metacall/metacall_version.h"
+  "source/version/include/version/version_api.h"
+  "source/version/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/preprocessor/include/preprocessor/preprocessor_api.h"
+  "source/preprocessor/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/environment/include/environment/environment_api.h"
+  "source/environment/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/format/include/format/format_api.h"
+  "source/format/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/log/include/log/log_api.h"
+  "source/log/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/memory/include/memory/memory_api.h"
+  "source/memory/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/portability/include/portability/portability_api.h"
+  "source/portability/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/threading/include/threading/threading_api.h"
+  "source/threading/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/adt/include/adt/adt_api.h"
+  "source/adt/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/filesystem/include/filesystem/filesystem_api.h"
+  "source/filesystem/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/dynlink/include/dynlink/dynlink_interface.h"
+  "source/dynlink/source/dynlink_interface.c"
+  "source/dynlink/include/dynlink/dynlink_api.h"
+  "source/dynlink/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/plugin/include/plugin/plugin_api.h"
+  "source/plugin/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/detour/include/detour/detour_api.h"
+  "source/detour/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/reflect/include/reflect/reflect_api.h"
+  "source/reflect/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/serial/include/serial/serial_api.h"
+  "source/serial/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/configuration/include/configuration/configuration_api.h"
+  "source/configuration/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/loader/include/loader/loader_api.h"
+  "source/loader/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/metacall/include/metacall/metacall_def.h"
+  "source/metacall/include/metacall/metacall_api.h"
+  "source/metacall/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/loaders/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/loaders/c_loader/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/loaders/cob_loader/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/loaders/cr_loader/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/loaders/cs_loader/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/loaders/dart_loader/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/loaders/ext_loader/include/ext_loader/ext_loader_api.h"
+  "source/loaders/ext_loader/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/loaders/file_loader/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/loaders/java_loader/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/loaders/jl_loader/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/loaders/jsm_loader/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/loaders/js_loader/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/loaders/llvm_loader/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/loaders/lua_loader/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/loaders/mock_loader/include/mock_loader/mock_loader_api.h"
+  "source/loaders/mock_loader/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/loaders/node_loader/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/loaders/py_loader/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/loaders/rb_loader/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/loaders/rs_loader/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/loaders/rpc_loader/include/rpc_loader/rpc_loader_api.h"
+  "source/loaders/rpc_loader/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/loaders/ts_loader/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/loaders/wasm_loader/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/serials/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/serials/metacall_serial/include/metacall_serial/metacall_serial_api.h"
+  "source/serials/metacall_serial/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/serials/rapid_json_serial/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/serials/msgpack_serial/include/msgpack_serial/msgpack_serial_api.h"
+  "source/serials/msgpack_serial/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/detours/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/extensions/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/extensions/plugin_extension/include/plugin_extension/plugin_extension_api.h"
+  "source/extensions/plugin_extension/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/plugins/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/plugins/backtrace_plugin/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/ports/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/scripts/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/scripts/c/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/scripts/cobol/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/scripts/csharp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/scripts/extension/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/scripts/extension/sum_extension/include/sum_extension/sum_extension_api.h"
+  "source/scripts/extension/sum_extension/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/scripts/file/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/scripts/java/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/scripts/julia/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/scripts/javascript/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/scripts/llvm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/scripts/lua/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/scripts/node/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/scripts/python/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/scripts/ruby/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/scripts/rust/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/scripts/rpc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/scripts/rpc/remote/rpc-remote-config.cmake"
+  "source/scripts/rpc/remote/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/scripts/typescript/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/scripts/wasm/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "DartConfiguration.tcl"
+  "source/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/preprocessor_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/environment_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/log_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/log_custom_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/log_socket_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/adt_set_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/adt_trie_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/adt_vector_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/adt_map_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/reflect_value_cast_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/reflect_function_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/reflect_object_class_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/reflect_scope_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/reflect_metadata_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/dynlink_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/detour_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/serial_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/configuration_test/global.json"
+  "source/tests/configuration_test/child_a.json"
+  "source/tests/configuration_test/child_b.json"
+  "source/tests/configuration_test/child_c.json"
+  "source/tests/configuration_test/child_d.json"
+  "source/tests/configuration_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/rb_loader_parser_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/portability_path_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_logs_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_load_memory_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_load_configuration_test/metacall_load_from_configuration_py_test_a.json"
+  "source/tests/metacall_load_configuration_test/metacall_load_from_configuration_py_test_b.json"
+  "source/tests/metacall_load_configuration_test/metacall_load_from_configuration_rb_test.json"
+  "source/tests/metacall_load_configuration_test/metacall_load_from_configuration_node_test.json"
+  "source/tests/metacall_load_configuration_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_load_configuration_relative_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_load_configuration_python_node_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_load_configuration_node_python_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_duplicated_handle_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_duplicated_symbols_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_handle_export_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_handle_get_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_node_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_node_event_loop_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_node_event_loop_signal_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_node_call_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_node_inline_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_node_async_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_node_reentrant_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_node_port_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_node_port_await_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_node_callback_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_node_fail_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_node_fail_env_var_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_node_fail_load_leak_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_node_typescript_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_node_python_async_after_destroy_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_node_python_await_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_node_python_exception_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_node_clear_mem_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_node_async_resources_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_node_await_chain_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_node_exception_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_node_python_deadlock_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_node_native_code_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_node_extension_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_distributable_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_cast_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_init_fini_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_thread_safe_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_ducktype_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_inspect_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_integration_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_depends_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_configuration_exec_path_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_clear_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_python_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_python_object_class_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_python_gc_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_python_open_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_python_dict_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_python_model_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_python_pointer_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_python_buffer_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_python_reentrant_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_python_varargs_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_python_loader_port_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_python_port_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_python_port_https_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_python_port_callback_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_python_port_import_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_python_callback_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_python_fail_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_python_relative_path_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_python_without_functions_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_python_builtins_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_python_async_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_python_exception_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_python_thread_destroy_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_map_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_map_await_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_initialize_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_initialize_ex_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_reinitialize_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_initialize_destroy_multiple_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_initialize_destroy_multiple_node_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_reload_functions_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_invalid_loader_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_fork_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_return_monad_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_callback_complex_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_ruby_fail_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_ruby_fail_empty_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_ruby_object_class_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_ruby_parser_integration_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_function_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_cobol_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_file_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_file_fail_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_file_glob_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_typescript_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_typescript_node_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_typescript_call_map_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_typescript_tsx_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_typescript_tsx_loop_fail_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_typescript_require_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_typescript_jsx_default_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_lua_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_rpc_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_csharp_static_class_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_llvm_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_ruby_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_cs_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_julia_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_java_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_wasm_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_wasm_python_port_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_rust_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_rust_load_from_mem_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_rust_load_from_package_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_rust_load_from_package_dep_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_rust_load_from_package_class_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_rust_class_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_c_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_version_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_dynlink_path_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_library_path_without_env_vars_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_ext_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_plugin_extension_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_plugin_extension_local_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_plugin_extension_destroy_order_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_cli_core_plugin_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_cli_core_plugin_await_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/tests/metacall_backtrace_plugin_test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/benchmarks/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/cli/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "source/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "docs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "CPackConfig-MetaCall.cmake"
+  "CPackSourceConfig.cmake"
+  "deploy/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "source/version/CMakeFiles/version.dir/DependInfo.cmake"
+  "source/preprocessor/CMakeFiles/preprocessor.dir/DependInfo.cmake"
+  "source/environment/CMakeFiles/environment.dir/DependInfo.cmake"
+  "source/format/CMakeFiles/format.dir/DependInfo.cmake"
+  "source/log/CMakeFiles/log.dir/DependInfo.cmake"
+  "source/memory/CMakeFiles/memory.dir/DependInfo.cmake"
+  "source/portability/CMakeFiles/portability.dir/DependInfo.cmake"
+  "source/threading/CMakeFiles/threading.dir/DependInfo.cmake"
+  "source/adt/CMakeFiles/adt.dir/DependInfo.cmake"
+  "source/filesystem/CMakeFiles/filesystem.dir/DependInfo.cmake"
+  "source/dynlink/CMakeFiles/dynlink.dir/DependInfo.cmake"
+  "source/plugin/CMakeFiles/plugin.dir/DependInfo.cmake"
+  "source/detour/CMakeFiles/detour.dir/DependInfo.cmake"
+  "source/reflect/CMakeFiles/reflect.dir/DependInfo.cmake"
+  "source/serial/CMakeFiles/serial.dir/DependInfo.cmake"
+  "source/configuration/CMakeFiles/configuration.dir/DependInfo.cmake"
+  "source/loader/CMakeFiles/loader.dir/DependInfo.cmake"
+  "source/metacall/CMakeFiles/metacall.dir/DependInfo.cmake"
+  "source/loaders/ext_loader/CMakeFiles/ext_loader.dir/DependInfo.cmake"
+  "source/loaders/mock_loader/CMakeFiles/mock_loader.dir/DependInfo.cmake"
+  "source/loaders/rpc_loader/CMakeFiles/rpc_loader.dir/DependInfo.cmake"
+  "source/serials/metacall_serial/CMakeFiles/metacall_serial.dir/DependInfo.cmake"
+  "source/serials/msgpack_serial/CMakeFiles/msgpack_serial.dir/DependInfo.cmake"
+  "source/extensions/plugin_extension/CMakeFiles/plugin_extension.dir/DependInfo.cmake"
+  "source/scripts/extension/sum_extension/CMakeFiles/sum_extension.dir/DependInfo.cmake"
+  "source/scripts/rpc/remote/CMakeFiles/rpc-remote.dir/DependInfo.cmake"
+  "source/tests/CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "source/tests/CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "source/tests/CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "source/tests/CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "source/tests/CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "source/tests/CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "source/tests/CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "source/tests/CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "source/tests/CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "source/tests/CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "source/tests/CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "source/tests/CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "source/tests/CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "source/tests/CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "source/tests/CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "source/tests/CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "source/tests/CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "source/tests/CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "source/tests/CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "source/tests/CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "source/tests/CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "source/tests/CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "source/tests/CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "source/tests/CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "source/tests/CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "source/tests/CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "source/tests/CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "source/tests/CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "source/tests/preprocessor_test/CMakeFiles/preprocessor-test.dir/DependInfo.cmake"
+  "source/tests/environment_test/CMakeFiles/environment-test.dir/DependInfo.cmake"
+  "source/tests/log_test/CMakeFiles/log-test.dir/DependInfo.cmake"
+  "source/tests/log_custom_test/CMakeFiles/log-custom-test.dir/DependInfo.cmake"
+  "source/tests/log_socket_test/CMakeFiles/log-socket-test.dir/DependInfo.cmake"
+  "source/tests/adt_set_test/CMakeFiles/adt-set-test.dir/DependInfo.cmake"
+  "source/tests/adt_trie_test/CMakeFiles/adt-trie-test.dir/DependInfo.cmake"
+  "source/tests/adt_vector_test/CMakeFiles/adt-vector-test.dir/DependInfo.cmake"
+  "source/tests/adt_map_test/CMakeFiles/adt-map-test.dir/DependInfo.cmake"
+  "source/tests/reflect_value_cast_test/CMakeFiles/reflect-value-cast-test.dir/DependInfo.cmake"
+  "source/tests/reflect_function_test/CMakeFiles/reflect-function-test.dir/DependInfo.cmake"
+  "source/tests/reflect_object_class_test/CMakeFiles/reflect-object-class-test.dir/DependInfo.cmake"
+  "source/tests/reflect_scope_test/CMakeFiles/reflect-scope-test.dir/DependInfo.cmake"
+  "source/tests/reflect_metadata_test/CMakeFiles/reflect-metadata-test.dir/DependInfo.cmake"
+  "source/tests/dynlink_test/CMakeFiles/dynlink-test.dir/DependInfo.cmake"
+  "source/tests/serial_test/CMakeFiles/serial-test.dir/DependInfo.cmake"
+  "source/tests/configuration_test/CMakeFiles/configuration-test.dir/DependInfo.cmake"
+  "source/tests/portability_path_test/CMakeFiles/portability-path-test.dir/DependInfo.cmake"
+  "source/tests/metacall_logs_test/CMakeFiles/metacall-logs-test.dir/DependInfo.cmake"
+  "source/tests/metacall_load_memory_test/CMakeFiles/metacall-load-memory-test.dir/DependInfo.cmake"
+  "source/tests/metacall_load_configuration_test/CMakeFiles/metacall-load-configuration-test.dir/DependInfo.cmake"
+  "source/tests/metacall_handle_export_test/CMakeFiles/metacall-handle-export-test.dir/DependInfo.cmake"
+  "source/tests/metacall_test/CMakeFiles/metacall-test.dir/DependInfo.cmake"
+  "source/tests/metacall_distributable_test/CMakeFiles/metacall-distributable-test.dir/DependInfo.cmake"
+  "source/tests/metacall_thread_safe_test/CMakeFiles/metacall-thread-safe-test.dir/DependInfo.cmake"
+  "source/tests/metacall_ducktype_test/CMakeFiles/metacall-ducktype-test.dir/DependInfo.cmake"
+  "source/tests/metacall_inspect_test/CMakeFiles/metacall-inspect-test.dir/DependInfo.cmake"
+  "source/tests/metacall_map_test/CMakeFiles/metacall-map-test.dir/DependInfo.cmake"
+  "source/tests/metacall_initialize_test/CMakeFiles/metacall-initialize-test.dir/DependInfo.cmake"
+  "source/tests/metacall_initialize_ex_test/CMakeFiles/metacall-initialize-ex-test.dir/DependInfo.cmake"
+  "source/tests/metacall_reinitialize_test/CMakeFiles/metacall-reinitialize-test.dir/DependInfo.cmake"
+  "source/tests/metacall_initialize_destroy_multiple_test/CMakeFiles/metacall-initialize-destroy-multiple-test.dir/DependInfo.cmake"
+  "source/tests/metacall_invalid_loader_test/CMakeFiles/metacall-invalid-loader-test.dir/DependInfo.cmake"
+  "source/tests/metacall_rpc_test/CMakeFiles/metacall-rpc-test.dir/DependInfo.cmake"
+  "source/tests/metacall_version_test/CMakeFiles/metacall-version-test.dir/DependInfo.cmake"
+  "source/tests/metacall_dynlink_path_test/CMakeFiles/metacall-dynlink-path-test.dir/DependInfo.cmake"
+  "source/tests/metacall_library_path_without_env_vars_test/CMakeFiles/metacall-library-path-without-env-vars-test.dir/DependInfo.cmake"
+  "source/tests/metacall_ext_test/CMakeFiles/metacall-ext-test.dir/DependInfo.cmake"
+  "deploy/CMakeFiles/pack.dir/DependInfo.cmake"
+  "deploy/CMakeFiles/pack-metacall.dir/DependInfo.cmake"
+  "deploy/CMakeFiles/component_install.dir/DependInfo.cmake"
+  "deploy/CMakeFiles/component_uninstall.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/component_uninstall"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/component_uninstall.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pack-metacall"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/pack-metacall.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,35 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/source
+# Build directory: /root/repo/_asan_build/source
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("version")
+subdirs("preprocessor")
+subdirs("environment")
+subdirs("format")
+subdirs("log")
+subdirs("memory")
+subdirs("portability")
+subdirs("threading")
+subdirs("adt")
+subdirs("filesystem")
+subdirs("dynlink")
+subdirs("plugin")
+subdirs("detour")
+subdirs("reflect")
+subdirs("serial")
+subdirs("configuration")
+subdirs("loader")
+subdirs("metacall")
+subdirs("loaders")
+subdirs("serials")
+subdirs("detours")
+subdirs("extensions")
+subdirs("plugins")
+subdirs("ports")
+subdirs("scripts")
+subdirs("tests")
+subdirs("benchmarks")
+subdirs("cli")
+subdirs("examples")
@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/adt/source/adt.c" "source/adt/CMakeFiles/adt.dir/source/adt.c.o" "gcc" "source/adt/CMakeFiles/adt.dir/source/adt.c.o.d"
+  "/root/repo/source/adt/source/adt_bucket.c" "source/adt/CMakeFiles/adt.dir/source/adt_bucket.c.o" "gcc" "source/adt/CMakeFiles/adt.dir/source/adt_bucket.c.o.d"
+  "/root/repo/source/adt/source/adt_comparable.c" "source/adt/CMakeFiles/adt.dir/source/adt_comparable.c.o" "gcc" "source/adt/CMakeFiles/adt.dir/source/adt_comparable.c.o.d"
+  "/root/repo/source/adt/source/adt_hash.c" "source/adt/CMakeFiles/adt.dir/source/adt_hash.c.o" "gcc" "source/adt/CMakeFiles/adt.dir/source/adt_hash.c.o.d"
+  "/root/repo/source/adt/source/adt_map.c" "source/adt/CMakeFiles/adt.dir/source/adt_map.c.o" "gcc" "source/adt/CMakeFiles/adt.dir/source/adt_map.c.o.d"
+  "/root/repo/source/adt/source/adt_set.c" "source/adt/CMakeFiles/adt.dir/source/adt_set.c.o" "gcc" "source/adt/CMakeFiles/adt.dir/source/adt_set.c.o.d"
+  "/root/repo/source/adt/source/adt_trie.c" "source/adt/CMakeFiles/adt.dir/source/adt_trie.c.o" "gcc" "source/adt/CMakeFiles/adt.dir/source/adt_trie.c.o.d"
+  "/root/repo/source/adt/source/adt_vector.c" "source/adt/CMakeFiles/adt.dir/source/adt_vector.c.o" "gcc" "source/adt/CMakeFiles/adt.dir/source/adt_vector.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_asan_build/source/log/CMakeFiles/log.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/preprocessor/CMakeFiles/preprocessor.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/format/CMakeFiles/format.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/threading/CMakeFiles/threading.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/version/CMakeFiles/version.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "../../libadtd.pdb"
+  "../../libadtd.so"
+  "CMakeFiles/adt.dir/source/adt.c.o"
+  "CMakeFiles/adt.dir/source/adt.c.o.d"
+  "CMakeFiles/adt.dir/source/adt_bucket.c.o"
+  "CMakeFiles/adt.dir/source/adt_bucket.c.o.d"
+  "CMakeFiles/adt.dir/source/adt_comparable.c.o"
+  "CMakeFiles/adt.dir/source/adt_comparable.c.o.d"
+  "CMakeFiles/adt.dir/source/adt_hash.c.o"
+  "CMakeFiles/adt.dir/source/adt_hash.c.o.d"
+  "CMakeFiles/adt.dir/source/adt_map.c.o"
+  "CMakeFiles/adt.dir/source/adt_map.c.o.d"
+  "CMakeFiles/adt.dir/source/adt_set.c.o"
+  "CMakeFiles/adt.dir/source/adt_set.c.o.d"
+  "CMakeFiles/adt.dir/source/adt_trie.c.o"
+  "CMakeFiles/adt.dir/source/adt_trie.c.o.d"
+  "CMakeFiles/adt.dir/source/adt_vector.c.o"
+  "CMakeFiles/adt.dir/source/adt_vector.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/adt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
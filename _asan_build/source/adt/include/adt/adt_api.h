@@ -0,0 +1,42 @@
+
+#ifndef ADT_API_H
+#define ADT_API_H
+
+#ifdef ADT_STATIC_DEFINE
+#  define ADT_API
+#  define ADT_NO_EXPORT
+#else
+#  ifndef ADT_API
+#    ifdef ADT_EXPORTS
+        /* We are building this library */
+#      define ADT_API __attribute__((visibility("default")))
+#    else
+        /* We are using this library */
+#      define ADT_API __attribute__((visibility("default")))
+#    endif
+#  endif
+
+#  ifndef ADT_NO_EXPORT
+#    define ADT_NO_EXPORT __attribute__((visibility("hidden")))
+#  endif
+#endif
+
+#ifndef ADT_DEPRECATED
+#  define ADT_DEPRECATED __attribute__ ((__deprecated__))
+#endif
+
+#ifndef ADT_DEPRECATED_EXPORT
+#  define ADT_DEPRECATED_EXPORT ADT_API ADT_DEPRECATED
+#endif
+
+#ifndef ADT_DEPRECATED_NO_EXPORT
+#  define ADT_DEPRECATED_NO_EXPORT ADT_NO_EXPORT ADT_DEPRECATED
+#endif
+
+#if 0 /* DEFINE_NO_DEPRECATED */
+#  ifndef ADT_NO_DEPRECATED
+#    define ADT_NO_DEPRECATED
+#  endif
+#endif
+
+#endif /* ADT_API_H */
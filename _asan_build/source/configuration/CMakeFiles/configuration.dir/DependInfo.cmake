@@ -0,0 +1,35 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/configuration/source/configuration.c" "source/configuration/CMakeFiles/configuration.dir/source/configuration.c.o" "gcc" "source/configuration/CMakeFiles/configuration.dir/source/configuration.c.o.d"
+  "/root/repo/source/configuration/source/configuration_impl.c" "source/configuration/CMakeFiles/configuration.dir/source/configuration_impl.c.o" "gcc" "source/configuration/CMakeFiles/configuration.dir/source/configuration_impl.c.o.d"
+  "/root/repo/source/configuration/source/configuration_object.c" "source/configuration/CMakeFiles/configuration.dir/source/configuration_object.c.o" "gcc" "source/configuration/CMakeFiles/configuration.dir/source/configuration_object.c.o.d"
+  "/root/repo/source/configuration/source/configuration_singleton.c" "source/configuration/CMakeFiles/configuration.dir/source/configuration_singleton.c.o" "gcc" "source/configuration/CMakeFiles/configuration.dir/source/configuration_singleton.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_asan_build/source/serial/CMakeFiles/serial.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/reflect/CMakeFiles/reflect.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/plugin/CMakeFiles/plugin.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/environment/CMakeFiles/environment.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/memory/CMakeFiles/memory.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/adt/CMakeFiles/adt.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/dynlink/CMakeFiles/dynlink.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/log/CMakeFiles/log.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/format/CMakeFiles/format.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/threading/CMakeFiles/threading.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/portability/CMakeFiles/portability.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/preprocessor/CMakeFiles/preprocessor.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/version/CMakeFiles/version.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,42 @@
+
+#ifndef DETOUR_API_H
+#define DETOUR_API_H
+
+#ifdef DETOUR_STATIC_DEFINE
+#  define DETOUR_API
+#  define DETOUR_NO_EXPORT
+#else
+#  ifndef DETOUR_API
+#    ifdef DETOUR_EXPORTS
+        /* We are building this library */
+#      define DETOUR_API __attribute__((visibility("default")))
+#    else
+        /* We are using this library */
+#      define DETOUR_API __attribute__((visibility("default")))
+#    endif
+#  endif
+
+#  ifndef DETOUR_NO_EXPORT
+#    define DETOUR_NO_EXPORT __attribute__((visibility("hidden")))
+#  endif
+#endif
+
+#ifndef DETOUR_DEPRECATED
+#  define DETOUR_DEPRECATED __attribute__ ((__deprecated__))
+#endif
+
+#ifndef DETOUR_DEPRECATED_EXPORT
+#  define DETOUR_DEPRECATED_EXPORT DETOUR_API DETOUR_DEPRECATED
+#endif
+
+#ifndef DETOUR_DEPRECATED_NO_EXPORT
+#  define DETOUR_DEPRECATED_NO_EXPORT DETOUR_NO_EXPORT DETOUR_DEPRECATED
+#endif
+
+#if 0 /* DEFINE_NO_DEPRECATED */
+#  ifndef DETOUR_NO_DEPRECATED
+#    define DETOUR_NO_DEPRECATED
+#  endif
+#endif
+
+#endif /* DETOUR_API_H */
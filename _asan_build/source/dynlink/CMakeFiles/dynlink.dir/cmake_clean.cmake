@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "../../libdynlinkd.pdb"
+  "../../libdynlinkd.so"
+  "CMakeFiles/dynlink.dir/source/dynlink.c.o"
+  "CMakeFiles/dynlink.dir/source/dynlink.c.o.d"
+  "CMakeFiles/dynlink.dir/source/dynlink_impl.c.o"
+  "CMakeFiles/dynlink.dir/source/dynlink_impl.c.o.d"
+  "CMakeFiles/dynlink.dir/source/dynlink_impl_unix.c.o"
+  "CMakeFiles/dynlink.dir/source/dynlink_impl_unix.c.o.d"
+  "CMakeFiles/dynlink.dir/source/dynlink_interface.c.o"
+  "CMakeFiles/dynlink.dir/source/dynlink_interface.c.o.d"
+  "CMakeFiles/dynlink.dir/source/dynlink_symbol.c.o"
+  "CMakeFiles/dynlink.dir/source/dynlink_symbol.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dynlink.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,30 @@
+/*
+ *	Dynamic Link Library by Parra Studios
+ *	A library for dynamic loading and linking shared objects at run-time.
+ *
+ *	Copyright (C) 2016 - 2022 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <dynlink/dynlink_interface.h>
+
+/* -- Methods -- */
+
+dynlink_impl_interface_singleton dynlink_interface(void)
+{
+	return &dynlink_impl_interface_singleton_unix;
+}
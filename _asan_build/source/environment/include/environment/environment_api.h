@@ -0,0 +1,42 @@
+
+#ifndef ENVIRONMENT_API_H
+#define ENVIRONMENT_API_H
+
+#ifdef ENVIRONMENT_STATIC_DEFINE
+#  define ENVIRONMENT_API
+#  define ENVIRONMENT_NO_EXPORT
+#else
+#  ifndef ENVIRONMENT_API
+#    ifdef ENVIRONMENT_EXPORTS
+        /* We are building this library */
+#      define ENVIRONMENT_API __attribute__((visibility("default")))
+#    else
+        /* We are using this library */
+#      define ENVIRONMENT_API __attribute__((visibility("default")))
+#    endif
+#  endif
+
+#  ifndef ENVIRONMENT_NO_EXPORT
+#    define ENVIRONMENT_NO_EXPORT __attribute__((visibility("hidden")))
+#  endif
+#endif
+
+#ifndef ENVIRONMENT_DEPRECATED
+#  define ENVIRONMENT_DEPRECATED __attribute__ ((__deprecated__))
+#endif
+
+#ifndef ENVIRONMENT_DEPRECATED_EXPORT
+#  define ENVIRONMENT_DEPRECATED_EXPORT ENVIRONMENT_API ENVIRONMENT_DEPRECATED
+#endif
+
+#ifndef ENVIRONMENT_DEPRECATED_NO_EXPORT
+#  define ENVIRONMENT_DEPRECATED_NO_EXPORT ENVIRONMENT_NO_EXPORT ENVIRONMENT_DEPRECATED
+#endif
+
+#if 0 /* DEFINE_NO_DEPRECATED */
+#  ifndef ENVIRONMENT_NO_DEPRECATED
+#    define ENVIRONMENT_NO_DEPRECATED
+#  endif
+#endif
+
+#endif /* ENVIRONMENT_API_H */
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../libplugin_extensiond.pdb"
+  "../../../libplugin_extensiond.so"
+  "CMakeFiles/plugin_extension.dir/source/plugin_extension.cpp.o"
+  "CMakeFiles/plugin_extension.dir/source/plugin_extension.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/plugin_extension.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/filesystem/source/filesystem.c" "source/filesystem/CMakeFiles/filesystem.dir/source/filesystem.c.o" "gcc" "source/filesystem/CMakeFiles/filesystem.dir/source/filesystem.c.o.d"
+  "/root/repo/source/filesystem/source/filesystem_directory_descriptor.c" "source/filesystem/CMakeFiles/filesystem.dir/source/filesystem_directory_descriptor.c.o" "gcc" "source/filesystem/CMakeFiles/filesystem.dir/source/filesystem_directory_descriptor.c.o.d"
+  "/root/repo/source/filesystem/source/filesystem_file_descriptor.c" "source/filesystem/CMakeFiles/filesystem.dir/source/filesystem_file_descriptor.c.o" "gcc" "source/filesystem/CMakeFiles/filesystem.dir/source/filesystem_file_descriptor.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_asan_build/source/adt/CMakeFiles/adt.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/log/CMakeFiles/log.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/preprocessor/CMakeFiles/preprocessor.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/format/CMakeFiles/format.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/threading/CMakeFiles/threading.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/version/CMakeFiles/version.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../libfilesystemd.pdb"
+  "../../libfilesystemd.so"
+  "CMakeFiles/filesystem.dir/source/filesystem.c.o"
+  "CMakeFiles/filesystem.dir/source/filesystem.c.o.d"
+  "CMakeFiles/filesystem.dir/source/filesystem_directory_descriptor.c.o"
+  "CMakeFiles/filesystem.dir/source/filesystem_directory_descriptor.c.o.d"
+  "CMakeFiles/filesystem.dir/source/filesystem_file_descriptor.c.o"
+  "CMakeFiles/filesystem.dir/source/filesystem_file_descriptor.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/filesystem.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
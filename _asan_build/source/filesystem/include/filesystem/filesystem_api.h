@@ -0,0 +1,42 @@
+
+#ifndef FILESYSTEM_API_H
+#define FILESYSTEM_API_H
+
+#ifdef FILESYSTEM_STATIC_DEFINE
+#  define FILESYSTEM_API
+#  define FILESYSTEM_NO_EXPORT
+#else
+#  ifndef FILESYSTEM_API
+#    ifdef FILESYSTEM_EXPORTS
+        /* We are building this library */
+#      define FILESYSTEM_API __attribute__((visibility("default")))
+#    else
+        /* We are using this library */
+#      define FILESYSTEM_API __attribute__((visibility("default")))
+#    endif
+#  endif
+
+#  ifndef FILESYSTEM_NO_EXPORT
+#    define FILESYSTEM_NO_EXPORT __attribute__((visibility("hidden")))
+#  endif
+#endif
+
+#ifndef FILESYSTEM_DEPRECATED
+#  define FILESYSTEM_DEPRECATED __attribute__ ((__deprecated__))
+#endif
+
+#ifndef FILESYSTEM_DEPRECATED_EXPORT
+#  define FILESYSTEM_DEPRECATED_EXPORT FILESYSTEM_API FILESYSTEM_DEPRECATED
+#endif
+
+#ifndef FILESYSTEM_DEPRECATED_NO_EXPORT
+#  define FILESYSTEM_DEPRECATED_NO_EXPORT FILESYSTEM_NO_EXPORT FILESYSTEM_DEPRECATED
+#endif
+
+#if 0 /* DEFINE_NO_DEPRECATED */
+#  ifndef FILESYSTEM_NO_DEPRECATED
+#    define FILESYSTEM_NO_DEPRECATED
+#  endif
+#endif
+
+#endif /* FILESYSTEM_API_H */
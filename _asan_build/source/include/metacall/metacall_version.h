@@ -0,0 +1,44 @@
+/*
+ *	CMake Versioning Utility by Parra Studios
+ *	A template for generating versioning utilities.
+ *
+ *	Copyright (C) 2016 - 2022 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef METACALL_VERSION_H
+#define METACALL_VERSION_H 1
+
+/* -- Definitions -- */
+
+#define METACALL_PROJECT_NAME            "MetaCall"
+#define METACALL_PROJECT_DESCRIPTION     "A library for providing inter-language foreign function interface calls"
+
+#define METACALL_AUTHOR_ORGANIZATION     "MetaCall Inc."
+#define METACALL_AUTHOR_DOMAIN           "https://metacall.io/"
+#define METACALL_AUTHOR_MAINTAINER       "vic798@gmail.com"
+
+#define METACALL_VERSION_MAJOR           "0"
+#define METACALL_VERSION_MAJOR_ID         0
+#define METACALL_VERSION_MINOR           "7"
+#define METACALL_VERSION_MINOR_ID         7
+#define METACALL_VERSION_PATCH           "3"
+#define METACALL_VERSION_PATCH_ID         3
+#define METACALL_VERSION_REVISION        "13c149c2ce15"
+
+#define METACALL_VERSION                 "0.7.3"
+#define METACALL_NAME_VERSION            "MetaCall v0.7.3 (13c149c2ce15)"
+
+#endif /* METACALL_VERSION_H */
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../libloaderd.pdb"
+  "../../libloaderd.so"
+  "CMakeFiles/loader.dir/source/loader.c.o"
+  "CMakeFiles/loader.dir/source/loader.c.o.d"
+  "CMakeFiles/loader.dir/source/loader_host.c.o"
+  "CMakeFiles/loader.dir/source/loader_host.c.o.d"
+  "CMakeFiles/loader.dir/source/loader_impl.c.o"
+  "CMakeFiles/loader.dir/source/loader_impl.c.o.d"
+  "CMakeFiles/loader.dir/source/loader_manager_impl.c.o"
+  "CMakeFiles/loader.dir/source/loader_manager_impl.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/loader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
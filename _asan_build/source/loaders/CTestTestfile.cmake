@@ -0,0 +1,27 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/source/loaders
+# Build directory: /root/repo/_asan_build/source/loaders
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("c_loader")
+subdirs("cob_loader")
+subdirs("cr_loader")
+subdirs("cs_loader")
+subdirs("dart_loader")
+subdirs("ext_loader")
+subdirs("file_loader")
+subdirs("java_loader")
+subdirs("jl_loader")
+subdirs("jsm_loader")
+subdirs("js_loader")
+subdirs("llvm_loader")
+subdirs("lua_loader")
+subdirs("mock_loader")
+subdirs("node_loader")
+subdirs("py_loader")
+subdirs("rb_loader")
+subdirs("rs_loader")
+subdirs("rpc_loader")
+subdirs("ts_loader")
+subdirs("wasm_loader")
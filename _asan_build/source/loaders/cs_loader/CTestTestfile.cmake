@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/source/loaders/cs_loader
+# Build directory: /root/repo/_asan_build/source/loaders/cs_loader
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/loaders/ext_loader/source/ext_loader.c" "source/loaders/ext_loader/CMakeFiles/ext_loader.dir/source/ext_loader.c.o" "gcc" "source/loaders/ext_loader/CMakeFiles/ext_loader.dir/source/ext_loader.c.o.d"
+  "/root/repo/source/loaders/ext_loader/source/ext_loader_impl.cpp" "source/loaders/ext_loader/CMakeFiles/ext_loader.dir/source/ext_loader_impl.cpp.o" "gcc" "source/loaders/ext_loader/CMakeFiles/ext_loader.dir/source/ext_loader_impl.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_asan_build/source/metacall/CMakeFiles/metacall.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
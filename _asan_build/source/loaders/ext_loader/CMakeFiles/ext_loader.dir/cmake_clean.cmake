@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../libext_loaderd.pdb"
+  "../../../libext_loaderd.so"
+  "CMakeFiles/ext_loader.dir/source/ext_loader.c.o"
+  "CMakeFiles/ext_loader.dir/source/ext_loader.c.o.d"
+  "CMakeFiles/ext_loader.dir/source/ext_loader_impl.cpp.o"
+  "CMakeFiles/ext_loader.dir/source/ext_loader_impl.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/ext_loader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
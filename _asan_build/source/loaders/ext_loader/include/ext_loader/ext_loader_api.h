@@ -0,0 +1,42 @@
+
+#ifndef EXT_LOADER_API_H
+#define EXT_LOADER_API_H
+
+#ifdef EXT_LOADER_STATIC_DEFINE
+#  define EXT_LOADER_API
+#  define EXT_LOADER_NO_EXPORT
+#else
+#  ifndef EXT_LOADER_API
+#    ifdef EXT_LOADER_EXPORTS
+        /* We are building this library */
+#      define EXT_LOADER_API __attribute__((visibility("default")))
+#    else
+        /* We are using this library */
+#      define EXT_LOADER_API __attribute__((visibility("default")))
+#    endif
+#  endif
+
+#  ifndef EXT_LOADER_NO_EXPORT
+#    define EXT_LOADER_NO_EXPORT __attribute__((visibility("hidden")))
+#  endif
+#endif
+
+#ifndef EXT_LOADER_DEPRECATED
+#  define EXT_LOADER_DEPRECATED __attribute__ ((__deprecated__))
+#endif
+
+#ifndef EXT_LOADER_DEPRECATED_EXPORT
+#  define EXT_LOADER_DEPRECATED_EXPORT EXT_LOADER_API EXT_LOADER_DEPRECATED
+#endif
+
+#ifndef EXT_LOADER_DEPRECATED_NO_EXPORT
+#  define EXT_LOADER_DEPRECATED_NO_EXPORT EXT_LOADER_NO_EXPORT EXT_LOADER_DEPRECATED
+#endif
+
+#if 0 /* DEFINE_NO_DEPRECATED */
+#  ifndef EXT_LOADER_NO_DEPRECATED
+#    define EXT_LOADER_NO_DEPRECATED
+#  endif
+#endif
+
+#endif /* EXT_LOADER_API_H */
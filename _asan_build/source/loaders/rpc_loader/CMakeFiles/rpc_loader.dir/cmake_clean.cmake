@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../librpc_loaderd.pdb"
+  "../../../librpc_loaderd.so"
+  "CMakeFiles/rpc_loader.dir/source/rpc_loader.c.o"
+  "CMakeFiles/rpc_loader.dir/source/rpc_loader.c.o.d"
+  "CMakeFiles/rpc_loader.dir/source/rpc_loader_impl.cpp.o"
+  "CMakeFiles/rpc_loader.dir/source/rpc_loader_impl.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/rpc_loader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,42 @@
+
+#ifndef RPC_LOADER_API_H
+#define RPC_LOADER_API_H
+
+#ifdef RPC_LOADER_STATIC_DEFINE
+#  define RPC_LOADER_API
+#  define RPC_LOADER_NO_EXPORT
+#else
+#  ifndef RPC_LOADER_API
+#    ifdef RPC_LOADER_EXPORTS
+        /* We are building this library */
+#      define RPC_LOADER_API __attribute__((visibility("default")))
+#    else
+        /* We are using this library */
+#      define RPC_LOADER_API __attribute__((visibility("default")))
+#    endif
+#  endif
+
+#  ifndef RPC_LOADER_NO_EXPORT
+#    define RPC_LOADER_NO_EXPORT __attribute__((visibility("hidden")))
+#  endif
+#endif
+
+#ifndef RPC_LOADER_DEPRECATED
+#  define RPC_LOADER_DEPRECATED __attribute__ ((__deprecated__))
+#endif
+
+#ifndef RPC_LOADER_DEPRECATED_EXPORT
+#  define RPC_LOADER_DEPRECATED_EXPORT RPC_LOADER_API RPC_LOADER_DEPRECATED
+#endif
+
+#ifndef RPC_LOADER_DEPRECATED_NO_EXPORT
+#  define RPC_LOADER_DEPRECATED_NO_EXPORT RPC_LOADER_NO_EXPORT RPC_LOADER_DEPRECATED
+#endif
+
+#if 0 /* DEFINE_NO_DEPRECATED */
+#  ifndef RPC_LOADER_NO_DEPRECATED
+#    define RPC_LOADER_NO_DEPRECATED
+#  endif
+#endif
+
+#endif /* RPC_LOADER_API_H */
@@ -0,0 +1,53 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/log/source/log.c" "source/log/CMakeFiles/log.dir/source/log.c.o" "gcc" "source/log/CMakeFiles/log.dir/source/log.c.o.d"
+  "/root/repo/source/log/source/log_aspect.c" "source/log/CMakeFiles/log.dir/source/log_aspect.c.o" "gcc" "source/log/CMakeFiles/log.dir/source/log_aspect.c.o.d"
+  "/root/repo/source/log/source/log_aspect_format.c" "source/log/CMakeFiles/log.dir/source/log_aspect_format.c.o" "gcc" "source/log/CMakeFiles/log.dir/source/log_aspect_format.c.o.d"
+  "/root/repo/source/log/source/log_aspect_schedule.c" "source/log/CMakeFiles/log.dir/source/log_aspect_schedule.c.o" "gcc" "source/log/CMakeFiles/log.dir/source/log_aspect_schedule.c.o.d"
+  "/root/repo/source/log/source/log_aspect_storage.c" "source/log/CMakeFiles/log.dir/source/log_aspect_storage.c.o" "gcc" "source/log/CMakeFiles/log.dir/source/log_aspect_storage.c.o.d"
+  "/root/repo/source/log/source/log_aspect_stream.c" "source/log/CMakeFiles/log.dir/source/log_aspect_stream.c.o" "gcc" "source/log/CMakeFiles/log.dir/source/log_aspect_stream.c.o.d"
+  "/root/repo/source/log/source/log_handle.c" "source/log/CMakeFiles/log.dir/source/log_handle.c.o" "gcc" "source/log/CMakeFiles/log.dir/source/log_handle.c.o.d"
+  "/root/repo/source/log/source/log_impl.c" "source/log/CMakeFiles/log.dir/source/log_impl.c.o" "gcc" "source/log/CMakeFiles/log.dir/source/log_impl.c.o.d"
+  "/root/repo/source/log/source/log_level.c" "source/log/CMakeFiles/log.dir/source/log_level.c.o" "gcc" "source/log/CMakeFiles/log.dir/source/log_level.c.o.d"
+  "/root/repo/source/log/source/log_map.c" "source/log/CMakeFiles/log.dir/source/log_map.c.o" "gcc" "source/log/CMakeFiles/log.dir/source/log_map.c.o.d"
+  "/root/repo/source/log/source/log_policy.c" "source/log/CMakeFiles/log.dir/source/log_policy.c.o" "gcc" "source/log/CMakeFiles/log.dir/source/log_policy.c.o.d"
+  "/root/repo/source/log/source/log_policy_format.c" "source/log/CMakeFiles/log.dir/source/log_policy_format.c.o" "gcc" "source/log/CMakeFiles/log.dir/source/log_policy_format.c.o.d"
+  "/root/repo/source/log/source/log_policy_format_binary.c" "source/log/CMakeFiles/log.dir/source/log_policy_format_binary.c.o" "gcc" "source/log/CMakeFiles/log.dir/source/log_policy_format_binary.c.o.d"
+  "/root/repo/source/log/source/log_policy_format_custom.c" "source/log/CMakeFiles/log.dir/source/log_policy_format_custom.c.o" "gcc" "source/log/CMakeFiles/log.dir/source/log_policy_format_custom.c.o.d"
+  "/root/repo/source/log/source/log_policy_format_text.c" "source/log/CMakeFiles/log.dir/source/log_policy_format_text.c.o" "gcc" "source/log/CMakeFiles/log.dir/source/log_policy_format_text.c.o.d"
+  "/root/repo/source/log/source/log_policy_schedule.c" "source/log/CMakeFiles/log.dir/source/log_policy_schedule.c.o" "gcc" "source/log/CMakeFiles/log.dir/source/log_policy_schedule.c.o.d"
+  "/root/repo/source/log/source/log_policy_schedule_async.c" "source/log/CMakeFiles/log.dir/source/log_policy_schedule_async.c.o" "gcc" "source/log/CMakeFiles/log.dir/source/log_policy_schedule_async.c.o.d"
+  "/root/repo/source/log/source/log_policy_schedule_sync.c" "source/log/CMakeFiles/log.dir/source/log_policy_schedule_sync.c.o" "gcc" "source/log/CMakeFiles/log.dir/source/log_policy_schedule_sync.c.o.d"
+  "/root/repo/source/log/source/log_policy_storage.c" "source/log/CMakeFiles/log.dir/source/log_policy_storage.c.o" "gcc" "source/log/CMakeFiles/log.dir/source/log_policy_storage.c.o.d"
+  "/root/repo/source/log/source/log_policy_storage_batch.c" "source/log/CMakeFiles/log.dir/source/log_policy_storage_batch.c.o" "gcc" "source/log/CMakeFiles/log.dir/source/log_policy_storage_batch.c.o.d"
+  "/root/repo/source/log/source/log_policy_storage_sequential.c" "source/log/CMakeFiles/log.dir/source/log_policy_storage_sequential.c.o" "gcc" "source/log/CMakeFiles/log.dir/source/log_policy_storage_sequential.c.o.d"
+  "/root/repo/source/log/source/log_policy_stream.c" "source/log/CMakeFiles/log.dir/source/log_policy_stream.c.o" "gcc" "source/log/CMakeFiles/log.dir/source/log_policy_stream.c.o.d"
+  "/root/repo/source/log/source/log_policy_stream_custom.c" "source/log/CMakeFiles/log.dir/source/log_policy_stream_custom.c.o" "gcc" "source/log/CMakeFiles/log.dir/source/log_policy_stream_custom.c.o.d"
+  "/root/repo/source/log/source/log_policy_stream_file.c" "source/log/CMakeFiles/log.dir/source/log_policy_stream_file.c.o" "gcc" "source/log/CMakeFiles/log.dir/source/log_policy_stream_file.c.o.d"
+  "/root/repo/source/log/source/log_policy_stream_nginx.c" "source/log/CMakeFiles/log.dir/source/log_policy_stream_nginx.c.o" "gcc" "source/log/CMakeFiles/log.dir/source/log_policy_stream_nginx.c.o.d"
+  "/root/repo/source/log/source/log_policy_stream_socket.c" "source/log/CMakeFiles/log.dir/source/log_policy_stream_socket.c.o" "gcc" "source/log/CMakeFiles/log.dir/source/log_policy_stream_socket.c.o.d"
+  "/root/repo/source/log/source/log_policy_stream_stdio.c" "source/log/CMakeFiles/log.dir/source/log_policy_stream_stdio.c.o" "gcc" "source/log/CMakeFiles/log.dir/source/log_policy_stream_stdio.c.o.d"
+  "/root/repo/source/log/source/log_policy_stream_syslog.c" "source/log/CMakeFiles/log.dir/source/log_policy_stream_syslog.c.o" "gcc" "source/log/CMakeFiles/log.dir/source/log_policy_stream_syslog.c.o.d"
+  "/root/repo/source/log/source/log_record.c" "source/log/CMakeFiles/log.dir/source/log_record.c.o" "gcc" "source/log/CMakeFiles/log.dir/source/log_record.c.o.d"
+  "/root/repo/source/log/source/log_singleton.c" "source/log/CMakeFiles/log.dir/source/log_singleton.c.o" "gcc" "source/log/CMakeFiles/log.dir/source/log_singleton.c.o.d"
+  "/root/repo/source/log/source/log_valid_size.c" "source/log/CMakeFiles/log.dir/source/log_valid_size.c.o" "gcc" "source/log/CMakeFiles/log.dir/source/log_valid_size.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_asan_build/source/preprocessor/CMakeFiles/preprocessor.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/format/CMakeFiles/format.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/threading/CMakeFiles/threading.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/version/CMakeFiles/version.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
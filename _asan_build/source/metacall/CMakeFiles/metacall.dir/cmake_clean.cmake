@@ -0,0 +1,243 @@
+file(REMOVE_RECURSE
+  "../../libmetacalld.pdb"
+  "../../libmetacalld.so"
+  "CMakeFiles/metacall.dir/__/adt/source/adt.c.o"
+  "CMakeFiles/metacall.dir/__/adt/source/adt.c.o.d"
+  "CMakeFiles/metacall.dir/__/adt/source/adt_bucket.c.o"
+  "CMakeFiles/metacall.dir/__/adt/source/adt_bucket.c.o.d"
+  "CMakeFiles/metacall.dir/__/adt/source/adt_comparable.c.o"
+  "CMakeFiles/metacall.dir/__/adt/source/adt_comparable.c.o.d"
+  "CMakeFiles/metacall.dir/__/adt/source/adt_hash.c.o"
+  "CMakeFiles/metacall.dir/__/adt/source/adt_hash.c.o.d"
+  "CMakeFiles/metacall.dir/__/adt/source/adt_map.c.o"
+  "CMakeFiles/metacall.dir/__/adt/source/adt_map.c.o.d"
+  "CMakeFiles/metacall.dir/__/adt/source/adt_set.c.o"
+  "CMakeFiles/metacall.dir/__/adt/source/adt_set.c.o.d"
+  "CMakeFiles/metacall.dir/__/adt/source/adt_trie.c.o"
+  "CMakeFiles/metacall.dir/__/adt/source/adt_trie.c.o.d"
+  "CMakeFiles/metacall.dir/__/adt/source/adt_vector.c.o"
+  "CMakeFiles/metacall.dir/__/adt/source/adt_vector.c.o.d"
+  "CMakeFiles/metacall.dir/__/configuration/source/configuration.c.o"
+  "CMakeFiles/metacall.dir/__/configuration/source/configuration.c.o.d"
+  "CMakeFiles/metacall.dir/__/configuration/source/configuration_impl.c.o"
+  "CMakeFiles/metacall.dir/__/configuration/source/configuration_impl.c.o.d"
+  "CMakeFiles/metacall.dir/__/configuration/source/configuration_object.c.o"
+  "CMakeFiles/metacall.dir/__/configuration/source/configuration_object.c.o.d"
+  "CMakeFiles/metacall.dir/__/configuration/source/configuration_singleton.c.o"
+  "CMakeFiles/metacall.dir/__/configuration/source/configuration_singleton.c.o.d"
+  "CMakeFiles/metacall.dir/__/detour/source/detour.c.o"
+  "CMakeFiles/metacall.dir/__/detour/source/detour.c.o.d"
+  "CMakeFiles/metacall.dir/__/dynlink/source/dynlink.c.o"
+  "CMakeFiles/metacall.dir/__/dynlink/source/dynlink.c.o.d"
+  "CMakeFiles/metacall.dir/__/dynlink/source/dynlink_impl.c.o"
+  "CMakeFiles/metacall.dir/__/dynlink/source/dynlink_impl.c.o.d"
+  "CMakeFiles/metacall.dir/__/dynlink/source/dynlink_impl_unix.c.o"
+  "CMakeFiles/metacall.dir/__/dynlink/source/dynlink_impl_unix.c.o.d"
+  "CMakeFiles/metacall.dir/__/dynlink/source/dynlink_interface.c.o"
+  "CMakeFiles/metacall.dir/__/dynlink/source/dynlink_interface.c.o.d"
+  "CMakeFiles/metacall.dir/__/dynlink/source/dynlink_symbol.c.o"
+  "CMakeFiles/metacall.dir/__/dynlink/source/dynlink_symbol.c.o.d"
+  "CMakeFiles/metacall.dir/__/environment/source/environment.c.o"
+  "CMakeFiles/metacall.dir/__/environment/source/environment.c.o.d"
+  "CMakeFiles/metacall.dir/__/environment/source/environment_variable.c.o"
+  "CMakeFiles/metacall.dir/__/environment/source/environment_variable.c.o.d"
+  "CMakeFiles/metacall.dir/__/environment/source/environment_variable_path.c.o"
+  "CMakeFiles/metacall.dir/__/environment/source/environment_variable_path.c.o.d"
+  "CMakeFiles/metacall.dir/__/filesystem/source/filesystem.c.o"
+  "CMakeFiles/metacall.dir/__/filesystem/source/filesystem.c.o.d"
+  "CMakeFiles/metacall.dir/__/filesystem/source/filesystem_directory_descriptor.c.o"
+  "CMakeFiles/metacall.dir/__/filesystem/source/filesystem_directory_descriptor.c.o.d"
+  "CMakeFiles/metacall.dir/__/filesystem/source/filesystem_file_descriptor.c.o"
+  "CMakeFiles/metacall.dir/__/filesystem/source/filesystem_file_descriptor.c.o.d"
+  "CMakeFiles/metacall.dir/__/format/source/format.c.o"
+  "CMakeFiles/metacall.dir/__/format/source/format.c.o.d"
+  "CMakeFiles/metacall.dir/__/format/source/format_print.c.o"
+  "CMakeFiles/metacall.dir/__/format/source/format_print.c.o.d"
+  "CMakeFiles/metacall.dir/__/loader/source/loader.c.o"
+  "CMakeFiles/metacall.dir/__/loader/source/loader.c.o.d"
+  "CMakeFiles/metacall.dir/__/loader/source/loader_host.c.o"
+  "CMakeFiles/metacall.dir/__/loader/source/loader_host.c.o.d"
+  "CMakeFiles/metacall.dir/__/loader/source/loader_impl.c.o"
+  "CMakeFiles/metacall.dir/__/loader/source/loader_impl.c.o.d"
+  "CMakeFiles/metacall.dir/__/loader/source/loader_manager_impl.c.o"
+  "CMakeFiles/metacall.dir/__/loader/source/loader_manager_impl.c.o.d"
+  "CMakeFiles/metacall.dir/__/log/source/log.c.o"
+  "CMakeFiles/metacall.dir/__/log/source/log.c.o.d"
+  "CMakeFiles/metacall.dir/__/log/source/log_aspect.c.o"
+  "CMakeFiles/metacall.dir/__/log/source/log_aspect.c.o.d"
+  "CMakeFiles/metacall.dir/__/log/source/log_aspect_format.c.o"
+  "CMakeFiles/metacall.dir/__/log/source/log_aspect_format.c.o.d"
+  "CMakeFiles/metacall.dir/__/log/source/log_aspect_schedule.c.o"
+  "CMakeFiles/metacall.dir/__/log/source/log_aspect_schedule.c.o.d"
+  "CMakeFiles/metacall.dir/__/log/source/log_aspect_storage.c.o"
+  "CMakeFiles/metacall.dir/__/log/source/log_aspect_storage.c.o.d"
+  "CMakeFiles/metacall.dir/__/log/source/log_aspect_stream.c.o"
+  "CMakeFiles/metacall.dir/__/log/source/log_aspect_stream.c.o.d"
+  "CMakeFiles/metacall.dir/__/log/source/log_handle.c.o"
+  "CMakeFiles/metacall.dir/__/log/source/log_handle.c.o.d"
+  "CMakeFiles/metacall.dir/__/log/source/log_impl.c.o"
+  "CMakeFiles/metacall.dir/__/log/source/log_impl.c.o.d"
+  "CMakeFiles/metacall.dir/__/log/source/log_level.c.o"
+  "CMakeFiles/metacall.dir/__/log/source/log_level.c.o.d"
+  "CMakeFiles/metacall.dir/__/log/source/log_map.c.o"
+  "CMakeFiles/metacall.dir/__/log/source/log_map.c.o.d"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy.c.o"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy.c.o.d"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_format.c.o"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_format.c.o.d"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_format_binary.c.o"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_format_binary.c.o.d"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_format_custom.c.o"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_format_custom.c.o.d"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_format_text.c.o"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_format_text.c.o.d"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_schedule.c.o"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_schedule.c.o.d"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_schedule_async.c.o"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_schedule_async.c.o.d"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_schedule_sync.c.o"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_schedule_sync.c.o.d"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_storage.c.o"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_storage.c.o.d"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_storage_batch.c.o"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_storage_batch.c.o.d"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_storage_sequential.c.o"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_storage_sequential.c.o.d"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_stream.c.o"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_stream.c.o.d"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_stream_custom.c.o"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_stream_custom.c.o.d"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_stream_file.c.o"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_stream_file.c.o.d"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_stream_nginx.c.o"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_stream_nginx.c.o.d"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_stream_socket.c.o"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_stream_socket.c.o.d"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_stream_stdio.c.o"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_stream_stdio.c.o.d"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_stream_syslog.c.o"
+  "CMakeFiles/metacall.dir/__/log/source/log_policy_stream_syslog.c.o.d"
+  "CMakeFiles/metacall.dir/__/log/source/log_record.c.o"
+  "CMakeFiles/metacall.dir/__/log/source/log_record.c.o.d"
+  "CMakeFiles/metacall.dir/__/log/source/log_singleton.c.o"
+  "CMakeFiles/metacall.dir/__/log/source/log_singleton.c.o.d"
+  "CMakeFiles/metacall.dir/__/log/source/log_valid_size.c.o"
+  "CMakeFiles/metacall.dir/__/log/source/log_valid_size.c.o.d"
+  "CMakeFiles/metacall.dir/__/memory/source/memory.c.o"
+  "CMakeFiles/metacall.dir/__/memory/source/memory.c.o.d"
+  "CMakeFiles/metacall.dir/__/memory/source/memory_allocator.c.o"
+  "CMakeFiles/metacall.dir/__/memory/source/memory_allocator.c.o.d"
+  "CMakeFiles/metacall.dir/__/memory/source/memory_allocator_nginx.c.o"
+  "CMakeFiles/metacall.dir/__/memory/source/memory_allocator_nginx.c.o.d"
+  "CMakeFiles/metacall.dir/__/memory/source/memory_allocator_nginx_impl.c.o"
+  "CMakeFiles/metacall.dir/__/memory/source/memory_allocator_nginx_impl.c.o.d"
+  "CMakeFiles/metacall.dir/__/memory/source/memory_allocator_slab.c.o"
+  "CMakeFiles/metacall.dir/__/memory/source/memory_allocator_slab.c.o.d"
+  "CMakeFiles/metacall.dir/__/memory/source/memory_allocator_slab_impl.c.o"
+  "CMakeFiles/metacall.dir/__/memory/source/memory_allocator_slab_impl.c.o.d"
+  "CMakeFiles/metacall.dir/__/memory/source/memory_allocator_std.c.o"
+  "CMakeFiles/metacall.dir/__/memory/source/memory_allocator_std.c.o.d"
+  "CMakeFiles/metacall.dir/__/memory/source/memory_allocator_std_impl.c.o"
+  "CMakeFiles/metacall.dir/__/memory/source/memory_allocator_std_impl.c.o.d"
+  "CMakeFiles/metacall.dir/__/plugin/source/plugin.c.o"
+  "CMakeFiles/metacall.dir/__/plugin/source/plugin.c.o.d"
+  "CMakeFiles/metacall.dir/__/plugin/source/plugin_descriptor.c.o"
+  "CMakeFiles/metacall.dir/__/plugin/source/plugin_descriptor.c.o.d"
+  "CMakeFiles/metacall.dir/__/plugin/source/plugin_impl.c.o"
+  "CMakeFiles/metacall.dir/__/plugin/source/plugin_impl.c.o.d"
+  "CMakeFiles/metacall.dir/__/plugin/source/plugin_loader.c.o"
+  "CMakeFiles/metacall.dir/__/plugin/source/plugin_loader.c.o.d"
+  "CMakeFiles/metacall.dir/__/plugin/source/plugin_manager.c.o"
+  "CMakeFiles/metacall.dir/__/plugin/source/plugin_manager.c.o.d"
+  "CMakeFiles/metacall.dir/__/portability/source/portability.c.o"
+  "CMakeFiles/metacall.dir/__/portability/source/portability.c.o.d"
+  "CMakeFiles/metacall.dir/__/portability/source/portability_executable_path.c.o"
+  "CMakeFiles/metacall.dir/__/portability/source/portability_executable_path.c.o.d"
+  "CMakeFiles/metacall.dir/__/portability/source/portability_library_path.c.o"
+  "CMakeFiles/metacall.dir/__/portability/source/portability_library_path.c.o.d"
+  "CMakeFiles/metacall.dir/__/portability/source/portability_path.c.o"
+  "CMakeFiles/metacall.dir/__/portability/source/portability_path.c.o.d"
+  "CMakeFiles/metacall.dir/__/preprocessor/source/preprocessor.c.o"
+  "CMakeFiles/metacall.dir/__/preprocessor/source/preprocessor.c.o.d"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect.c.o"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect.c.o.d"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_attribute.c.o"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_attribute.c.o.d"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_class.c.o"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_class.c.o.d"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_class_visibility.c.o"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_class_visibility.c.o.d"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_constructor.c.o"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_constructor.c.o.d"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_context.c.o"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_context.c.o.d"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_exception.c.o"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_exception.c.o.d"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_function.c.o"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_function.c.o.d"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_future.c.o"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_future.c.o.d"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_memory_tracker.c.o"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_memory_tracker.c.o.d"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_method.c.o"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_method.c.o.d"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_object.c.o"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_object.c.o.d"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_scope.c.o"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_scope.c.o.d"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_signature.c.o"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_signature.c.o.d"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_throwable.c.o"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_throwable.c.o.d"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_type.c.o"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_type.c.o.d"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_type_id.c.o"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_type_id.c.o.d"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_value.c.o"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_value.c.o.d"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_value_type.c.o"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_value_type.c.o.d"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_value_type_cast.c.o"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_value_type_cast.c.o.d"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_value_type_demotion.c.o"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_value_type_demotion.c.o.d"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_value_type_id_size.c.o"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_value_type_id_size.c.o.d"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_value_type_promotion.c.o"
+  "CMakeFiles/metacall.dir/__/reflect/source/reflect_value_type_promotion.c.o.d"
+  "CMakeFiles/metacall.dir/__/serial/source/serial.c.o"
+  "CMakeFiles/metacall.dir/__/serial/source/serial.c.o.d"
+  "CMakeFiles/metacall.dir/__/threading/source/threading.c.o"
+  "CMakeFiles/metacall.dir/__/threading/source/threading.c.o.d"
+  "CMakeFiles/metacall.dir/__/threading/source/threading_condition_pthread.c.o"
+  "CMakeFiles/metacall.dir/__/threading/source/threading_condition_pthread.c.o.d"
+  "CMakeFiles/metacall.dir/__/threading/source/threading_left_right.c.o"
+  "CMakeFiles/metacall.dir/__/threading/source/threading_left_right.c.o.d"
+  "CMakeFiles/metacall.dir/__/threading/source/threading_mutex_pthread.c.o"
+  "CMakeFiles/metacall.dir/__/threading/source/threading_mutex_pthread.c.o.d"
+  "CMakeFiles/metacall.dir/__/threading/source/threading_rwlock_pthread.c.o"
+  "CMakeFiles/metacall.dir/__/threading/source/threading_rwlock_pthread.c.o.d"
+  "CMakeFiles/metacall.dir/__/threading/source/threading_thread_id.c.o"
+  "CMakeFiles/metacall.dir/__/threading/source/threading_thread_id.c.o.d"
+  "CMakeFiles/metacall.dir/__/threading/source/threading_thread_pthread.c.o"
+  "CMakeFiles/metacall.dir/__/threading/source/threading_thread_pthread.c.o.d"
+  "CMakeFiles/metacall.dir/__/version/source/version.c.o"
+  "CMakeFiles/metacall.dir/__/version/source/version.c.o.d"
+  "CMakeFiles/metacall.dir/source/metacall.c.o"
+  "CMakeFiles/metacall.dir/source/metacall.c.o.d"
+  "CMakeFiles/metacall.dir/source/metacall_allocator.c.o"
+  "CMakeFiles/metacall.dir/source/metacall_allocator.c.o.d"
+  "CMakeFiles/metacall.dir/source/metacall_error.c.o"
+  "CMakeFiles/metacall.dir/source/metacall_error.c.o.d"
+  "CMakeFiles/metacall.dir/source/metacall_fork.c.o"
+  "CMakeFiles/metacall.dir/source/metacall_fork.c.o.d"
+  "CMakeFiles/metacall.dir/source/metacall_log.c.o"
+  "CMakeFiles/metacall.dir/source/metacall_log.c.o.d"
+  "CMakeFiles/metacall.dir/source/metacall_value.c.o"
+  "CMakeFiles/metacall.dir/source/metacall_value.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/metacall.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
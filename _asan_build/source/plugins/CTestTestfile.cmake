@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/source/plugins
+# Build directory: /root/repo/_asan_build/source/plugins
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("backtrace_plugin")
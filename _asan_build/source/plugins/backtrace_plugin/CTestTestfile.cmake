@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/source/plugins/backtrace_plugin
+# Build directory: /root/repo/_asan_build/source/plugins/backtrace_plugin
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/portability/source/portability.c" "source/portability/CMakeFiles/portability.dir/source/portability.c.o" "gcc" "source/portability/CMakeFiles/portability.dir/source/portability.c.o.d"
+  "/root/repo/source/portability/source/portability_executable_path.c" "source/portability/CMakeFiles/portability.dir/source/portability_executable_path.c.o" "gcc" "source/portability/CMakeFiles/portability.dir/source/portability_executable_path.c.o.d"
+  "/root/repo/source/portability/source/portability_library_path.c" "source/portability/CMakeFiles/portability.dir/source/portability_library_path.c.o" "gcc" "source/portability/CMakeFiles/portability.dir/source/portability_library_path.c.o.d"
+  "/root/repo/source/portability/source/portability_path.c" "source/portability/CMakeFiles/portability.dir/source/portability_path.c.o" "gcc" "source/portability/CMakeFiles/portability.dir/source/portability_path.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_asan_build/source/preprocessor/CMakeFiles/preprocessor.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/version/CMakeFiles/version.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../libportabilityd.pdb"
+  "../../libportabilityd.so"
+  "CMakeFiles/portability.dir/source/portability.c.o"
+  "CMakeFiles/portability.dir/source/portability.c.o.d"
+  "CMakeFiles/portability.dir/source/portability_executable_path.c.o"
+  "CMakeFiles/portability.dir/source/portability_executable_path.c.o.d"
+  "CMakeFiles/portability.dir/source/portability_library_path.c.o"
+  "CMakeFiles/portability.dir/source/portability_library_path.c.o.d"
+  "CMakeFiles/portability.dir/source/portability_path.c.o"
+  "CMakeFiles/portability.dir/source/portability_path.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/portability.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,49 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/reflect/source/reflect.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect.c.o.d"
+  "/root/repo/source/reflect/source/reflect_attribute.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_attribute.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_attribute.c.o.d"
+  "/root/repo/source/reflect/source/reflect_class.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_class.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_class.c.o.d"
+  "/root/repo/source/reflect/source/reflect_class_visibility.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_class_visibility.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_class_visibility.c.o.d"
+  "/root/repo/source/reflect/source/reflect_constructor.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_constructor.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_constructor.c.o.d"
+  "/root/repo/source/reflect/source/reflect_context.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_context.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_context.c.o.d"
+  "/root/repo/source/reflect/source/reflect_exception.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_exception.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_exception.c.o.d"
+  "/root/repo/source/reflect/source/reflect_function.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_function.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_function.c.o.d"
+  "/root/repo/source/reflect/source/reflect_future.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_future.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_future.c.o.d"
+  "/root/repo/source/reflect/source/reflect_memory_tracker.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_memory_tracker.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_memory_tracker.c.o.d"
+  "/root/repo/source/reflect/source/reflect_method.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_method.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_method.c.o.d"
+  "/root/repo/source/reflect/source/reflect_object.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_object.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_object.c.o.d"
+  "/root/repo/source/reflect/source/reflect_scope.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_scope.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_scope.c.o.d"
+  "/root/repo/source/reflect/source/reflect_signature.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_signature.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_signature.c.o.d"
+  "/root/repo/source/reflect/source/reflect_throwable.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_throwable.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_throwable.c.o.d"
+  "/root/repo/source/reflect/source/reflect_type.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_type.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_type.c.o.d"
+  "/root/repo/source/reflect/source/reflect_type_id.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_type_id.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_type_id.c.o.d"
+  "/root/repo/source/reflect/source/reflect_value.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_value.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_value.c.o.d"
+  "/root/repo/source/reflect/source/reflect_value_type.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_value_type.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_value_type.c.o.d"
+  "/root/repo/source/reflect/source/reflect_value_type_cast.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_value_type_cast.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_value_type_cast.c.o.d"
+  "/root/repo/source/reflect/source/reflect_value_type_demotion.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_value_type_demotion.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_value_type_demotion.c.o.d"
+  "/root/repo/source/reflect/source/reflect_value_type_id_size.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_value_type_id_size.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_value_type_id_size.c.o.d"
+  "/root/repo/source/reflect/source/reflect_value_type_promotion.c" "source/reflect/CMakeFiles/reflect.dir/source/reflect_value_type_promotion.c.o" "gcc" "source/reflect/CMakeFiles/reflect.dir/source/reflect_value_type_promotion.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_asan_build/source/memory/CMakeFiles/memory.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/portability/CMakeFiles/portability.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/adt/CMakeFiles/adt.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/log/CMakeFiles/log.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/preprocessor/CMakeFiles/preprocessor.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/format/CMakeFiles/format.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/threading/CMakeFiles/threading.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/version/CMakeFiles/version.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
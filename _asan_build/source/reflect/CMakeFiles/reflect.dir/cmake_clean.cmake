@@ -0,0 +1,55 @@
+file(REMOVE_RECURSE
+  "../../libreflectd.pdb"
+  "../../libreflectd.so"
+  "CMakeFiles/reflect.dir/source/reflect.c.o"
+  "CMakeFiles/reflect.dir/source/reflect.c.o.d"
+  "CMakeFiles/reflect.dir/source/reflect_attribute.c.o"
+  "CMakeFiles/reflect.dir/source/reflect_attribute.c.o.d"
+  "CMakeFiles/reflect.dir/source/reflect_class.c.o"
+  "CMakeFiles/reflect.dir/source/reflect_class.c.o.d"
+  "CMakeFiles/reflect.dir/source/reflect_class_visibility.c.o"
+  "CMakeFiles/reflect.dir/source/reflect_class_visibility.c.o.d"
+  "CMakeFiles/reflect.dir/source/reflect_constructor.c.o"
+  "CMakeFiles/reflect.dir/source/reflect_constructor.c.o.d"
+  "CMakeFiles/reflect.dir/source/reflect_context.c.o"
+  "CMakeFiles/reflect.dir/source/reflect_context.c.o.d"
+  "CMakeFiles/reflect.dir/source/reflect_exception.c.o"
+  "CMakeFiles/reflect.dir/source/reflect_exception.c.o.d"
+  "CMakeFiles/reflect.dir/source/reflect_function.c.o"
+  "CMakeFiles/reflect.dir/source/reflect_function.c.o.d"
+  "CMakeFiles/reflect.dir/source/reflect_future.c.o"
+  "CMakeFiles/reflect.dir/source/reflect_future.c.o.d"
+  "CMakeFiles/reflect.dir/source/reflect_memory_tracker.c.o"
+  "CMakeFiles/reflect.dir/source/reflect_memory_tracker.c.o.d"
+  "CMakeFiles/reflect.dir/source/reflect_method.c.o"
+  "CMakeFiles/reflect.dir/source/reflect_method.c.o.d"
+  "CMakeFiles/reflect.dir/source/reflect_object.c.o"
+  "CMakeFiles/reflect.dir/source/reflect_object.c.o.d"
+  "CMakeFiles/reflect.dir/source/reflect_scope.c.o"
+  "CMakeFiles/reflect.dir/source/reflect_scope.c.o.d"
+  "CMakeFiles/reflect.dir/source/reflect_signature.c.o"
+  "CMakeFiles/reflect.dir/source/reflect_signature.c.o.d"
+  "CMakeFiles/reflect.dir/source/reflect_throwable.c.o"
+  "CMakeFiles/reflect.dir/source/reflect_throwable.c.o.d"
+  "CMakeFiles/reflect.dir/source/reflect_type.c.o"
+  "CMakeFiles/reflect.dir/source/reflect_type.c.o.d"
+  "CMakeFiles/reflect.dir/source/reflect_type_id.c.o"
+  "CMakeFiles/reflect.dir/source/reflect_type_id.c.o.d"
+  "CMakeFiles/reflect.dir/source/reflect_value.c.o"
+  "CMakeFiles/reflect.dir/source/reflect_value.c.o.d"
+  "CMakeFiles/reflect.dir/source/reflect_value_type.c.o"
+  "CMakeFiles/reflect.dir/source/reflect_value_type.c.o.d"
+  "CMakeFiles/reflect.dir/source/reflect_value_type_cast.c.o"
+  "CMakeFiles/reflect.dir/source/reflect_value_type_cast.c.o.d"
+  "CMakeFiles/reflect.dir/source/reflect_value_type_demotion.c.o"
+  "CMakeFiles/reflect.dir/source/reflect_value_type_demotion.c.o.d"
+  "CMakeFiles/reflect.dir/source/reflect_value_type_id_size.c.o"
+  "CMakeFiles/reflect.dir/source/reflect_value_type_id_size.c.o.d"
+  "CMakeFiles/reflect.dir/source/reflect_value_type_promotion.c.o"
+  "CMakeFiles/reflect.dir/source/reflect_value_type_promotion.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/reflect.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
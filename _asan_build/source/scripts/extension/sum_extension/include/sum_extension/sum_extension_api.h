@@ -0,0 +1,42 @@
+
+#ifndef SUM_EXTENSION_API_H
+#define SUM_EXTENSION_API_H
+
+#ifdef SUM_EXTENSION_STATIC_DEFINE
+#  define SUM_EXTENSION_API
+#  define SUM_EXTENSION_NO_EXPORT
+#else
+#  ifndef SUM_EXTENSION_API
+#    ifdef SUM_EXTENSION_EXPORTS
+        /* We are building this library */
+#      define SUM_EXTENSION_API __attribute__((visibility("default")))
+#    else
+        /* We are using this library */
+#      define SUM_EXTENSION_API __attribute__((visibility("default")))
+#    endif
+#  endif
+
+#  ifndef SUM_EXTENSION_NO_EXPORT
+#    define SUM_EXTENSION_NO_EXPORT __attribute__((visibility("hidden")))
+#  endif
+#endif
+
+#ifndef SUM_EXTENSION_DEPRECATED
+#  define SUM_EXTENSION_DEPRECATED __attribute__ ((__deprecated__))
+#endif
+
+#ifndef SUM_EXTENSION_DEPRECATED_EXPORT
+#  define SUM_EXTENSION_DEPRECATED_EXPORT SUM_EXTENSION_API SUM_EXTENSION_DEPRECATED
+#endif
+
+#ifndef SUM_EXTENSION_DEPRECATED_NO_EXPORT
+#  define SUM_EXTENSION_DEPRECATED_NO_EXPORT SUM_EXTENSION_NO_EXPORT SUM_EXTENSION_DEPRECATED
+#endif
+
+#if 0 /* DEFINE_NO_DEPRECATED */
+#  ifndef SUM_EXTENSION_NO_DEPRECATED
+#    define SUM_EXTENSION_NO_DEPRECATED
+#  endif
+#endif
+
+#endif /* SUM_EXTENSION_API_H */
@@ -0,0 +1,33 @@
+#
+#	RPC project generator by Parra Studios
+#	Generates a RPC project embedded into CMake.
+#
+#	Copyright (C) 2016 - 2022 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+#
+#	Licensed under the Apache License, Version 2.0 (the "License");
+#	you may not use this file except in compliance with the License.
+#	You may obtain a copy of the License at
+#
+#		http://www.apache.org/licenses/LICENSE-2.0
+#
+#	Unless required by applicable law or agreed to in writing, software
+#	distributed under the License is distributed on an "AS IS" BASIS,
+#	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#	See the License for the specific language governing permissions and
+#	limitations under the License.
+#
+
+# Check if this loader is enabled
+if(NOT OPTION_BUILD_SCRIPTS OR NOT OPTION_BUILD_SCRIPTS_RPC)
+    return()
+endif()
+
+#
+# External dependencies
+#
+
+# Target name
+set(target remote)
+
+# Exit here if required dependencies are not met
+message(STATUS "Script ${target}")
@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/source/serials
+# Build directory: /root/repo/_asan_build/source/serials
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("metacall_serial")
+subdirs("rapid_json_serial")
+subdirs("msgpack_serial")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../libmsgpack_seriald.pdb"
+  "../../../libmsgpack_seriald.so"
+  "CMakeFiles/msgpack_serial.dir/source/msgpack_serial.c.o"
+  "CMakeFiles/msgpack_serial.dir/source/msgpack_serial.c.o.d"
+  "CMakeFiles/msgpack_serial.dir/source/msgpack_serial_impl.c.o"
+  "CMakeFiles/msgpack_serial.dir/source/msgpack_serial_impl.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/msgpack_serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/source/tests/adt_map_test
+# Build directory: /root/repo/_asan_build/source/tests/adt_map_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(adt-map-test "/root/repo/_asan_build/adt-map-testd")
+set_tests_properties(adt-map-test PROPERTIES  LABELS "adt-map-test" _BACKTRACE_TRIPLES "/root/repo/source/tests/adt_map_test/CMakeLists.txt;123;add_test;/root/repo/source/tests/adt_map_test/CMakeLists.txt;0;")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../adt-set-testd"
+  "../../../adt-set-testd.pdb"
+  "CMakeFiles/adt-set-test.dir/source/adt_set_test.cpp.o"
+  "CMakeFiles/adt-set-test.dir/source/adt_set_test.cpp.o.d"
+  "CMakeFiles/adt-set-test.dir/source/main.cpp.o"
+  "CMakeFiles/adt-set-test.dir/source/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/adt-set-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
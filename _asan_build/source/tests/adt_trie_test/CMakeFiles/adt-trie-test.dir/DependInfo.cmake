@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/tests/adt_trie_test/source/adt_trie_test.cpp" "source/tests/adt_trie_test/CMakeFiles/adt-trie-test.dir/source/adt_trie_test.cpp.o" "gcc" "source/tests/adt_trie_test/CMakeFiles/adt-trie-test.dir/source/adt_trie_test.cpp.o.d"
+  "/root/repo/source/tests/adt_trie_test/source/main.cpp" "source/tests/adt_trie_test/CMakeFiles/adt-trie-test.dir/source/main.cpp.o" "gcc" "source/tests/adt_trie_test/CMakeFiles/adt-trie-test.dir/source/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_asan_build/source/adt/CMakeFiles/adt.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/log/CMakeFiles/log.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/preprocessor/CMakeFiles/preprocessor.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/format/CMakeFiles/format.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/threading/CMakeFiles/threading.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/source/version/CMakeFiles/version.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../configuration-testd"
+  "../../../configuration-testd.pdb"
+  "CMakeFiles/configuration-test.dir/source/configuration_test.cpp.o"
+  "CMakeFiles/configuration-test.dir/source/configuration_test.cpp.o.d"
+  "CMakeFiles/configuration-test.dir/source/main.cpp.o"
+  "CMakeFiles/configuration-test.dir/source/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/configuration-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../dynlink-testd"
+  "../../../dynlink-testd.pdb"
+  "CMakeFiles/dynlink-test.dir/source/dynlink_test.cpp.o"
+  "CMakeFiles/dynlink-test.dir/source/dynlink_test.cpp.o.d"
+  "CMakeFiles/dynlink-test.dir/source/main.cpp.o"
+  "CMakeFiles/dynlink-test.dir/source/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dynlink-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/source/tests/dynlink_test
+# Build directory: /root/repo/_asan_build/source/tests/dynlink_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(dynlink-test "/root/repo/_asan_build/dynlink-testd")
+set_tests_properties(dynlink-test PROPERTIES  ENVIRONMENT "DYNLINK_TEST_LIBRARY_PATH=/root/repo/_asan_build" LABELS "dynlink-test" _BACKTRACE_TRIPLES "/root/repo/source/tests/dynlink_test/CMakeLists.txt;124;add_test;/root/repo/source/tests/dynlink_test/CMakeLists.txt;0;")
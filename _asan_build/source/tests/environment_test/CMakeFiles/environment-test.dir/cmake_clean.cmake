@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../environment-testd"
+  "../../../environment-testd.pdb"
+  "CMakeFiles/environment-test.dir/source/environment_test.cpp.o"
+  "CMakeFiles/environment-test.dir/source/environment_test.cpp.o.d"
+  "CMakeFiles/environment-test.dir/source/main.cpp.o"
+  "CMakeFiles/environment-test.dir/source/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/environment-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
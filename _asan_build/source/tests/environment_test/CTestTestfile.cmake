@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/source/tests/environment_test
+# Build directory: /root/repo/_asan_build/source/tests/environment_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(environment-test "/root/repo/_asan_build/environment-testd")
+set_tests_properties(environment-test PROPERTIES  ENVIRONMENT "ENV_TEXT=abcd;ENV_PATH=abcd;ENV_SAN=abcd/" LABELS "environment-test" _BACKTRACE_TRIPLES "/root/repo/source/tests/environment_test/CMakeLists.txt;119;add_test;/root/repo/source/tests/environment_test/CMakeLists.txt;0;")
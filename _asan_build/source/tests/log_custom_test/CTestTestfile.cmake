@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/source/tests/log_custom_test
+# Build directory: /root/repo/_asan_build/source/tests/log_custom_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(log-custom-test "/root/repo/_asan_build/log-custom-testd")
+set_tests_properties(log-custom-test PROPERTIES  LABELS "log-custom-test" _BACKTRACE_TRIPLES "/root/repo/source/tests/log_custom_test/CMakeLists.txt;121;add_test;/root/repo/source/tests/log_custom_test/CMakeLists.txt;0;")
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/source/tests/log_test
+# Build directory: /root/repo/_asan_build/source/tests/log_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(log-test "/root/repo/_asan_build/log-testd")
+set_tests_properties(log-test PROPERTIES  LABELS "log-test" _BACKTRACE_TRIPLES "/root/repo/source/tests/log_test/CMakeLists.txt;121;add_test;/root/repo/source/tests/log_test/CMakeLists.txt;0;")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../metacall-distributable-testd"
+  "../../../metacall-distributable-testd.pdb"
+  "CMakeFiles/metacall-distributable-test.dir/source/main.cpp.o"
+  "CMakeFiles/metacall-distributable-test.dir/source/main.cpp.o.d"
+  "CMakeFiles/metacall-distributable-test.dir/source/metacall_distributable_test.cpp.o"
+  "CMakeFiles/metacall-distributable-test.dir/source/metacall_distributable_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/metacall-distributable-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
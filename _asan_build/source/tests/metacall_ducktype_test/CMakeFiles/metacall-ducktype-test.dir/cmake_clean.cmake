@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../metacall-ducktype-testd"
+  "../../../metacall-ducktype-testd.pdb"
+  "CMakeFiles/metacall-ducktype-test.dir/source/main.cpp.o"
+  "CMakeFiles/metacall-ducktype-test.dir/source/main.cpp.o.d"
+  "CMakeFiles/metacall-ducktype-test.dir/source/metacall_ducktype_test.cpp.o"
+  "CMakeFiles/metacall-ducktype-test.dir/source/metacall_ducktype_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/metacall-ducktype-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
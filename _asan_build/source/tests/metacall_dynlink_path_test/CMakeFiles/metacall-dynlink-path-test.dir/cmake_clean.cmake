@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../metacall-dynlink-path-testd"
+  "../../../metacall-dynlink-path-testd.pdb"
+  "CMakeFiles/metacall-dynlink-path-test.dir/source/main.cpp.o"
+  "CMakeFiles/metacall-dynlink-path-test.dir/source/main.cpp.o.d"
+  "CMakeFiles/metacall-dynlink-path-test.dir/source/metacall_dynlink_path_test.cpp.o"
+  "CMakeFiles/metacall-dynlink-path-test.dir/source/metacall_dynlink_path_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/metacall-dynlink-path-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../metacall-ext-testd"
+  "../../../metacall-ext-testd.pdb"
+  "CMakeFiles/metacall-ext-test.dir/source/main.cpp.o"
+  "CMakeFiles/metacall-ext-test.dir/source/main.cpp.o.d"
+  "CMakeFiles/metacall-ext-test.dir/source/metacall_ext_test.cpp.o"
+  "CMakeFiles/metacall-ext-test.dir/source/metacall_ext_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/metacall-ext-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../metacall-handle-export-testd"
+  "../../../metacall-handle-export-testd.pdb"
+  "CMakeFiles/metacall-handle-export-test.dir/source/main.cpp.o"
+  "CMakeFiles/metacall-handle-export-test.dir/source/main.cpp.o.d"
+  "CMakeFiles/metacall-handle-export-test.dir/source/metacall_handle_export_test.cpp.o"
+  "CMakeFiles/metacall-handle-export-test.dir/source/metacall_handle_export_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/metacall-handle-export-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../metacall-initialize-destroy-multiple-testd"
+  "../../../metacall-initialize-destroy-multiple-testd.pdb"
+  "CMakeFiles/metacall-initialize-destroy-multiple-test.dir/source/main.cpp.o"
+  "CMakeFiles/metacall-initialize-destroy-multiple-test.dir/source/main.cpp.o.d"
+  "CMakeFiles/metacall-initialize-destroy-multiple-test.dir/source/metacall_initialize_destroy_multiple_test.cpp.o"
+  "CMakeFiles/metacall-initialize-destroy-multiple-test.dir/source/metacall_initialize_destroy_multiple_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/metacall-initialize-destroy-multiple-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
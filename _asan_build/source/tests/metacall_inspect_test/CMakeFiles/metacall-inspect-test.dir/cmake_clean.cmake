@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../metacall-inspect-testd"
+  "../../../metacall-inspect-testd.pdb"
+  "CMakeFiles/metacall-inspect-test.dir/source/main.cpp.o"
+  "CMakeFiles/metacall-inspect-test.dir/source/main.cpp.o.d"
+  "CMakeFiles/metacall-inspect-test.dir/source/metacall_inspect_test.cpp.o"
+  "CMakeFiles/metacall-inspect-test.dir/source/metacall_inspect_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/metacall-inspect-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../metacall-load-memory-testd"
+  "../../../metacall-load-memory-testd.pdb"
+  "CMakeFiles/metacall-load-memory-test.dir/source/main.cpp.o"
+  "CMakeFiles/metacall-load-memory-test.dir/source/main.cpp.o.d"
+  "CMakeFiles/metacall-load-memory-test.dir/source/metacall_load_memory_test.cpp.o"
+  "CMakeFiles/metacall-load-memory-test.dir/source/metacall_load_memory_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/metacall-load-memory-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../metacall-map-testd"
+  "../../../metacall-map-testd.pdb"
+  "CMakeFiles/metacall-map-test.dir/source/main.cpp.o"
+  "CMakeFiles/metacall-map-test.dir/source/main.cpp.o.d"
+  "CMakeFiles/metacall-map-test.dir/source/metacall_map_test.cpp.o"
+  "CMakeFiles/metacall-map-test.dir/source/metacall_map_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/metacall-map-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
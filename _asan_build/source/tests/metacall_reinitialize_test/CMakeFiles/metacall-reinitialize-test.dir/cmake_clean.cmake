@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../metacall-reinitialize-testd"
+  "../../../metacall-reinitialize-testd.pdb"
+  "CMakeFiles/metacall-reinitialize-test.dir/source/main.cpp.o"
+  "CMakeFiles/metacall-reinitialize-test.dir/source/main.cpp.o.d"
+  "CMakeFiles/metacall-reinitialize-test.dir/source/metacall_reinitialize_test.cpp.o"
+  "CMakeFiles/metacall-reinitialize-test.dir/source/metacall_reinitialize_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/metacall-reinitialize-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
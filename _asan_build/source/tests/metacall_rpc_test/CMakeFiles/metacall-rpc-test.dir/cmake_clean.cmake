@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../metacall-rpc-testd"
+  "../../../metacall-rpc-testd.pdb"
+  "CMakeFiles/metacall-rpc-test.dir/source/main.cpp.o"
+  "CMakeFiles/metacall-rpc-test.dir/source/main.cpp.o.d"
+  "CMakeFiles/metacall-rpc-test.dir/source/metacall_rpc_test.cpp.o"
+  "CMakeFiles/metacall-rpc-test.dir/source/metacall_rpc_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/metacall-rpc-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
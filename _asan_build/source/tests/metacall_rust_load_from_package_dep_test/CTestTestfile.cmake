@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/source/tests/metacall_rust_load_from_package_dep_test
+# Build directory: /root/repo/_asan_build/source/tests/metacall_rust_load_from_package_dep_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../metacall-testd"
+  "../../../metacall-testd.pdb"
+  "CMakeFiles/metacall-test.dir/source/main.cpp.o"
+  "CMakeFiles/metacall-test.dir/source/main.cpp.o.d"
+  "CMakeFiles/metacall-test.dir/source/metacall_test.cpp.o"
+  "CMakeFiles/metacall-test.dir/source/metacall_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/metacall-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
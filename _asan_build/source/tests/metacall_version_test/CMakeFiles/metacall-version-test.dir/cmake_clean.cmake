@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../metacall-version-testd"
+  "../../../metacall-version-testd.pdb"
+  "CMakeFiles/metacall-version-test.dir/source/main.cpp.o"
+  "CMakeFiles/metacall-version-test.dir/source/main.cpp.o.d"
+  "CMakeFiles/metacall-version-test.dir/source/metacall_version_test.cpp.o"
+  "CMakeFiles/metacall-version-test.dir/source/metacall_version_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/metacall-version-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../reflect-function-testd"
+  "../../../reflect-function-testd.pdb"
+  "CMakeFiles/reflect-function-test.dir/source/main.cpp.o"
+  "CMakeFiles/reflect-function-test.dir/source/main.cpp.o.d"
+  "CMakeFiles/reflect-function-test.dir/source/reflect_function_test.cpp.o"
+  "CMakeFiles/reflect-function-test.dir/source/reflect_function_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/reflect-function-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/source/tests/reflect_metadata_test
+# Build directory: /root/repo/_asan_build/source/tests/reflect_metadata_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(reflect-metadata-test "/root/repo/_asan_build/reflect-metadata-testd")
+set_tests_properties(reflect-metadata-test PROPERTIES  ENVIRONMENT "SERIAL_LIBRARY_PATH=/root/repo/_asan_build" LABELS "reflect-metadata-test" _BACKTRACE_TRIPLES "/root/repo/source/tests/reflect_metadata_test/CMakeLists.txt;131;add_test;/root/repo/source/tests/reflect_metadata_test/CMakeLists.txt;0;")
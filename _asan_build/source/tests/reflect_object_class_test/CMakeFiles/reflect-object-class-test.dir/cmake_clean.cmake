@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../reflect-object-class-testd"
+  "../../../reflect-object-class-testd.pdb"
+  "CMakeFiles/reflect-object-class-test.dir/source/main.cpp.o"
+  "CMakeFiles/reflect-object-class-test.dir/source/main.cpp.o.d"
+  "CMakeFiles/reflect-object-class-test.dir/source/reflect_object_class_test.cpp.o"
+  "CMakeFiles/reflect-object-class-test.dir/source/reflect_object_class_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/reflect-object-class-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/source/tests/reflect_object_class_test
+# Build directory: /root/repo/_asan_build/source/tests/reflect_object_class_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(reflect-object-class-test "/root/repo/_asan_build/reflect-object-class-testd")
+set_tests_properties(reflect-object-class-test PROPERTIES  LABELS "reflect-object-class-test" _BACKTRACE_TRIPLES "/root/repo/source/tests/reflect_object_class_test/CMakeLists.txt;131;add_test;/root/repo/source/tests/reflect_object_class_test/CMakeLists.txt;0;")
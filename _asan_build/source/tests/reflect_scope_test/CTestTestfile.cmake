@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/source/tests/reflect_scope_test
+# Build directory: /root/repo/_asan_build/source/tests/reflect_scope_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(reflect-scope-test "/root/repo/_asan_build/reflect-scope-testd")
+set_tests_properties(reflect-scope-test PROPERTIES  ENVIRONMENT "SERIAL_LIBRARY_PATH=/root/repo/_asan_build" LABELS "reflect-scope-test" _BACKTRACE_TRIPLES "/root/repo/source/tests/reflect_scope_test/CMakeLists.txt;132;add_test;/root/repo/source/tests/reflect_scope_test/CMakeLists.txt;0;")
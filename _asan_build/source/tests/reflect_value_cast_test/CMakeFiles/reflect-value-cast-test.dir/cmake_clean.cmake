@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "../../../reflect-value-cast-testd"
+  "../../../reflect-value-cast-testd.pdb"
+  "CMakeFiles/reflect-value-cast-test.dir/source/main.cpp.o"
+  "CMakeFiles/reflect-value-cast-test.dir/source/main.cpp.o.d"
+  "CMakeFiles/reflect-value-cast-test.dir/source/reflect_value_cast_bool_test.cpp.o"
+  "CMakeFiles/reflect-value-cast-test.dir/source/reflect_value_cast_bool_test.cpp.o.d"
+  "CMakeFiles/reflect-value-cast-test.dir/source/reflect_value_cast_char_test.cpp.o"
+  "CMakeFiles/reflect-value-cast-test.dir/source/reflect_value_cast_char_test.cpp.o.d"
+  "CMakeFiles/reflect-value-cast-test.dir/source/reflect_value_cast_double_test.cpp.o"
+  "CMakeFiles/reflect-value-cast-test.dir/source/reflect_value_cast_double_test.cpp.o.d"
+  "CMakeFiles/reflect-value-cast-test.dir/source/reflect_value_cast_float_test.cpp.o"
+  "CMakeFiles/reflect-value-cast-test.dir/source/reflect_value_cast_float_test.cpp.o.d"
+  "CMakeFiles/reflect-value-cast-test.dir/source/reflect_value_cast_int_test.cpp.o"
+  "CMakeFiles/reflect-value-cast-test.dir/source/reflect_value_cast_int_test.cpp.o.d"
+  "CMakeFiles/reflect-value-cast-test.dir/source/reflect_value_cast_long_test.cpp.o"
+  "CMakeFiles/reflect-value-cast-test.dir/source/reflect_value_cast_long_test.cpp.o.d"
+  "CMakeFiles/reflect-value-cast-test.dir/source/reflect_value_cast_short_test.cpp.o"
+  "CMakeFiles/reflect-value-cast-test.dir/source/reflect_value_cast_short_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/reflect-value-cast-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
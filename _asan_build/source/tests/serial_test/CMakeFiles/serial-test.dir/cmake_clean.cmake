@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../serial-testd"
+  "../../../serial-testd.pdb"
+  "CMakeFiles/serial-test.dir/source/main.cpp.o"
+  "CMakeFiles/serial-test.dir/source/main.cpp.o.d"
+  "CMakeFiles/serial-test.dir/source/serial_test.cpp.o"
+  "CMakeFiles/serial-test.dir/source/serial_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/serial-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
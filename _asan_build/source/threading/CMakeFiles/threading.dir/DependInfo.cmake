@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/threading/source/threading.c" "source/threading/CMakeFiles/threading.dir/source/threading.c.o" "gcc" "source/threading/CMakeFiles/threading.dir/source/threading.c.o.d"
+  "/root/repo/source/threading/source/threading_condition_pthread.c" "source/threading/CMakeFiles/threading.dir/source/threading_condition_pthread.c.o" "gcc" "source/threading/CMakeFiles/threading.dir/source/threading_condition_pthread.c.o.d"
+  "/root/repo/source/threading/source/threading_left_right.c" "source/threading/CMakeFiles/threading.dir/source/threading_left_right.c.o" "gcc" "source/threading/CMakeFiles/threading.dir/source/threading_left_right.c.o.d"
+  "/root/repo/source/threading/source/threading_mutex_pthread.c" "source/threading/CMakeFiles/threading.dir/source/threading_mutex_pthread.c.o" "gcc" "source/threading/CMakeFiles/threading.dir/source/threading_mutex_pthread.c.o.d"
+  "/root/repo/source/threading/source/threading_rwlock_pthread.c" "source/threading/CMakeFiles/threading.dir/source/threading_rwlock_pthread.c.o" "gcc" "source/threading/CMakeFiles/threading.dir/source/threading_rwlock_pthread.c.o.d"
+  "/root/repo/source/threading/source/threading_thread_id.c" "source/threading/CMakeFiles/threading.dir/source/threading_thread_id.c.o" "gcc" "source/threading/CMakeFiles/threading.dir/source/threading_thread_id.c.o.d"
+  "/root/repo/source/threading/source/threading_thread_pthread.c" "source/threading/CMakeFiles/threading.dir/source/threading_thread_pthread.c.o" "gcc" "source/threading/CMakeFiles/threading.dir/source/threading_thread_pthread.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_asan_build/source/version/CMakeFiles/version.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
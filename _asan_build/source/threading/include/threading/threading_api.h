@@ -0,0 +1,42 @@
+
+#ifndef THREADING_API_H
+#define THREADING_API_H
+
+#ifdef THREADING_STATIC_DEFINE
+#  define THREADING_API
+#  define THREADING_NO_EXPORT
+#else
+#  ifndef THREADING_API
+#    ifdef THREADING_EXPORTS
+        /* We are building this library */
+#      define THREADING_API __attribute__((visibility("default")))
+#    else
+        /* We are using this library */
+#      define THREADING_API __attribute__((visibility("default")))
+#    endif
+#  endif
+
+#  ifndef THREADING_NO_EXPORT
+#    define THREADING_NO_EXPORT __attribute__((visibility("hidden")))
+#  endif
+#endif
+
+#ifndef THREADING_DEPRECATED
+#  define THREADING_DEPRECATED __attribute__ ((__deprecated__))
+#endif
+
+#ifndef THREADING_DEPRECATED_EXPORT
+#  define THREADING_DEPRECATED_EXPORT THREADING_API THREADING_DEPRECATED
+#endif
+
+#ifndef THREADING_DEPRECATED_NO_EXPORT
+#  define THREADING_DEPRECATED_NO_EXPORT THREADING_NO_EXPORT THREADING_DEPRECATED
+#endif
+
+#if 0 /* DEFINE_NO_DEPRECATED */
+#  ifndef THREADING_NO_DEPRECATED
+#    define THREADING_NO_DEPRECATED
+#  endif
+#endif
+
+#endif /* THREADING_API_H */
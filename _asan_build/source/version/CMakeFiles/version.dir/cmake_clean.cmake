@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../libversiond.pdb"
+  "../../libversiond.so"
+  "CMakeFiles/version.dir/source/version.c.o"
+  "CMakeFiles/version.dir/source/version.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/version.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
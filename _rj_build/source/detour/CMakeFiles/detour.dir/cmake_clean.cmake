@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../libdetourd.pdb"
+  "../../libdetourd.so"
+  "CMakeFiles/detour.dir/source/detour.c.o"
+  "CMakeFiles/detour.dir/source/detour.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/detour.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/source/detours
+# Build directory: /root/repo/_rj_build/source/detours
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("funchook_detour")
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/detours/funchook_detour/source/funchook_detour.c" "source/detours/funchook_detour/CMakeFiles/funchook_detour.dir/source/funchook_detour.c.o" "gcc" "source/detours/funchook_detour/CMakeFiles/funchook_detour.dir/source/funchook_detour.c.o.d"
+  "/root/repo/source/detours/funchook_detour/source/funchook_detour_impl.c" "source/detours/funchook_detour/CMakeFiles/funchook_detour.dir/source/funchook_detour_impl.c.o" "gcc" "source/detours/funchook_detour/CMakeFiles/funchook_detour.dir/source/funchook_detour_impl.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rj_build/source/metacall/CMakeFiles/metacall.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
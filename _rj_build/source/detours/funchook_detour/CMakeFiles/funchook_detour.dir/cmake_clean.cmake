@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../libfunchook_detourd.pdb"
+  "../../../libfunchook_detourd.so"
+  "CMakeFiles/funchook_detour.dir/source/funchook_detour.c.o"
+  "CMakeFiles/funchook_detour.dir/source/funchook_detour.c.o.d"
+  "CMakeFiles/funchook_detour.dir/source/funchook_detour_impl.c.o"
+  "CMakeFiles/funchook_detour.dir/source/funchook_detour_impl.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/funchook_detour.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
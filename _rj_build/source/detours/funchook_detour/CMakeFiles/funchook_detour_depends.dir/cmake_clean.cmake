@@ -0,0 +1,16 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/funchook_detour_depends"
+  "CMakeFiles/funchook_detour_depends-complete"
+  "funchook/src/funchook_detour_depends-stamp/funchook_detour_depends-build"
+  "funchook/src/funchook_detour_depends-stamp/funchook_detour_depends-configure"
+  "funchook/src/funchook_detour_depends-stamp/funchook_detour_depends-download"
+  "funchook/src/funchook_detour_depends-stamp/funchook_detour_depends-install"
+  "funchook/src/funchook_detour_depends-stamp/funchook_detour_depends-mkdir"
+  "funchook/src/funchook_detour_depends-stamp/funchook_detour_depends-patch"
+  "funchook/src/funchook_detour_depends-stamp/funchook_detour_depends-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/funchook_detour_depends.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/source/detours/funchook_detour
+# Build directory: /root/repo/_rj_build/source/detours/funchook_detour
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,11 @@
+#!/usr/bin/env sh
+
+# Download repository if it does not exist
+if [ ! -d /root/repo/_rj_build/source/detours/funchook_detour/funchook/src/funchook/.git ]
+then
+	if [ -d /root/repo/_rj_build/source/detours/funchook_detour/funchook/src/funchook ]
+	then
+		rm -rf /root/repo/_rj_build/source/detours/funchook_detour/funchook/src/funchook
+	fi
+	/usr/bin/git clone --single-branch --branch v1.1.1 --recursive https://github.com/kubo/funchook.git /root/repo/_rj_build/source/detours/funchook_detour/funchook/src/funchook
+fi
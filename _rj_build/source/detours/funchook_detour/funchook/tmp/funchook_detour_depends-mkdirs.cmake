@@ -0,0 +1,22 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+cmake_minimum_required(VERSION 3.5)
+
+file(MAKE_DIRECTORY
+  "/root/repo/_rj_build/source/detours/funchook_detour/funchook/src/funchook"
+  "/root/repo/_rj_build/source/detours/funchook_detour/funchook/src/funchook_detour_depends-build"
+  "/root/repo/_rj_build"
+  "/root/repo/_rj_build/source/detours/funchook_detour/funchook/tmp"
+  "/root/repo/_rj_build/source/detours/funchook_detour/funchook/src/funchook_detour_depends-stamp"
+  "/root/repo/_rj_build/source/detours/funchook_detour/funchook/src"
+  "/root/repo/_rj_build/source/detours/funchook_detour/funchook/src/funchook_detour_depends-stamp"
+)
+
+set(configSubDirs )
+foreach(subDir IN LISTS configSubDirs)
+    file(MAKE_DIRECTORY "/root/repo/_rj_build/source/detours/funchook_detour/funchook/src/funchook_detour_depends-stamp/${subDir}")
+endforeach()
+if(cfgdir)
+  file(MAKE_DIRECTORY "/root/repo/_rj_build/source/detours/funchook_detour/funchook/src/funchook_detour_depends-stamp${cfgdir}") # cfgdir has leading slash
+endif()
@@ -0,0 +1,42 @@
+
+#ifndef FUNCHOOK_DETOUR_API_H
+#define FUNCHOOK_DETOUR_API_H
+
+#ifdef FUNCHOOK_DETOUR_STATIC_DEFINE
+#  define FUNCHOOK_DETOUR_API
+#  define FUNCHOOK_DETOUR_NO_EXPORT
+#else
+#  ifndef FUNCHOOK_DETOUR_API
+#    ifdef FUNCHOOK_DETOUR_EXPORTS
+        /* We are building this library */
+#      define FUNCHOOK_DETOUR_API __attribute__((visibility("default")))
+#    else
+        /* We are using this library */
+#      define FUNCHOOK_DETOUR_API __attribute__((visibility("default")))
+#    endif
+#  endif
+
+#  ifndef FUNCHOOK_DETOUR_NO_EXPORT
+#    define FUNCHOOK_DETOUR_NO_EXPORT __attribute__((visibility("hidden")))
+#  endif
+#endif
+
+#ifndef FUNCHOOK_DETOUR_DEPRECATED
+#  define FUNCHOOK_DETOUR_DEPRECATED __attribute__ ((__deprecated__))
+#endif
+
+#ifndef FUNCHOOK_DETOUR_DEPRECATED_EXPORT
+#  define FUNCHOOK_DETOUR_DEPRECATED_EXPORT FUNCHOOK_DETOUR_API FUNCHOOK_DETOUR_DEPRECATED
+#endif
+
+#ifndef FUNCHOOK_DETOUR_DEPRECATED_NO_EXPORT
+#  define FUNCHOOK_DETOUR_DEPRECATED_NO_EXPORT FUNCHOOK_DETOUR_NO_EXPORT FUNCHOOK_DETOUR_DEPRECATED
+#endif
+
+#if 0 /* DEFINE_NO_DEPRECATED */
+#  ifndef FUNCHOOK_DETOUR_NO_DEPRECATED
+#    define FUNCHOOK_DETOUR_NO_DEPRECATED
+#  endif
+#endif
+
+#endif /* FUNCHOOK_DETOUR_API_H */
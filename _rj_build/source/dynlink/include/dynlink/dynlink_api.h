@@ -0,0 +1,42 @@
+
+#ifndef DYNLINK_API_H
+#define DYNLINK_API_H
+
+#ifdef DYNLINK_STATIC_DEFINE
+#  define DYNLINK_API
+#  define DYNLINK_NO_EXPORT
+#else
+#  ifndef DYNLINK_API
+#    ifdef DYNLINK_EXPORTS
+        /* We are building this library */
+#      define DYNLINK_API __attribute__((visibility("default")))
+#    else
+        /* We are using this library */
+#      define DYNLINK_API __attribute__((visibility("default")))
+#    endif
+#  endif
+
+#  ifndef DYNLINK_NO_EXPORT
+#    define DYNLINK_NO_EXPORT __attribute__((visibility("hidden")))
+#  endif
+#endif
+
+#ifndef DYNLINK_DEPRECATED
+#  define DYNLINK_DEPRECATED __attribute__ ((__deprecated__))
+#endif
+
+#ifndef DYNLINK_DEPRECATED_EXPORT
+#  define DYNLINK_DEPRECATED_EXPORT DYNLINK_API DYNLINK_DEPRECATED
+#endif
+
+#ifndef DYNLINK_DEPRECATED_NO_EXPORT
+#  define DYNLINK_DEPRECATED_NO_EXPORT DYNLINK_NO_EXPORT DYNLINK_DEPRECATED
+#endif
+
+#if 0 /* DEFINE_NO_DEPRECATED */
+#  ifndef DYNLINK_NO_DEPRECATED
+#    define DYNLINK_NO_DEPRECATED
+#  endif
+#endif
+
+#endif /* DYNLINK_API_H */
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/environment/source/environment.c" "source/environment/CMakeFiles/environment.dir/source/environment.c.o" "gcc" "source/environment/CMakeFiles/environment.dir/source/environment.c.o.d"
+  "/root/repo/source/environment/source/environment_variable.c" "source/environment/CMakeFiles/environment.dir/source/environment_variable.c.o" "gcc" "source/environment/CMakeFiles/environment.dir/source/environment_variable.c.o.d"
+  "/root/repo/source/environment/source/environment_variable_path.c" "source/environment/CMakeFiles/environment.dir/source/environment_variable_path.c.o" "gcc" "source/environment/CMakeFiles/environment.dir/source/environment_variable_path.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rj_build/source/preprocessor/CMakeFiles/preprocessor.dir/DependInfo.cmake"
+  "/root/repo/_rj_build/source/version/CMakeFiles/version.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/source/extensions/plugin_extension
+# Build directory: /root/repo/_rj_build/source/extensions/plugin_extension
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
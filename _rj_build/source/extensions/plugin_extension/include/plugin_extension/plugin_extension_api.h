@@ -0,0 +1,42 @@
+
+#ifndef PLUGIN_EXTENSION_API_H
+#define PLUGIN_EXTENSION_API_H
+
+#ifdef PLUGIN_EXTENSION_STATIC_DEFINE
+#  define PLUGIN_EXTENSION_API
+#  define PLUGIN_EXTENSION_NO_EXPORT
+#else
+#  ifndef PLUGIN_EXTENSION_API
+#    ifdef PLUGIN_EXTENSION_EXPORTS
+        /* We are building this library */
+#      define PLUGIN_EXTENSION_API __attribute__((visibility("default")))
+#    else
+        /* We are using this library */
+#      define PLUGIN_EXTENSION_API __attribute__((visibility("default")))
+#    endif
+#  endif
+
+#  ifndef PLUGIN_EXTENSION_NO_EXPORT
+#    define PLUGIN_EXTENSION_NO_EXPORT __attribute__((visibility("hidden")))
+#  endif
+#endif
+
+#ifndef PLUGIN_EXTENSION_DEPRECATED
+#  define PLUGIN_EXTENSION_DEPRECATED __attribute__ ((__deprecated__))
+#endif
+
+#ifndef PLUGIN_EXTENSION_DEPRECATED_EXPORT
+#  define PLUGIN_EXTENSION_DEPRECATED_EXPORT PLUGIN_EXTENSION_API PLUGIN_EXTENSION_DEPRECATED
+#endif
+
+#ifndef PLUGIN_EXTENSION_DEPRECATED_NO_EXPORT
+#  define PLUGIN_EXTENSION_DEPRECATED_NO_EXPORT PLUGIN_EXTENSION_NO_EXPORT PLUGIN_EXTENSION_DEPRECATED
+#endif
+
+#if 0 /* DEFINE_NO_DEPRECATED */
+#  ifndef PLUGIN_EXTENSION_NO_DEPRECATED
+#    define PLUGIN_EXTENSION_NO_DEPRECATED
+#  endif
+#endif
+
+#endif /* PLUGIN_EXTENSION_API_H */
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/format/source/format.c" "source/format/CMakeFiles/format.dir/source/format.c.o" "gcc" "source/format/CMakeFiles/format.dir/source/format.c.o.d"
+  "/root/repo/source/format/source/format_print.c" "source/format/CMakeFiles/format.dir/source/format_print.c.o" "gcc" "source/format/CMakeFiles/format.dir/source/format_print.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rj_build/source/version/CMakeFiles/version.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,37 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/loader/source/loader.c" "source/loader/CMakeFiles/loader.dir/source/loader.c.o" "gcc" "source/loader/CMakeFiles/loader.dir/source/loader.c.o.d"
+  "/root/repo/source/loader/source/loader_host.c" "source/loader/CMakeFiles/loader.dir/source/loader_host.c.o" "gcc" "source/loader/CMakeFiles/loader.dir/source/loader_host.c.o.d"
+  "/root/repo/source/loader/source/loader_impl.c" "source/loader/CMakeFiles/loader.dir/source/loader_impl.c.o" "gcc" "source/loader/CMakeFiles/loader.dir/source/loader_impl.c.o.d"
+  "/root/repo/source/loader/source/loader_manager_impl.c" "source/loader/CMakeFiles/loader.dir/source/loader_manager_impl.c.o" "gcc" "source/loader/CMakeFiles/loader.dir/source/loader_manager_impl.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rj_build/source/detour/CMakeFiles/detour.dir/DependInfo.cmake"
+  "/root/repo/_rj_build/source/configuration/CMakeFiles/configuration.dir/DependInfo.cmake"
+  "/root/repo/_rj_build/source/serial/CMakeFiles/serial.dir/DependInfo.cmake"
+  "/root/repo/_rj_build/source/reflect/CMakeFiles/reflect.dir/DependInfo.cmake"
+  "/root/repo/_rj_build/source/plugin/CMakeFiles/plugin.dir/DependInfo.cmake"
+  "/root/repo/_rj_build/source/environment/CMakeFiles/environment.dir/DependInfo.cmake"
+  "/root/repo/_rj_build/source/memory/CMakeFiles/memory.dir/DependInfo.cmake"
+  "/root/repo/_rj_build/source/adt/CMakeFiles/adt.dir/DependInfo.cmake"
+  "/root/repo/_rj_build/source/dynlink/CMakeFiles/dynlink.dir/DependInfo.cmake"
+  "/root/repo/_rj_build/source/log/CMakeFiles/log.dir/DependInfo.cmake"
+  "/root/repo/_rj_build/source/format/CMakeFiles/format.dir/DependInfo.cmake"
+  "/root/repo/_rj_build/source/threading/CMakeFiles/threading.dir/DependInfo.cmake"
+  "/root/repo/_rj_build/source/portability/CMakeFiles/portability.dir/DependInfo.cmake"
+  "/root/repo/_rj_build/source/preprocessor/CMakeFiles/preprocessor.dir/DependInfo.cmake"
+  "/root/repo/_rj_build/source/version/CMakeFiles/version.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
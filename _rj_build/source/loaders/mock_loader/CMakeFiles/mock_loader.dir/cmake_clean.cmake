@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../libmock_loaderd.pdb"
+  "../../../libmock_loaderd.so"
+  "CMakeFiles/mock_loader.dir/source/mock_loader.c.o"
+  "CMakeFiles/mock_loader.dir/source/mock_loader.c.o.d"
+  "CMakeFiles/mock_loader.dir/source/mock_loader_impl.c.o"
+  "CMakeFiles/mock_loader.dir/source/mock_loader_impl.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mock_loader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,42 @@
+
+#ifndef MOCK_LOADER_API_H
+#define MOCK_LOADER_API_H
+
+#ifdef MOCK_LOADER_STATIC_DEFINE
+#  define MOCK_LOADER_API
+#  define MOCK_LOADER_NO_EXPORT
+#else
+#  ifndef MOCK_LOADER_API
+#    ifdef MOCK_LOADER_EXPORTS
+        /* We are building this library */
+#      define MOCK_LOADER_API __attribute__((visibility("default")))
+#    else
+        /* We are using this library */
+#      define MOCK_LOADER_API __attribute__((visibility("default")))
+#    endif
+#  endif
+
+#  ifndef MOCK_LOADER_NO_EXPORT
+#    define MOCK_LOADER_NO_EXPORT __attribute__((visibility("hidden")))
+#  endif
+#endif
+
+#ifndef MOCK_LOADER_DEPRECATED
+#  define MOCK_LOADER_DEPRECATED __attribute__ ((__deprecated__))
+#endif
+
+#ifndef MOCK_LOADER_DEPRECATED_EXPORT
+#  define MOCK_LOADER_DEPRECATED_EXPORT MOCK_LOADER_API MOCK_LOADER_DEPRECATED
+#endif
+
+#ifndef MOCK_LOADER_DEPRECATED_NO_EXPORT
+#  define MOCK_LOADER_DEPRECATED_NO_EXPORT MOCK_LOADER_NO_EXPORT MOCK_LOADER_DEPRECATED
+#endif
+
+#if 0 /* DEFINE_NO_DEPRECATED */
+#  ifndef MOCK_LOADER_NO_DEPRECATED
+#    define MOCK_LOADER_NO_DEPRECATED
+#  endif
+#endif
+
+#endif /* MOCK_LOADER_API_H */
@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/memory/source/memory.c" "source/memory/CMakeFiles/memory.dir/source/memory.c.o" "gcc" "source/memory/CMakeFiles/memory.dir/source/memory.c.o.d"
+  "/root/repo/source/memory/source/memory_allocator.c" "source/memory/CMakeFiles/memory.dir/source/memory_allocator.c.o" "gcc" "source/memory/CMakeFiles/memory.dir/source/memory_allocator.c.o.d"
+  "/root/repo/source/memory/source/memory_allocator_nginx.c" "source/memory/CMakeFiles/memory.dir/source/memory_allocator_nginx.c.o" "gcc" "source/memory/CMakeFiles/memory.dir/source/memory_allocator_nginx.c.o.d"
+  "/root/repo/source/memory/source/memory_allocator_nginx_impl.c" "source/memory/CMakeFiles/memory.dir/source/memory_allocator_nginx_impl.c.o" "gcc" "source/memory/CMakeFiles/memory.dir/source/memory_allocator_nginx_impl.c.o.d"
+  "/root/repo/source/memory/source/memory_allocator_slab.c" "source/memory/CMakeFiles/memory.dir/source/memory_allocator_slab.c.o" "gcc" "source/memory/CMakeFiles/memory.dir/source/memory_allocator_slab.c.o.d"
+  "/root/repo/source/memory/source/memory_allocator_slab_impl.c" "source/memory/CMakeFiles/memory.dir/source/memory_allocator_slab_impl.c.o" "gcc" "source/memory/CMakeFiles/memory.dir/source/memory_allocator_slab_impl.c.o.d"
+  "/root/repo/source/memory/source/memory_allocator_std.c" "source/memory/CMakeFiles/memory.dir/source/memory_allocator_std.c.o" "gcc" "source/memory/CMakeFiles/memory.dir/source/memory_allocator_std.c.o.d"
+  "/root/repo/source/memory/source/memory_allocator_std_impl.c" "source/memory/CMakeFiles/memory.dir/source/memory_allocator_std_impl.c.o" "gcc" "source/memory/CMakeFiles/memory.dir/source/memory_allocator_std_impl.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rj_build/source/log/CMakeFiles/log.dir/DependInfo.cmake"
+  "/root/repo/_rj_build/source/preprocessor/CMakeFiles/preprocessor.dir/DependInfo.cmake"
+  "/root/repo/_rj_build/source/format/CMakeFiles/format.dir/DependInfo.cmake"
+  "/root/repo/_rj_build/source/threading/CMakeFiles/threading.dir/DependInfo.cmake"
+  "/root/repo/_rj_build/source/version/CMakeFiles/version.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "../../libmemoryd.pdb"
+  "../../libmemoryd.so"
+  "CMakeFiles/memory.dir/source/memory.c.o"
+  "CMakeFiles/memory.dir/source/memory.c.o.d"
+  "CMakeFiles/memory.dir/source/memory_allocator.c.o"
+  "CMakeFiles/memory.dir/source/memory_allocator.c.o.d"
+  "CMakeFiles/memory.dir/source/memory_allocator_nginx.c.o"
+  "CMakeFiles/memory.dir/source/memory_allocator_nginx.c.o.d"
+  "CMakeFiles/memory.dir/source/memory_allocator_nginx_impl.c.o"
+  "CMakeFiles/memory.dir/source/memory_allocator_nginx_impl.c.o.d"
+  "CMakeFiles/memory.dir/source/memory_allocator_slab.c.o"
+  "CMakeFiles/memory.dir/source/memory_allocator_slab.c.o.d"
+  "CMakeFiles/memory.dir/source/memory_allocator_slab_impl.c.o"
+  "CMakeFiles/memory.dir/source/memory_allocator_slab_impl.c.o.d"
+  "CMakeFiles/memory.dir/source/memory_allocator_std.c.o"
+  "CMakeFiles/memory.dir/source/memory_allocator_std.c.o.d"
+  "CMakeFiles/memory.dir/source/memory_allocator_std_impl.c.o"
+  "CMakeFiles/memory.dir/source/memory_allocator_std_impl.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/memory.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,135 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/adt/source/adt.c" "source/metacall/CMakeFiles/metacall.dir/__/adt/source/adt.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/adt/source/adt.c.o.d"
+  "/root/repo/source/adt/source/adt_bucket.c" "source/metacall/CMakeFiles/metacall.dir/__/adt/source/adt_bucket.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/adt/source/adt_bucket.c.o.d"
+  "/root/repo/source/adt/source/adt_comparable.c" "source/metacall/CMakeFiles/metacall.dir/__/adt/source/adt_comparable.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/adt/source/adt_comparable.c.o.d"
+  "/root/repo/source/adt/source/adt_hash.c" "source/metacall/CMakeFiles/metacall.dir/__/adt/source/adt_hash.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/adt/source/adt_hash.c.o.d"
+  "/root/repo/source/adt/source/adt_map.c" "source/metacall/CMakeFiles/metacall.dir/__/adt/source/adt_map.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/adt/source/adt_map.c.o.d"
+  "/root/repo/source/adt/source/adt_set.c" "source/metacall/CMakeFiles/metacall.dir/__/adt/source/adt_set.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/adt/source/adt_set.c.o.d"
+  "/root/repo/source/adt/source/adt_trie.c" "source/metacall/CMakeFiles/metacall.dir/__/adt/source/adt_trie.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/adt/source/adt_trie.c.o.d"
+  "/root/repo/source/adt/source/adt_vector.c" "source/metacall/CMakeFiles/metacall.dir/__/adt/source/adt_vector.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/adt/source/adt_vector.c.o.d"
+  "/root/repo/source/configuration/source/configuration.c" "source/metacall/CMakeFiles/metacall.dir/__/configuration/source/configuration.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/configuration/source/configuration.c.o.d"
+  "/root/repo/source/configuration/source/configuration_impl.c" "source/metacall/CMakeFiles/metacall.dir/__/configuration/source/configuration_impl.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/configuration/source/configuration_impl.c.o.d"
+  "/root/repo/source/configuration/source/configuration_object.c" "source/metacall/CMakeFiles/metacall.dir/__/configuration/source/configuration_object.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/configuration/source/configuration_object.c.o.d"
+  "/root/repo/source/configuration/source/configuration_singleton.c" "source/metacall/CMakeFiles/metacall.dir/__/configuration/source/configuration_singleton.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/configuration/source/configuration_singleton.c.o.d"
+  "/root/repo/source/detour/source/detour.c" "source/metacall/CMakeFiles/metacall.dir/__/detour/source/detour.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/detour/source/detour.c.o.d"
+  "/root/repo/source/dynlink/source/dynlink.c" "source/metacall/CMakeFiles/metacall.dir/__/dynlink/source/dynlink.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/dynlink/source/dynlink.c.o.d"
+  "/root/repo/source/dynlink/source/dynlink_impl.c" "source/metacall/CMakeFiles/metacall.dir/__/dynlink/source/dynlink_impl.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/dynlink/source/dynlink_impl.c.o.d"
+  "/root/repo/source/dynlink/source/dynlink_impl_unix.c" "source/metacall/CMakeFiles/metacall.dir/__/dynlink/source/dynlink_impl_unix.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/dynlink/source/dynlink_impl_unix.c.o.d"
+  "/root/repo/_rj_build/source/dynlink/source/dynlink_interface.c" "source/metacall/CMakeFiles/metacall.dir/__/dynlink/source/dynlink_interface.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/dynlink/source/dynlink_interface.c.o.d"
+  "/root/repo/source/dynlink/source/dynlink_symbol.c" "source/metacall/CMakeFiles/metacall.dir/__/dynlink/source/dynlink_symbol.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/dynlink/source/dynlink_symbol.c.o.d"
+  "/root/repo/source/environment/source/environment.c" "source/metacall/CMakeFiles/metacall.dir/__/environment/source/environment.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/environment/source/environment.c.o.d"
+  "/root/repo/source/environment/source/environment_variable.c" "source/metacall/CMakeFiles/metacall.dir/__/environment/source/environment_variable.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/environment/source/environment_variable.c.o.d"
+  "/root/repo/source/environment/source/environment_variable_path.c" "source/metacall/CMakeFiles/metacall.dir/__/environment/source/environment_variable_path.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/environment/source/environment_variable_path.c.o.d"
+  "/root/repo/source/filesystem/source/filesystem.c" "source/metacall/CMakeFiles/metacall.dir/__/filesystem/source/filesystem.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/filesystem/source/filesystem.c.o.d"
+  "/root/repo/source/filesystem/source/filesystem_directory_descriptor.c" "source/metacall/CMakeFiles/metacall.dir/__/filesystem/source/filesystem_directory_descriptor.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/filesystem/source/filesystem_directory_descriptor.c.o.d"
+  "/root/repo/source/filesystem/source/filesystem_file_descriptor.c" "source/metacall/CMakeFiles/metacall.dir/__/filesystem/source/filesystem_file_descriptor.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/filesystem/source/filesystem_file_descriptor.c.o.d"
+  "/root/repo/source/format/source/format.c" "source/metacall/CMakeFiles/metacall.dir/__/format/source/format.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/format/source/format.c.o.d"
+  "/root/repo/source/format/source/format_print.c" "source/metacall/CMakeFiles/metacall.dir/__/format/source/format_print.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/format/source/format_print.c.o.d"
+  "/root/repo/source/loader/source/loader.c" "source/metacall/CMakeFiles/metacall.dir/__/loader/source/loader.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/loader/source/loader.c.o.d"
+  "/root/repo/source/loader/source/loader_host.c" "source/metacall/CMakeFiles/metacall.dir/__/loader/source/loader_host.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/loader/source/loader_host.c.o.d"
+  "/root/repo/source/loader/source/loader_impl.c" "source/metacall/CMakeFiles/metacall.dir/__/loader/source/loader_impl.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/loader/source/loader_impl.c.o.d"
+  "/root/repo/source/loader/source/loader_manager_impl.c" "source/metacall/CMakeFiles/metacall.dir/__/loader/source/loader_manager_impl.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/loader/source/loader_manager_impl.c.o.d"
+  "/root/repo/source/log/source/log.c" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log.c.o.d"
+  "/root/repo/source/log/source/log_aspect.c" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_aspect.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_aspect.c.o.d"
+  "/root/repo/source/log/source/log_aspect_format.c" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_aspect_format.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_aspect_format.c.o.d"
+  "/root/repo/source/log/source/log_aspect_schedule.c" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_aspect_schedule.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_aspect_schedule.c.o.d"
+  "/root/repo/source/log/source/log_aspect_storage.c" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_aspect_storage.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_aspect_storage.c.o.d"
+  "/root/repo/source/log/source/log_aspect_stream.c" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_aspect_stream.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_aspect_stream.c.o.d"
+  "/root/repo/source/log/source/log_handle.c" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_handle.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_handle.c.o.d"
+  "/root/repo/source/log/source/log_impl.c" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_impl.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_impl.c.o.d"
+  "/root/repo/source/log/source/log_level.c" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_level.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_level.c.o.d"
+  "/root/repo/source/log/source/log_map.c" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_map.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_map.c.o.d"
+  "/root/repo/source/log/source/log_policy.c" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy.c.o.d"
+  "/root/repo/source/log/source/log_policy_format.c" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_format.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_format.c.o.d"
+  "/root/repo/source/log/source/log_policy_format_binary.c" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_format_binary.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_format_binary.c.o.d"
+  "/root/repo/source/log/source/log_policy_format_custom.c" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_format_custom.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_format_custom.c.o.d"
+  "/root/repo/source/log/source/log_policy_format_text.c" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_format_text.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_format_text.c.o.d"
+  "/root/repo/source/log/source/log_policy_schedule.c" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_schedule.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_schedule.c.o.d"
+  "/root/repo/source/log/source/log_policy_schedule_async.c" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_schedule_async.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_schedule_async.c.o.d"
+  "/root/repo/source/log/source/log_policy_schedule_sync.c" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_schedule_sync.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_schedule_sync.c.o.d"
+  "/root/repo/source/log/source/log_policy_storage.c" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_storage.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_storage.c.o.d"
+  "/root/repo/source/log/source/log_policy_storage_batch.c" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_storage_batch.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_storage_batch.c.o.d"
+  "/root/repo/source/log/source/log_policy_storage_sequential.c" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_storage_sequential.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_storage_sequential.c.o.d"
+  "/root/repo/source/log/source/log_policy_stream.c" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_stream.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_stream.c.o.d"
+  "/root/repo/source/log/source/log_policy_stream_custom.c" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_stream_custom.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_stream_custom.c.o.d"
+  "/root/repo/source/log/source/log_policy_stream_file.c" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_stream_file.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_stream_file.c.o.d"
+  "/root/repo/source/log/source/log_policy_stream_nginx.c" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_stream_nginx.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_stream_nginx.c.o.d"
+  "/root/repo/source/log/source/log_policy_stream_socket.c" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_stream_socket.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_stream_socket.c.o.d"
+  "/root/repo/source/log/source/log_policy_stream_stdio.c" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_stream_stdio.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_stream_stdio.c.o.d"
+  "/root/repo/source/log/source/log_policy_stream_syslog.c" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_stream_syslog.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_policy_stream_syslog.c.o.d"
+  "/root/repo/source/log/source/log_record.c" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_record.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_record.c.o.d"
+  "/root/repo/source/log/source/log_singleton.c" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_singleton.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_singleton.c.o.d"
+  "/root/repo/source/log/source/log_valid_size.c" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_valid_size.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/log/source/log_valid_size.c.o.d"
+  "/root/repo/source/memory/source/memory.c" "source/metacall/CMakeFiles/metacall.dir/__/memory/source/memory.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/memory/source/memory.c.o.d"
+  "/root/repo/source/memory/source/memory_allocator.c" "source/metacall/CMakeFiles/metacall.dir/__/memory/source/memory_allocator.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/memory/source/memory_allocator.c.o.d"
+  "/root/repo/source/memory/source/memory_allocator_nginx.c" "source/metacall/CMakeFiles/metacall.dir/__/memory/source/memory_allocator_nginx.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/memory/source/memory_allocator_nginx.c.o.d"
+  "/root/repo/source/memory/source/memory_allocator_nginx_impl.c" "source/metacall/CMakeFiles/metacall.dir/__/memory/source/memory_allocator_nginx_impl.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/memory/source/memory_allocator_nginx_impl.c.o.d"
+  "/root/repo/source/memory/source/memory_allocator_slab.c" "source/metacall/CMakeFiles/metacall.dir/__/memory/source/memory_allocator_slab.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/memory/source/memory_allocator_slab.c.o.d"
+  "/root/repo/source/memory/source/memory_allocator_slab_impl.c" "source/metacall/CMakeFiles/metacall.dir/__/memory/source/memory_allocator_slab_impl.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/memory/source/memory_allocator_slab_impl.c.o.d"
+  "/root/repo/source/memory/source/memory_allocator_std.c" "source/metacall/CMakeFiles/metacall.dir/__/memory/source/memory_allocator_std.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/memory/source/memory_allocator_std.c.o.d"
+  "/root/repo/source/memory/source/memory_allocator_std_impl.c" "source/metacall/CMakeFiles/metacall.dir/__/memory/source/memory_allocator_std_impl.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/memory/source/memory_allocator_std_impl.c.o.d"
+  "/root/repo/source/plugin/source/plugin.c" "source/metacall/CMakeFiles/metacall.dir/__/plugin/source/plugin.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/plugin/source/plugin.c.o.d"
+  "/root/repo/source/plugin/source/plugin_descriptor.c" "source/metacall/CMakeFiles/metacall.dir/__/plugin/source/plugin_descriptor.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/plugin/source/plugin_descriptor.c.o.d"
+  "/root/repo/source/plugin/source/plugin_impl.c" "source/metacall/CMakeFiles/metacall.dir/__/plugin/source/plugin_impl.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/plugin/source/plugin_impl.c.o.d"
+  "/root/repo/source/plugin/source/plugin_loader.c" "source/metacall/CMakeFiles/metacall.dir/__/plugin/source/plugin_loader.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/plugin/source/plugin_loader.c.o.d"
+  "/root/repo/source/plugin/source/plugin_manager.c" "source/metacall/CMakeFiles/metacall.dir/__/plugin/source/plugin_manager.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/plugin/source/plugin_manager.c.o.d"
+  "/root/repo/source/portability/source/portability.c" "source/metacall/CMakeFiles/metacall.dir/__/portability/source/portability.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/portability/source/portability.c.o.d"
+  "/root/repo/source/portability/source/portability_executable_path.c" "source/metacall/CMakeFiles/metacall.dir/__/portability/source/portability_executable_path.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/portability/source/portability_executable_path.c.o.d"
+  "/root/repo/source/portability/source/portability_library_path.c" "source/metacall/CMakeFiles/metacall.dir/__/portability/source/portability_library_path.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/portability/source/portability_library_path.c.o.d"
+  "/root/repo/source/portability/source/portability_path.c" "source/metacall/CMakeFiles/metacall.dir/__/portability/source/portability_path.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/portability/source/portability_path.c.o.d"
+  "/root/repo/source/preprocessor/source/preprocessor.c" "source/metacall/CMakeFiles/metacall.dir/__/preprocessor/source/preprocessor.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/preprocessor/source/preprocessor.c.o.d"
+  "/root/repo/source/reflect/source/reflect.c" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect.c.o.d"
+  "/root/repo/source/reflect/source/reflect_attribute.c" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_attribute.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_attribute.c.o.d"
+  "/root/repo/source/reflect/source/reflect_class.c" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_class.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_class.c.o.d"
+  "/root/repo/source/reflect/source/reflect_class_visibility.c" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_class_visibility.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_class_visibility.c.o.d"
+  "/root/repo/source/reflect/source/reflect_constructor.c" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_constructor.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_constructor.c.o.d"
+  "/root/repo/source/reflect/source/reflect_context.c" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_context.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_context.c.o.d"
+  "/root/repo/source/reflect/source/reflect_exception.c" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_exception.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_exception.c.o.d"
+  "/root/repo/source/reflect/source/reflect_function.c" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_function.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_function.c.o.d"
+  "/root/repo/source/reflect/source/reflect_future.c" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_future.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_future.c.o.d"
+  "/root/repo/source/reflect/source/reflect_memory_tracker.c" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_memory_tracker.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_memory_tracker.c.o.d"
+  "/root/repo/source/reflect/source/reflect_method.c" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_method.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_method.c.o.d"
+  "/root/repo/source/reflect/source/reflect_object.c" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_object.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_object.c.o.d"
+  "/root/repo/source/reflect/source/reflect_scope.c" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_scope.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_scope.c.o.d"
+  "/root/repo/source/reflect/source/reflect_signature.c" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_signature.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_signature.c.o.d"
+  "/root/repo/source/reflect/source/reflect_throwable.c" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_throwable.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_throwable.c.o.d"
+  "/root/repo/source/reflect/source/reflect_type.c" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_type.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_type.c.o.d"
+  "/root/repo/source/reflect/source/reflect_type_id.c" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_type_id.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_type_id.c.o.d"
+  "/root/repo/source/reflect/source/reflect_value.c" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_value.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_value.c.o.d"
+  "/root/repo/source/reflect/source/reflect_value_type.c" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_value_type.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_value_type.c.o.d"
+  "/root/repo/source/reflect/source/reflect_value_type_cast.c" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_value_type_cast.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_value_type_cast.c.o.d"
+  "/root/repo/source/reflect/source/reflect_value_type_demotion.c" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_value_type_demotion.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_value_type_demotion.c.o.d"
+  "/root/repo/source/reflect/source/reflect_value_type_id_size.c" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_value_type_id_size.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_value_type_id_size.c.o.d"
+  "/root/repo/source/reflect/source/reflect_value_type_promotion.c" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_value_type_promotion.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/reflect/source/reflect_value_type_promotion.c.o.d"
+  "/root/repo/source/serial/source/serial.c" "source/metacall/CMakeFiles/metacall.dir/__/serial/source/serial.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/serial/source/serial.c.o.d"
+  "/root/repo/source/threading/source/threading.c" "source/metacall/CMakeFiles/metacall.dir/__/threading/source/threading.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/threading/source/threading.c.o.d"
+  "/root/repo/source/threading/source/threading_condition_pthread.c" "source/metacall/CMakeFiles/metacall.dir/__/threading/source/threading_condition_pthread.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/threading/source/threading_condition_pthread.c.o.d"
+  "/root/repo/source/threading/source/threading_left_right.c" "source/metacall/CMakeFiles/metacall.dir/__/threading/source/threading_left_right.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/threading/source/threading_left_right.c.o.d"
+  "/root/repo/source/threading/source/threading_mutex_pthread.c" "source/metacall/CMakeFiles/metacall.dir/__/threading/source/threading_mutex_pthread.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/threading/source/threading_mutex_pthread.c.o.d"
+  "/root/repo/source/threading/source/threading_rwlock_pthread.c" "source/metacall/CMakeFiles/metacall.dir/__/threading/source/threading_rwlock_pthread.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/threading/source/threading_rwlock_pthread.c.o.d"
+  "/root/repo/source/threading/source/threading_thread_id.c" "source/metacall/CMakeFiles/metacall.dir/__/threading/source/threading_thread_id.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/threading/source/threading_thread_id.c.o.d"
+  "/root/repo/source/threading/source/threading_thread_pthread.c" "source/metacall/CMakeFiles/metacall.dir/__/threading/source/threading_thread_pthread.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/threading/source/threading_thread_pthread.c.o.d"
+  "/root/repo/source/version/source/version.c" "source/metacall/CMakeFiles/metacall.dir/__/version/source/version.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/__/version/source/version.c.o.d"
+  "/root/repo/source/metacall/source/metacall.c" "source/metacall/CMakeFiles/metacall.dir/source/metacall.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/source/metacall.c.o.d"
+  "/root/repo/source/metacall/source/metacall_allocator.c" "source/metacall/CMakeFiles/metacall.dir/source/metacall_allocator.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/source/metacall_allocator.c.o.d"
+  "/root/repo/source/metacall/source/metacall_error.c" "source/metacall/CMakeFiles/metacall.dir/source/metacall_error.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/source/metacall_error.c.o.d"
+  "/root/repo/source/metacall/source/metacall_fork.c" "source/metacall/CMakeFiles/metacall.dir/source/metacall_fork.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/source/metacall_fork.c.o.d"
+  "/root/repo/source/metacall/source/metacall_log.c" "source/metacall/CMakeFiles/metacall.dir/source/metacall_log.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/source/metacall_log.c.o.d"
+  "/root/repo/source/metacall/source/metacall_value.c" "source/metacall/CMakeFiles/metacall.dir/source/metacall_value.c.o" "gcc" "source/metacall/CMakeFiles/metacall.dir/source/metacall_value.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
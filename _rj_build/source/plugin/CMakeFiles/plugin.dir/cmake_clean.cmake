@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "../../libplugind.pdb"
+  "../../libplugind.so"
+  "CMakeFiles/plugin.dir/source/plugin.c.o"
+  "CMakeFiles/plugin.dir/source/plugin.c.o.d"
+  "CMakeFiles/plugin.dir/source/plugin_descriptor.c.o"
+  "CMakeFiles/plugin.dir/source/plugin_descriptor.c.o.d"
+  "CMakeFiles/plugin.dir/source/plugin_impl.c.o"
+  "CMakeFiles/plugin.dir/source/plugin_impl.c.o.d"
+  "CMakeFiles/plugin.dir/source/plugin_loader.c.o"
+  "CMakeFiles/plugin.dir/source/plugin_loader.c.o.d"
+  "CMakeFiles/plugin.dir/source/plugin_manager.c.o"
+  "CMakeFiles/plugin.dir/source/plugin_manager.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/plugin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,42 @@
+
+#ifndef PORTABILITY_API_H
+#define PORTABILITY_API_H
+
+#ifdef PORTABILITY_STATIC_DEFINE
+#  define PORTABILITY_API
+#  define PORTABILITY_NO_EXPORT
+#else
+#  ifndef PORTABILITY_API
+#    ifdef PORTABILITY_EXPORTS
+        /* We are building this library */
+#      define PORTABILITY_API __attribute__((visibility("default")))
+#    else
+        /* We are using this library */
+#      define PORTABILITY_API __attribute__((visibility("default")))
+#    endif
+#  endif
+
+#  ifndef PORTABILITY_NO_EXPORT
+#    define PORTABILITY_NO_EXPORT __attribute__((visibility("hidden")))
+#  endif
+#endif
+
+#ifndef PORTABILITY_DEPRECATED
+#  define PORTABILITY_DEPRECATED __attribute__ ((__deprecated__))
+#endif
+
+#ifndef PORTABILITY_DEPRECATED_EXPORT
+#  define PORTABILITY_DEPRECATED_EXPORT PORTABILITY_API PORTABILITY_DEPRECATED
+#endif
+
+#ifndef PORTABILITY_DEPRECATED_NO_EXPORT
+#  define PORTABILITY_DEPRECATED_NO_EXPORT PORTABILITY_NO_EXPORT PORTABILITY_DEPRECATED
+#endif
+
+#if 0 /* DEFINE_NO_DEPRECATED */
+#  ifndef PORTABILITY_NO_DEPRECATED
+#    define PORTABILITY_NO_DEPRECATED
+#  endif
+#endif
+
+#endif /* PORTABILITY_API_H */
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../libpreprocessord.pdb"
+  "../../libpreprocessord.so"
+  "CMakeFiles/preprocessor.dir/source/preprocessor.c.o"
+  "CMakeFiles/preprocessor.dir/source/preprocessor.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/preprocessor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,42 @@
+
+#ifndef REFLECT_API_H
+#define REFLECT_API_H
+
+#ifdef REFLECT_STATIC_DEFINE
+#  define REFLECT_API
+#  define REFLECT_NO_EXPORT
+#else
+#  ifndef REFLECT_API
+#    ifdef REFLECT_EXPORTS
+        /* We are building this library */
+#      define REFLECT_API __attribute__((visibility("default")))
+#    else
+        /* We are using this library */
+#      define REFLECT_API __attribute__((visibility("default")))
+#    endif
+#  endif
+
+#  ifndef REFLECT_NO_EXPORT
+#    define REFLECT_NO_EXPORT __attribute__((visibility("hidden")))
+#  endif
+#endif
+
+#ifndef REFLECT_DEPRECATED
+#  define REFLECT_DEPRECATED __attribute__ ((__deprecated__))
+#endif
+
+#ifndef REFLECT_DEPRECATED_EXPORT
+#  define REFLECT_DEPRECATED_EXPORT REFLECT_API REFLECT_DEPRECATED
+#endif
+
+#ifndef REFLECT_DEPRECATED_NO_EXPORT
+#  define REFLECT_DEPRECATED_NO_EXPORT REFLECT_NO_EXPORT REFLECT_DEPRECATED
+#endif
+
+#if 0 /* DEFINE_NO_DEPRECATED */
+#  ifndef REFLECT_NO_DEPRECATED
+#    define REFLECT_NO_DEPRECATED
+#  endif
+#endif
+
+#endif /* REFLECT_API_H */
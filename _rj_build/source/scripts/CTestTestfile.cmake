@@ -0,0 +1,23 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/source/scripts
+# Build directory: /root/repo/_rj_build/source/scripts
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("c")
+subdirs("cobol")
+subdirs("csharp")
+subdirs("extension")
+subdirs("file")
+subdirs("java")
+subdirs("julia")
+subdirs("javascript")
+subdirs("llvm")
+subdirs("lua")
+subdirs("node")
+subdirs("python")
+subdirs("ruby")
+subdirs("rust")
+subdirs("rpc")
+subdirs("typescript")
+subdirs("wasm")
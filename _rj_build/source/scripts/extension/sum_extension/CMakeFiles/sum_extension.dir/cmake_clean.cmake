@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../libsum_extensiond.pdb"
+  "../../../../libsum_extensiond.so"
+  "CMakeFiles/sum_extension.dir/source/sum_extension.cpp.o"
+  "CMakeFiles/sum_extension.dir/source/sum_extension.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sum_extension.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
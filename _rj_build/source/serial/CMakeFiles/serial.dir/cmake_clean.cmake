@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../libseriald.pdb"
+  "../../libseriald.so"
+  "CMakeFiles/serial.dir/source/serial.c.o"
+  "CMakeFiles/serial.dir/source/serial.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/serials/metacall_serial/source/metacall_serial.c" "source/serials/metacall_serial/CMakeFiles/metacall_serial.dir/source/metacall_serial.c.o" "gcc" "source/serials/metacall_serial/CMakeFiles/metacall_serial.dir/source/metacall_serial.c.o.d"
+  "/root/repo/source/serials/metacall_serial/source/metacall_serial_impl.c" "source/serials/metacall_serial/CMakeFiles/metacall_serial.dir/source/metacall_serial_impl.c.o" "gcc" "source/serials/metacall_serial/CMakeFiles/metacall_serial.dir/source/metacall_serial_impl.c.o.d"
+  "/root/repo/source/serials/metacall_serial/source/metacall_serial_impl_deserialize.c" "source/serials/metacall_serial/CMakeFiles/metacall_serial.dir/source/metacall_serial_impl_deserialize.c.o" "gcc" "source/serials/metacall_serial/CMakeFiles/metacall_serial.dir/source/metacall_serial_impl_deserialize.c.o.d"
+  "/root/repo/source/serials/metacall_serial/source/metacall_serial_impl_serialize.c" "source/serials/metacall_serial/CMakeFiles/metacall_serial.dir/source/metacall_serial_impl_serialize.c.o" "gcc" "source/serials/metacall_serial/CMakeFiles/metacall_serial.dir/source/metacall_serial_impl_serialize.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rj_build/source/metacall/CMakeFiles/metacall.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
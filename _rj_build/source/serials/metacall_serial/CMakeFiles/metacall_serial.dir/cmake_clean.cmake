@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../../libmetacall_seriald.pdb"
+  "../../../libmetacall_seriald.so"
+  "CMakeFiles/metacall_serial.dir/source/metacall_serial.c.o"
+  "CMakeFiles/metacall_serial.dir/source/metacall_serial.c.o.d"
+  "CMakeFiles/metacall_serial.dir/source/metacall_serial_impl.c.o"
+  "CMakeFiles/metacall_serial.dir/source/metacall_serial_impl.c.o.d"
+  "CMakeFiles/metacall_serial.dir/source/metacall_serial_impl_deserialize.c.o"
+  "CMakeFiles/metacall_serial.dir/source/metacall_serial_impl_deserialize.c.o.d"
+  "CMakeFiles/metacall_serial.dir/source/metacall_serial_impl_serialize.c.o"
+  "CMakeFiles/metacall_serial.dir/source/metacall_serial_impl_serialize.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/metacall_serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,42 @@
+
+#ifndef METACALL_SERIAL_API_H
+#define METACALL_SERIAL_API_H
+
+#ifdef METACALL_SERIAL_STATIC_DEFINE
+#  define METACALL_SERIAL_API
+#  define METACALL_SERIAL_NO_EXPORT
+#else
+#  ifndef METACALL_SERIAL_API
+#    ifdef METACALL_SERIAL_EXPORTS
+        /* We are building this library */
+#      define METACALL_SERIAL_API __attribute__((visibility("default")))
+#    else
+        /* We are using this library */
+#      define METACALL_SERIAL_API __attribute__((visibility("default")))
+#    endif
+#  endif
+
+#  ifndef METACALL_SERIAL_NO_EXPORT
+#    define METACALL_SERIAL_NO_EXPORT __attribute__((visibility("hidden")))
+#  endif
+#endif
+
+#ifndef METACALL_SERIAL_DEPRECATED
+#  define METACALL_SERIAL_DEPRECATED __attribute__ ((__deprecated__))
+#endif
+
+#ifndef METACALL_SERIAL_DEPRECATED_EXPORT
+#  define METACALL_SERIAL_DEPRECATED_EXPORT METACALL_SERIAL_API METACALL_SERIAL_DEPRECATED
+#endif
+
+#ifndef METACALL_SERIAL_DEPRECATED_NO_EXPORT
+#  define METACALL_SERIAL_DEPRECATED_NO_EXPORT METACALL_SERIAL_NO_EXPORT METACALL_SERIAL_DEPRECATED
+#endif
+
+#if 0 /* DEFINE_NO_DEPRECATED */
+#  ifndef METACALL_SERIAL_NO_DEPRECATED
+#    define METACALL_SERIAL_NO_DEPRECATED
+#  endif
+#endif
+
+#endif /* METACALL_SERIAL_API_H */
@@ -0,0 +1,42 @@
+
+#ifndef MSGPACK_SERIAL_API_H
+#define MSGPACK_SERIAL_API_H
+
+#ifdef MSGPACK_SERIAL_STATIC_DEFINE
+#  define MSGPACK_SERIAL_API
+#  define MSGPACK_SERIAL_NO_EXPORT
+#else
+#  ifndef MSGPACK_SERIAL_API
+#    ifdef MSGPACK_SERIAL_EXPORTS
+        /* We are building this library */
+#      define MSGPACK_SERIAL_API __attribute__((visibility("default")))
+#    else
+        /* We are using this library */
+#      define MSGPACK_SERIAL_API __attribute__((visibility("default")))
+#    endif
+#  endif
+
+#  ifndef MSGPACK_SERIAL_NO_EXPORT
+#    define MSGPACK_SERIAL_NO_EXPORT __attribute__((visibility("hidden")))
+#  endif
+#endif
+
+#ifndef MSGPACK_SERIAL_DEPRECATED
+#  define MSGPACK_SERIAL_DEPRECATED __attribute__ ((__deprecated__))
+#endif
+
+#ifndef MSGPACK_SERIAL_DEPRECATED_EXPORT
+#  define MSGPACK_SERIAL_DEPRECATED_EXPORT MSGPACK_SERIAL_API MSGPACK_SERIAL_DEPRECATED
+#endif
+
+#ifndef MSGPACK_SERIAL_DEPRECATED_NO_EXPORT
+#  define MSGPACK_SERIAL_DEPRECATED_NO_EXPORT MSGPACK_SERIAL_NO_EXPORT MSGPACK_SERIAL_DEPRECATED
+#endif
+
+#if 0 /* DEFINE_NO_DEPRECATED */
+#  ifndef MSGPACK_SERIAL_NO_DEPRECATED
+#    define MSGPACK_SERIAL_NO_DEPRECATED
+#  endif
+#endif
+
+#endif /* MSGPACK_SERIAL_API_H */
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/serials/rapid_json_serial/source/rapid_json_serial.c" "source/serials/rapid_json_serial/CMakeFiles/rapid_json_serial.dir/source/rapid_json_serial.c.o" "gcc" "source/serials/rapid_json_serial/CMakeFiles/rapid_json_serial.dir/source/rapid_json_serial.c.o.d"
+  "/root/repo/source/serials/rapid_json_serial/source/rapid_json_serial_impl.cpp" "source/serials/rapid_json_serial/CMakeFiles/rapid_json_serial.dir/source/rapid_json_serial_impl.cpp.o" "gcc" "source/serials/rapid_json_serial/CMakeFiles/rapid_json_serial.dir/source/rapid_json_serial_impl.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rj_build/source/metacall/CMakeFiles/metacall.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../librapid_json_seriald.pdb"
+  "../../../librapid_json_seriald.so"
+  "CMakeFiles/rapid_json_serial.dir/source/rapid_json_serial.c.o"
+  "CMakeFiles/rapid_json_serial.dir/source/rapid_json_serial.c.o.d"
+  "CMakeFiles/rapid_json_serial.dir/source/rapid_json_serial_impl.cpp.o"
+  "CMakeFiles/rapid_json_serial.dir/source/rapid_json_serial_impl.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/rapid_json_serial.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
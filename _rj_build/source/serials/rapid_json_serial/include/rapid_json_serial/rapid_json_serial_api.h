@@ -0,0 +1,42 @@
+
+#ifndef RAPID_JSON_SERIAL_API_H
+#define RAPID_JSON_SERIAL_API_H
+
+#ifdef RAPID_JSON_SERIAL_STATIC_DEFINE
+#  define RAPID_JSON_SERIAL_API
+#  define RAPID_JSON_SERIAL_NO_EXPORT
+#else
+#  ifndef RAPID_JSON_SERIAL_API
+#    ifdef RAPID_JSON_SERIAL_EXPORTS
+        /* We are building this library */
+#      define RAPID_JSON_SERIAL_API __attribute__((visibility("default")))
+#    else
+        /* We are using this library */
+#      define RAPID_JSON_SERIAL_API __attribute__((visibility("default")))
+#    endif
+#  endif
+
+#  ifndef RAPID_JSON_SERIAL_NO_EXPORT
+#    define RAPID_JSON_SERIAL_NO_EXPORT __attribute__((visibility("hidden")))
+#  endif
+#endif
+
+#ifndef RAPID_JSON_SERIAL_DEPRECATED
+#  define RAPID_JSON_SERIAL_DEPRECATED __attribute__ ((__deprecated__))
+#endif
+
+#ifndef RAPID_JSON_SERIAL_DEPRECATED_EXPORT
+#  define RAPID_JSON_SERIAL_DEPRECATED_EXPORT RAPID_JSON_SERIAL_API RAPID_JSON_SERIAL_DEPRECATED
+#endif
+
+#ifndef RAPID_JSON_SERIAL_DEPRECATED_NO_EXPORT
+#  define RAPID_JSON_SERIAL_DEPRECATED_NO_EXPORT RAPID_JSON_SERIAL_NO_EXPORT RAPID_JSON_SERIAL_DEPRECATED
+#endif
+
+#if 0 /* DEFINE_NO_DEPRECATED */
+#  ifndef RAPID_JSON_SERIAL_NO_DEPRECATED
+#    define RAPID_JSON_SERIAL_NO_DEPRECATED
+#  endif
+#endif
+
+#endif /* RAPID_JSON_SERIAL_API_H */
@@ -0,0 +1,149 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/source/tests
+# Build directory: /root/repo/_rj_build/source/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("preprocessor_test")
+subdirs("environment_test")
+subdirs("log_test")
+subdirs("log_custom_test")
+subdirs("log_socket_test")
+subdirs("adt_set_test")
+subdirs("adt_trie_test")
+subdirs("adt_vector_test")
+subdirs("adt_map_test")
+subdirs("reflect_value_cast_test")
+subdirs("reflect_function_test")
+subdirs("reflect_object_class_test")
+subdirs("reflect_scope_test")
+subdirs("reflect_metadata_test")
+subdirs("dynlink_test")
+subdirs("detour_test")
+subdirs("serial_test")
+subdirs("configuration_test")
+subdirs("rb_loader_parser_test")
+subdirs("portability_path_test")
+subdirs("metacall_logs_test")
+subdirs("metacall_load_memory_test")
+subdirs("metacall_load_configuration_test")
+subdirs("metacall_load_configuration_relative_test")
+subdirs("metacall_load_configuration_python_node_test")
+subdirs("metacall_load_configuration_node_python_test")
+subdirs("metacall_duplicated_handle_test")
+subdirs("metacall_duplicated_symbols_test")
+subdirs("metacall_handle_export_test")
+subdirs("metacall_handle_get_test")
+subdirs("metacall_test")
+subdirs("metacall_node_test")
+subdirs("metacall_node_event_loop_test")
+subdirs("metacall_node_event_loop_signal_test")
+subdirs("metacall_node_call_test")
+subdirs("metacall_node_inline_test")
+subdirs("metacall_node_async_test")
+subdirs("metacall_node_reentrant_test")
+subdirs("metacall_node_port_test")
+subdirs("metacall_node_port_await_test")
+subdirs("metacall_node_callback_test")
+subdirs("metacall_node_fail_test")
+subdirs("metacall_node_fail_env_var_test")
+subdirs("metacall_node_fail_load_leak_test")
+subdirs("metacall_node_typescript_test")
+subdirs("metacall_node_python_async_after_destroy_test")
+subdirs("metacall_node_python_await_test")
+subdirs("metacall_node_python_exception_test")
+subdirs("metacall_node_clear_mem_test")
+subdirs("metacall_node_async_resources_test")
+subdirs("metacall_node_await_chain_test")
+subdirs("metacall_node_exception_test")
+subdirs("metacall_node_python_deadlock_test")
+subdirs("metacall_node_native_code_test")
+subdirs("metacall_node_extension_test")
+subdirs("metacall_distributable_test")
+subdirs("metacall_cast_test")
+subdirs("metacall_init_fini_test")
+subdirs("metacall_thread_safe_test")
+subdirs("metacall_ducktype_test")
+subdirs("metacall_inspect_test")
+subdirs("metacall_integration_test")
+subdirs("metacall_depends_test")
+subdirs("metacall_configuration_exec_path_test")
+subdirs("metacall_clear_test")
+subdirs("metacall_python_test")
+subdirs("metacall_python_object_class_test")
+subdirs("metacall_python_gc_test")
+subdirs("metacall_python_open_test")
+subdirs("metacall_python_dict_test")
+subdirs("metacall_python_model_test")
+subdirs("metacall_python_pointer_test")
+subdirs("metacall_python_buffer_test")
+subdirs("metacall_python_reentrant_test")
+subdirs("metacall_python_varargs_test")
+subdirs("metacall_python_loader_port_test")
+subdirs("metacall_python_port_test")
+subdirs("metacall_python_port_https_test")
+subdirs("metacall_python_port_callback_test")
+subdirs("metacall_python_port_import_test")
+subdirs("metacall_python_callback_test")
+subdirs("metacall_python_fail_test")
+subdirs("metacall_python_relative_path_test")
+subdirs("metacall_python_without_functions_test")
+subdirs("metacall_python_builtins_test")
+subdirs("metacall_python_async_test")
+subdirs("metacall_python_exception_test")
+subdirs("metacall_python_thread_destroy_test")
+subdirs("metacall_map_test")
+subdirs("metacall_map_await_test")
+subdirs("metacall_initialize_test")
+subdirs("metacall_initialize_ex_test")
+subdirs("metacall_reinitialize_test")
+subdirs("metacall_initialize_destroy_multiple_test")
+subdirs("metacall_initialize_destroy_multiple_node_test")
+subdirs("metacall_reload_functions_test")
+subdirs("metacall_invalid_loader_test")
+subdirs("metacall_fork_test")
+subdirs("metacall_return_monad_test")
+subdirs("metacall_callback_complex_test")
+subdirs("metacall_ruby_fail_test")
+subdirs("metacall_ruby_fail_empty_test")
+subdirs("metacall_ruby_object_class_test")
+subdirs("metacall_ruby_parser_integration_test")
+subdirs("metacall_function_test")
+subdirs("metacall_cobol_test")
+subdirs("metacall_file_test")
+subdirs("metacall_file_fail_test")
+subdirs("metacall_file_glob_test")
+subdirs("metacall_typescript_test")
+subdirs("metacall_typescript_node_test")
+subdirs("metacall_typescript_call_map_test")
+subdirs("metacall_typescript_tsx_test")
+subdirs("metacall_typescript_tsx_loop_fail_test")
+subdirs("metacall_typescript_require_test")
+subdirs("metacall_typescript_jsx_default_test")
+subdirs("metacall_lua_test")
+subdirs("metacall_rpc_test")
+subdirs("metacall_csharp_static_class_test")
+subdirs("metacall_llvm_test")
+subdirs("metacall_ruby_test")
+subdirs("metacall_cs_test")
+subdirs("metacall_julia_test")
+subdirs("metacall_java_test")
+subdirs("metacall_wasm_test")
+subdirs("metacall_wasm_python_port_test")
+subdirs("metacall_rust_test")
+subdirs("metacall_rust_load_from_mem_test")
+subdirs("metacall_rust_load_from_package_test")
+subdirs("metacall_rust_load_from_package_dep_test")
+subdirs("metacall_rust_load_from_package_class_test")
+subdirs("metacall_rust_class_test")
+subdirs("metacall_c_test")
+subdirs("metacall_version_test")
+subdirs("metacall_dynlink_path_test")
+subdirs("metacall_library_path_without_env_vars_test")
+subdirs("metacall_ext_test")
+subdirs("metacall_plugin_extension_test")
+subdirs("metacall_plugin_extension_local_test")
+subdirs("metacall_plugin_extension_destroy_order_test")
+subdirs("metacall_cli_core_plugin_test")
+subdirs("metacall_cli_core_plugin_await_test")
+subdirs("metacall_backtrace_plugin_test")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../adt-map-testd"
+  "../../../adt-map-testd.pdb"
+  "CMakeFiles/adt-map-test.dir/source/adt_map_test.cpp.o"
+  "CMakeFiles/adt-map-test.dir/source/adt_map_test.cpp.o.d"
+  "CMakeFiles/adt-map-test.dir/source/main.cpp.o"
+  "CMakeFiles/adt-map-test.dir/source/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/adt-map-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
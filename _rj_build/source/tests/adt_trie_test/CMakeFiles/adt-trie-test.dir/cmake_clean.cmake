@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../adt-trie-testd"
+  "../../../adt-trie-testd.pdb"
+  "CMakeFiles/adt-trie-test.dir/source/adt_trie_test.cpp.o"
+  "CMakeFiles/adt-trie-test.dir/source/adt_trie_test.cpp.o.d"
+  "CMakeFiles/adt-trie-test.dir/source/main.cpp.o"
+  "CMakeFiles/adt-trie-test.dir/source/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/adt-trie-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
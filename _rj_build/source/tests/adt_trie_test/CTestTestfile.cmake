@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/source/tests/adt_trie_test
+# Build directory: /root/repo/_rj_build/source/tests/adt_trie_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(adt-trie-test "/root/repo/_rj_build/adt-trie-testd")
+set_tests_properties(adt-trie-test PROPERTIES  LABELS "adt-trie-test" _BACKTRACE_TRIPLES "/root/repo/source/tests/adt_trie_test/CMakeLists.txt;122;add_test;/root/repo/source/tests/adt_trie_test/CMakeLists.txt;0;")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../adt-vector-testd"
+  "../../../adt-vector-testd.pdb"
+  "CMakeFiles/adt-vector-test.dir/source/adt_vector_test.cpp.o"
+  "CMakeFiles/adt-vector-test.dir/source/adt_vector_test.cpp.o.d"
+  "CMakeFiles/adt-vector-test.dir/source/main.cpp.o"
+  "CMakeFiles/adt-vector-test.dir/source/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/adt-vector-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
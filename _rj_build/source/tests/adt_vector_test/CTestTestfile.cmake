@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/source/tests/adt_vector_test
+# Build directory: /root/repo/_rj_build/source/tests/adt_vector_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(adt-vector-test "/root/repo/_rj_build/adt-vector-testd")
+set_tests_properties(adt-vector-test PROPERTIES  LABELS "adt-vector-test" _BACKTRACE_TRIPLES "/root/repo/source/tests/adt_vector_test/CMakeLists.txt;123;add_test;/root/repo/source/tests/adt_vector_test/CMakeLists.txt;0;")
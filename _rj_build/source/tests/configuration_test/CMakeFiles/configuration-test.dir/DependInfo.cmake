@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/tests/configuration_test/source/configuration_test.cpp" "source/tests/configuration_test/CMakeFiles/configuration-test.dir/source/configuration_test.cpp.o" "gcc" "source/tests/configuration_test/CMakeFiles/configuration-test.dir/source/configuration_test.cpp.o.d"
+  "/root/repo/source/tests/configuration_test/source/main.cpp" "source/tests/configuration_test/CMakeFiles/configuration-test.dir/source/main.cpp.o" "gcc" "source/tests/configuration_test/CMakeFiles/configuration-test.dir/source/main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rj_build/source/metacall/CMakeFiles/metacall.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/source/tests/configuration_test
+# Build directory: /root/repo/_rj_build/source/tests/configuration_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(configuration-test "/root/repo/_rj_build/configuration-testd")
+set_tests_properties(configuration-test PROPERTIES  ENVIRONMENT "SERIAL_LIBRARY_PATH=/root/repo/_rj_build;CONFIGURATION_PATH=/root/repo/_rj_build/source/tests/configuration_test/global.json" LABELS "configuration-test" WORKING_DIRECTORY "/root/repo/_rj_build/source/tests/configuration_test" _BACKTRACE_TRIPLES "/root/repo/source/tests/configuration_test/CMakeLists.txt;131;add_test;/root/repo/source/tests/configuration_test/CMakeLists.txt;0;")
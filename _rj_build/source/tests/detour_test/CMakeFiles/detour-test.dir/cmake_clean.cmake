@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../detour-testd"
+  "../../../detour-testd.pdb"
+  "CMakeFiles/detour-test.dir/source/detour_test.cpp.o"
+  "CMakeFiles/detour-test.dir/source/detour_test.cpp.o.d"
+  "CMakeFiles/detour-test.dir/source/main.cpp.o"
+  "CMakeFiles/detour-test.dir/source/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/detour-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../log-custom-testd"
+  "../../../log-custom-testd.pdb"
+  "CMakeFiles/log-custom-test.dir/source/log_custom_test.cpp.o"
+  "CMakeFiles/log-custom-test.dir/source/log_custom_test.cpp.o.d"
+  "CMakeFiles/log-custom-test.dir/source/main.cpp.o"
+  "CMakeFiles/log-custom-test.dir/source/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/log-custom-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../log-socket-testd"
+  "../../../log-socket-testd.pdb"
+  "CMakeFiles/log-socket-test.dir/source/log_socket_test.cpp.o"
+  "CMakeFiles/log-socket-test.dir/source/log_socket_test.cpp.o.d"
+  "CMakeFiles/log-socket-test.dir/source/main.cpp.o"
+  "CMakeFiles/log-socket-test.dir/source/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/log-socket-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
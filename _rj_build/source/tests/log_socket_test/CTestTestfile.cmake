@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/source/tests/log_socket_test
+# Build directory: /root/repo/_rj_build/source/tests/log_socket_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(log-socket-test "/root/repo/_rj_build/log-socket-testd")
+set_tests_properties(log-socket-test PROPERTIES  LABELS "log-socket-test" _BACKTRACE_TRIPLES "/root/repo/source/tests/log_socket_test/CMakeLists.txt;121;add_test;/root/repo/source/tests/log_socket_test/CMakeLists.txt;0;")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../log-testd"
+  "../../../log-testd.pdb"
+  "CMakeFiles/log-test.dir/source/log_test.cpp.o"
+  "CMakeFiles/log-test.dir/source/log_test.cpp.o.d"
+  "CMakeFiles/log-test.dir/source/main.cpp.o"
+  "CMakeFiles/log-test.dir/source/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/log-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
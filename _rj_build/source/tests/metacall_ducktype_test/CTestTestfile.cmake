@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/source/tests/metacall_ducktype_test
+# Build directory: /root/repo/_rj_build/source/tests/metacall_ducktype_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(metacall-ducktype-test "/root/repo/_rj_build/metacall-ducktype-testd")
+set_tests_properties(metacall-ducktype-test PROPERTIES  ENVIRONMENT "LOADER_LIBRARY_PATH=/root/repo/_rj_build;LOADER_SCRIPT_PATH=/root/repo/_rj_build/scripts;CONFIGURATION_PATH=/root/repo/_rj_build/configurations/global.json;SERIAL_LIBRARY_PATH=/root/repo/_rj_build;DETOUR_LIBRARY_PATH=/root/repo/_rj_build;PORT_LIBRARY_PATH=/root/repo/_rj_build;LSAN_OPTIONS=verbosity=1:log_threads=1:print_suppressions=false:suppressions=/root/repo/source/tests/sanitizer/lsan.supp;ASAN_OPTIONS=use_sigaltstack=0:symbolize=1:alloc_dealloc_mismatch=0:strict_string_checks=1:detect_stack_use_after_return=1:check_initialization_order=1:strict_init_order=1" LABELS "metacall-ducktype-test" _BACKTRACE_TRIPLES "/root/repo/source/tests/metacall_ducktype_test/CMakeLists.txt;117;add_test;/root/repo/source/tests/metacall_ducktype_test/CMakeLists.txt;0;")
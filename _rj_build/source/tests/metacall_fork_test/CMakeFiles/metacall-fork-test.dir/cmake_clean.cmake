@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../metacall-fork-testd"
+  "../../../metacall-fork-testd.pdb"
+  "CMakeFiles/metacall-fork-test.dir/source/main.cpp.o"
+  "CMakeFiles/metacall-fork-test.dir/source/main.cpp.o.d"
+  "CMakeFiles/metacall-fork-test.dir/source/metacall_fork_test.cpp.o"
+  "CMakeFiles/metacall-fork-test.dir/source/metacall_fork_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/metacall-fork-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
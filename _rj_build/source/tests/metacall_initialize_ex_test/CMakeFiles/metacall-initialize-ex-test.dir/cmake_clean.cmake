@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../metacall-initialize-ex-testd"
+  "../../../metacall-initialize-ex-testd.pdb"
+  "CMakeFiles/metacall-initialize-ex-test.dir/source/main.cpp.o"
+  "CMakeFiles/metacall-initialize-ex-test.dir/source/main.cpp.o.d"
+  "CMakeFiles/metacall-initialize-ex-test.dir/source/metacall_initialize_ex_test.cpp.o"
+  "CMakeFiles/metacall-initialize-ex-test.dir/source/metacall_initialize_ex_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/metacall-initialize-ex-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
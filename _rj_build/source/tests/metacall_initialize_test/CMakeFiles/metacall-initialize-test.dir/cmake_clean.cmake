@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../metacall-initialize-testd"
+  "../../../metacall-initialize-testd.pdb"
+  "CMakeFiles/metacall-initialize-test.dir/source/main.cpp.o"
+  "CMakeFiles/metacall-initialize-test.dir/source/main.cpp.o.d"
+  "CMakeFiles/metacall-initialize-test.dir/source/metacall_initialize_test.cpp.o"
+  "CMakeFiles/metacall-initialize-test.dir/source/metacall_initialize_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/metacall-initialize-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../metacall-invalid-loader-testd"
+  "../../../metacall-invalid-loader-testd.pdb"
+  "CMakeFiles/metacall-invalid-loader-test.dir/source/main.cpp.o"
+  "CMakeFiles/metacall-invalid-loader-test.dir/source/main.cpp.o.d"
+  "CMakeFiles/metacall-invalid-loader-test.dir/source/metacall_invalid_loader_test.cpp.o"
+  "CMakeFiles/metacall-invalid-loader-test.dir/source/metacall_invalid_loader_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/metacall-invalid-loader-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
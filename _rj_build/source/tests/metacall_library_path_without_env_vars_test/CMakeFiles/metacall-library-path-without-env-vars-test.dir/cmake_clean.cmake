@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../metacall-library-path-without-env-vars-testd"
+  "../../../metacall-library-path-without-env-vars-testd.pdb"
+  "CMakeFiles/metacall-library-path-without-env-vars-test.dir/source/main.cpp.o"
+  "CMakeFiles/metacall-library-path-without-env-vars-test.dir/source/main.cpp.o.d"
+  "CMakeFiles/metacall-library-path-without-env-vars-test.dir/source/metacall_library_path_without_env_vars_test.cpp.o"
+  "CMakeFiles/metacall-library-path-without-env-vars-test.dir/source/metacall_library_path_without_env_vars_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/metacall-library-path-without-env-vars-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/source/tests/metacall_library_path_without_env_vars_test
+# Build directory: /root/repo/_rj_build/source/tests/metacall_library_path_without_env_vars_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(metacall-library-path-without-env-vars-test "/root/repo/_rj_build/metacall-library-path-without-env-vars-testd")
+set_tests_properties(metacall-library-path-without-env-vars-test PROPERTIES  ENVIRONMENT "CONFIGURATION_PATH=/root/repo/_rj_build/configurations/global.json" LABELS "metacall-library-path-without-env-vars-test" _BACKTRACE_TRIPLES "/root/repo/source/tests/metacall_library_path_without_env_vars_test/CMakeLists.txt;122;add_test;/root/repo/source/tests/metacall_library_path_without_env_vars_test/CMakeLists.txt;0;")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../metacall-load-configuration-testd"
+  "../../../metacall-load-configuration-testd.pdb"
+  "CMakeFiles/metacall-load-configuration-test.dir/source/main.cpp.o"
+  "CMakeFiles/metacall-load-configuration-test.dir/source/main.cpp.o.d"
+  "CMakeFiles/metacall-load-configuration-test.dir/source/metacall_load_configuration_test.cpp.o"
+  "CMakeFiles/metacall-load-configuration-test.dir/source/metacall_load_configuration_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/metacall-load-configuration-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../metacall-logs-testd"
+  "../../../metacall-logs-testd.pdb"
+  "CMakeFiles/metacall-logs-test.dir/source/main.cpp.o"
+  "CMakeFiles/metacall-logs-test.dir/source/main.cpp.o.d"
+  "CMakeFiles/metacall-logs-test.dir/source/metacall_logs_test.cpp.o"
+  "CMakeFiles/metacall-logs-test.dir/source/metacall_logs_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/metacall-logs-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
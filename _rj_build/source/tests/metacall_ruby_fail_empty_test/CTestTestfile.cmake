@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/source/tests/metacall_ruby_fail_empty_test
+# Build directory: /root/repo/_rj_build/source/tests/metacall_ruby_fail_empty_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
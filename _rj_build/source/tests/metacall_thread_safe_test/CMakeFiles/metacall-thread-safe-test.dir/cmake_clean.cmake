@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../metacall-thread-safe-testd"
+  "../../../metacall-thread-safe-testd.pdb"
+  "CMakeFiles/metacall-thread-safe-test.dir/source/main.cpp.o"
+  "CMakeFiles/metacall-thread-safe-test.dir/source/main.cpp.o.d"
+  "CMakeFiles/metacall-thread-safe-test.dir/source/metacall_thread_safe_test.cpp.o"
+  "CMakeFiles/metacall-thread-safe-test.dir/source/metacall_thread_safe_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/metacall-thread-safe-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
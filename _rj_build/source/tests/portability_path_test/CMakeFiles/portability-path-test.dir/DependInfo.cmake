@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/source/tests/portability_path_test/source/main.cpp" "source/tests/portability_path_test/CMakeFiles/portability-path-test.dir/source/main.cpp.o" "gcc" "source/tests/portability_path_test/CMakeFiles/portability-path-test.dir/source/main.cpp.o.d"
+  "/root/repo/source/tests/portability_path_test/source/portability_path_test.cpp" "source/tests/portability_path_test/CMakeFiles/portability-path-test.dir/source/portability_path_test.cpp.o" "gcc" "source/tests/portability_path_test/CMakeFiles/portability-path-test.dir/source/portability_path_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rj_build/source/portability/CMakeFiles/portability.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../portability-path-testd"
+  "../../../portability-path-testd.pdb"
+  "CMakeFiles/portability-path-test.dir/source/main.cpp.o"
+  "CMakeFiles/portability-path-test.dir/source/main.cpp.o.d"
+  "CMakeFiles/portability-path-test.dir/source/portability_path_test.cpp.o"
+  "CMakeFiles/portability-path-test.dir/source/portability_path_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/portability-path-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
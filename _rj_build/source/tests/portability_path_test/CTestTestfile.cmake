@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/source/tests/portability_path_test
+# Build directory: /root/repo/_rj_build/source/tests/portability_path_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(portability-path-test "/root/repo/_rj_build/portability-path-testd")
+set_tests_properties(portability-path-test PROPERTIES  LABELS "portability-path-test" _BACKTRACE_TRIPLES "/root/repo/source/tests/portability_path_test/CMakeLists.txt;117;add_test;/root/repo/source/tests/portability_path_test/CMakeLists.txt;0;")
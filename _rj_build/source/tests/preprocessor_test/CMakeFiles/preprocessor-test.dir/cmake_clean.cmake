@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../preprocessor-testd"
+  "../../../preprocessor-testd.pdb"
+  "CMakeFiles/preprocessor-test.dir/source/main.cpp.o"
+  "CMakeFiles/preprocessor-test.dir/source/main.cpp.o.d"
+  "CMakeFiles/preprocessor-test.dir/source/preprocessor_test.cpp.o"
+  "CMakeFiles/preprocessor-test.dir/source/preprocessor_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/preprocessor-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
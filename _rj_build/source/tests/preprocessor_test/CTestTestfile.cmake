@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/source/tests/preprocessor_test
+# Build directory: /root/repo/_rj_build/source/tests/preprocessor_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(preprocessor-test "/root/repo/_rj_build/preprocessor-testd")
+set_tests_properties(preprocessor-test PROPERTIES  LABELS "preprocessor-test" _BACKTRACE_TRIPLES "/root/repo/source/tests/preprocessor_test/CMakeLists.txt;118;add_test;/root/repo/source/tests/preprocessor_test/CMakeLists.txt;0;")
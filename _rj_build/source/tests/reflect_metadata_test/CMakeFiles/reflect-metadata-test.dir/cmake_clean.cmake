@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../reflect-metadata-testd"
+  "../../../reflect-metadata-testd.pdb"
+  "CMakeFiles/reflect-metadata-test.dir/source/main.cpp.o"
+  "CMakeFiles/reflect-metadata-test.dir/source/main.cpp.o.d"
+  "CMakeFiles/reflect-metadata-test.dir/source/reflect_metadata_test.cpp.o"
+  "CMakeFiles/reflect-metadata-test.dir/source/reflect_metadata_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/reflect-metadata-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../../reflect-scope-testd"
+  "../../../reflect-scope-testd.pdb"
+  "CMakeFiles/reflect-scope-test.dir/source/main.cpp.o"
+  "CMakeFiles/reflect-scope-test.dir/source/main.cpp.o.d"
+  "CMakeFiles/reflect-scope-test.dir/source/reflect_scope_test.cpp.o"
+  "CMakeFiles/reflect-scope-test.dir/source/reflect_scope_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/reflect-scope-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
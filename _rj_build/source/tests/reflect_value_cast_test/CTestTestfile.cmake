@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/source/tests/reflect_value_cast_test
+# Build directory: /root/repo/_rj_build/source/tests/reflect_value_cast_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(reflect-value-cast-test "/root/repo/_rj_build/reflect-value-cast-testd")
+set_tests_properties(reflect-value-cast-test PROPERTIES  LABELS "reflect-value-cast-test" _BACKTRACE_TRIPLES "/root/repo/source/tests/reflect_value_cast_test/CMakeLists.txt;137;add_test;/root/repo/source/tests/reflect_value_cast_test/CMakeLists.txt;0;")
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/source/tests/serial_test
+# Build directory: /root/repo/_rj_build/source/tests/serial_test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(serial-test "/root/repo/_rj_build/serial-testd")
+set_tests_properties(serial-test PROPERTIES  ENVIRONMENT "SERIAL_LIBRARY_PATH=/root/repo/_rj_build" LABELS "serial-test" _BACKTRACE_TRIPLES "/root/repo/source/tests/serial_test/CMakeLists.txt;137;add_test;/root/repo/source/tests/serial_test/CMakeLists.txt;0;")
@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "../../libthreadingd.pdb"
+  "../../libthreadingd.so"
+  "CMakeFiles/threading.dir/source/threading.c.o"
+  "CMakeFiles/threading.dir/source/threading.c.o.d"
+  "CMakeFiles/threading.dir/source/threading_condition_pthread.c.o"
+  "CMakeFiles/threading.dir/source/threading_condition_pthread.c.o.d"
+  "CMakeFiles/threading.dir/source/threading_left_right.c.o"
+  "CMakeFiles/threading.dir/source/threading_left_right.c.o.d"
+  "CMakeFiles/threading.dir/source/threading_mutex_pthread.c.o"
+  "CMakeFiles/threading.dir/source/threading_mutex_pthread.c.o.d"
+  "CMakeFiles/threading.dir/source/threading_rwlock_pthread.c.o"
+  "CMakeFiles/threading.dir/source/threading_rwlock_pthread.c.o.d"
+  "CMakeFiles/threading.dir/source/threading_thread_id.c.o"
+  "CMakeFiles/threading.dir/source/threading_thread_id.c.o.d"
+  "CMakeFiles/threading.dir/source/threading_thread_pthread.c.o"
+  "CMakeFiles/threading.dir/source/threading_thread_pthread.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/threading.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,42 @@
+
+#ifndef VERSION_API_H
+#define VERSION_API_H
+
+#ifdef VERSION_STATIC_DEFINE
+#  define VERSION_API
+#  define VERSION_NO_EXPORT
+#else
+#  ifndef VERSION_API
+#    ifdef VERSION_EXPORTS
+        /* We are building this library */
+#      define VERSION_API __attribute__((visibility("default")))
+#    else
+        /* We are using this library */
+#      define VERSION_API __attribute__((visibility("default")))
+#    endif
+#  endif
+
+#  ifndef VERSION_NO_EXPORT
+#    define VERSION_NO_EXPORT __attribute__((visibility("hidden")))
+#  endif
+#endif
+
+#ifndef VERSION_DEPRECATED
+#  define VERSION_DEPRECATED __attribute__ ((__deprecated__))
+#endif
+
+#ifndef VERSION_DEPRECATED_EXPORT
+#  define VERSION_DEPRECATED_EXPORT VERSION_API VERSION_DEPRECATED
+#endif
+
+#ifndef VERSION_DEPRECATED_NO_EXPORT
+#  define VERSION_DEPRECATED_NO_EXPORT VERSION_NO_EXPORT VERSION_DEPRECATED
+#endif
+
+#if 0 /* DEFINE_NO_DEPRECATED */
+#  ifndef VERSION_NO_DEPRECATED
+#    define VERSION_NO_DEPRECATED
+#  endif
+#endif
+
+#endif /* VERSION_API_H */
@@ -23,6 +23,9 @@
 #include <log/log.h>
 #include <metacall/metacall_loaders.h>
 
+#include <cinttypes>
+#include <cstdio>
+
 static int stream_write(void *, const char *, const size_t)
 {
 	// Disable stream write so we do not count stdout on the benchmark
@@ -101,4 +104,197 @@ BENCHMARK_REGISTER_F(log_bench, call_va)
 	->Iterations(1)
 	->Repetitions(3);
 
+#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64)
+	#define LOG_BENCH_NULL_DEVICE "NUL"
+#else
+	#define LOG_BENCH_NULL_DEVICE "/dev/null"
+#endif
+
+static int64_t stream_null_flush_count = 0;
+
+static int stream_null_write(void *context, const char *buffer, const size_t size)
+{
+	size_t length = size > 0 ? size - 1 : 0;
+
+	return fwrite(buffer, 1, length, static_cast<FILE *>(context)) != length;
+}
+
+static int stream_null_flush(void *context)
+{
+	// Each flush of the stream issues a write system call
+	++stream_null_flush_count;
+
+	return fflush(static_cast<FILE *>(context));
+}
+
+class log_bench_storage : public benchmark::Fixture
+{
+public:
+	void SetUp(benchmark::State &state)
+	{
+		static FILE *null_stream = NULL;
+
+		if (null_stream == NULL)
+		{
+			null_stream = fopen(LOG_BENCH_NULL_DEVICE, "w");
+
+			if (null_stream == NULL)
+			{
+				state.SkipWithError("Error opening the null device");
+
+				return;
+			}
+
+			// Only the error records force a flush of the batch, info records are coalesced
+			if (log_configure("sequential",
+					log_policy_format_text(),
+					log_policy_schedule_sync(),
+					log_policy_storage_sequential(),
+					log_policy_stream_custom(null_stream, &stream_null_write, &stream_null_flush)) != 0 ||
+				log_configure("batch",
+					log_policy_format_text(),
+					log_policy_schedule_sync(),
+					log_policy_storage_batch_threshold(0x10000, LOG_LEVEL_ERROR, 1000),
+					log_policy_stream_custom(null_stream, &stream_null_write, &stream_null_flush)) != 0)
+			{
+				state.SkipWithError("Error creating the log");
+			}
+		}
+
+		stream_null_flush_count = 0;
+	}
+
+	void TearDown(benchmark::State &state)
+	{
+		state.counters["syscalls_per_record"] = benchmark::Counter(static_cast<double>(stream_null_flush_count) / static_cast<double>(state.items_processed()));
+	}
+};
+
+BENCHMARK_DEFINE_F(log_bench_storage, sequential)
+(benchmark::State &state)
+{
+	const int64_t call_count = 10000;
+
+	for (auto _ : state)
+	{
+		for (int64_t it = 0; it < call_count; ++it)
+		{
+			log_write("sequential", LOG_LEVEL_INFO, "Message %" PRId64, it);
+		}
+	}
+
+	state.SetLabel("Log Benchmark - Sequential Storage");
+	state.SetItemsProcessed(call_count);
+}
+
+BENCHMARK_REGISTER_F(log_bench_storage, sequential)
+	->Threads(1)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(3);
+
+BENCHMARK_DEFINE_F(log_bench_storage, batch)
+(benchmark::State &state)
+{
+	const int64_t call_count = 10000;
+
+	for (auto _ : state)
+	{
+		for (int64_t it = 0; it < call_count; ++it)
+		{
+			log_write("batch", LOG_LEVEL_INFO, "Message %" PRId64, it);
+		}
+	}
+
+	state.SetLabel("Log Benchmark - Batch Storage");
+	state.SetItemsProcessed(call_count);
+}
+
+BENCHMARK_REGISTER_F(log_bench_storage, batch)
+	->Threads(1)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(3);
+
+class log_bench_schedule : public benchmark::Fixture
+{
+public:
+	void SetUp(benchmark::State &state)
+	{
+		static bool configured = false;
+
+		if (state.thread_index() == 0 && configured == false)
+		{
+			// Both logs are configured once and shared by all the threads of each run
+			if (log_configure("sync",
+					log_policy_format_text(),
+					log_policy_schedule_sync(),
+					log_policy_storage_sequential(),
+					log_policy_stream_custom(NULL, &stream_write, &stream_flush)) != 0 ||
+				log_configure("async",
+					log_policy_format_text(),
+					log_policy_schedule_async_queue(0x1000, LOG_POLICY_SCHEDULE_ASYNC_OVERFLOW_BLOCK),
+					log_policy_storage_sequential(),
+					log_policy_stream_custom(NULL, &stream_write, &stream_flush)) != 0)
+			{
+				state.SkipWithError("Error creating the log");
+			}
+
+			configured = true;
+		}
+	}
+
+	void TearDown(benchmark::State &)
+	{
+	}
+};
+
+BENCHMARK_DEFINE_F(log_bench_schedule, sync)
+(benchmark::State &state)
+{
+	const int64_t call_count = 10000;
+
+	for (auto _ : state)
+	{
+		for (int64_t it = 0; it < call_count; ++it)
+		{
+			log_write("sync", LOG_LEVEL_ERROR, "Message %" PRId64, it);
+		}
+	}
+
+	state.SetLabel("Log Benchmark - Synchronous Schedule");
+	state.SetItemsProcessed(call_count);
+}
+
+BENCHMARK_REGISTER_F(log_bench_schedule, sync)
+	->ThreadRange(1, 8)
+	->UseRealTime()
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(3);
+
+BENCHMARK_DEFINE_F(log_bench_schedule, async)
+(benchmark::State &state)
+{
+	const int64_t call_count = 10000;
+
+	for (auto _ : state)
+	{
+		for (int64_t it = 0; it < call_count; ++it)
+		{
+			log_write("async", LOG_LEVEL_ERROR, "Message %" PRId64, it);
+		}
+	}
+
+	state.SetLabel("Log Benchmark - Asynchronous Schedule");
+	state.SetItemsProcessed(call_count);
+}
+
+BENCHMARK_REGISTER_F(log_bench_schedule, async)
+	->ThreadRange(1, 8)
+	->UseRealTime()
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(3);
+
 BENCHMARK_MAIN();
@@ -0,0 +1,180 @@
+/*
+ *	MetaCall Library by Parra Studios
+ *	A library for providing a foreign function interface calls.
+ *
+ *	Copyright (C) 2016 - 2022 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <metacall/metacall.h>
+#include <metacall/metacall_loaders.h>
+
+#include <cstdio>
+#include <string>
+
+/* Number of functions of the generated plugin, all of them go through Clang and TCC */
+static const int function_count = 64;
+
+/* Write a C plugin into the script directory, the seed changes the contents (and the cache key) */
+static std::string metacall_c_init_bench_source(const char *name, int seed)
+{
+	std::string path = std::string(METACALL_C_INIT_BENCH_SCRIPT_PATH) + "/" + name + ".c";
+	FILE *file = fopen(path.c_str(), "w");
+
+	if (file == NULL)
+	{
+		return std::string();
+	}
+
+	fprintf(file, "/* Seed: %d */\n#include <stdio.h>\n#include <string.h>\n\n", seed);
+
+	for (int iterator = 0; iterator < function_count; ++iterator)
+	{
+		fprintf(file,
+			"long %s_%d(long left, long right, double factor)\n"
+			"{\n"
+			"\treturn (long)((left * %d + right) * factor);\n"
+			"}\n\n",
+			name, iterator, iterator);
+	}
+
+	fclose(file);
+
+	return path;
+}
+
+static int metacall_c_init_bench_load(const std::string &path)
+{
+	const char *paths[] = {
+		path.c_str()
+	};
+
+	void *handle = NULL;
+
+	if (metacall_load_from_file("c", paths, sizeof(paths) / sizeof(paths[0]), &handle) != 0)
+	{
+		return 1;
+	}
+
+	return metacall_clear(handle);
+}
+
+class metacall_c_init_bench : public benchmark::Fixture
+{
+public:
+};
+
+BENCHMARK_DEFINE_F(metacall_c_init_bench, load_cold)
+(benchmark::State &state)
+{
+	static int seed = 0;
+
+	for (auto _ : state)
+	{
+/* C */
+#if defined(OPTION_BUILD_LOADERS_C)
+		{
+			state.PauseTiming();
+
+			/* Every iteration generates new contents, so the loader misses the cache and has to
+			parse with Clang, compile with TCC and store the object and signatures */
+			std::string path = metacall_c_init_bench_source("c_init_cold", seed++);
+
+			state.ResumeTiming();
+
+			if (path.empty() || metacall_c_init_bench_load(path) != 0)
+			{
+				state.SkipWithError("Error loading the cold C plugin");
+			}
+		}
+#endif /* OPTION_BUILD_LOADERS_C */
+	}
+
+	state.SetLabel("MetaCall C Init Benchmark - Load Cold Cache");
+}
+
+BENCHMARK_REGISTER_F(metacall_c_init_bench, load_cold)
+	->Threads(1)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(3);
+
+BENCHMARK_DEFINE_F(metacall_c_init_bench, load_warm)
+(benchmark::State &state)
+{
+	for (auto _ : state)
+	{
+/* C */
+#if defined(OPTION_BUILD_LOADERS_C)
+		{
+			state.PauseTiming();
+
+			/* The contents are always the same, populate the cache before measuring */
+			std::string path = metacall_c_init_bench_source("c_init_warm", 0);
+
+			if (path.empty() || metacall_c_init_bench_load(path) != 0)
+			{
+				state.SkipWithError("Error populating the C loader cache");
+			}
+
+			state.ResumeTiming();
+
+			if (metacall_c_init_bench_load(path) != 0)
+			{
+				state.SkipWithError("Error loading the warm C plugin");
+			}
+		}
+#endif /* OPTION_BUILD_LOADERS_C */
+	}
+
+	state.SetLabel("MetaCall C Init Benchmark - Load Warm Cache");
+}
+
+BENCHMARK_REGISTER_F(metacall_c_init_bench, load_warm)
+	->Threads(1)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(3);
+
+int main(int argc, char *argv[])
+{
+	metacall_print_info();
+
+	metacall_log_null();
+
+	if (metacall_initialize() != 0)
+	{
+		return 1;
+	}
+
+	::benchmark::Initialize(&argc, argv);
+
+	if (::benchmark::ReportUnrecognizedArguments(argc, argv))
+	{
+		return 2;
+	}
+
+	::benchmark::RunSpecifiedBenchmarks();
+	::benchmark::Shutdown();
+
+	if (metacall_destroy() != 0)
+	{
+		return 3;
+	}
+
+	return 0;
+}
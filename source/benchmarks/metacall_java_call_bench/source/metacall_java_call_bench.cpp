@@ -0,0 +1,271 @@
+/*
+ *	MetaCall Library by Parra Studios
+ *	A library for providing a foreign function interface calls.
+ *
+ *	Copyright (C) 2016 - 2022 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <metacall/metacall.h>
+#include <metacall/metacall_loaders.h>
+
+class metacall_java_call_bench : public benchmark::Fixture
+{
+public:
+};
+
+BENCHMARK_DEFINE_F(metacall_java_call_bench, call_array_args)
+(benchmark::State &state)
+{
+	const int64_t call_count = 500000;
+	const int64_t call_size = sizeof(int) * 2; // (int) -> int
+
+	for (auto _ : state)
+	{
+/* Java */
+#if defined(OPTION_BUILD_LOADERS_JAVA)
+		{
+			state.PauseTiming();
+
+			void *cls = metacall_class("Fibonacci");
+
+			void *args[1] = {
+				metacall_value_create_int(1)
+			};
+
+			state.ResumeTiming();
+
+			for (int64_t it = 0; it < call_count; ++it)
+			{
+				void *ret = metacallv_class(cls, "fib_impl", args, sizeof(args) / sizeof(args[0]));
+
+				state.PauseTiming();
+
+				if (ret == NULL)
+				{
+					state.SkipWithError("Null return value from fib_impl");
+				}
+
+				if (metacall_value_to_int(ret) != 1)
+				{
+					state.SkipWithError("Invalid return value from fib_impl");
+				}
+
+				metacall_value_destroy(ret);
+
+				state.ResumeTiming();
+			}
+
+			state.PauseTiming();
+
+			for (auto arg : args)
+			{
+				metacall_value_destroy(arg);
+			}
+
+			state.ResumeTiming();
+		}
+#endif /* OPTION_BUILD_LOADERS_JAVA */
+	}
+
+	state.SetLabel("MetaCall Java Call Benchmark - Array Argument Call");
+	state.SetBytesProcessed(call_size * call_count);
+	state.SetItemsProcessed(call_count);
+}
+
+BENCHMARK_REGISTER_F(metacall_java_call_bench, call_array_args)
+	->Threads(1)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(5);
+
+BENCHMARK_DEFINE_F(metacall_java_call_bench, call_typed_args)
+(benchmark::State &state)
+{
+	const int64_t call_count = 500000;
+	const int64_t call_size = sizeof(int) * 2; // (int) -> int
+
+	for (auto _ : state)
+	{
+/* Java */
+#if defined(OPTION_BUILD_LOADERS_JAVA)
+		{
+			state.PauseTiming();
+
+			void *cls = metacall_class("Fibonacci");
+
+			void *args[1] = {
+				metacall_value_create_int(1)
+			};
+
+			state.ResumeTiming();
+
+			for (int64_t it = 0; it < call_count; ++it)
+			{
+				void *ret = metacallt_class(cls, "fib_impl", METACALL_INT, args, sizeof(args) / sizeof(args[0]));
+
+				state.PauseTiming();
+
+				if (ret == NULL)
+				{
+					state.SkipWithError("Null return value from fib_impl");
+				}
+
+				if (metacall_value_to_int(ret) != 1)
+				{
+					state.SkipWithError("Invalid return value from fib_impl");
+				}
+
+				metacall_value_destroy(ret);
+
+				state.ResumeTiming();
+			}
+
+			state.PauseTiming();
+
+			for (auto arg : args)
+			{
+				metacall_value_destroy(arg);
+			}
+
+			state.ResumeTiming();
+		}
+#endif /* OPTION_BUILD_LOADERS_JAVA */
+	}
+
+	state.SetLabel("MetaCall Java Call Benchmark - Typed Argument Call");
+	state.SetBytesProcessed(call_size * call_count);
+	state.SetItemsProcessed(call_count);
+}
+
+BENCHMARK_REGISTER_F(metacall_java_call_bench, call_typed_args)
+	->Threads(1)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(5);
+
+BENCHMARK_DEFINE_F(metacall_java_call_bench, call_array_args_threads)
+(benchmark::State &state)
+{
+	const int64_t call_count = 100000;
+	const int64_t call_size = sizeof(int) * 2; // (int) -> int
+
+	for (auto _ : state)
+	{
+/* Java */
+#if defined(OPTION_BUILD_LOADERS_JAVA)
+		{
+			state.PauseTiming();
+
+			void *cls = metacall_class("Fibonacci");
+
+			void *args[1] = {
+				metacall_value_create_int(1)
+			};
+
+			state.ResumeTiming();
+
+			/* Each thread is attached to the JVM on its first call and runs concurrently with the others */
+			for (int64_t it = 0; it < call_count; ++it)
+			{
+				void *ret = metacallv_class(cls, "fib_impl", args, sizeof(args) / sizeof(args[0]));
+
+				if (ret == NULL)
+				{
+					state.SkipWithError("Null return value from fib_impl");
+					break;
+				}
+
+				if (metacall_value_to_int(ret) != 1)
+				{
+					state.SkipWithError("Invalid return value from fib_impl");
+				}
+
+				metacall_value_destroy(ret);
+			}
+
+			state.PauseTiming();
+
+			for (auto arg : args)
+			{
+				metacall_value_destroy(arg);
+			}
+
+			state.ResumeTiming();
+		}
+#endif /* OPTION_BUILD_LOADERS_JAVA */
+	}
+
+	state.SetLabel("MetaCall Java Call Benchmark - Array Argument Call (Multiple Threads)");
+	state.SetBytesProcessed(call_size * call_count);
+	state.SetItemsProcessed(call_count);
+}
+
+BENCHMARK_REGISTER_F(metacall_java_call_bench, call_array_args_threads)
+	->Threads(1)
+	->Threads(2)
+	->Threads(4)
+	->Threads(8)
+	->UseRealTime()
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(3);
+
+/* BENCHMARK_MAIN(); */
+
+int main(int argc, char **argv)
+{
+	::benchmark::Initialize(&argc, argv);
+
+	if (::benchmark::ReportUnrecognizedArguments(argc, argv))
+	{
+		return 1;
+	}
+
+	/* The JVM cannot be created again once it has been destroyed in the same process, */
+	/* so MetaCall is initialized once here instead of using SetUp and TearDown in the Fixture */
+
+	metacall_print_info();
+
+	metacall_log_null();
+
+	if (metacall_initialize() != 0)
+	{
+		return 1;
+	}
+
+/* Java */
+#if defined(OPTION_BUILD_LOADERS_JAVA)
+	{
+		static const char tag[] = "java";
+
+		const char *java_scripts[] = {
+			"Fibonacci.java"
+		};
+
+		if (metacall_load_from_file(tag, java_scripts, sizeof(java_scripts) / sizeof(java_scripts[0]), NULL) != 0)
+		{
+			metacall_destroy();
+			return 1;
+		}
+	}
+#endif /* OPTION_BUILD_LOADERS_JAVA */
+
+	::benchmark::RunSpecifiedBenchmarks();
+
+	return metacall_destroy();
+}
@@ -0,0 +1,179 @@
+/*
+ *	MetaCall Library by Parra Studios
+ *	A library for providing a foreign function interface calls.
+ *
+ *	Copyright (C) 2016 - 2022 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <metacall/metacall.h>
+#include <metacall/metacall_loaders.h>
+
+#include <string>
+
+static int64_t handle_count = 0;
+
+#if !defined(OPTION_BUILD_LOADERS_PY)
+static void *host_symbol(size_t, void *[], void *)
+{
+	return metacall_value_create_long(0L);
+}
+#endif /* OPTION_BUILD_LOADERS_PY */
+
+/* Loads handles until there are count of them, each one exports a single function named symbol_<index> */
+static int load_handles(int64_t count)
+{
+	for (; handle_count < count; ++handle_count)
+	{
+		std::string name = "symbol_" + std::to_string(handle_count);
+
+/* Python */
+#if defined(OPTION_BUILD_LOADERS_PY)
+		{
+			std::string script = "def " + name + "():\n\treturn 0\n";
+
+			if (metacall_load_from_memory("py", script.c_str(), script.size() + 1, NULL) != 0)
+			{
+				return 1;
+			}
+		}
+#else
+		{
+			if (metacall_register(name.c_str(), host_symbol, NULL, METACALL_LONG, 0) != 0)
+			{
+				return 1;
+			}
+		}
+#endif /* OPTION_BUILD_LOADERS_PY */
+	}
+
+	return 0;
+}
+
+class metacall_lookup_bench : public benchmark::Fixture
+{
+public:
+	void SetUp(benchmark::State &state)
+	{
+		if (load_handles(state.range(0)) != 0)
+		{
+			state.SkipWithError("Error loading the handles");
+		}
+	}
+};
+
+BENCHMARK_DEFINE_F(metacall_lookup_bench, lookup_hit)
+(benchmark::State &state)
+{
+	const int64_t call_count = 1000000;
+	const std::string name = "symbol_" + std::to_string(state.range(0) - 1);
+
+	for (auto _ : state)
+	{
+		for (int64_t it = 0; it < call_count; ++it)
+		{
+			void *func = metacall_function(name.c_str());
+
+			if (func == NULL)
+			{
+				state.SkipWithError("Symbol not found");
+			}
+
+			benchmark::DoNotOptimize(func);
+		}
+	}
+
+	state.SetLabel("MetaCall Lookup Benchmark - Existing Symbol");
+	state.SetItemsProcessed(call_count);
+}
+
+BENCHMARK_REGISTER_F(metacall_lookup_bench, lookup_hit)
+	->Threads(1)
+	->Unit(benchmark::kMillisecond)
+	->RangeMultiplier(4)
+	->Range(1, 256)
+	->Iterations(1)
+	->Repetitions(3);
+
+BENCHMARK_DEFINE_F(metacall_lookup_bench, lookup_miss)
+(benchmark::State &state)
+{
+	const int64_t call_count = 1000000;
+
+	for (auto _ : state)
+	{
+		for (int64_t it = 0; it < call_count; ++it)
+		{
+			void *func = metacall_function("symbol_not_found");
+
+			if (func != NULL)
+			{
+				state.SkipWithError("Symbol found");
+			}
+
+			benchmark::DoNotOptimize(func);
+		}
+	}
+
+	state.SetLabel("MetaCall Lookup Benchmark - Non Existing Symbol");
+	state.SetItemsProcessed(call_count);
+}
+
+BENCHMARK_REGISTER_F(metacall_lookup_bench, lookup_miss)
+	->Threads(1)
+	->Unit(benchmark::kMillisecond)
+	->RangeMultiplier(4)
+	->Range(1, 256)
+	->Iterations(1)
+	->Repetitions(3);
+
+int main(int argc, char *argv[])
+{
+	metacall_print_info();
+
+	metacall_log_null();
+
+	if (metacall_initialize() != 0)
+	{
+		return 1;
+	}
+
+	/* Initialize as many loaders as possible so the lookup has to deal with all of them */
+	static const char script[] = "<mock>";
+
+	if (metacall_load_from_memory("mock", script, sizeof(script), NULL) != 0)
+	{
+		return 2;
+	}
+
+	::benchmark::Initialize(&argc, argv);
+
+	if (::benchmark::ReportUnrecognizedArguments(argc, argv))
+	{
+		return 3;
+	}
+
+	::benchmark::RunSpecifiedBenchmarks();
+	::benchmark::Shutdown();
+
+	if (metacall_destroy() != 0)
+	{
+		return 4;
+	}
+
+	return 0;
+}
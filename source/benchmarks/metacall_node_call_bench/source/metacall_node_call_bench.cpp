@@ -147,6 +147,149 @@ BENCHMARK_REGISTER_F(metacall_node_call_bench, call_array_args)
 	->Iterations(1)
 	->Repetitions(3);
 
+BENCHMARK_DEFINE_F(metacall_node_call_bench, call_array_args_threads)
+(benchmark::State &state)
+{
+	const int64_t call_count = 100000;
+	const int64_t call_size = sizeof(double) * 3; // (double, double) -> double
+
+	for (auto _ : state)
+	{
+/* NodeJS */
+#if defined(OPTION_BUILD_LOADERS_NODE)
+		{
+			state.PauseTiming();
+
+			void *args[2] = {
+				metacall_value_create_double(0.0),
+				metacall_value_create_double(0.0)
+			};
+
+			state.ResumeTiming();
+
+			/* All the threads submit their calls concurrently into the event loop of NodeJS */
+			for (int64_t it = 0; it < call_count; ++it)
+			{
+				void *ret = metacallv_s("int_mem_type", args, sizeof(args) / sizeof(args[0]));
+
+				if (ret == NULL)
+				{
+					state.SkipWithError("Null return value from int_mem_type");
+					break;
+				}
+
+				if (metacall_value_to_double(ret) != 0.0)
+				{
+					state.SkipWithError("Invalid return value from int_mem_type");
+				}
+
+				metacall_value_destroy(ret);
+			}
+
+			state.PauseTiming();
+
+			for (auto arg : args)
+			{
+				metacall_value_destroy(arg);
+			}
+
+			state.ResumeTiming();
+		}
+#endif /* OPTION_BUILD_LOADERS_NODE */
+	}
+
+	state.SetLabel("MetaCall NodeJS Call Benchmark - Array Argument Call (Multiple Threads)");
+	state.SetBytesProcessed(call_size * call_count);
+	state.SetItemsProcessed(call_count);
+}
+
+BENCHMARK_REGISTER_F(metacall_node_call_bench, call_array_args_threads)
+	->Threads(1)
+	->Threads(2)
+	->Threads(4)
+	->Threads(8)
+	->UseRealTime()
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(3);
+
+BENCHMARK_DEFINE_F(metacall_node_call_bench, call_prepared_args)
+(benchmark::State &state)
+{
+	const int64_t call_count = 100000;
+	const int64_t call_size = sizeof(double) * 3; // (double, double) -> double
+
+	for (auto _ : state)
+	{
+/* NodeJS */
+#if defined(OPTION_BUILD_LOADERS_NODE)
+		{
+			state.PauseTiming();
+
+			const enum metacall_value_id ids[] = {
+				METACALL_DOUBLE, METACALL_DOUBLE
+			};
+
+			void *prepared = metacall_prepare(metacall_function("int_mem_type"), ids, sizeof(ids) / sizeof(ids[0]));
+
+			if (prepared == NULL)
+			{
+				state.SkipWithError("Invalid prepared call of int_mem_type");
+			}
+
+			void *args[2] = {
+				metacall_value_create_double(0.0),
+				metacall_value_create_double(0.0)
+			};
+
+			state.ResumeTiming();
+
+			for (int64_t it = 0; it < call_count; ++it)
+			{
+				void *ret = metacall_prepared_call(prepared, args);
+
+				state.PauseTiming();
+
+				if (ret == NULL)
+				{
+					state.SkipWithError("Null return value from int_mem_type");
+				}
+
+				if (metacall_value_to_double(ret) != 0.0)
+				{
+					state.SkipWithError("Invalid return value from int_mem_type");
+				}
+
+				metacall_value_destroy(ret);
+
+				state.ResumeTiming();
+			}
+
+			state.PauseTiming();
+
+			for (auto arg : args)
+			{
+				metacall_value_destroy(arg);
+			}
+
+			metacall_prepared_destroy(prepared);
+
+			state.ResumeTiming();
+		}
+#endif /* OPTION_BUILD_LOADERS_NODE */
+	}
+
+	state.SetLabel("MetaCall NodeJS Call Benchmark - Prepared Call");
+	state.SetBytesProcessed(call_size * call_count);
+	state.SetItemsProcessed(call_count);
+}
+
+BENCHMARK_REGISTER_F(metacall_node_call_bench, call_prepared_args)
+	->Threads(1)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(3);
+
 BENCHMARK_DEFINE_F(metacall_node_call_bench, call_async)
 (benchmark::State &state)
 {
@@ -150,4 +150,69 @@ BENCHMARK_REGISTER_F(metacall_py_c_api_bench, call_object)
 	->Iterations(1)
 	->Repetitions(5);
 
+/* Vectorcall is available since Python 3.8, this is the baseline of the fast path of the Python Loader */
+#if PY_VERSION_HEX >= 0x03080000
+	#if PY_VERSION_HEX < 0x03090000
+		#define PyObject_Vectorcall _PyObject_Vectorcall
+	#endif
+
+BENCHMARK_DEFINE_F(metacall_py_c_api_bench, call_vectorcall)
+(benchmark::State &state)
+{
+	const int64_t call_count = 1000000;
+	const int64_t call_size = sizeof(long) * 3; // (long, long) -> long
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+
+		PyObject *args[3] = {
+			NULL,
+			PyLong_FromLong(0L),
+			PyLong_FromLong(0L)
+		};
+
+		state.ResumeTiming();
+
+		for (int64_t it = 0; it < call_count; ++it)
+		{
+			PyObject *ret = PyObject_Vectorcall(func, &args[1], 2 | PY_VECTORCALL_ARGUMENTS_OFFSET, NULL);
+
+			state.PauseTiming();
+
+			if (ret == NULL)
+			{
+				state.SkipWithError("Null return value from int_mem_type");
+			}
+
+			if (PyLong_AsLong(ret) != 0L)
+			{
+				state.SkipWithError("Invalid return value from int_mem_type");
+			}
+
+			Py_DECREF(ret);
+
+			state.ResumeTiming();
+		}
+
+		state.PauseTiming();
+
+		Py_DECREF(args[1]);
+		Py_DECREF(args[2]);
+
+		state.ResumeTiming();
+	}
+
+	state.SetLabel("MetaCall Python C API Benchmark - Vectorcall");
+	state.SetBytesProcessed(call_size * call_count);
+	state.SetItemsProcessed(call_count);
+}
+
+BENCHMARK_REGISTER_F(metacall_py_c_api_bench, call_vectorcall)
+	->Threads(1)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(5);
+#endif
+
 BENCHMARK_MAIN();
@@ -23,6 +23,16 @@
 #include <metacall/metacall.h>
 #include <metacall/metacall_loaders.h>
 
+#include <cstdint>
+
+#if defined(__unix__)
+	#include <dlfcn.h>
+#endif
+
+/* Counter of the allocations done by the whole process, it is provided by a library preloaded */
+/* in the benchmark test, when running the benchmark without it the allocations are not reported */
+static uint64_t (*malloc_count)(void) = NULL;
+
 class metacall_py_call_bench : public benchmark::Fixture
 {
 public:
@@ -39,6 +49,8 @@ BENCHMARK_DEFINE_F(metacall_py_call_bench, call_va_args)
 /* Python */
 #if defined(OPTION_BUILD_LOADERS_PY)
 		{
+			uint64_t allocations = malloc_count != NULL ? malloc_count() : 0;
+
 			for (int64_t it = 0; it < call_count; ++it)
 			{
 				void *ret = metacall("int_mem_type", 0L, 0L);
@@ -59,6 +71,11 @@ BENCHMARK_DEFINE_F(metacall_py_call_bench, call_va_args)
 
 				state.ResumeTiming();
 			}
+
+			if (malloc_count != NULL)
+			{
+				state.counters["mallocs_per_call"] = (double)(malloc_count() - allocations) / call_count;
+			}
 		}
 #endif /* OPTION_BUILD_LOADERS_PY */
 	}
@@ -92,6 +109,8 @@ BENCHMARK_DEFINE_F(metacall_py_call_bench, call_array_args)
 				metacall_value_create_long(0L)
 			};
 
+			uint64_t allocations = malloc_count != NULL ? malloc_count() : 0;
+
 			state.ResumeTiming();
 
 			for (int64_t it = 0; it < call_count; ++it)
@@ -117,6 +136,11 @@ BENCHMARK_DEFINE_F(metacall_py_call_bench, call_array_args)
 
 			state.PauseTiming();
 
+			if (malloc_count != NULL)
+			{
+				state.counters["mallocs_per_call"] = (double)(malloc_count() - allocations) / call_count;
+			}
+
 			for (auto arg : args)
 			{
 				metacall_value_destroy(arg);
@@ -138,6 +162,223 @@ BENCHMARK_REGISTER_F(metacall_py_call_bench, call_array_args)
 	->Iterations(1)
 	->Repetitions(5);
 
+BENCHMARK_DEFINE_F(metacall_py_call_bench, call_array_args_threads)
+(benchmark::State &state)
+{
+	const int64_t call_count = 100000;
+	const int64_t call_size = sizeof(long) * 3; // (long, long) -> long
+
+	for (auto _ : state)
+	{
+/* Python */
+#if defined(OPTION_BUILD_LOADERS_PY)
+		{
+			state.PauseTiming();
+
+			void *args[2] = {
+				metacall_value_create_long(0L),
+				metacall_value_create_long(0L)
+			};
+
+			state.ResumeTiming();
+
+			/* All the threads enter into Python concurrently, with the GIL they are serialized, */
+			/* while free-threaded builds of Python run them in parallel */
+			for (int64_t it = 0; it < call_count; ++it)
+			{
+				void *ret = metacallv_s("int_mem_type", args, sizeof(args) / sizeof(args[0]));
+
+				if (ret == NULL)
+				{
+					state.SkipWithError("Null return value from int_mem_type");
+					break;
+				}
+
+				if (metacall_value_to_long(ret) != 0L)
+				{
+					state.SkipWithError("Invalid return value from int_mem_type");
+				}
+
+				metacall_value_destroy(ret);
+			}
+
+			state.PauseTiming();
+
+			for (auto arg : args)
+			{
+				metacall_value_destroy(arg);
+			}
+
+			state.ResumeTiming();
+		}
+#endif /* OPTION_BUILD_LOADERS_PY */
+	}
+
+	state.SetLabel("MetaCall Python Call Benchmark - Array Argument Call (Multiple Threads)");
+	state.SetBytesProcessed(call_size * call_count);
+	state.SetItemsProcessed(call_count);
+}
+
+BENCHMARK_REGISTER_F(metacall_py_call_bench, call_array_args_threads)
+	->Threads(1)
+	->Threads(2)
+	->Threads(4)
+	->Threads(8)
+	->UseRealTime()
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(3);
+
+BENCHMARK_DEFINE_F(metacall_py_call_bench, call_blocking_threads)
+(benchmark::State &state)
+{
+	const int64_t call_count = 200;
+	const int64_t call_size = sizeof(long) * 2; // (long) -> long
+
+	for (auto _ : state)
+	{
+/* Python */
+#if defined(OPTION_BUILD_LOADERS_PY)
+		{
+			state.PauseTiming();
+
+			void *args[1] = {
+				metacall_value_create_long(1L)
+			};
+
+			state.ResumeTiming();
+
+			/* The function blocks for a millisecond releasing the GIL (as I/O or native extensions do), */
+			/* so the calls of different threads overlap and the throughput grows with the number of threads */
+			for (int64_t it = 0; it < call_count; ++it)
+			{
+				void *ret = metacallv_s("blocking_mem_type", args, sizeof(args) / sizeof(args[0]));
+
+				if (ret == NULL)
+				{
+					state.SkipWithError("Null return value from blocking_mem_type");
+					break;
+				}
+
+				if (metacall_value_to_long(ret) != 1L)
+				{
+					state.SkipWithError("Invalid return value from blocking_mem_type");
+				}
+
+				metacall_value_destroy(ret);
+			}
+
+			state.PauseTiming();
+
+			for (auto arg : args)
+			{
+				metacall_value_destroy(arg);
+			}
+
+			state.ResumeTiming();
+		}
+#endif /* OPTION_BUILD_LOADERS_PY */
+	}
+
+	state.SetLabel("MetaCall Python Call Benchmark - Blocking Call (Multiple Threads)");
+	state.SetBytesProcessed(call_size * call_count);
+	state.SetItemsProcessed(call_count);
+}
+
+BENCHMARK_REGISTER_F(metacall_py_call_bench, call_blocking_threads)
+	->Threads(1)
+	->Threads(2)
+	->Threads(4)
+	->Threads(8)
+	->UseRealTime()
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(3);
+
+BENCHMARK_DEFINE_F(metacall_py_call_bench, call_prepared_args)
+(benchmark::State &state)
+{
+	const int64_t call_count = 1000000;
+	const int64_t call_size = sizeof(long) * 3; // (long, long) -> long
+
+	for (auto _ : state)
+	{
+/* Python */
+#if defined(OPTION_BUILD_LOADERS_PY)
+		{
+			state.PauseTiming();
+
+			const enum metacall_value_id ids[] = {
+				METACALL_LONG, METACALL_LONG
+			};
+
+			void *prepared = metacall_prepare(metacall_function("int_mem_type"), ids, sizeof(ids) / sizeof(ids[0]));
+
+			if (prepared == NULL)
+			{
+				state.SkipWithError("Invalid prepared call of int_mem_type");
+			}
+
+			void *args[2] = {
+				metacall_value_create_long(0L),
+				metacall_value_create_long(0L)
+			};
+
+			uint64_t allocations = malloc_count != NULL ? malloc_count() : 0;
+
+			state.ResumeTiming();
+
+			for (int64_t it = 0; it < call_count; ++it)
+			{
+				void *ret = metacall_prepared_call(prepared, args);
+
+				state.PauseTiming();
+
+				if (ret == NULL)
+				{
+					state.SkipWithError("Null return value from int_mem_type");
+				}
+
+				if (metacall_value_to_long(ret) != 0L)
+				{
+					state.SkipWithError("Invalid return value from int_mem_type");
+				}
+
+				metacall_value_destroy(ret);
+
+				state.ResumeTiming();
+			}
+
+			state.PauseTiming();
+
+			if (malloc_count != NULL)
+			{
+				state.counters["mallocs_per_call"] = (double)(malloc_count() - allocations) / call_count;
+			}
+
+			for (auto arg : args)
+			{
+				metacall_value_destroy(arg);
+			}
+
+			metacall_prepared_destroy(prepared);
+
+			state.ResumeTiming();
+		}
+#endif /* OPTION_BUILD_LOADERS_PY */
+	}
+
+	state.SetLabel("MetaCall Python Call Benchmark - Prepared Call");
+	state.SetBytesProcessed(call_size * call_count);
+	state.SetItemsProcessed(call_count);
+}
+
+BENCHMARK_REGISTER_F(metacall_py_call_bench, call_prepared_args)
+	->Threads(1)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(5);
+
 /* Use main for initializing MetaCall once. There's a bug in Python async which prevents reinitialization */
 /* https://github.com/python/cpython/issues/89425 */
 /* https://bugs.python.org/issue45262 */
@@ -153,6 +394,10 @@ int main(int argc, char *argv[])
 		return 1;
 	}
 
+#if defined(__unix__)
+	malloc_count = reinterpret_cast<uint64_t (*)(void)>(dlsym(RTLD_DEFAULT, "metacall_py_call_bench_malloc_count"));
+#endif
+
 /* Python */
 #if defined(OPTION_BUILD_LOADERS_PY)
 	{
@@ -167,6 +412,18 @@ int main(int argc, char *argv[])
 		{
 			return 2;
 		}
+
+		static const char blocking_mem_type[] =
+			"#!/usr/bin/env python3\n"
+			"import time\n"
+			"def blocking_mem_type(value: int) -> int:\n"
+			"\ttime.sleep(0.001)\n"
+			"\treturn value;";
+
+		if (metacall_load_from_memory(tag, blocking_mem_type, sizeof(blocking_mem_type), NULL) != 0)
+		{
+			return 2;
+		}
 	}
 #endif /* OPTION_BUILD_LOADERS_PY */
 
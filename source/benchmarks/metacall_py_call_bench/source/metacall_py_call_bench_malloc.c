@@ -0,0 +1,43 @@
+/*
+ *	MetaCall Library by Parra Studios
+ *	A library for providing a foreign function interface calls.
+ *
+ *	Copyright (C) 2016 - 2022 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Count the calls to malloc of the whole process, including the ones done by MetaCall and Python. */
+/* This library is preloaded only when running the benchmark, so no other target gets its allocator replaced */
+#if defined(__GLIBC__)
+extern void *__libc_malloc(size_t size);
+
+static atomic_uint_fast64_t malloc_count = 0;
+
+void *malloc(size_t size)
+{
+	atomic_fetch_add_explicit(&malloc_count, 1, memory_order_relaxed);
+
+	return __libc_malloc(size);
+}
+
+uint64_t metacall_py_call_bench_malloc_count(void)
+{
+	return (uint64_t)atomic_load_explicit(&malloc_count, memory_order_relaxed);
+}
+#endif
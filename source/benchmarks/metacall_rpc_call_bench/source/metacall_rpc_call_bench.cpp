@@ -0,0 +1,278 @@
+/*
+ *	MetaCall Library by Parra Studios
+ *	A library for providing a foreign function interface calls.
+ *
+ *	Copyright (C) 2016 - 2022 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <metacall/metacall.h>
+#include <metacall/metacall_loaders.h>
+
+#include <vector>
+
+class metacall_rpc_call_bench : public benchmark::Fixture
+{
+public:
+};
+
+BENCHMARK_DEFINE_F(metacall_rpc_call_bench, call_latency)
+(benchmark::State &state)
+{
+	const int64_t call_count = 1000;
+	const int64_t call_size = sizeof(long) * 3; // (long, long) -> long
+
+	for (auto _ : state)
+	{
+/* RPC */
+#if defined(OPTION_BUILD_LOADERS_RPC)
+		{
+			state.PauseTiming();
+
+			void *args[2] = {
+				metacall_value_create_long(3L),
+				metacall_value_create_long(4L)
+			};
+
+			state.ResumeTiming();
+
+			for (int64_t it = 0; it < call_count; ++it)
+			{
+				void *ret = metacallv("sum", args);
+
+				state.PauseTiming();
+
+				if (ret == NULL)
+				{
+					state.SkipWithError("Null return value from sum");
+				}
+
+				if (metacall_value_cast_long(&ret) != 7L)
+				{
+					state.SkipWithError("Invalid return value from sum");
+				}
+
+				metacall_value_destroy(ret);
+
+				state.ResumeTiming();
+			}
+
+			state.PauseTiming();
+
+			for (auto arg : args)
+			{
+				metacall_value_destroy(arg);
+			}
+
+			state.ResumeTiming();
+		}
+#endif /* OPTION_BUILD_LOADERS_RPC */
+	}
+
+	state.SetLabel("MetaCall RPC Call Benchmark - Sequential Call Latency");
+	state.SetBytesProcessed(call_size * call_count);
+	state.SetItemsProcessed(call_count);
+}
+
+BENCHMARK_REGISTER_F(metacall_rpc_call_bench, call_latency)
+	->Threads(1)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(5);
+
+BENCHMARK_DEFINE_F(metacall_rpc_call_bench, call_throughput)
+(benchmark::State &state)
+{
+	const int64_t call_count = 1000;
+	const int64_t call_size = sizeof(long) * 3; // (long, long) -> long
+
+	for (auto _ : state)
+	{
+/* RPC */
+#if defined(OPTION_BUILD_LOADERS_RPC)
+		{
+			state.PauseTiming();
+
+			void *args[2] = {
+				metacall_value_create_long(3L),
+				metacall_value_create_long(4L)
+			};
+
+			state.ResumeTiming();
+
+			/* Each thread keeps one request in flight, sharing the connections of the loader pool */
+			for (int64_t it = 0; it < call_count; ++it)
+			{
+				void *ret = metacallv("sum", args);
+
+				if (ret == NULL)
+				{
+					state.SkipWithError("Null return value from sum");
+					break;
+				}
+
+				if (metacall_value_cast_long(&ret) != 7L)
+				{
+					state.SkipWithError("Invalid return value from sum");
+				}
+
+				metacall_value_destroy(ret);
+			}
+
+			state.PauseTiming();
+
+			for (auto arg : args)
+			{
+				metacall_value_destroy(arg);
+			}
+
+			state.ResumeTiming();
+		}
+#endif /* OPTION_BUILD_LOADERS_RPC */
+	}
+
+	state.SetLabel("MetaCall RPC Call Benchmark - Concurrent Call Throughput");
+	state.SetBytesProcessed(call_size * call_count);
+	state.SetItemsProcessed(call_count);
+}
+
+BENCHMARK_REGISTER_F(metacall_rpc_call_bench, call_throughput)
+	->Threads(1)
+	->Threads(2)
+	->Threads(4)
+	->Threads(8)
+	->UseRealTime()
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(3);
+
+BENCHMARK_DEFINE_F(metacall_rpc_call_bench, call_batch)
+(benchmark::State &state)
+{
+	const int64_t call_count = 1000;
+	const int64_t batch_count = 500;
+	const int64_t call_size = sizeof(long) * 3; // (long, long) -> long
+
+	for (auto _ : state)
+	{
+/* RPC */
+#if defined(OPTION_BUILD_LOADERS_RPC)
+		{
+			state.PauseTiming();
+
+			void *func = metacall_function("sum");
+
+			void *args[2] = {
+				metacall_value_create_long(3L),
+				metacall_value_create_long(4L)
+			};
+
+			std::vector<void *> funcs(batch_count, func), rets(batch_count, NULL);
+			std::vector<void **> batch_args(batch_count, args);
+			std::vector<size_t> sizes(batch_count, 2);
+
+			state.ResumeTiming();
+
+			/* Each batch of calls is sent to the endpoint in a single round trip */
+			for (int64_t it = 0; it < call_count; it += batch_count)
+			{
+				if (metacallfv_batch_s(funcs.data(), batch_args.data(), sizes.data(), batch_count, rets.data()) != 0)
+				{
+					state.SkipWithError("Invalid batch call to sum");
+				}
+
+				state.PauseTiming();
+
+				for (auto &ret : rets)
+				{
+					if (ret == NULL || metacall_value_cast_long(&ret) != 7L)
+					{
+						state.SkipWithError("Invalid return value from sum");
+					}
+
+					metacall_value_destroy(ret);
+				}
+
+				state.ResumeTiming();
+			}
+
+			state.PauseTiming();
+
+			for (auto arg : args)
+			{
+				metacall_value_destroy(arg);
+			}
+
+			state.ResumeTiming();
+		}
+#endif /* OPTION_BUILD_LOADERS_RPC */
+	}
+
+	state.SetLabel("MetaCall RPC Call Benchmark - Batch Call");
+	state.SetBytesProcessed(call_size * call_count);
+	state.SetItemsProcessed(call_count);
+}
+
+BENCHMARK_REGISTER_F(metacall_rpc_call_bench, call_batch)
+	->Threads(1)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(5);
+
+/* BENCHMARK_MAIN(); */
+
+int main(int argc, char **argv)
+{
+	::benchmark::Initialize(&argc, argv);
+
+	if (::benchmark::ReportUnrecognizedArguments(argc, argv))
+	{
+		return 1;
+	}
+
+	/* MetaCall is initialized once here instead of using SetUp and TearDown in the Fixture, */
+	/* because SetUp and TearDown run in every thread of the multithreaded benchmarks */
+
+	metacall_print_info();
+
+	metacall_log_null();
+
+	if (metacall_initialize() != 0)
+	{
+		return 1;
+	}
+
+/* RPC */
+#if defined(OPTION_BUILD_LOADERS_RPC)
+	{
+		static const char tag[] = "rpc";
+
+		/* Endpoint served by the stub server of metacall-rpc-test (see CMakeLists.txt) */
+		static const char buffer[] = "http://localhost:6094/viferga/example/v1";
+
+		if (metacall_load_from_memory(tag, buffer, sizeof(buffer), NULL) != 0)
+		{
+			metacall_destroy();
+			return 1;
+		}
+	}
+#endif /* OPTION_BUILD_LOADERS_RPC */
+
+	::benchmark::RunSpecifiedBenchmarks();
+
+	return metacall_destroy();
+}
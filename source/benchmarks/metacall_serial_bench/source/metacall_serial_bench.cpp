@@ -0,0 +1,187 @@
+/*
+ *	MetaCall Library by Parra Studios
+ *	A library for providing a foreign function interface calls.
+ *
+ *	Copyright (C) 2016 - 2022 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <metacall/metacall.h>
+
+#include <cstdlib>
+#include <string>
+
+/* Indexed by the first benchmark argument */
+static const char *serial_names[] = {
+	"metacall",
+	"rapid_json",
+	"msgpack"
+};
+
+static void *allocator = NULL;
+
+/* Second benchmark argument, zero for a scalar and one for a nested document */
+static void *create_payload(int64_t payload)
+{
+	static const char str[] = "hello world";
+
+	if (payload == 0)
+	{
+		return metacall_value_create_double(545.3453);
+	}
+
+	void *items[16];
+
+	for (size_t iterator = 0; iterator < sizeof(items) / sizeof(items[0]); ++iterator)
+	{
+		void *item[] = {
+			metacall_value_create_long(251251251L + (long)iterator),
+			metacall_value_create_double(6.8 * (double)iterator),
+			metacall_value_create_string(str, sizeof(str) - 1),
+			metacall_value_create_bool(iterator % 2)
+		};
+
+		items[iterator] = metacall_value_create_array((const void **)item, sizeof(item) / sizeof(item[0]));
+	}
+
+	return metacall_value_create_array((const void **)items, sizeof(items) / sizeof(items[0]));
+}
+
+static void set_label(benchmark::State &state)
+{
+	state.SetLabel(std::string(serial_names[state.range(0)]) + (state.range(1) == 0 ? " - Scalar" : " - Document"));
+}
+
+static void serialize(benchmark::State &state)
+{
+	const char *name = serial_names[state.range(0)];
+
+	void *v = create_payload(state.range(1));
+
+	size_t size = 0;
+
+	for (auto _ : state)
+	{
+		char *buffer = metacall_serialize(name, v, &size, allocator);
+
+		if (buffer == NULL)
+		{
+			state.SkipWithError("Serial does not support this payload");
+			break;
+		}
+
+		benchmark::DoNotOptimize(buffer);
+
+		metacall_allocator_free(allocator, buffer);
+	}
+
+	metacall_value_destroy(v);
+
+	state.counters["bytes"] = (double)size;
+
+	set_label(state);
+}
+
+BENCHMARK(serialize)
+	->ArgsProduct({ { 0, 1, 2 }, { 0, 1 } })
+	->Unit(benchmark::kNanosecond)
+	->Repetitions(3);
+
+static void deserialize(benchmark::State &state)
+{
+	const char *name = serial_names[state.range(0)];
+
+	void *v = create_payload(state.range(1));
+
+	size_t size = 0;
+
+	char *buffer = metacall_serialize(name, v, &size, allocator);
+
+	metacall_value_destroy(v);
+
+	if (buffer == NULL)
+	{
+		state.SkipWithError("Serial does not support this payload");
+		return;
+	}
+
+	for (auto _ : state)
+	{
+		void *result = metacall_deserialize(name, buffer, size, allocator);
+
+		if (result == NULL)
+		{
+			state.SkipWithError("Serial can not deserialize this payload");
+			break;
+		}
+
+		benchmark::DoNotOptimize(result);
+
+		metacall_value_destroy(result);
+	}
+
+	metacall_allocator_free(allocator, buffer);
+
+	state.counters["bytes"] = (double)size;
+
+	set_label(state);
+}
+
+BENCHMARK(deserialize)
+	->ArgsProduct({ { 0, 1, 2 }, { 0, 1 } })
+	->Unit(benchmark::kNanosecond)
+	->Repetitions(3);
+
+int main(int argc, char *argv[])
+{
+	struct metacall_allocator_std_type std_ctx = { &std::malloc, &std::realloc, &std::free };
+
+	metacall_print_info();
+
+	metacall_log_null();
+
+	if (metacall_initialize() != 0)
+	{
+		return 1;
+	}
+
+	allocator = metacall_allocator_create(METACALL_ALLOCATOR_STD, (void *)&std_ctx);
+
+	if (allocator == NULL)
+	{
+		return 2;
+	}
+
+	::benchmark::Initialize(&argc, argv);
+
+	if (::benchmark::ReportUnrecognizedArguments(argc, argv))
+	{
+		return 3;
+	}
+
+	::benchmark::RunSpecifiedBenchmarks();
+	::benchmark::Shutdown();
+
+	metacall_allocator_destroy(allocator);
+
+	if (metacall_destroy() != 0)
+	{
+		return 4;
+	}
+
+	return 0;
+}
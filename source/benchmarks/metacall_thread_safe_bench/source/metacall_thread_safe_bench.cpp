@@ -0,0 +1,126 @@
+/*
+ *	MetaCall Library by Parra Studios
+ *	A library for providing a foreign function interface calls.
+ *
+ *	Copyright (C) 2016 - 2022 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <metacall/metacall.h>
+
+static void *thread_safe_sum(size_t, void *args[], void *)
+{
+	return metacall_value_create_long(metacall_value_to_long(args[0]) + metacall_value_to_long(args[1]));
+}
+
+class metacall_thread_safe_bench : public benchmark::Fixture
+{
+public:
+};
+
+BENCHMARK_DEFINE_F(metacall_thread_safe_bench, call_array_args)
+(benchmark::State &state)
+{
+	const int64_t call_count = 100000;
+	const int64_t call_size = sizeof(long) * 3; // (long, long) -> long
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+
+		void *args[2] = {
+			metacall_value_create_long(0L),
+			metacall_value_create_long(0L)
+		};
+
+		state.ResumeTiming();
+
+		/* Each thread looks up the function by name and calls it, so the global scope is read concurrently */
+		for (int64_t it = 0; it < call_count; ++it)
+		{
+			void *ret = metacallv_s("thread_safe_sum", args, sizeof(args) / sizeof(args[0]));
+
+			benchmark::DoNotOptimize(ret);
+
+			if (ret == NULL)
+			{
+				state.SkipWithError("Null return value from thread_safe_sum");
+				break;
+			}
+
+			metacall_value_destroy(ret);
+		}
+
+		state.PauseTiming();
+
+		for (auto arg : args)
+		{
+			metacall_value_destroy(arg);
+		}
+
+		state.ResumeTiming();
+	}
+
+	state.SetLabel("MetaCall Thread Safe Benchmark - Array Argument Call");
+	state.SetBytesProcessed(call_size * call_count);
+	state.SetItemsProcessed(call_count);
+}
+
+BENCHMARK_REGISTER_F(metacall_thread_safe_bench, call_array_args)
+	->Threads(1)
+	->Threads(2)
+	->Threads(4)
+	->Threads(8)
+	->UseRealTime()
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(3);
+
+/* Use main for initializing MetaCall once, all the threads share the same runtime */
+int main(int argc, char *argv[])
+{
+	metacall_print_info();
+
+	metacall_log_null();
+
+	if (metacall_initialize() != 0)
+	{
+		return 1;
+	}
+
+	if (metacall_register("thread_safe_sum", thread_safe_sum, NULL, METACALL_LONG, 2, METACALL_LONG, METACALL_LONG) != 0)
+	{
+		return 2;
+	}
+
+	::benchmark::Initialize(&argc, argv);
+
+	if (::benchmark::ReportUnrecognizedArguments(argc, argv))
+	{
+		return 3;
+	}
+
+	::benchmark::RunSpecifiedBenchmarks();
+	::benchmark::Shutdown();
+
+	if (metacall_destroy() != 0)
+	{
+		return 4;
+	}
+
+	return 0;
+}
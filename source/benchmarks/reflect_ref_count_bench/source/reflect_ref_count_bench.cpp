@@ -0,0 +1,145 @@
+/*
+ *	MetaCall Library by Parra Studios
+ *	A library for providing a foreign function interface calls.
+ *
+ *	Copyright (C) 2016 - 2022 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <reflect/reflect_value.h>
+
+#include <atomic>
+#include <cstdint>
+
+static const int64_t call_count = 1000000;
+
+/* Mirrors the memory ordering of threading_atomic_ref_count.h, which is C only */
+static std::atomic<uintmax_t> shared_ref(1);
+
+static value shared_value = NULL;
+
+class reflect_ref_count_bench : public benchmark::Fixture
+{
+public:
+	void SetUp(benchmark::State &state)
+	{
+		if (state.thread_index() == 0)
+		{
+			shared_value = value_alloc(sizeof(long));
+
+			if (shared_value == NULL)
+			{
+				state.SkipWithError("Error allocating the value");
+			}
+		}
+	}
+
+	void TearDown(benchmark::State &state)
+	{
+		if (state.thread_index() == 0)
+		{
+			value_destroy(shared_value);
+		}
+	}
+};
+
+BENCHMARK_DEFINE_F(reflect_ref_count_bench, plain_ref_count)
+(benchmark::State &state)
+{
+	size_t ref_count = 1;
+
+	for (auto _ : state)
+	{
+		for (int64_t it = 0; it < call_count; ++it)
+		{
+			++ref_count;
+			benchmark::DoNotOptimize(ref_count);
+			--ref_count;
+			benchmark::DoNotOptimize(ref_count);
+		}
+	}
+
+	state.SetLabel("Reflect Ref Count Benchmark - Plain Counter");
+	state.SetItemsProcessed(call_count);
+}
+
+BENCHMARK_REGISTER_F(reflect_ref_count_bench, plain_ref_count)
+	->Threads(1)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(3);
+
+BENCHMARK_DEFINE_F(reflect_ref_count_bench, atomic_ref_count)
+(benchmark::State &state)
+{
+	for (auto _ : state)
+	{
+		for (int64_t it = 0; it < call_count; ++it)
+		{
+			shared_ref.fetch_add(1, std::memory_order_relaxed);
+
+			if (shared_ref.fetch_sub(1, std::memory_order_release) == 1)
+			{
+				std::atomic_thread_fence(std::memory_order_acquire);
+			}
+		}
+	}
+
+	state.SetLabel("Reflect Ref Count Benchmark - Atomic Counter");
+	state.SetItemsProcessed(call_count);
+}
+
+BENCHMARK_REGISTER_F(reflect_ref_count_bench, atomic_ref_count)
+	->ThreadRange(1, 8)
+	->UseRealTime()
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(3);
+
+BENCHMARK_DEFINE_F(reflect_ref_count_bench, value_ref)
+(benchmark::State &state)
+{
+	for (auto _ : state)
+	{
+		for (int64_t it = 0; it < call_count; ++it)
+		{
+			value_ref_inc(shared_value);
+			value_ref_dec(shared_value);
+		}
+	}
+
+	state.SetLabel("Reflect Ref Count Benchmark - Value Reference");
+	state.SetItemsProcessed(call_count);
+}
+
+/* Values are only safe to share between threads when built with OPTION_THREAD_SAFE */
+#if defined(THREADING_THREAD_SAFE)
+BENCHMARK_REGISTER_F(reflect_ref_count_bench, value_ref)
+	->ThreadRange(1, 8)
+	->UseRealTime()
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(3);
+#else
+BENCHMARK_REGISTER_F(reflect_ref_count_bench, value_ref)
+	->Threads(1)
+	->Unit(benchmark::kMillisecond)
+	->Iterations(1)
+	->Repetitions(3);
+#endif
+
+BENCHMARK_MAIN();
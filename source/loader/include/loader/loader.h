@@ -77,6 +77,8 @@ LOADER_API loader_impl loader_get_impl(const loader_tag tag);
 
 LOADER_API loader_data loader_get(const char *name);
 
+LOADER_API function loader_get_function(const char *name);
+
 LOADER_API void *loader_get_handle(const loader_tag tag, const char *name);
 
 LOADER_API void loader_set_options(const loader_tag tag, void *options);
@@ -89,6 +91,8 @@ LOADER_API void *loader_handle_export(void *handle);
 
 LOADER_API loader_data loader_handle_get(void *handle, const char *name);
 
+LOADER_API function loader_handle_get_function(void *handle, const char *name);
+
 LOADER_API value loader_metadata(void);
 
 LOADER_API int loader_clear(void *handle);
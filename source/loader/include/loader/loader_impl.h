@@ -37,6 +37,10 @@ extern "C" {
 
 LOADER_API int loader_impl_is_initialized(loader_impl impl);
 
+LOADER_API int loader_impl_lock(loader_impl impl);
+
+LOADER_API void loader_impl_unlock(loader_impl impl);
+
 LOADER_API loader_impl loader_impl_create(const loader_tag tag);
 
 LOADER_API loader_impl loader_impl_create_host(const loader_tag tag);
@@ -29,6 +29,10 @@
 
 #include <plugin/plugin_manager.h>
 
+#include <reflect/reflect_context.h>
+
+#include <threading/threading_rwlock.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -48,11 +52,13 @@ struct loader_initialization_order_type
 
 struct loader_manager_impl_type
 {
-	plugin host;				 /* Points to the internal host loader (it stores functions registered by the user) */
-	vector initialization_order; /* Stores the loader implementations by order of initialization (used for destruction) */
-	uint64_t init_thread_id;	 /* Stores the thread id of the thread that initialized metacall */
-	vector script_paths;		 /* Vector of search path for the scripts */
-	set destroy_map;			 /* Tracks the list of destroyed runtimes during destruction of the manager (loader_impl -> NULL) */
+	plugin host;					   /* Points to the internal host loader (it stores functions registered by the user) */
+	vector initialization_order;	   /* Stores the loader implementations by order of initialization (used for destruction) */
+	uint64_t init_thread_id;		   /* Stores the thread id of the thread that initialized metacall */
+	vector script_paths;			   /* Vector of search path for the scripts */
+	set destroy_map;				   /* Tracks the list of destroyed runtimes during destruction of the manager (loader_impl -> NULL) */
+	context symbols;				   /* Process-wide index of all the symbols populated into the global scope of any loader (name -> value), it does not own the values */
+	struct threading_rwlock_type lock; /* Serializes the updates of the manager (loader creation, initialization order and registration of global symbols) */
 };
 
 /* -- Type Definitions -- */
@@ -71,6 +77,10 @@ LOADER_API void loader_manager_impl_set_destroyed(loader_manager_impl manager_im
 
 LOADER_API int loader_manager_impl_is_destroyed(loader_manager_impl manager_impl, loader_impl impl);
 
+LOADER_API int loader_manager_impl_symbols_append(loader_manager_impl manager_impl, context ctx);
+
+LOADER_API int loader_manager_impl_symbols_remove(loader_manager_impl manager_impl, context ctx);
+
 LOADER_API void loader_manager_impl_destroy(loader_manager_impl manager_impl);
 
 #ifdef __cplusplus
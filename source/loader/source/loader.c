@@ -37,6 +37,7 @@
 
 #include <log/log.h>
 
+#include <threading/threading_rwlock.h>
 #include <threading/threading_thread_id.h>
 
 #include <stdlib.h>
@@ -53,19 +54,12 @@
 struct loader_metadata_cb_iterator_type
 {
 	size_t iterator;
+	size_t size;
 	value *values;
 };
 
-struct loader_get_cb_iterator_type
-{
-	const char *name;
-	value obj; /* scope_object */
-};
-
 /* -- Type Definitions -- */
 
-typedef struct loader_get_cb_iterator_type *loader_get_cb_iterator;
-
 typedef struct loader_metadata_cb_iterator_type *loader_metadata_cb_iterator;
 
 /* -- Private Methods -- */
@@ -76,10 +70,12 @@ static void loader_initialization_register_plugin(plugin p);
 
 static plugin loader_get_impl_plugin(const loader_tag tag);
 
-static int loader_get_cb_iterate(plugin_manager manager, plugin p, void *data);
+static int loader_register_symbol(loader_impl impl, const char *name);
 
 static int loader_metadata_cb_iterate(plugin_manager manager, plugin p, void *data);
 
+static void loader_unload_children_thread(loader_impl impl, uint64_t id);
+
 /* -- Member Data -- */
 
 static plugin_manager_declare(loader_manager);
@@ -197,7 +193,11 @@ void loader_initialization_register_plugin(plugin p)
 			plugin_name(p), vector_size(manager_impl->initialization_order), initialization_order.id);
 		*/
 
+		threading_rwlock_write_lock(&manager_impl->lock);
+
 		vector_push_back(manager_impl->initialization_order, &initialization_order);
+
+		threading_rwlock_write_unlock(&manager_impl->lock);
 	}
 }
 
@@ -213,27 +213,83 @@ int loader_is_initialized(const loader_tag tag)
 	return loader_impl_is_initialized(plugin_impl_type(p, loader_impl));
 }
 
+int loader_register_symbol(loader_impl impl, const char *name)
+{
+	loader_manager_impl manager_impl = plugin_manager_impl_type(&loader_manager, loader_manager_impl);
+	value v;
+
+	if (manager_impl == NULL || name == NULL)
+	{
+		return 0;
+	}
+
+	v = loader_impl_get_value(impl, name);
+
+	if (v == NULL)
+	{
+		return 1;
+	}
+
+	/* Index the symbol registered directly into the global scope of the loader (the key is owned by the function) */
+	return scope_define(context_scope(manager_impl->symbols), function_name(value_to_function(v)), v);
+}
+
 int loader_register(const char *name, loader_register_invoke invoke, function *func, type_id return_type, size_t arg_size, type_id args_type_id[])
 {
 	loader_manager_impl manager_impl = plugin_manager_impl_type(&loader_manager, loader_manager_impl);
+	loader_impl host = plugin_impl_type(manager_impl->host, loader_impl);
+	int result = 1;
+
+	/* The check and the registration must be atomic, other threads can be registering symbols into the global scope concurrently */
+	threading_rwlock_write_lock(&manager_impl->lock);
 
-	return loader_host_register(plugin_impl_type(manager_impl->host, loader_impl), NULL, name, invoke, func, return_type, arg_size, args_type_id);
+	if (name != NULL && loader_get(name) != NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Duplicated symbol found named '%s' already defined in the global scope", name);
+	}
+	else if (loader_host_register(host, NULL, name, invoke, func, return_type, arg_size, args_type_id) == 0)
+	{
+		result = loader_register_symbol(host, name);
+	}
+
+	threading_rwlock_write_unlock(&manager_impl->lock);
+
+	return result;
 }
 
 int loader_register_impl(void *impl, void *ctx, const char *name, loader_register_invoke invoke, type_id return_type, size_t arg_size, type_id args_type_id[])
 {
-	return loader_host_register((loader_impl)impl, (context)ctx, name, invoke, NULL, return_type, arg_size, args_type_id);
+	loader_manager_impl manager_impl = plugin_manager_impl_type(&loader_manager, loader_manager_impl);
+	int result = 1;
+
+	threading_rwlock_write_lock(&manager_impl->lock);
+
+	if (ctx == NULL && name != NULL && loader_get(name) != NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Duplicated symbol found named '%s' already defined in the global scope", name);
+	}
+	else if (loader_host_register((loader_impl)impl, (context)ctx, name, invoke, NULL, return_type, arg_size, args_type_id) == 0)
+	{
+		/* If there is no context, the function has been registered into the global scope of the loader */
+		result = (ctx == NULL) ? loader_register_symbol((loader_impl)impl, name) : 0;
+	}
+
+	threading_rwlock_write_unlock(&manager_impl->lock);
+
+	return result;
 }
 
 plugin loader_get_impl_plugin(const loader_tag tag)
 {
-	plugin p = plugin_manager_get(&loader_manager, tag);
+	plugin p = plugin_manager_get(&loader_manager, tag), registered;
 
 	if (p != NULL)
 	{
 		return p;
 	}
 
+	/* Slow path, the loader is created and loaded without holding any lock, if another thread
+	* registers the same loader meanwhile, this one is discarded and the registered one is used */
 	loader_impl impl = loader_impl_create(tag);
 
 	if (impl == NULL)
@@ -241,23 +297,37 @@ plugin loader_get_impl_plugin(const loader_tag tag)
 		goto loader_create_error;
 	}
 
-	p = plugin_manager_create(&loader_manager, tag, impl, &loader_impl_destroy_dtor);
+	p = plugin_loader_load(loader_manager.l, tag, impl, &loader_impl_destroy_dtor);
 
 	if (p == NULL)
 	{
-		goto plugin_manager_create_error;
+		goto plugin_load_error;
 	}
 
-	/* Store in the loader implementation the reference to the plugin which belongs to */
+	/* Store in the loader implementation the reference to the plugin which belongs to, it must
+	* be done before registering it because other threads can use the loader right after that */
 	loader_impl_attach(impl, p);
 
+	registered = plugin_manager_insert(&loader_manager, p);
+
+	if (registered != p)
+	{
+		/* The destructor of the plugin destroys the loader implementation too */
+		plugin_destroy(p);
+
+		if (registered == NULL)
+		{
+			goto loader_create_error;
+		}
+	}
+
 	/* TODO: Disable logs here until log is completely thread safe and async signal safe */
 	/* log_write("metacall", LOG_LEVEL_DEBUG, "Created loader (%s) implementation <%p>", tag, (void *)impl); */
 
-	return p;
+	return registered;
 
-plugin_manager_create_error:
-	loader_impl_destroy(p, impl);
+plugin_load_error:
+	loader_impl_destroy(NULL, impl);
 loader_create_error:
 	log_write("metacall", LOG_LEVEL_ERROR, "Failed to create loader: %s", tag);
 	return NULL;
@@ -293,7 +363,19 @@ int loader_execution_path(const loader_tag tag, const loader_path path)
 	/* TODO: Disable logs here until log is completely thread safe and async signal safe */
 	/* log_write("metacall", LOG_LEVEL_DEBUG, "Define execution path (%s): %s", tag, path); */
 
-	return loader_impl_execution_path(p, plugin_impl_type(p, loader_impl), path);
+	loader_impl impl = plugin_impl_type(p, loader_impl);
+	int result;
+
+	if (loader_impl_lock(impl) != 0)
+	{
+		return 1;
+	}
+
+	result = loader_impl_execution_path(p, impl, path);
+
+	loader_impl_unlock(impl);
+
+	return result;
 }
 
 int loader_load_from_file(const loader_tag tag, const loader_path paths[], size_t size, void **handle)
@@ -314,7 +396,20 @@ int loader_load_from_file(const loader_tag tag, const loader_path paths[], size_
 	/* TODO: Disable logs here until log is completely thread safe and async signal safe */
 	/* log_write("metacall", LOG_LEVEL_DEBUG, "Loading %" PRIuS " file(s) (%s) from path(s): %s ...", size, tag, paths[0]); */
 
-	return loader_impl_load_from_file(&loader_manager, p, plugin_impl_type(p, loader_impl), paths, size, handle);
+	loader_impl impl = plugin_impl_type(p, loader_impl);
+	int result;
+
+	/* Loads of the same loader are serialized, they modify the handles and the scope of the loader */
+	if (loader_impl_lock(impl) != 0)
+	{
+		return 1;
+	}
+
+	result = loader_impl_load_from_file(&loader_manager, p, impl, paths, size, handle);
+
+	loader_impl_unlock(impl);
+
+	return result;
 }
 
 int loader_load_from_memory(const loader_tag tag, const char *buffer, size_t size, void **handle)
@@ -335,7 +430,19 @@ int loader_load_from_memory(const loader_tag tag, const char *buffer, size_t siz
 	/* TODO: Disable logs here until log is completely thread safe and async signal safe */
 	/* log_write("metacall", LOG_LEVEL_DEBUG, "Loading buffer from memory (%s):\n%s", tag, buffer); */
 
-	return loader_impl_load_from_memory(&loader_manager, p, plugin_impl_type(p, loader_impl), buffer, size, handle);
+	loader_impl impl = plugin_impl_type(p, loader_impl);
+	int result;
+
+	if (loader_impl_lock(impl) != 0)
+	{
+		return 1;
+	}
+
+	result = loader_impl_load_from_memory(&loader_manager, p, impl, buffer, size, handle);
+
+	loader_impl_unlock(impl);
+
+	return result;
 }
 
 int loader_load_from_package(const loader_tag tag, const loader_path path, void **handle)
@@ -356,7 +463,19 @@ int loader_load_from_package(const loader_tag tag, const loader_path path, void
 	/* TODO: Disable logs here until log is completely thread safe and async signal safe */
 	/* log_write("metacall", LOG_LEVEL_DEBUG, "Loading package (%s): %s", tag, path); */
 
-	return loader_impl_load_from_package(&loader_manager, p, plugin_impl_type(p, loader_impl), path, handle);
+	loader_impl impl = plugin_impl_type(p, loader_impl);
+	int result;
+
+	if (loader_impl_lock(impl) != 0)
+	{
+		return 1;
+	}
+
+	result = loader_impl_load_from_package(&loader_manager, p, impl, path, handle);
+
+	loader_impl_unlock(impl);
+
+	return result;
 }
 
 int loader_load_from_configuration(const loader_path path, void **handle, void *allocator)
@@ -502,35 +621,32 @@ int loader_load_from_configuration(const loader_path path, void **handle, void *
 	return 0;
 }
 
-int loader_get_cb_iterate(plugin_manager manager, plugin p, void *data)
+loader_data loader_get(const char *name)
 {
-	loader_impl impl = plugin_impl_type(p, loader_impl);
-	loader_get_cb_iterator get_iterator = data;
-
-	(void)manager;
-
-	get_iterator->obj = loader_impl_get_value(impl, get_iterator->name);
+	loader_manager_impl manager_impl = plugin_manager_impl_type(&loader_manager, loader_manager_impl);
 
-	if (get_iterator->obj != NULL)
+	if (manager_impl == NULL)
 	{
-		/* TODO: Disable logs here until log is completely thread safe and async signal safe */
-		/* log_write("metacall", LOG_LEVEL_DEBUG, "Loader (%s) get value: %s <%p>", plugin_name(p), get_iterator->name, (void *)get_iterator->obj); */
-		return 1;
+		return NULL;
 	}
 
-	return 0;
+	/* The global symbol index contains the global scope of all loaders, so the lookup
+	* does not depend on the amount of loaders or handles that have been loaded */
+	return (loader_data)scope_get(context_scope(manager_impl->symbols), name);
 }
 
-loader_data loader_get(const char *name)
+function loader_get_function(const char *name)
 {
-	struct loader_get_cb_iterator_type get_iterator;
-
-	get_iterator.name = name;
-	get_iterator.obj = NULL;
+	loader_manager_impl manager_impl = plugin_manager_impl_type(&loader_manager, loader_manager_impl);
 
-	plugin_manager_iterate(&loader_manager, &loader_get_cb_iterate, (void *)&get_iterator);
+	if (manager_impl == NULL)
+	{
+		return NULL;
+	}
 
-	return (loader_data)get_iterator.obj;
+	/* The function is returned with a reference so it can be called while other thread clears its handle,
+	* it must be released with function_destroy once the call has finished */
+	return scope_get_function(context_scope(manager_impl->symbols), name);
 }
 
 void *loader_get_handle(const loader_tag tag, const char *name)
@@ -578,6 +694,20 @@ loader_data loader_handle_get(void *handle, const char *name)
 	return NULL;
 }
 
+function loader_handle_get_function(void *handle, const char *name)
+{
+	if (handle != NULL)
+	{
+		context ctx = loader_impl_handle_context(handle);
+
+		scope sp = context_scope(ctx);
+
+		return scope_get_function(sp, name);
+	}
+
+	return NULL;
+}
+
 value loader_metadata_impl(plugin p, loader_impl impl)
 {
 	const char *tag = plugin_name(p);
@@ -619,6 +749,12 @@ int loader_metadata_cb_iterate(plugin_manager manager, plugin p, void *data)
 
 	(void)manager;
 
+	/* A loader may have been created after allocating the map, it will appear in the next call */
+	if (metadata_iterator->iterator == metadata_iterator->size)
+	{
+		return 0;
+	}
+
 	metadata_iterator->values[metadata_iterator->iterator] = loader_metadata_impl(p, impl);
 
 	if (metadata_iterator->values[metadata_iterator->iterator] != NULL)
@@ -632,7 +768,8 @@ int loader_metadata_cb_iterate(plugin_manager manager, plugin p, void *data)
 value loader_metadata(void)
 {
 	struct loader_metadata_cb_iterator_type metadata_iterator;
-	value v = value_create_map(NULL, plugin_manager_size(&loader_manager));
+	size_t size = plugin_manager_size(&loader_manager);
+	value v = value_create_map(NULL, size);
 
 	if (v == NULL)
 	{
@@ -640,6 +777,7 @@ value loader_metadata(void)
 	}
 
 	metadata_iterator.iterator = 0;
+	metadata_iterator.size = size;
 	metadata_iterator.values = value_to_map(v);
 
 	plugin_manager_iterate(&loader_manager, &loader_metadata_cb_iterate, (void *)&metadata_iterator);
@@ -667,18 +805,22 @@ void loader_set_destroyed(loader_impl impl)
 }
 
 void loader_unload_children(loader_impl impl)
+{
+	loader_unload_children_thread(impl, thread_id_get_current());
+}
+
+void loader_unload_children_thread(loader_impl impl, uint64_t id)
 {
 	loader_manager_impl manager_impl = plugin_manager_impl_type(&loader_manager, loader_manager_impl);
-	uint64_t current = thread_id_get_current();
 	size_t iterator, size = vector_size(manager_impl->initialization_order);
 	vector stack = vector_create_type(loader_initialization_order);
 
-	/* Get all loaders that have been initialized in the current thread */
+	/* Get all loaders that have been initialized in the thread */
 	for (iterator = 0; iterator < size; ++iterator)
 	{
 		loader_initialization_order order = vector_at(manager_impl->initialization_order, iterator);
 
-		if (order->being_deleted == 1 && order->p != NULL && current == order->id)
+		if (order->being_deleted == 1 && order->p != NULL && id == order->id)
 		{
 			/* Mark for deletion */
 			vector_push_back(stack, &order);
@@ -688,7 +830,7 @@ void loader_unload_children(loader_impl impl)
 		}
 	}
 
-	/* Free all loaders of the current thread and with BFS, look for children */
+	/* Free all loaders of the thread and with BFS, look for children */
 	while (vector_size(stack) != 0)
 	{
 		loader_initialization_order order = vector_back_type(stack, loader_initialization_order);
@@ -727,6 +869,9 @@ void loader_unload_children(loader_impl impl)
 	if (impl != NULL)
 	{
 		loader_impl_destroy_objects(impl);
+
+		/* Once the handles are destroyed, only the symbols registered directly into the loader remain, detach them from the global symbol index */
+		loader_manager_impl_symbols_remove(manager_impl, loader_impl_context(impl));
 	}
 }
 
@@ -744,21 +889,22 @@ void loader_destroy(void)
 
 		if (manager_impl->init_thread_id != current)
 		{
-			log_write("metacall", LOG_LEVEL_ERROR, "Destruction of the loaders is being executed "
-												   "from different thread of where MetaCall was initialized, "
-												   "this is very dangerous and it can generate memory leaks and deadlocks, "
-												   "I hope you know what are you doing...");
-
-			/* TODO: How to deal with this? */
+			log_write("metacall", LOG_LEVEL_WARNING, "Destruction of the loaders is being executed "
+													 "from different thread of where MetaCall was initialized, "
+													 "the loaders must support being destroyed from another thread");
 		}
 
 		loader_initialization_debug();
 
-		loader_unload_children(NULL);
+		/* Unload the loaders initialized in the thread of MetaCall even if the destruction happens in another thread,
+		otherwise they would be destroyed by the plugin manager after the loader manager has been freed */
+		loader_unload_children_thread(NULL, manager_impl->init_thread_id);
 
 		/* The host is the first loader, it must be destroyed at the end */
 		if (manager_impl->host != NULL)
 		{
+			loader_manager_impl_symbols_remove(manager_impl, loader_impl_context(plugin_impl_type(manager_impl->host, loader_impl)));
+
 			if (plugin_manager_clear(&loader_manager, manager_impl->host) != 0)
 			{
 				log_write("metacall", LOG_LEVEL_ERROR, "Failed to clear host loader");
@@ -85,6 +85,7 @@ function_interface function_host_singleton(void)
 		NULL,
 		&function_host_interface_invoke,
 		&function_host_interface_await,
+		NULL,
 		NULL
 	};
 
@@ -186,7 +187,8 @@ int loader_host_register(loader_impl host, context ctx, const char *name, loader
 		scope sp = context_scope(ctx);
 		value v = value_create_function(f);
 
-		if (scope_define(sp, name, v) != 0)
+		/* The key is owned by the function, the name passed by the caller may not outlive the scope */
+		if (scope_define(sp, function_name(f), v) != 0)
 		{
 			value_type_destroy(v);
 			return 1;
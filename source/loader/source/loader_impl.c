@@ -36,6 +36,10 @@
 
 #include <configuration/configuration.h>
 
+#include <threading/threading_atomic.h>
+#include <threading/threading_rwlock.h>
+#include <threading/threading_thread_id.h>
+
 #include <stdlib.h>
 #include <string.h>
 
@@ -65,30 +69,29 @@ struct loader_handle_impl_type;
 
 struct loader_impl_metadata_cb_iterator_type;
 
-struct loader_impl_handle_register_cb_iterator_type;
-
 /* -- Type Definitions -- */
 
 typedef struct loader_handle_impl_type *loader_handle_impl;
 
 typedef struct loader_impl_metadata_cb_iterator_type *loader_impl_metadata_cb_iterator;
 
-typedef struct loader_impl_handle_register_cb_iterator_type *loader_impl_handle_register_cb_iterator;
-
 /* -- Member Data -- */
 
 struct loader_impl_type
 {
-	plugin p;					   /* Plugin instance to which loader belongs to */
-	int init;					   /* Flag for checking if the loader is initialized */
-	set handle_impl_path_map;	   /* Indexes handles by path */
-	set handle_impl_map;		   /* Indexes handles from loaders to handle impl (loader_handle -> loader_handle_impl) */
-	vector handle_impl_init_order; /* Stores the order of handle initialization, so it can be destroyed in LIFO manner, for avoiding memory bugs when destroying them */
-	loader_impl_data data;		   /* Derived metadata provided by the loader, usually contains the data of the VM, Interpreter or JIT */
-	context ctx;				   /* Contains the objects, classes and functions loaded in the global scope of each loader */
-	set type_info_map;			   /* Stores a set indexed by type name of all of the types existing in the loader (global scope (TODO: may need refactor per handle)) */
-	void *options;				   /* Additional initialization options passed in the initialize phase */
-	set exec_path_map;			   /* Set of execution paths passed by the end user */
+	plugin p;						   /* Plugin instance to which loader belongs to */
+	int init;						   /* Flag for checking if the loader is initialized */
+	set handle_impl_path_map;		   /* Indexes handles by path */
+	set handle_impl_map;			   /* Indexes handles from loaders to handle impl (loader_handle -> loader_handle_impl) */
+	vector handle_impl_init_order;	   /* Stores the order of handle initialization, so it can be destroyed in LIFO manner, for avoiding memory bugs when destroying them */
+	loader_impl_data data;			   /* Derived metadata provided by the loader, usually contains the data of the VM, Interpreter or JIT */
+	context ctx;					   /* Contains the objects, classes and functions loaded in the global scope of each loader */
+	set type_info_map;				   /* Stores a set indexed by type name of all of the types existing in the loader (global scope (TODO: may need refactor per handle)) */
+	void *options;					   /* Additional initialization options passed in the initialize phase */
+	set exec_path_map;				   /* Set of execution paths passed by the end user */
+	struct threading_rwlock_type lock; /* Serializes the loads and clears of the loader, it is reentrant for the thread that owns it */
+	atomic_uintmax_t lock_owner;	   /* Thread id of the current owner of the lock, used for allowing nested loads from the same thread */
+	size_t lock_depth;				   /* Number of times that the lock has been acquired by its owner */
 };
 
 struct loader_handle_impl_type
@@ -101,12 +104,7 @@ struct loader_handle_impl_type
 	context ctx;				 /* Contains the objects, classes and functions loaded in the handle */
 	int populated;				 /* If it is populated (0), the handle context is also stored in loader context (global scope), otherwise it is private */
 	vector populated_handles;	 /* Vector containing all the references to which this handle has been populated into, it is necessary for detach the symbols when destroying (used in load_from_* when passing an input parameter) */
-};
-
-struct loader_impl_handle_register_cb_iterator_type
-{
-	context handle_ctx;
-	char *duplicated_key;
+	loader_manager_impl manager; /* Reference to the loader manager whose global symbol index contains the handle symbols (only when populated into the global scope) */
 };
 
 struct loader_impl_metadata_cb_iterator_type
@@ -129,8 +127,6 @@ static loader_handle_impl loader_impl_load_handle(loader_impl impl, loader_impl_
 
 static int loader_impl_handle_init(loader_impl impl, const char *path, loader_handle_impl handle_impl, void **handle_ptr, int populated);
 
-static int loader_impl_handle_register_cb_iterate(plugin_manager manager, plugin p, void *data);
-
 static int loader_impl_handle_register(plugin_manager manager, loader_impl impl, const char *path, loader_handle_impl handle_impl, void **handle_ptr);
 
 static size_t loader_impl_handle_name(plugin_manager manager, const loader_path path, loader_path result);
@@ -209,8 +205,17 @@ loader_impl loader_impl_allocate(const loader_tag tag)
 		goto alloc_exec_path_map_error;
 	}
 
+	if (threading_rwlock_initialize(&impl->lock) != 0)
+	{
+		goto alloc_lock_error;
+	}
+
+	atomic_store(&impl->lock_owner, THREAD_ID_INVALID);
+
 	return impl;
 
+alloc_lock_error:
+	set_destroy(impl->exec_path_map);
 alloc_exec_path_map_error:
 	context_destroy(impl->ctx);
 alloc_ctx_error:
@@ -460,6 +465,46 @@ int loader_impl_is_initialized(loader_impl impl)
 	return impl->init;
 }
 
+int loader_impl_lock(loader_impl impl)
+{
+#if defined(THREADING_THREAD_SAFE)
+	uint64_t current = thread_id_get_current();
+
+	/* A script being loaded can load other scripts of the same loader in the same thread, so allow the owner to lock it again */
+	if (atomic_load_explicit(&impl->lock_owner, memory_order_acquire) == (uintmax_t)current)
+	{
+		++impl->lock_depth;
+		return 0;
+	}
+
+	if (threading_rwlock_write_lock(&impl->lock) != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Loader (%s) failed to acquire the lock", plugin_name(impl->p));
+		return 1;
+	}
+
+	atomic_store_explicit(&impl->lock_owner, (uintmax_t)current, memory_order_release);
+	impl->lock_depth = 1;
+#else
+	(void)impl;
+#endif
+
+	return 0;
+}
+
+void loader_impl_unlock(loader_impl impl)
+{
+#if defined(THREADING_THREAD_SAFE)
+	if (--impl->lock_depth == 0)
+	{
+		atomic_store_explicit(&impl->lock_owner, THREAD_ID_INVALID, memory_order_release);
+		threading_rwlock_write_unlock(&impl->lock);
+	}
+#else
+	(void)impl;
+#endif
+}
+
 loader_impl loader_impl_create(const loader_tag tag)
 {
 	loader_impl impl = loader_impl_allocate(tag);
@@ -535,6 +580,7 @@ loader_handle_impl loader_impl_load_handle(loader_impl impl, loader_impl_interfa
 	handle_impl->iface = iface;
 	strncpy(handle_impl->path, path, LOADER_PATH_SIZE);
 	handle_impl->module = module;
+	handle_impl->manager = NULL;
 	handle_impl->ctx = context_create(handle_impl->path);
 
 	if (handle_impl->ctx == NULL)
@@ -590,6 +636,11 @@ void loader_impl_destroy_handle(loader_handle_impl handle_impl)
 			context_remove(handle_impl->impl->ctx, handle_impl->ctx);
 		}
 
+		if (handle_impl->manager != NULL)
+		{
+			loader_manager_impl_symbols_remove(handle_impl->manager, handle_impl->ctx);
+		}
+
 		for (iterator = 0; iterator < vector_size(handle_impl->populated_handles); ++iterator)
 		{
 			loader_handle_impl populated_handle_impl = vector_at_type(handle_impl->populated_handles, iterator, loader_handle_impl);
@@ -708,39 +759,39 @@ int loader_impl_handle_init(loader_impl impl, const char *path, loader_handle_im
 	return result;
 }
 
-int loader_impl_handle_register_cb_iterate(plugin_manager manager, plugin p, void *data)
-{
-	loader_impl impl = plugin_impl_type(p, loader_impl);
-	loader_impl_handle_register_cb_iterator iterator = (loader_impl_handle_register_cb_iterator)data;
-
-	(void)manager;
-
-	return (context_contains(impl->ctx, iterator->handle_ctx, &iterator->duplicated_key) == 0);
-}
-
 int loader_impl_handle_register(plugin_manager manager, loader_impl impl, const char *path, loader_handle_impl handle_impl, void **handle_ptr)
 {
 	/* If there's no handle input/output pointer passed as input parameter, then propagate the handle symbols to the loader context */
 	if (handle_ptr == NULL)
 	{
 		/* This case handles the global scope (shared scope between all loaders, there is no out reference to a handle) */
-		struct loader_impl_handle_register_cb_iterator_type iterator;
-
-		iterator.handle_ctx = handle_impl->ctx;
-		iterator.duplicated_key = NULL;
+		loader_manager_impl manager_impl = plugin_manager_impl_type(manager, loader_manager_impl);
+		char *duplicated_key = NULL;
 
-		/* This checks if there are duplicated keys between all loaders and the current handle context */
-		plugin_manager_iterate(manager, &loader_impl_handle_register_cb_iterate, &iterator);
+		/* The check and the registration must be atomic, other loaders can be registering symbols into the global scope concurrently */
+		threading_rwlock_write_lock(&manager_impl->lock);
 
-		if (iterator.duplicated_key != NULL)
+		/* This checks if there are duplicated keys between all loaders and the current handle context,
+		* the global symbol index contains the symbols of all loaders so it can be done in a single pass */
+		if (context_contains(manager_impl->symbols, handle_impl->ctx, &duplicated_key) == 0 && duplicated_key != NULL)
 		{
-			log_write("metacall", LOG_LEVEL_ERROR, "Duplicated symbol found named '%s' already defined in the global scope by handle: %s", iterator.duplicated_key, path);
+			threading_rwlock_write_unlock(&manager_impl->lock);
+			log_write("metacall", LOG_LEVEL_ERROR, "Duplicated symbol found named '%s' already defined in the global scope by handle: %s", duplicated_key, path);
 			return 1;
 		}
 		else if (context_append(impl->ctx, handle_impl->ctx) == 0)
 		{
+			if (loader_manager_impl_symbols_append(manager_impl, handle_impl->ctx) == 0)
+			{
+				handle_impl->manager = manager_impl;
+			}
+
+			threading_rwlock_write_unlock(&manager_impl->lock);
+
 			return loader_impl_handle_init(impl, path, handle_impl, handle_ptr, 0);
 		}
+
+		threading_rwlock_write_unlock(&manager_impl->lock);
 	}
 	else
 	{
@@ -1352,8 +1403,16 @@ int loader_impl_clear(void *handle)
 
 		size_t iterator;
 
+		int result;
+
+		/* Clears are serialized with the loads of the same loader */
+		if (loader_impl_lock(impl) != 0)
+		{
+			return 1;
+		}
+
 		/* Remove the handle from the path indexing set */
-		int result = !(set_remove(impl->handle_impl_path_map, (set_key)handle_impl->path) == handle_impl);
+		result = !(set_remove(impl->handle_impl_path_map, (set_key)handle_impl->path) == handle_impl);
 
 		/* Remove the handle from the pointer indexing set */
 		result |= !(set_remove(impl->handle_impl_map, (set_key)handle_impl->module) == handle_impl);
@@ -1372,6 +1431,8 @@ int loader_impl_clear(void *handle)
 
 		loader_impl_destroy_handle(handle_impl);
 
+		loader_impl_unlock(impl);
+
 		return result;
 	}
 
@@ -1464,6 +1525,8 @@ void loader_impl_destroy_deallocate(loader_impl impl)
 
 	context_destroy(impl->ctx);
 
+	threading_rwlock_destroy(&impl->lock);
+
 	free(impl);
 }
 
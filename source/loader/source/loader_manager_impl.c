@@ -36,6 +36,8 @@
 #define LOADER_SCRIPT_PATH		   "LOADER_SCRIPT_PATH"
 #define LOADER_SCRIPT_DEFAULT_PATH "."
 
+#define LOADER_MANAGER_IMPL_SYMBOLS_NAME "__metacall_symbols__"
+
 /* -- Private Methods -- */
 
 static vector loader_manager_impl_script_paths_initialize(void);
@@ -148,6 +150,14 @@ loader_manager_impl loader_manager_impl_initialize(void)
 		goto destroy_map_error;
 	}
 
+	manager_impl->symbols = context_create(LOADER_MANAGER_IMPL_SYMBOLS_NAME);
+
+	if (manager_impl->symbols == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Loader failed to allocate the global symbol index");
+		goto symbols_error;
+	}
+
 	manager_impl->script_paths = loader_manager_impl_script_paths_initialize();
 
 	if (manager_impl->script_paths == NULL)
@@ -156,6 +166,12 @@ loader_manager_impl loader_manager_impl_initialize(void)
 		goto script_paths_error;
 	}
 
+	if (threading_rwlock_initialize(&manager_impl->lock) != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Loader failed to initialize the manager lock");
+		goto lock_error;
+	}
+
 	manager_impl->init_thread_id = thread_id_get_current();
 
 	manager_impl->host = loader_host_initialize();
@@ -169,8 +185,12 @@ loader_manager_impl loader_manager_impl_initialize(void)
 	return manager_impl;
 
 host_error:
+	threading_rwlock_destroy(&manager_impl->lock);
+lock_error:
 	loader_manager_impl_script_paths_destroy(manager_impl->script_paths);
 script_paths_error:
+	context_destroy(manager_impl->symbols);
+symbols_error:
 	set_destroy(manager_impl->destroy_map);
 destroy_map_error:
 	vector_destroy(manager_impl->initialization_order);
@@ -220,6 +240,26 @@ int loader_manager_impl_is_destroyed(loader_manager_impl manager_impl, loader_im
 	return set_get(manager_impl->destroy_map, impl) != &loader_manager_impl_is_destroyed_ptr;
 }
 
+int loader_manager_impl_symbols_append(loader_manager_impl manager_impl, context ctx)
+{
+	if (manager_impl == NULL || manager_impl->symbols == NULL || ctx == NULL)
+	{
+		return 1;
+	}
+
+	return context_append(manager_impl->symbols, ctx);
+}
+
+int loader_manager_impl_symbols_remove(loader_manager_impl manager_impl, context ctx)
+{
+	if (manager_impl == NULL || manager_impl->symbols == NULL || ctx == NULL)
+	{
+		return 1;
+	}
+
+	return context_remove(manager_impl->symbols, ctx);
+}
+
 void loader_manager_impl_destroy(loader_manager_impl manager_impl)
 {
 	if (manager_impl != NULL)
@@ -234,6 +274,13 @@ void loader_manager_impl_destroy(loader_manager_impl manager_impl)
 			set_destroy(manager_impl->destroy_map);
 		}
 
+		/* The index does not own the values, at this point all the loaders have
+		* detached their symbols from it, so it is empty and nothing is destroyed */
+		if (manager_impl->symbols != NULL)
+		{
+			context_destroy(manager_impl->symbols);
+		}
+
 		manager_impl->init_thread_id = THREAD_ID_INVALID;
 
 		if (manager_impl->script_paths != NULL)
@@ -241,6 +288,8 @@ void loader_manager_impl_destroy(loader_manager_impl manager_impl)
 			loader_manager_impl_script_paths_destroy(manager_impl->script_paths);
 		}
 
+		threading_rwlock_destroy(&manager_impl->lock);
+
 		free(manager_impl);
 	}
 }
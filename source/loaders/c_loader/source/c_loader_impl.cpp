@@ -35,12 +35,17 @@
 
 #include <metacall/metacall.h>
 
+#include <fstream>
 #include <iterator>
 #include <map>
 #include <new>
+#include <set>
 #include <string>
 #include <vector>
 
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
 
 /* LibFFI */
@@ -53,18 +58,43 @@
 #include <clang-c/CXString.h>
 #include <clang-c/Index.h>
 
+/* Version of the cache layout, it must be increased when the format of the entries changes */
+#define C_LOADER_IMPL_CACHE_VERSION 0x02
+
+/* Maximum size of a string stored in the cache, used for detecting corrupted entries */
+#define C_LOADER_IMPL_CACHE_STRING_SIZE 0x1000
+
 typedef struct loader_impl_c_type
 {
 	std::vector<std::string> execution_paths;
 	std::string libtcc_runtime_path;
+	std::string cache_path; /* Directory of the compiled object cache (empty if disabled) */
 
 } * loader_impl_c;
 
+typedef struct loader_impl_c_cache_parameter_type
+{
+	std::string name;
+	std::string type_name;
+	type_id id;
+
+} loader_impl_c_cache_parameter;
+
+typedef struct loader_impl_c_cache_signature_type
+{
+	std::string name;
+	std::vector<loader_impl_c_cache_parameter> parameters; /* The first one is the return type */
+
+} loader_impl_c_cache_signature;
+
 typedef struct loader_impl_c_handle_type
 {
 	TCCState *state;
 	std::vector<std::string> files;
 	std::map<std::string, const void *> symbols;
+	std::string cache_entry; /* Path of the cache entry without extension (empty if not cached) */
+	std::vector<loader_impl_c_cache_signature> signatures;
+	bool cacheable; /* False if any signature cannot be stored (i.e closures need Clang cursors) */
 
 } * loader_impl_c_handle;
 
@@ -93,6 +123,11 @@ static ffi_type *c_loader_impl_ffi_type(type_id id);
 /* Retrieve the type from the Clang type */
 static type c_loader_impl_discover_type(loader_impl impl, CXCursor &cursor, CXType &cx_type);
 
+class c_loader_type_impl;
+
+/* Create a type and register it into the loader */
+static type c_loader_impl_define_type(loader_impl impl, type_id id, const char *name, c_loader_type_impl *impl_type);
+
 /* Convert CXString to std::string */
 static std::string c_loader_impl_cxstring_to_str(const CXString &s);
 
@@ -284,40 +319,45 @@ void c_loader_impl_function_closure(ffi_cif *cif, void *ret, void *args[], void
 	delete[] values;
 }
 
-static loader_impl_c_handle c_loader_impl_handle_create(loader_impl_c c_impl)
+static std::string c_loader_impl_include_path(void)
 {
-	loader_impl_c_handle c_handle = new loader_impl_c_handle_type();
+	const char *loader_lib_path = loader_library_path();
+	const char *include_dir = "../include";
+	char join_path[PORTABILITY_PATH_SIZE];
+	char metacall_incl_path[PORTABILITY_PATH_SIZE];
 
-	if (c_handle == nullptr)
-	{
-		return nullptr;
-	}
+	size_t join_path_size = portability_path_join(loader_lib_path, strlen(loader_lib_path) + 1, include_dir, strlen(include_dir) + 1, join_path, PORTABILITY_PATH_SIZE);
+	size_t metacall_incl_path_size = portability_path_canonical(join_path, join_path_size, metacall_incl_path, PORTABILITY_PATH_SIZE);
 
-	c_handle->state = tcc_new();
+	return std::string(metacall_incl_path, metacall_incl_path_size > 0 ? metacall_incl_path_size - 1 : 0);
+}
 
-	if (c_handle->state == NULL)
+static TCCState *c_loader_impl_tcc_create(loader_impl_c c_impl, int output_type)
+{
+	TCCState *state = tcc_new();
+
+	if (state == NULL)
 	{
-		delete c_handle;
-		return nullptr;
+		return NULL;
 	}
 
-	/* JIT the code into memory */
-	tcc_set_output_type(c_handle->state, TCC_OUTPUT_MEMORY);
+	/* JIT the code into memory or compile it into a relocatable object */
+	tcc_set_output_type(state, output_type);
 
 	/* Register runtime path for TCC (in order to find libtcc1.a and runtime objects) */
-	tcc_set_lib_path(c_handle->state, c_impl->libtcc_runtime_path.c_str());
+	tcc_set_lib_path(state, c_impl->libtcc_runtime_path.c_str());
 
 	/* Register execution paths */
 	for (auto exec_path : c_impl->execution_paths)
 	{
-		tcc_add_include_path(c_handle->state, exec_path.c_str());
-		tcc_add_library_path(c_handle->state, exec_path.c_str());
+		tcc_add_include_path(state, exec_path.c_str());
+		tcc_add_library_path(state, exec_path.c_str());
 	}
 
 	/* TODO */
 	/*
 	#if (!defined(NDEBUG) || defined(DEBUG) || defined(_DEBUG) || defined(__DEBUG) || defined(__DEBUG__))
-		tcc_enable_debug(c_handle->state);
+		tcc_enable_debug(state);
 	#endif
 	*/
 
@@ -327,20 +367,33 @@ static loader_impl_c_handle c_loader_impl_handle_create(loader_impl_c c_impl)
 	/* TODO: Add some warnings? */
 	/* tcc_set_warning */
 
-	/* tcc_add_include_path, tcc_add_library_path */
-	const char *loader_lib_path = loader_library_path();
-	const char *include_dir = "../include";
-	char join_path[PORTABILITY_PATH_SIZE];
-	char metacall_incl_path[PORTABILITY_PATH_SIZE];
-
-	size_t join_path_size = portability_path_join(loader_lib_path, strlen(loader_lib_path) + 1, include_dir, strlen(include_dir) + 1, join_path, PORTABILITY_PATH_SIZE);
-	(void)portability_path_canonical(join_path, join_path_size, metacall_incl_path, PORTABILITY_PATH_SIZE);
-
 	/* Add metacall include path */
-	tcc_add_include_path(c_handle->state, metacall_incl_path);
+	tcc_add_include_path(state, c_loader_impl_include_path().c_str());
 
 	/* Add metacall library path (in other to find metacall library) */
-	tcc_add_library_path(c_handle->state, c_impl->libtcc_runtime_path.c_str());
+	tcc_add_library_path(state, c_impl->libtcc_runtime_path.c_str());
+
+	return state;
+}
+
+static loader_impl_c_handle c_loader_impl_handle_create(loader_impl_c c_impl)
+{
+	loader_impl_c_handle c_handle = new loader_impl_c_handle_type();
+
+	if (c_handle == nullptr)
+	{
+		return nullptr;
+	}
+
+	c_handle->state = c_loader_impl_tcc_create(c_impl, TCC_OUTPUT_MEMORY);
+
+	if (c_handle->state == NULL)
+	{
+		delete c_handle;
+		return nullptr;
+	}
+
+	c_handle->cacheable = true;
 
 	return c_handle;
 }
@@ -510,7 +563,8 @@ function_interface function_c_singleton()
 		&function_c_interface_create,
 		&function_c_interface_invoke,
 		&function_c_interface_await,
-		&function_c_interface_destroy
+		&function_c_interface_destroy,
+		NULL
 	};
 
 	return &c_interface;
@@ -608,6 +662,14 @@ loader_impl_data c_loader_impl_initialize(loader_impl impl, configuration config
 
 	c_impl->libtcc_runtime_path = std::string(value_to_string(path), value_type_size(path));
 
+	/* Enable the compiled object cache if the directory has been provided in the loader configuration */
+	value cache_path = configuration_value(config, "cache_path");
+
+	if (cache_path != NULL && value_type_id(cache_path) == TYPE_STRING)
+	{
+		c_impl->cache_path = std::string(value_to_string(cache_path), value_type_size(cache_path) - 1);
+	}
+
 	/* Register initialization */
 	loader_initialization_register(impl);
 
@@ -725,7 +787,12 @@ type c_loader_impl_discover_type(loader_impl impl, CXCursor &cursor, CXType &cx_
 	c_loader_type_impl *impl_type = NULL;
 	type_id id = c_loader_impl_clang_type(impl, cursor, cx_type, &impl_type);
 
-	t = type_create(id, type_str.c_str(), impl_type, &type_c_singleton);
+	return c_loader_impl_define_type(impl, id, type_str.c_str(), impl_type);
+}
+
+static type c_loader_impl_define_type(loader_impl impl, type_id id, const char *name, c_loader_type_impl *impl_type)
+{
+	type t = type_create(id, name, impl_type, &type_c_singleton);
 
 	if (t == NULL)
 	{
@@ -741,11 +808,8 @@ type c_loader_impl_discover_type(loader_impl impl, CXCursor &cursor, CXType &cx_
 	return t;
 }
 
-static int c_loader_impl_discover_signature(loader_impl impl, loader_impl_c_handle c_handle, scope sp, CXCursor cursor)
+static int c_loader_impl_register_function(loader_impl_c_handle c_handle, scope sp, const std::string &func_name, type ret_type, const std::vector<std::string> &arg_names, const std::vector<type> &arg_types)
 {
-	auto cursor_type = clang_getCursorType(cursor);
-	auto func_name = c_loader_impl_cxstring_to_str(clang_getCursorSpelling(cursor));
-
 	if (c_handle->symbols.count(func_name) == 0)
 	{
 		log_write("metacall", LOG_LEVEL_ERROR, "Symbol '%s' not found, skipping the function", func_name.c_str());
@@ -756,15 +820,11 @@ static int c_loader_impl_discover_signature(loader_impl impl, loader_impl_c_hand
 
 	c_function->address = c_handle->symbols[func_name];
 
-	int num_args = clang_Cursor_getNumArguments(cursor);
-	size_t args_size = num_args < 0 ? (size_t)0 : (size_t)num_args;
+	size_t args_size = arg_types.size();
 
 	function f = function_create(func_name.c_str(), args_size, c_function, &function_c_singleton);
 	signature s = function_signature(f);
 
-	auto result_type = clang_getResultType(cursor_type);
-	type ret_type = c_loader_impl_discover_type(impl, cursor, result_type);
-
 	signature_set_return(s, ret_type);
 
 	c_function->ret_type = c_loader_impl_ffi_type(type_index(ret_type));
@@ -773,13 +833,8 @@ static int c_loader_impl_discover_signature(loader_impl impl, loader_impl_c_hand
 
 	for (size_t args_count = 0; args_count < args_size; ++args_count)
 	{
-		auto arg_cursor = clang_Cursor_getArgument(cursor, args_count);
-		auto arg_name = c_loader_impl_cxstring_to_str(clang_getCursorSpelling(arg_cursor));
-		auto arg_type = clang_getArgType(cursor_type, args_count);
-		type t = c_loader_impl_discover_type(impl, arg_cursor, arg_type);
-
-		signature_set(s, args_count, arg_name.c_str(), t);
-		c_function->arg_types[args_count] = c_loader_impl_ffi_type(type_index(t));
+		signature_set(s, args_count, arg_names[args_count].c_str(), arg_types[args_count]);
+		c_function->arg_types[args_count] = c_loader_impl_ffi_type(type_index(arg_types[args_count]));
 	}
 
 	if (ffi_prep_cif(&c_function->cif, FFI_DEFAULT_ABI, args_size, c_function->ret_type, c_function->arg_types) != FFI_OK)
@@ -800,6 +855,68 @@ static int c_loader_impl_discover_signature(loader_impl impl, loader_impl_c_hand
 	return 0;
 }
 
+static void c_loader_impl_cache_parameter(loader_impl_c_handle c_handle, loader_impl_c_cache_signature &signature, const std::string &name, type t)
+{
+	/* Closures are prepared from the Clang cursor, so they cannot be restored from the cache */
+	if (t == NULL || type_index(t) == TYPE_FUNCTION)
+	{
+		c_handle->cacheable = false;
+		return;
+	}
+
+	loader_impl_c_cache_parameter parameter = { name, type_name(t), type_index(t) };
+
+	signature.parameters.push_back(parameter);
+}
+
+static int c_loader_impl_discover_signature(loader_impl impl, loader_impl_c_handle c_handle, scope sp, CXCursor cursor)
+{
+	auto cursor_type = clang_getCursorType(cursor);
+	auto func_name = c_loader_impl_cxstring_to_str(clang_getCursorSpelling(cursor));
+
+	int num_args = clang_Cursor_getNumArguments(cursor);
+	size_t args_size = num_args < 0 ? (size_t)0 : (size_t)num_args;
+
+	auto result_type = clang_getResultType(cursor_type);
+	type ret_type = c_loader_impl_discover_type(impl, cursor, result_type);
+
+	std::vector<std::string> arg_names;
+	std::vector<type> arg_types;
+
+	for (size_t args_count = 0; args_count < args_size; ++args_count)
+	{
+		auto arg_cursor = clang_Cursor_getArgument(cursor, args_count);
+		auto arg_type = clang_getArgType(cursor_type, args_count);
+
+		arg_names.push_back(c_loader_impl_cxstring_to_str(clang_getCursorSpelling(arg_cursor)));
+		arg_types.push_back(c_loader_impl_discover_type(impl, arg_cursor, arg_type));
+	}
+
+	if (c_loader_impl_register_function(c_handle, sp, func_name, ret_type, arg_names, arg_types) != 0)
+	{
+		return 1;
+	}
+
+	/* Record the signature in order to store it into the cache after the discovery */
+	if (c_handle->cache_entry.empty() == false && c_handle->cacheable == true)
+	{
+		loader_impl_c_cache_signature signature;
+
+		signature.name = func_name;
+
+		c_loader_impl_cache_parameter(c_handle, signature, std::string(), ret_type);
+
+		for (size_t args_count = 0; args_count < args_size; ++args_count)
+		{
+			c_loader_impl_cache_parameter(c_handle, signature, arg_names[args_count], arg_types[args_count]);
+		}
+
+		c_handle->signatures.push_back(signature);
+	}
+
+	return 0;
+}
+
 static CXChildVisitResult c_loader_impl_discover_visitor(CXCursor cursor, CXCursor, void *data)
 {
 	c_loader_impl_discover_visitor_data visitor_data = static_cast<c_loader_impl_discover_visitor_data>(data);
@@ -886,53 +1003,557 @@ static void c_loader_impl_handle_add(loader_impl_c_handle c_handle, const loader
 	}
 }
 
-loader_handle c_loader_impl_load_from_file(loader_impl impl, const loader_path paths[], size_t size)
+static std::string c_loader_impl_cache_path(const std::string &directory, const std::string &name)
 {
-	loader_impl_c c_impl = static_cast<loader_impl_c>(loader_impl_get(impl));
-	loader_impl_c_handle c_handle = c_loader_impl_handle_create(c_impl);
+	loader_path path;
+	size_t size = portability_path_join(directory.c_str(), directory.length() + 1, name.c_str(), name.length() + 1, path, LOADER_PATH_SIZE);
 
-	if (c_handle == nullptr)
+	return std::string(path, size - 1);
+}
+
+static void c_loader_impl_cache_hash(uint64_t &hash, const char *data, size_t size)
+{
+	/* FNV-1a */
+	for (size_t iterator = 0; iterator < size; ++iterator)
 	{
-		return NULL;
+		hash ^= static_cast<uint64_t>(static_cast<unsigned char>(data[iterator]));
+		hash *= UINT64_C(0x100000001B3);
 	}
+}
 
-	for (size_t iterator = 0; iterator < size; ++iterator)
+static void c_loader_impl_cache_hash_str(uint64_t &hash, const std::string &str)
+{
+	/* Include the null terminator so concatenated strings do not collide */
+	c_loader_impl_cache_hash(hash, str.c_str(), str.length() + 1);
+}
+
+static bool c_loader_impl_cache_hash_file(uint64_t &hash, const std::string &path)
+{
+	std::ifstream stream(path, std::ios::in | std::ios::binary);
+	char buffer[0x1000];
+
+	if (!stream)
+	{
+		return false;
+	}
+
+	while (stream.read(buffer, sizeof(buffer)) || stream.gcount() > 0)
+	{
+		c_loader_impl_cache_hash(hash, buffer, static_cast<size_t>(stream.gcount()));
+	}
+
+	return true;
+}
+
+static std::string c_loader_impl_cache_key(loader_impl_c c_impl, const std::vector<std::string> &files)
+{
+	uint64_t hash = UINT64_C(0xCBF29CE484222325);
+
+	/* The key covers everything that changes the output of the compiler: the layout version,
+	the include and library paths, and the path and contents of each source, the headers
+	included from the sources are tracked apart in the dependency list of the entry */
+	c_loader_impl_cache_hash_str(hash, std::to_string(C_LOADER_IMPL_CACHE_VERSION));
+	c_loader_impl_cache_hash_str(hash, std::to_string(sizeof(void *)));
+	c_loader_impl_cache_hash_str(hash, c_impl->libtcc_runtime_path);
+	c_loader_impl_cache_hash_str(hash, loader_library_path());
+
+	for (auto exec_path : c_impl->execution_paths)
+	{
+		c_loader_impl_cache_hash_str(hash, exec_path);
+	}
+
+	for (auto file : files)
+	{
+		c_loader_impl_cache_hash_str(hash, file);
+
+		if (c_loader_impl_cache_hash_file(hash, file) == false)
+		{
+			return std::string();
+		}
+	}
+
+	char key[sizeof(uint64_t) * 2 + 1];
+
+	snprintf(key, sizeof(key), "%016llx", static_cast<unsigned long long>(hash));
+
+	return std::string(key);
+}
+
+static void c_loader_impl_cache_write_str(std::ofstream &stream, const std::string &str)
+{
+	uint32_t size = static_cast<uint32_t>(str.length());
+
+	stream.write(reinterpret_cast<const char *>(&size), sizeof(size));
+	stream.write(str.c_str(), size);
+}
+
+static bool c_loader_impl_cache_read_str(std::ifstream &stream, std::string &str)
+{
+	uint32_t size = 0;
+
+	if (!stream.read(reinterpret_cast<char *>(&size), sizeof(size)) || size > C_LOADER_IMPL_CACHE_STRING_SIZE)
+	{
+		return false;
+	}
+
+	str.resize(size);
+
+	return size == 0 || static_cast<bool>(stream.read(&str[0], size));
+}
+
+static void c_loader_impl_cache_inclusion(CXFile file, CXSourceLocation *stack, unsigned int depth, CXClientData data)
+{
+	std::set<std::string> *dependencies = static_cast<std::set<std::string> *>(data);
+
+	(void)stack;
+
+	/* The sources have depth zero, they are already part of the key */
+	if (depth > 0)
+	{
+		CXString name = clang_getFileName(file);
+		const char *path = clang_getCString(name);
+
+		if (path != NULL)
+		{
+			dependencies->insert(path);
+		}
+
+		clang_disposeString(name);
+	}
+}
+
+static int c_loader_impl_cache_dependencies(loader_impl_c c_impl, const std::vector<std::string> &files, std::set<std::string> &dependencies)
+{
+	std::vector<std::string> include_args;
+	std::vector<const char *> args;
+
+	/* Resolve the headers with the same include paths as TCC */
+	for (auto exec_path : c_impl->execution_paths)
+	{
+		include_args.push_back("-I" + exec_path);
+	}
+
+	include_args.push_back("-I" + c_loader_impl_include_path());
+
+	for (auto &arg : include_args)
+	{
+		args.push_back(arg.c_str());
+	}
+
+	for (auto file : files)
+	{
+		CXIndex index = clang_createIndex(0, 0);
+		CXTranslationUnit unit = clang_parseTranslationUnit(
+			index,
+			file.c_str(), args.data(), static_cast<int>(args.size()),
+			nullptr, 0,
+			CXTranslationUnit_SkipFunctionBodies);
+
+		if (unit == nullptr)
+		{
+			clang_disposeIndex(index);
+			return 1;
+		}
+
+		clang_getInclusions(unit, &c_loader_impl_cache_inclusion, static_cast<CXClientData>(&dependencies));
+
+		clang_disposeTranslationUnit(unit);
+		clang_disposeIndex(index);
+	}
+
+	return 0;
+}
+
+static void c_loader_impl_cache_store_dependencies(loader_impl_c_handle c_handle, const std::string &entry, const std::set<std::string> &dependencies)
+{
+	std::string path = entry + ".dep";
+	std::string temp_path = path + "." + std::to_string(reinterpret_cast<uintptr_t>(c_handle)) + ".tmp";
+	std::ofstream stream(temp_path, std::ios::out | std::ios::binary | std::ios::trunc);
+	uint32_t version = C_LOADER_IMPL_CACHE_VERSION;
+	uint32_t dependencies_size = static_cast<uint32_t>(dependencies.size());
+
+	if (!stream)
+	{
+		return;
+	}
+
+	stream.write(reinterpret_cast<const char *>(&version), sizeof(version));
+	stream.write(reinterpret_cast<const char *>(&dependencies_size), sizeof(dependencies_size));
+
+	for (auto &dependency : dependencies)
 	{
-		size_t path_size = strnlen(paths[iterator], LOADER_PATH_SIZE) + 1;
+		uint64_t hash = UINT64_C(0xCBF29CE484222325);
 
-		/* We assume it is a path so we load from path */
-		if (portability_path_is_absolute(paths[iterator], path_size) == 0)
+		if (c_loader_impl_cache_hash_file(hash, dependency) == false)
 		{
-			if (tcc_add_file(c_handle->state, paths[iterator]) == -1)
+			stream.close();
+			std::remove(temp_path.c_str());
+			return;
+		}
+
+		c_loader_impl_cache_write_str(stream, dependency);
+		stream.write(reinterpret_cast<const char *>(&hash), sizeof(hash));
+	}
+
+	stream.close();
+
+	if (!stream || std::rename(temp_path.c_str(), path.c_str()) != 0)
+	{
+		std::remove(temp_path.c_str());
+	}
+}
+
+static bool c_loader_impl_cache_valid_dependencies(const std::string &entry)
+{
+	std::ifstream stream(entry + ".dep", std::ios::in | std::ios::binary);
+	uint32_t version = 0, dependencies_size = 0;
+
+	if (!stream)
+	{
+		return false;
+	}
+
+	if (!stream.read(reinterpret_cast<char *>(&version), sizeof(version)) || version != C_LOADER_IMPL_CACHE_VERSION)
+	{
+		return false;
+	}
+
+	if (!stream.read(reinterpret_cast<char *>(&dependencies_size), sizeof(dependencies_size)))
+	{
+		return false;
+	}
+
+	/* The entry is only valid if every header included by the sources still has the same contents */
+	for (uint32_t iterator = 0; iterator < dependencies_size; ++iterator)
+	{
+		std::string dependency;
+		uint64_t stored = 0, hash = UINT64_C(0xCBF29CE484222325);
+
+		if (c_loader_impl_cache_read_str(stream, dependency) == false || !stream.read(reinterpret_cast<char *>(&stored), sizeof(stored)))
+		{
+			return false;
+		}
+
+		if (c_loader_impl_cache_hash_file(hash, dependency) == false || hash != stored)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static int c_loader_impl_cache_object(loader_impl_c c_impl, loader_impl_c_handle c_handle, const std::string &object_path)
+{
+	TCCState *state = c_loader_impl_tcc_create(c_impl, TCC_OUTPUT_OBJ);
+
+	if (state == NULL)
+	{
+		return 1;
+	}
+
+	for (auto file : c_handle->files)
+	{
+		if (tcc_add_file(state, file.c_str()) == -1)
+		{
+			tcc_delete(state);
+			return 1;
+		}
+	}
+
+	/* Write into a temporary file and rename it, so concurrent loaders never read a partial object */
+	std::string temp_path = object_path + "." + std::to_string(reinterpret_cast<uintptr_t>(c_handle)) + ".tmp";
+
+	if (tcc_output_file(state, temp_path.c_str()) == -1)
+	{
+		log_write("metacall", LOG_LEVEL_WARNING, "Failed to write the C loader cache object: %s", temp_path.c_str());
+		std::remove(temp_path.c_str());
+		tcc_delete(state);
+		return 1;
+	}
+
+	tcc_delete(state);
+
+	if (std::rename(temp_path.c_str(), object_path.c_str()) != 0)
+	{
+		std::remove(temp_path.c_str());
+
+		/* Another loader may have won the race and stored the same object */
+		return c_loader_impl_file_exists(object_path.c_str()) == true ? 0 : 1;
+	}
+
+	return 0;
+}
+
+static int c_loader_impl_cache_compile(loader_impl_c c_impl, loader_impl_c_handle c_handle, const std::vector<std::string> &inputs)
+{
+	if (c_impl->cache_path.empty() == true || c_handle->files.empty() == true)
+	{
+		return 1;
+	}
+
+	std::string key = c_loader_impl_cache_key(c_impl, c_handle->files);
+
+	if (key.empty() == true)
+	{
+		return 1;
+	}
+
+	std::string entry = c_loader_impl_cache_path(c_impl->cache_path, key);
+	std::string object_path = entry + ".o";
+
+	/* On a cache miss, or if any included header has changed, compile the sources into a relocatable object */
+	if (c_loader_impl_file_exists(object_path.c_str()) == false || c_loader_impl_cache_valid_dependencies(entry) == false)
+	{
+		std::set<std::string> dependencies;
+
+		/* The signatures may depend on the headers too, drop them so the discovery stores them again */
+		std::remove((entry + ".dep").c_str());
+		std::remove((entry + ".sig").c_str());
+
+		if (c_loader_impl_cache_object(c_impl, c_handle, object_path) != 0)
+		{
+			return 1;
+		}
+
+		/* Without the dependency list the entry is never valid, so it will be compiled again in the next load */
+		if (c_loader_impl_cache_dependencies(c_impl, c_handle->files, dependencies) == 0)
+		{
+			c_loader_impl_cache_store_dependencies(c_handle, entry, dependencies);
+		}
+	}
+
+	/* Load the relocatable object instead of the sources, so TCC only has to link it */
+	if (tcc_add_file(c_handle->state, object_path.c_str()) == -1)
+	{
+		/* Remove the entry so it gets compiled again in the next load */
+		log_write("metacall", LOG_LEVEL_ERROR, "Failed to load the C loader cache object: %s", object_path.c_str());
+		std::remove(object_path.c_str());
+		std::remove((entry + ".dep").c_str());
+		std::remove((entry + ".sig").c_str());
+		return -1;
+	}
+
+	/* Linker scripts are not part of the object, add them after it */
+	for (auto input : inputs)
+	{
+		if (c_loader_impl_is_ld_script(input.c_str(), input.length() + 1) == true && tcc_add_file(c_handle->state, input.c_str()) == -1)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Failed to load file: %s", input.c_str());
+			return -1;
+		}
+	}
+
+	c_handle->cache_entry = entry;
+
+	return 0;
+}
+
+static void c_loader_impl_cache_store_signatures(loader_impl_c_handle c_handle)
+{
+	std::string path = c_handle->cache_entry + ".sig";
+	std::string temp_path = path + "." + std::to_string(reinterpret_cast<uintptr_t>(c_handle)) + ".tmp";
+	std::ofstream stream(temp_path, std::ios::out | std::ios::binary | std::ios::trunc);
+	uint32_t version = C_LOADER_IMPL_CACHE_VERSION;
+	uint32_t signatures_size = static_cast<uint32_t>(c_handle->signatures.size());
+
+	if (!stream)
+	{
+		return;
+	}
+
+	stream.write(reinterpret_cast<const char *>(&version), sizeof(version));
+	stream.write(reinterpret_cast<const char *>(&signatures_size), sizeof(signatures_size));
+
+	for (auto &signature : c_handle->signatures)
+	{
+		uint32_t parameters_size = static_cast<uint32_t>(signature.parameters.size());
+
+		c_loader_impl_cache_write_str(stream, signature.name);
+		stream.write(reinterpret_cast<const char *>(&parameters_size), sizeof(parameters_size));
+
+		for (auto &parameter : signature.parameters)
+		{
+			int32_t id = static_cast<int32_t>(parameter.id);
+
+			c_loader_impl_cache_write_str(stream, parameter.name);
+			c_loader_impl_cache_write_str(stream, parameter.type_name);
+			stream.write(reinterpret_cast<const char *>(&id), sizeof(id));
+		}
+	}
+
+	stream.close();
+
+	if (!stream || std::rename(temp_path.c_str(), path.c_str()) != 0)
+	{
+		std::remove(temp_path.c_str());
+	}
+}
+
+static bool c_loader_impl_cache_load_signatures(loader_impl_c_handle c_handle, std::vector<loader_impl_c_cache_signature> &signatures)
+{
+	std::ifstream stream(c_handle->cache_entry + ".sig", std::ios::in | std::ios::binary);
+	uint32_t version = 0, signatures_size = 0;
+
+	if (!stream)
+	{
+		return false;
+	}
+
+	if (!stream.read(reinterpret_cast<char *>(&version), sizeof(version)) || version != C_LOADER_IMPL_CACHE_VERSION)
+	{
+		return false;
+	}
+
+	if (!stream.read(reinterpret_cast<char *>(&signatures_size), sizeof(signatures_size)))
+	{
+		return false;
+	}
+
+	for (uint32_t iterator = 0; iterator < signatures_size; ++iterator)
+	{
+		loader_impl_c_cache_signature signature;
+		uint32_t parameters_size = 0;
+
+		if (c_loader_impl_cache_read_str(stream, signature.name) == false || !stream.read(reinterpret_cast<char *>(&parameters_size), sizeof(parameters_size)) || parameters_size == 0)
+		{
+			return false;
+		}
+
+		for (uint32_t parameter_it = 0; parameter_it < parameters_size; ++parameter_it)
+		{
+			loader_impl_c_cache_parameter parameter;
+			int32_t id = 0;
+
+			if (c_loader_impl_cache_read_str(stream, parameter.name) == false || c_loader_impl_cache_read_str(stream, parameter.type_name) == false ||
+				!stream.read(reinterpret_cast<char *>(&id), sizeof(id)) || id < 0 || id > TYPE_INVALID)
 			{
-				log_write("metacall", LOG_LEVEL_ERROR, "Failed to load file: %s", paths[iterator]);
-				c_loader_impl_handle_destroy(c_handle);
-				return NULL;
+				return false;
 			}
 
-			c_loader_impl_handle_add(c_handle, paths[iterator], path_size);
+			parameter.id = static_cast<type_id>(id);
+
+			signature.parameters.push_back(parameter);
 		}
-		else
+
+		signatures.push_back(signature);
+	}
+
+	return true;
+}
+
+static int c_loader_impl_cache_discover(loader_impl impl, loader_impl_c_handle c_handle, context ctx, const std::vector<loader_impl_c_cache_signature> &signatures)
+{
+	scope sp = context_scope(ctx);
+
+	for (auto &signature : signatures)
+	{
+		std::vector<std::string> arg_names;
+		std::vector<type> types;
+
+		for (auto &parameter : signature.parameters)
 		{
-			bool found = false;
+			type t = loader_impl_type(impl, parameter.type_name.c_str());
 
-			/* Otherwise, check the execution paths */
-			for (auto exec_path : c_impl->execution_paths)
+			if (t == NULL)
 			{
-				loader_path path;
-				size_t path_size = portability_path_join(exec_path.c_str(), exec_path.length() + 1, paths[iterator], strnlen(paths[iterator], LOADER_PATH_SIZE) + 1, path, LOADER_PATH_SIZE);
+				t = c_loader_impl_define_type(impl, parameter.id, parameter.type_name.c_str(), NULL);
+			}
 
-				if (c_loader_impl_file_exists(path) == true && tcc_add_file(c_handle->state, path) != -1)
-				{
-					c_loader_impl_handle_add(c_handle, path, path_size);
-					found = true;
-					break;
-				}
+			if (t == NULL)
+			{
+				log_write("metacall", LOG_LEVEL_ERROR, "Failed to define type %s from the C loader cache", parameter.type_name.c_str());
+				return 1;
 			}
 
-			if (found == false)
+			arg_names.push_back(parameter.name);
+			types.push_back(t);
+		}
+
+		/* The first parameter is the return type */
+		type ret_type = types.front();
+
+		arg_names.erase(arg_names.begin());
+		types.erase(types.begin());
+
+		if (c_loader_impl_register_function(c_handle, sp, signature.name, ret_type, arg_names, types) != 0)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Failed to discover C function declaration '%s' from the cache", signature.name.c_str());
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static bool c_loader_impl_resolve_path(loader_impl_c c_impl, const loader_path path, std::string &result)
+{
+	size_t path_size = strnlen(path, LOADER_PATH_SIZE) + 1;
+
+	/* We assume it is a path so we load from path */
+	if (portability_path_is_absolute(path, path_size) == 0)
+	{
+		result = std::string(path, path_size - 1);
+		return true;
+	}
+
+	/* Otherwise, check the execution paths */
+	for (auto exec_path : c_impl->execution_paths)
+	{
+		loader_path join_path;
+		size_t join_path_size = portability_path_join(exec_path.c_str(), exec_path.length() + 1, path, path_size, join_path, LOADER_PATH_SIZE);
+
+		if (c_loader_impl_file_exists(join_path) == true)
+		{
+			result = std::string(join_path, join_path_size - 1);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+loader_handle c_loader_impl_load_from_file(loader_impl impl, const loader_path paths[], size_t size)
+{
+	loader_impl_c c_impl = static_cast<loader_impl_c>(loader_impl_get(impl));
+	loader_impl_c_handle c_handle = c_loader_impl_handle_create(c_impl);
+	std::vector<std::string> inputs;
+
+	if (c_handle == nullptr)
+	{
+		return NULL;
+	}
+
+	for (size_t iterator = 0; iterator < size; ++iterator)
+	{
+		std::string input;
+
+		if (c_loader_impl_resolve_path(c_impl, paths[iterator], input) == false)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Failed to load file: %s", paths[iterator]);
+			c_loader_impl_handle_destroy(c_handle);
+			return NULL;
+		}
+
+		c_loader_impl_handle_add(c_handle, input.c_str(), input.length() + 1);
+		inputs.push_back(input);
+	}
+
+	/* Try to load the relocatable object from the cache, otherwise compile the sources into memory */
+	int cache_result = c_loader_impl_cache_compile(c_impl, c_handle, inputs);
+
+	if (cache_result == -1)
+	{
+		c_loader_impl_handle_destroy(c_handle);
+		return NULL;
+	}
+	else if (cache_result == 1)
+	{
+		for (auto input : inputs)
+		{
+			if (tcc_add_file(c_handle->state, input.c_str()) == -1)
 			{
-				log_write("metacall", LOG_LEVEL_ERROR, "Failed to load file: %s", paths[iterator]);
+				log_write("metacall", LOG_LEVEL_ERROR, "Failed to load file: %s", input.c_str());
 				c_loader_impl_handle_destroy(c_handle);
 				return NULL;
 			}
@@ -1033,8 +1654,26 @@ int c_loader_impl_discover(loader_impl impl, loader_handle handle, context ctx)
 	/* Get all symbols */
 	tcc_list_symbols(c_handle->state, static_cast<void *>(c_handle), &c_loader_impl_discover_symbols);
 
+	/* Register the functions from the cached signatures, skipping the Clang pass */
+	if (c_handle->cache_entry.empty() == false)
+	{
+		std::vector<loader_impl_c_cache_signature> signatures;
+
+		if (c_loader_impl_cache_load_signatures(c_handle, signatures) == true)
+		{
+			return c_loader_impl_cache_discover(impl, c_handle, ctx, signatures);
+		}
+	}
+
 	/* Parse the AST and register functions */
-	return c_loader_impl_discover_ast(impl, c_handle, ctx);
+	int result = c_loader_impl_discover_ast(impl, c_handle, ctx);
+
+	if (result == 0 && c_handle->cache_entry.empty() == false && c_handle->cacheable == true)
+	{
+		c_loader_impl_cache_store_signatures(c_handle);
+	}
+
+	return result;
 }
 
 int c_loader_impl_destroy(loader_impl impl)
@@ -160,7 +160,8 @@ function_interface function_cs_singleton(void)
 		&function_cs_interface_create,
 		&function_cs_interface_invoke,
 		&function_cs_interface_await,
-		&function_cs_interface_destroy
+		&function_cs_interface_destroy,
+		NULL
 	};
 
 	return &cs_interface;
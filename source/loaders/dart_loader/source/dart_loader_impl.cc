@@ -242,7 +242,8 @@ function_interface function_dart_singleton(void)
 		&function_dart_interface_create,
 		&function_dart_interface_invoke,
 		&function_dart_interface_await,
-		&function_dart_interface_destroy
+		&function_dart_interface_destroy,
+		NULL
 	};
 
 	return &dart_interface;
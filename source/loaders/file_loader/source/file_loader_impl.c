@@ -164,7 +164,8 @@ function_interface function_file_singleton(void)
 		&function_file_interface_create,
 		&function_file_interface_invoke,
 		&function_file_interface_await,
-		&function_file_interface_destroy
+		&function_file_interface_destroy,
+		NULL
 	};
 
 	return &file_interface;
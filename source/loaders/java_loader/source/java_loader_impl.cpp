@@ -32,7 +32,10 @@
 #include <log/log.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <map>
+#include <mutex>
 #include <string>
 
 #include <jni.h>
@@ -40,7 +43,24 @@
 typedef struct loader_impl_java_type
 {
 	JavaVM *jvm; // Pointer to the JVM (Java Virtual Machine)
-	JNIEnv *env; // Pointer to native interface
+
+	jclass bootstrap_cls; // Global reference to the bootstrap class
+	jclass string_cls;	  // Global reference to java.lang.String
+
+	jmethodID class_get_name_id; // java.lang.Class.getName
+
+	jmethodID execution_path_id;			 // bootstrap.java_bootstrap_execution_path
+	jmethodID find_class_id;				 // bootstrap.FindClass
+	jmethodID load_from_file_id;			 // bootstrap.loadFromFile
+	jmethodID load_from_memory_id;			 // bootstrap.load_from_memory
+	jmethodID load_from_package_id;			 // bootstrap.load_from_package
+	jmethodID get_class_name_id;			 // bootstrap.java_bootstrap_get_class_name
+	jmethodID discover_fields_id;			 // bootstrap.java_bootstrap_discover_fields
+	jmethodID discover_fields_details_id;	 // bootstrap.java_bootstrap_discover_fields_details
+	jmethodID discover_methods_id;			 // bootstrap.java_bootstrap_discover_methods
+	jmethodID discover_method_details_id;	 // bootstrap.java_bootstrap_discover_method_details
+	jmethodID discover_method_args_size_id;	 // bootstrap.java_bootstrap_discover_method_args_size
+	jmethodID discover_method_parameters_id; // bootstrap.java_bootstrap_discover_method_parameters
 
 } * loader_impl_java;
 
@@ -55,9 +75,11 @@ typedef struct loader_impl_java_class_type
 {
 	const char *name;
 	jobject cls;
-	jclass concls;
+	jclass concls; // Global reference to the class resolved with bootstrap.FindClass at discover time
 	loader_impl impl;
 	loader_impl_java java_impl;
+	std::map<std::string, jmethodID> constructors; // Constructor ids indexed by JNI signature
+	std::mutex constructors_mutex;
 } * loader_impl_java_class;
 
 typedef struct loader_impl_java_object_type
@@ -72,14 +94,117 @@ typedef struct loader_impl_java_field_type
 {
 	const char *fieldName;
 	jobject fieldObj;
+	jfieldID fieldID;
 } * loader_impl_java_field;
 
 typedef struct loader_impl_java_method_type
 {
 	jobject methodObj;
 	const char *methodSignature;
+	jmethodID methodID;
 } * loader_impl_java_method;
 
+typedef struct loader_impl_java_thread_type
+{
+	JavaVM *jvm;   // JVM where the thread is attached
+	JNIEnv *env;   // Pointer to native interface of the thread
+	bool attached; // True if the thread was attached by the loader
+
+	~loader_impl_java_thread_type();
+
+} loader_impl_java_thread;
+
+/* The JVM can be created only once per process, this points to it while it is alive, the mutex
+prevents the exiting threads from detaching while the JVM is being destroyed */
+static std::atomic<JavaVM *> java_loader_impl_jvm(nullptr);
+static std::mutex java_loader_impl_jvm_mutex;
+
+/* Each thread calling into Java has its own JNIEnv, it is attached on the first call and detached when the thread exits */
+static thread_local loader_impl_java_thread java_loader_impl_thread = { nullptr, nullptr, false };
+
+loader_impl_java_thread_type::~loader_impl_java_thread_type()
+{
+	if (attached && jvm != nullptr)
+	{
+		std::lock_guard<std::mutex> lock(java_loader_impl_jvm_mutex);
+
+		/* Once the JVM is destroyed it can not be used anymore, so the detach is only done while it is alive */
+		if (jvm == java_loader_impl_jvm.load())
+		{
+			jvm->DetachCurrentThread();
+		}
+	}
+}
+
+static void java_loader_impl_jvm_destroy(loader_impl_java java_impl)
+{
+	/* Threads exiting after this point must not detach from the destroyed JVM */
+	{
+		std::lock_guard<std::mutex> lock(java_loader_impl_jvm_mutex);
+
+		java_loader_impl_jvm.store(nullptr);
+	}
+
+	java_loader_impl_thread.jvm = nullptr;
+	java_loader_impl_thread.env = nullptr;
+	java_loader_impl_thread.attached = false;
+
+	java_impl->jvm->DestroyJavaVM();
+}
+
+static JNIEnv *java_loader_impl_env(loader_impl_java java_impl)
+{
+	loader_impl_java_thread &thread = java_loader_impl_thread;
+
+	if (thread.jvm == java_impl->jvm && thread.env != nullptr)
+	{
+		return thread.env;
+	}
+
+	JNIEnv *env = nullptr;
+	jint rc = java_impl->jvm->GetEnv((void **)&env, JNI_VERSION_1_6);
+	bool attached = false;
+
+	if (rc == JNI_EDETACHED)
+	{
+		/* Attach as daemon so threads which never exit do not block the destruction of the JVM */
+		rc = java_impl->jvm->AttachCurrentThreadAsDaemon((void **)&env, NULL);
+		attached = true;
+	}
+
+	if (rc != JNI_OK || env == nullptr)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "JNI failed to attach to the current thread");
+		return nullptr;
+	}
+
+	thread.jvm = java_impl->jvm;
+	thread.env = env;
+	thread.attached = attached;
+
+	return env;
+}
+
+/* Native threads do not return to Java, so local references created during a call are released at the end of it */
+class java_loader_impl_local_frame
+{
+public:
+	java_loader_impl_local_frame(JNIEnv *env) :
+		env(env), pushed(env->PushLocalFrame(16) == JNI_OK) {}
+
+	~java_loader_impl_local_frame()
+	{
+		if (pushed)
+		{
+			env->PopLocalFrame(NULL);
+		}
+	}
+
+private:
+	JNIEnv *env;
+	bool pushed;
+};
+
 static type_interface type_java_singleton(void);
 
 static type java_loader_impl_type(loader_impl impl, const char *type_str, const char *type_signature)
@@ -235,8 +360,10 @@ static std::string getJNISignature(class_args args, size_t argc, const char *ret
 	return sig;
 }
 
-void getJValArray(jvalue *constructorArgs, class_args args, size_t argc, JNIEnv *env)
+void getJValArray(jvalue *constructorArgs, class_args args, size_t argc, loader_impl_java java_impl)
 {
+	JNIEnv *env = java_loader_impl_env(java_impl);
+
 	for (size_t i = 0; i < argc; i++)
 	{
 		type_id id = value_type_id(args[i]);
@@ -282,7 +409,7 @@ void getJValArray(jvalue *constructorArgs, class_args args, size_t argc, JNIEnv
 
 			if (array_size == 0)
 			{
-				jobjectArray arr = env->NewObjectArray((jsize)0, env->FindClass("java/lang/String"), env->NewStringUTF(""));
+				jobjectArray arr = env->NewObjectArray((jsize)0, java_impl->string_cls, env->NewStringUTF(""));
 				constructorArgs[i].l = arr;
 				return;
 			}
@@ -380,7 +507,7 @@ void getJValArray(jvalue *constructorArgs, class_args args, size_t argc, JNIEnv
 				}
 
 				case TYPE_STRING: {
-					jobjectArray arr = env->NewObjectArray((jsize)array_size, env->FindClass("java/lang/String"), env->NewStringUTF(""));
+					jobjectArray arr = env->NewObjectArray((jsize)array_size, java_impl->string_cls, env->NewStringUTF(""));
 
 					for (size_t i = 0; i < array_size; i++)
 						env->SetObjectArrayElement(arr, (jsize)i, env->NewStringUTF(value_to_string(array_value[i])));
@@ -439,11 +566,19 @@ value java_object_interface_get(object obj, object_impl impl, struct accessor_ty
 	(void)obj;
 
 	attribute attr = accessor->data.attr;
-	const char *key = (const char *)attribute_name(attr);
 	type fieldType = (type)attribute_type(attr);
 
 	loader_impl_java_object java_obj = static_cast<loader_impl_java_object>(impl);
 	loader_impl_java java_impl = java_obj->java_impl;
+	loader_impl_java_field java_field = static_cast<loader_impl_java_field>(attribute_data(attr));
+	JNIEnv *env = java_loader_impl_env(java_impl);
+
+	if (env == nullptr)
+	{
+		return NULL;
+	}
+
+	java_loader_impl_local_frame frame(env);
 
 	jobject clsObj = java_obj->conObj;
 	jclass clscls = java_obj->concls;
@@ -451,7 +586,7 @@ value java_object_interface_get(object obj, object_impl impl, struct accessor_ty
 	if (clscls != nullptr)
 	{
 		const char *fType = static_cast<std::string *>(type_derived(fieldType))->c_str();
-		jfieldID fID = java_impl->env->GetFieldID(clscls, key, fType);
+		jfieldID fID = java_field->fieldID;
 
 		if (fID != nullptr)
 		{
@@ -460,56 +595,56 @@ value java_object_interface_get(object obj, object_impl impl, struct accessor_ty
 			switch (id)
 			{
 				case TYPE_BOOL: {
-					jboolean gotVal = java_impl->env->GetBooleanField(clsObj, fID);
+					jboolean gotVal = env->GetBooleanField(clsObj, fID);
 					return value_create_bool((boolean)gotVal);
 				}
 
 				case TYPE_CHAR: {
-					jchar gotVal = java_impl->env->GetCharField(clsObj, fID);
+					jchar gotVal = env->GetCharField(clsObj, fID);
 					return value_create_char((char)gotVal);
 				}
 
 				case TYPE_SHORT: {
-					jshort gotVal = java_impl->env->GetShortField(clsObj, fID);
+					jshort gotVal = env->GetShortField(clsObj, fID);
 					return value_create_short((short)gotVal);
 				}
 
 				case TYPE_INT: {
-					jint gotVal = java_impl->env->GetIntField(clsObj, fID);
+					jint gotVal = env->GetIntField(clsObj, fID);
 					return value_create_int((int)gotVal);
 				}
 
 				case TYPE_LONG: {
-					jlong gotVal = java_impl->env->GetLongField(clsObj, fID);
+					jlong gotVal = env->GetLongField(clsObj, fID);
 					return value_create_long((long)gotVal);
 				}
 
 				case TYPE_FLOAT: {
-					jfloat gotVal = java_impl->env->GetFloatField(clsObj, fID);
+					jfloat gotVal = env->GetFloatField(clsObj, fID);
 					return value_create_float((float)gotVal);
 				}
 
 				case TYPE_DOUBLE: {
-					jdouble gotVal = java_impl->env->GetDoubleField(clsObj, fID);
+					jdouble gotVal = env->GetDoubleField(clsObj, fID);
 					return value_create_double((double)gotVal);
 				}
 
 				case TYPE_STRING: {
-					jstring gotVal = (jstring)java_impl->env->GetObjectField(clsObj, fID);
-					const char *gotValConv = java_impl->env->GetStringUTFChars(gotVal, NULL);
+					jstring gotVal = (jstring)env->GetObjectField(clsObj, fID);
+					const char *gotValConv = env->GetStringUTFChars(gotVal, NULL);
 					return value_create_string(gotValConv, strlen(gotValConv));
 				}
 
 				case TYPE_ARRAY: {
 					if (!strcmp(fType, "[Z"))
 					{
-						jbooleanArray gotVal = (jbooleanArray)java_impl->env->GetObjectField(clsObj, fID);
-						size_t array_size = (size_t)java_impl->env->GetArrayLength(gotVal);
+						jbooleanArray gotVal = (jbooleanArray)env->GetObjectField(clsObj, fID);
+						size_t array_size = (size_t)env->GetArrayLength(gotVal);
 
 						void *v = value_create_array(NULL, (size_t)array_size);
 						value *array_value = value_to_array(v);
 
-						jboolean *body = java_impl->env->GetBooleanArrayElements(gotVal, 0);
+						jboolean *body = env->GetBooleanArrayElements(gotVal, 0);
 						for (size_t i = 0; i < array_size; i++)
 							array_value[i] = value_create_bool(body[i]);
 
@@ -517,13 +652,13 @@ value java_object_interface_get(object obj, object_impl impl, struct accessor_ty
 					}
 					else if (!strcmp(fType, "[C"))
 					{
-						jcharArray gotVal = (jcharArray)java_impl->env->GetObjectField(clsObj, fID);
-						size_t array_size = (size_t)java_impl->env->GetArrayLength(gotVal);
+						jcharArray gotVal = (jcharArray)env->GetObjectField(clsObj, fID);
+						size_t array_size = (size_t)env->GetArrayLength(gotVal);
 
 						void *v = value_create_array(NULL, (size_t)array_size);
 						value *array_value = value_to_array(v);
 
-						jchar *body = java_impl->env->GetCharArrayElements(gotVal, 0);
+						jchar *body = env->GetCharArrayElements(gotVal, 0);
 						for (size_t i = 0; i < array_size; i++)
 							array_value[i] = value_create_char(body[i]);
 
@@ -531,13 +666,13 @@ value java_object_interface_get(object obj, object_impl impl, struct accessor_ty
 					}
 					else if (!strcmp(fType, "[S"))
 					{
-						jshortArray gotVal = (jshortArray)java_impl->env->GetObjectField(clsObj, fID);
-						size_t array_size = (size_t)java_impl->env->GetArrayLength(gotVal);
+						jshortArray gotVal = (jshortArray)env->GetObjectField(clsObj, fID);
+						size_t array_size = (size_t)env->GetArrayLength(gotVal);
 
 						void *v = value_create_array(NULL, (size_t)array_size);
 						value *array_value = value_to_array(v);
 
-						jshort *body = java_impl->env->GetShortArrayElements(gotVal, 0);
+						jshort *body = env->GetShortArrayElements(gotVal, 0);
 						for (size_t i = 0; i < array_size; i++)
 							array_value[i] = value_create_short(body[i]);
 
@@ -545,13 +680,13 @@ value java_object_interface_get(object obj, object_impl impl, struct accessor_ty
 					}
 					else if (!strcmp(fType, "[I"))
 					{
-						jintArray gotVal = (jintArray)java_impl->env->GetObjectField(clsObj, fID);
-						size_t array_size = (size_t)java_impl->env->GetArrayLength(gotVal);
+						jintArray gotVal = (jintArray)env->GetObjectField(clsObj, fID);
+						size_t array_size = (size_t)env->GetArrayLength(gotVal);
 
 						void *v = value_create_array(NULL, (size_t)array_size);
 						value *array_value = value_to_array(v);
 
-						jint *body = java_impl->env->GetIntArrayElements(gotVal, 0);
+						jint *body = env->GetIntArrayElements(gotVal, 0);
 						for (size_t i = 0; i < array_size; i++)
 							array_value[i] = value_create_int(body[i]);
 
@@ -559,13 +694,13 @@ value java_object_interface_get(object obj, object_impl impl, struct accessor_ty
 					}
 					else if (!strcmp(fType, "[J"))
 					{
-						jlongArray gotVal = (jlongArray)java_impl->env->GetObjectField(clsObj, fID);
-						size_t array_size = (size_t)java_impl->env->GetArrayLength(gotVal);
+						jlongArray gotVal = (jlongArray)env->GetObjectField(clsObj, fID);
+						size_t array_size = (size_t)env->GetArrayLength(gotVal);
 
 						void *v = value_create_array(NULL, (size_t)array_size);
 						value *array_value = value_to_array(v);
 
-						jlong *body = java_impl->env->GetLongArrayElements(gotVal, 0);
+						jlong *body = env->GetLongArrayElements(gotVal, 0);
 						for (size_t i = 0; i < array_size; i++)
 							array_value[i] = value_create_long(body[i]);
 
@@ -573,13 +708,13 @@ value java_object_interface_get(object obj, object_impl impl, struct accessor_ty
 					}
 					else if (!strcmp(fType, "[F"))
 					{
-						jfloatArray gotVal = (jfloatArray)java_impl->env->GetObjectField(clsObj, fID);
-						size_t array_size = (size_t)java_impl->env->GetArrayLength(gotVal);
+						jfloatArray gotVal = (jfloatArray)env->GetObjectField(clsObj, fID);
+						size_t array_size = (size_t)env->GetArrayLength(gotVal);
 
 						void *v = value_create_array(NULL, (size_t)array_size);
 						value *array_value = value_to_array(v);
 
-						jfloat *body = java_impl->env->GetFloatArrayElements(gotVal, 0);
+						jfloat *body = env->GetFloatArrayElements(gotVal, 0);
 						for (size_t i = 0; i < array_size; i++)
 							array_value[i] = value_create_float(body[i]);
 
@@ -587,13 +722,13 @@ value java_object_interface_get(object obj, object_impl impl, struct accessor_ty
 					}
 					else if (!strcmp(fType, "[D"))
 					{
-						jdoubleArray gotVal = (jdoubleArray)java_impl->env->GetObjectField(clsObj, fID);
-						size_t array_size = (size_t)java_impl->env->GetArrayLength(gotVal);
+						jdoubleArray gotVal = (jdoubleArray)env->GetObjectField(clsObj, fID);
+						size_t array_size = (size_t)env->GetArrayLength(gotVal);
 
 						void *v = value_create_array(NULL, (size_t)array_size);
 						value *array_value = value_to_array(v);
 
-						jdouble *body = java_impl->env->GetDoubleArrayElements(gotVal, 0);
+						jdouble *body = env->GetDoubleArrayElements(gotVal, 0);
 						for (size_t i = 0; i < array_size; i++)
 							array_value[i] = value_create_double(body[i]);
 
@@ -602,16 +737,16 @@ value java_object_interface_get(object obj, object_impl impl, struct accessor_ty
 					else if (!strcmp(fType, "[Ljava/lang/String;"))
 					{
 						// TODO: Make this generic and recursive for any kind of array
-						jobjectArray gotVal = (jobjectArray)java_impl->env->GetObjectField(clsObj, fID);
-						size_t array_size = (size_t)java_impl->env->GetArrayLength(gotVal);
+						jobjectArray gotVal = (jobjectArray)env->GetObjectField(clsObj, fID);
+						size_t array_size = (size_t)env->GetArrayLength(gotVal);
 
 						void *v = value_create_array(NULL, (size_t)array_size);
 						value *array_value = value_to_array(v);
 
 						for (size_t i = 0; i < array_size; i++)
 						{
-							jstring cur_ele = (jstring)java_impl->env->GetObjectArrayElement(gotVal, i);
-							const char *cur_element = java_impl->env->GetStringUTFChars(cur_ele, NULL);
+							jstring cur_ele = (jstring)env->GetObjectArrayElement(gotVal, i);
+							const char *cur_element = env->GetStringUTFChars(cur_ele, NULL);
 							array_value[i] = value_create_string(cur_element, strlen(cur_element));
 						}
 
@@ -635,11 +770,19 @@ int java_object_interface_set(object obj, object_impl impl, struct accessor_type
 	(void)obj;
 
 	attribute attr = accessor->data.attr;
-	const char *key = (const char *)attribute_name(attr);
 	type fieldType = (type)attribute_type(attr);
 
 	loader_impl_java_object java_obj = static_cast<loader_impl_java_object>(impl);
 	loader_impl_java java_impl = java_obj->java_impl;
+	loader_impl_java_field java_field = static_cast<loader_impl_java_field>(attribute_data(attr));
+	JNIEnv *env = java_loader_impl_env(java_impl);
+
+	if (env == nullptr)
+	{
+		return 1;
+	}
+
+	java_loader_impl_local_frame frame(env);
 
 	jobject conObj = java_obj->conObj;
 	jclass clscls = java_obj->concls;
@@ -647,7 +790,7 @@ int java_object_interface_set(object obj, object_impl impl, struct accessor_type
 	if (clscls != nullptr)
 	{
 		const char *fType = static_cast<std::string *>(type_derived(fieldType))->c_str();
-		jfieldID fID = java_impl->env->GetFieldID(clscls, key, fType);
+		jfieldID fID = java_field->fieldID;
 
 		if (fID != nullptr)
 		{
@@ -657,50 +800,50 @@ int java_object_interface_set(object obj, object_impl impl, struct accessor_type
 			{
 				case TYPE_BOOL: {
 					jboolean val = (jboolean)value_to_bool(v);
-					java_impl->env->SetBooleanField(conObj, fID, val);
+					env->SetBooleanField(conObj, fID, val);
 					return 0;
 				}
 
 				case TYPE_CHAR: {
 					jchar val = (jchar)value_to_char(v);
-					java_impl->env->SetCharField(conObj, fID, val);
+					env->SetCharField(conObj, fID, val);
 					return 0;
 				}
 
 				case TYPE_SHORT: {
 					jshort val = (jshort)value_to_short(v);
-					java_impl->env->SetShortField(conObj, fID, val);
+					env->SetShortField(conObj, fID, val);
 					return 0;
 				}
 
 				case TYPE_INT: {
 					jint val = (jint)value_to_int(v);
-					java_impl->env->SetIntField(conObj, fID, val);
+					env->SetIntField(conObj, fID, val);
 					return 0;
 				}
 
 				case TYPE_LONG: {
 					jlong val = (jlong)value_to_long(v);
-					java_impl->env->SetLongField(conObj, fID, val);
+					env->SetLongField(conObj, fID, val);
 					return 0;
 				}
 
 				case TYPE_FLOAT: {
 					jfloat val = (jfloat)value_to_float(v);
-					java_impl->env->SetFloatField(conObj, fID, val);
+					env->SetFloatField(conObj, fID, val);
 					return 0;
 				}
 
 				case TYPE_DOUBLE: {
 					jdouble val = (jdouble)value_to_double(v);
-					java_impl->env->SetDoubleField(conObj, fID, val);
+					env->SetDoubleField(conObj, fID, val);
 					return 0;
 				}
 
 				case TYPE_STRING: {
 					const char *strV = value_to_string(v);
-					jstring val = java_impl->env->NewStringUTF(strV);
-					java_impl->env->SetObjectField(conObj, fID, val);
+					jstring val = env->NewStringUTF(strV);
+					env->SetObjectField(conObj, fID, val);
 					return 0;
 				}
 
@@ -710,98 +853,98 @@ int java_object_interface_set(object obj, object_impl impl, struct accessor_type
 
 					if (!strcmp(fType, "[Z"))
 					{
-						jbooleanArray setArr = java_impl->env->NewBooleanArray((jsize)array_size);
+						jbooleanArray setArr = env->NewBooleanArray((jsize)array_size);
 
 						jboolean *fill = (jboolean *)malloc(array_size * sizeof(jboolean));
 
 						for (size_t i = 0; i < array_size; i++)
 							fill[i] = (jboolean)value_to_bool(array_value[i]);
 
-						java_impl->env->SetBooleanArrayRegion(setArr, 0, array_size, fill);
-						java_impl->env->SetObjectField(conObj, fID, setArr);
+						env->SetBooleanArrayRegion(setArr, 0, array_size, fill);
+						env->SetObjectField(conObj, fID, setArr);
 						free(fill);
 					}
 					else if (!strcmp(fType, "[C"))
 					{
-						jcharArray setArr = java_impl->env->NewCharArray((jsize)array_size);
+						jcharArray setArr = env->NewCharArray((jsize)array_size);
 
 						jchar *fill = (jchar *)malloc(array_size * sizeof(jchar));
 						for (size_t i = 0; i < array_size; i++)
 							fill[i] = (jchar)value_to_char(array_value[i]);
 
-						java_impl->env->SetCharArrayRegion(setArr, 0, array_size, fill);
-						java_impl->env->SetObjectField(conObj, fID, setArr);
+						env->SetCharArrayRegion(setArr, 0, array_size, fill);
+						env->SetObjectField(conObj, fID, setArr);
 						free(fill);
 					}
 					else if (!strcmp(fType, "[S"))
 					{
-						jshortArray setArr = java_impl->env->NewShortArray((jsize)array_size);
+						jshortArray setArr = env->NewShortArray((jsize)array_size);
 
 						jshort *fill = (jshort *)malloc(array_size * sizeof(jshort));
 						for (size_t i = 0; i < array_size; i++)
 							fill[i] = (jshort)value_to_short(array_value[i]);
 
-						java_impl->env->SetShortArrayRegion(setArr, 0, array_size, fill);
-						java_impl->env->SetObjectField(conObj, fID, setArr);
+						env->SetShortArrayRegion(setArr, 0, array_size, fill);
+						env->SetObjectField(conObj, fID, setArr);
 						free(fill);
 					}
 					else if (!strcmp(fType, "[I"))
 					{
-						jintArray setArr = java_impl->env->NewIntArray((jsize)array_size);
+						jintArray setArr = env->NewIntArray((jsize)array_size);
 
 						jint *fill = (jint *)malloc(array_size * sizeof(jint));
 						for (size_t i = 0; i < array_size; i++)
 							fill[i] = (jint)value_to_int(array_value[i]);
 
-						java_impl->env->SetIntArrayRegion(setArr, 0, array_size, fill);
-						java_impl->env->SetObjectField(conObj, fID, setArr);
+						env->SetIntArrayRegion(setArr, 0, array_size, fill);
+						env->SetObjectField(conObj, fID, setArr);
 						free(fill);
 					}
 					else if (!strcmp(fType, "[J"))
 					{
-						jlongArray setArr = java_impl->env->NewLongArray((jsize)array_size);
+						jlongArray setArr = env->NewLongArray((jsize)array_size);
 
 						jlong *fill = (jlong *)malloc(array_size * sizeof(jlong));
 						for (size_t i = 0; i < array_size; i++)
 							fill[i] = (jlong)value_to_long(array_value[i]);
 
-						java_impl->env->SetLongArrayRegion(setArr, 0, array_size, fill);
-						java_impl->env->SetObjectField(conObj, fID, setArr);
+						env->SetLongArrayRegion(setArr, 0, array_size, fill);
+						env->SetObjectField(conObj, fID, setArr);
 						free(fill);
 					}
 					else if (!strcmp(fType, "[F"))
 					{
-						jfloatArray setArr = java_impl->env->NewFloatArray((jsize)array_size);
+						jfloatArray setArr = env->NewFloatArray((jsize)array_size);
 
 						jfloat *fill = (jfloat *)malloc(array_size * sizeof(jfloat));
 						for (size_t i = 0; i < array_size; i++)
 							fill[i] = (jfloat)value_to_float(array_value[i]);
 
-						java_impl->env->SetFloatArrayRegion(setArr, 0, array_size, fill);
-						java_impl->env->SetObjectField(conObj, fID, setArr);
+						env->SetFloatArrayRegion(setArr, 0, array_size, fill);
+						env->SetObjectField(conObj, fID, setArr);
 						free(fill);
 					}
 					else if (!strcmp(fType, "[D"))
 					{
-						jdoubleArray setArr = java_impl->env->NewDoubleArray((jsize)array_size);
+						jdoubleArray setArr = env->NewDoubleArray((jsize)array_size);
 
 						jdouble *fill = (jdouble *)malloc(array_size * sizeof(jdouble));
 						for (size_t i = 0; i < array_size; i++)
 							fill[i] = (jdouble)value_to_double(array_value[i]);
 
-						java_impl->env->SetDoubleArrayRegion(setArr, 0, array_size, fill);
-						java_impl->env->SetObjectField(conObj, fID, setArr);
+						env->SetDoubleArrayRegion(setArr, 0, array_size, fill);
+						env->SetObjectField(conObj, fID, setArr);
 						free(fill);
 					}
 					else if (!strcmp(fType, "[Ljava/lang/String;"))
 					{
 						// TODO: This should be more generic and include other types of objects, not only string
-						jobjectArray setArr = java_impl->env->NewObjectArray((jsize)array_size, java_impl->env->FindClass("java/lang/String"), java_impl->env->NewStringUTF(""));
+						jobjectArray setArr = env->NewObjectArray((jsize)array_size, java_impl->string_cls, env->NewStringUTF(""));
 
 						for (size_t i = 0; i < array_size; i++)
-							java_impl->env->SetObjectArrayElement(setArr, (jsize)i, java_impl->env->NewStringUTF(value_to_string(array_value[i])));
+							env->SetObjectArrayElement(setArr, (jsize)i, env->NewStringUTF(value_to_string(array_value[i])));
 
-						java_impl->env->SetObjectField(conObj, fID, setArr);
+						env->SetObjectField(conObj, fID, setArr);
 					}
 
 					return 0;
@@ -824,13 +967,18 @@ value java_object_interface_method_invoke(object obj, object_impl impl, method m
 
 	loader_impl_java_object java_obj = static_cast<loader_impl_java_object>(impl);
 	loader_impl_java java_impl = java_obj->java_impl;
+	JNIEnv *env = java_loader_impl_env(java_impl);
+
+	if (env == nullptr)
+	{
+		return NULL;
+	}
+
+	java_loader_impl_local_frame frame(env);
+
 	jobject clsObj = java_obj->conObj;
-	jclass clscls = java_obj->concls;
 
 	loader_impl_java_method java_method = (loader_impl_java_method)method_data(m);
-	const char *methodSignature = java_method->methodSignature;
-
-	char *methodName = (char *)method_name(m);
 
 	signature sg = method_signature(m);
 	type t = signature_get_return(sg);
@@ -839,58 +987,58 @@ value java_object_interface_method_invoke(object obj, object_impl impl, method m
 	if (argc > 0)
 	{
 		constructorArgs = new jvalue[argc];
-		getJValArray(constructorArgs, args, argc, java_impl->env); // Create a jvalue array that can be passed to JNI
+		getJValArray(constructorArgs, args, argc, java_impl); // Create a jvalue array that can be passed to JNI
 	}
 
-	jmethodID function_invoke_id = java_impl->env->GetMethodID(clscls, methodName, methodSignature);
+	jmethodID function_invoke_id = java_method->methodID;
 
 	if (function_invoke_id != nullptr)
 	{
 		switch (type_index(t))
 		{
 			case TYPE_NULL: {
-				java_impl->env->CallVoidMethodA(clsObj, function_invoke_id, constructorArgs);
+				env->CallVoidMethodA(clsObj, function_invoke_id, constructorArgs);
 				return value_create_null();
 			}
 
 			case TYPE_BOOL: {
-				jboolean returnVal = (jboolean)java_impl->env->CallBooleanMethodA(clsObj, function_invoke_id, constructorArgs);
+				jboolean returnVal = (jboolean)env->CallBooleanMethodA(clsObj, function_invoke_id, constructorArgs);
 				return value_create_bool(returnVal);
 			}
 
 			case TYPE_CHAR: {
-				jchar returnVal = (jchar)java_impl->env->CallCharMethodA(clsObj, function_invoke_id, constructorArgs);
+				jchar returnVal = (jchar)env->CallCharMethodA(clsObj, function_invoke_id, constructorArgs);
 				return value_create_char(returnVal);
 			}
 
 			case TYPE_SHORT: {
-				jshort returnVal = (jshort)java_impl->env->CallShortMethodA(clsObj, function_invoke_id, constructorArgs);
+				jshort returnVal = (jshort)env->CallShortMethodA(clsObj, function_invoke_id, constructorArgs);
 				return value_create_short(returnVal);
 			}
 
 			case TYPE_INT: {
-				jint returnVal = (jint)java_impl->env->CallIntMethodA(clsObj, function_invoke_id, constructorArgs);
+				jint returnVal = (jint)env->CallIntMethodA(clsObj, function_invoke_id, constructorArgs);
 				return value_create_int(returnVal);
 			}
 
 			case TYPE_LONG: {
-				jlong returnVal = (jlong)java_impl->env->CallLongMethodA(clsObj, function_invoke_id, constructorArgs);
+				jlong returnVal = (jlong)env->CallLongMethodA(clsObj, function_invoke_id, constructorArgs);
 				return value_create_long(returnVal);
 			}
 
 			case TYPE_FLOAT: {
-				jfloat returnVal = (jfloat)java_impl->env->CallFloatMethodA(clsObj, function_invoke_id, constructorArgs);
+				jfloat returnVal = (jfloat)env->CallFloatMethodA(clsObj, function_invoke_id, constructorArgs);
 				return value_create_float(returnVal);
 			}
 
 			case TYPE_DOUBLE: {
-				jdouble returnVal = (jdouble)java_impl->env->CallDoubleMethodA(clsObj, function_invoke_id, constructorArgs);
+				jdouble returnVal = (jdouble)env->CallDoubleMethodA(clsObj, function_invoke_id, constructorArgs);
 				return value_create_double(returnVal);
 			}
 
 			case TYPE_STRING: {
-				jstring returnVal = (jstring)java_impl->env->CallObjectMethodA(clsObj, function_invoke_id, constructorArgs);
-				const char *returnString = java_impl->env->GetStringUTFChars(returnVal, NULL);
+				jstring returnVal = (jstring)env->CallObjectMethodA(clsObj, function_invoke_id, constructorArgs);
+				const char *returnString = env->GetStringUTFChars(returnVal, NULL);
 				return value_create_string(returnString, strlen(returnString));
 			}
 		}
@@ -929,7 +1077,19 @@ void java_object_interface_destroy(object obj, object_impl impl)
 	(void)obj;
 
 	if (java_obj != nullptr)
+	{
+		if (java_obj->conObj != nullptr)
+		{
+			JNIEnv *env = java_loader_impl_env(java_obj->java_impl);
+
+			if (env != nullptr)
+			{
+				env->DeleteGlobalRef(java_obj->conObj);
+			}
+		}
+
 		delete java_obj;
+	}
 }
 
 object_interface java_object_interface_singleton(void)
@@ -970,43 +1130,60 @@ object java_class_interface_constructor(klass cls, class_impl impl, const char *
 
 	java_obj->java_impl = java_cls->java_impl;
 
+	JNIEnv *env = java_loader_impl_env(java_cls->java_impl);
+
+	if (env == nullptr)
+	{
+		return obj;
+	}
+
+	java_loader_impl_local_frame frame(env);
+
 	jvalue *constructorArgs = nullptr;
 
 	if (argc > 0)
 	{
 		constructorArgs = new jvalue[argc];
-		getJValArray(constructorArgs, args, argc, java_cls->java_impl->env); // Create a jvalue array that can be passed to JNI
+		getJValArray(constructorArgs, args, argc, java_cls->java_impl); // Create a jvalue array that can be passed to JNI
 	}
 
-	if (java_cls->java_impl->env != nullptr && java_cls->cls != nullptr)
+	if (java_cls->concls != nullptr)
 	{
-		jclass classPtr = java_cls->java_impl->env->FindClass("bootstrap");
+		jclass clscls = java_cls->concls;
+		std::string sig = getJNISignature(args, argc, "void");
+		jmethodID constMID;
 
-		if (classPtr != nullptr)
+		/* Constructors are not discovered yet, so their ids are resolved on first use for each signature */
 		{
-			jmethodID findCls = java_cls->java_impl->env->GetStaticMethodID(classPtr, "FindClass", "(Ljava/lang/String;)Ljava/lang/Class;");
-			if (findCls != nullptr)
+			std::lock_guard<std::mutex> lock(java_cls->constructors_mutex);
+			std::map<std::string, jmethodID>::iterator it = java_cls->constructors.find(sig);
+
+			if (it != java_cls->constructors.end())
 			{
-				jclass clscls = (jclass)java_cls->java_impl->env->CallStaticObjectMethod(classPtr, findCls, java_cls->java_impl->env->NewStringUTF(name));
-				if (clscls != nullptr)
-				{
-					std::string sig = getJNISignature(args, argc, "void");
+				constMID = it->second;
+			}
+			else
+			{
+				constMID = env->GetMethodID(clscls, "<init>", sig.c_str());
 
-					jmethodID constMID = java_cls->java_impl->env->GetMethodID(clscls, "<init>", sig.c_str());
-					if (constMID != nullptr)
-					{
-						jobject newCls = java_cls->java_impl->env->NewObjectA(clscls, constMID, constructorArgs);
-						if (newCls != nullptr)
-						{
-							java_cls->concls = clscls;
-							java_obj->concls = clscls;
-							java_obj->conObj = newCls;
-							java_obj->name = name;
-						}
-					}
+				if (constMID != nullptr)
+				{
+					java_cls->constructors[sig] = constMID;
 				}
 			}
 		}
+
+		if (constMID != nullptr)
+		{
+			jobject newCls = env->NewObjectA(clscls, constMID, constructorArgs);
+			if (newCls != nullptr)
+			{
+				/* The object can be used later from any thread, so it must outlive the local frame */
+				java_obj->concls = clscls;
+				java_obj->conObj = env->NewGlobalRef(newCls);
+				java_obj->name = name;
+			}
+		}
 	}
 
 	if (constructorArgs != nullptr)
@@ -1022,16 +1199,25 @@ value java_class_interface_static_get(klass cls, class_impl impl, struct accesso
 	(void)cls;
 
 	attribute attr = accessor->data.attr;
-	const char *key = (const char *)attribute_name(attr);
 	type fieldType = (type)attribute_type(attr);
 	loader_impl_java_class java_cls = static_cast<loader_impl_java_class>(impl);
 	loader_impl_java java_impl = java_cls->java_impl;
+	loader_impl_java_field java_field = static_cast<loader_impl_java_field>(attribute_data(attr));
+	JNIEnv *env = java_loader_impl_env(java_impl);
+
+	if (env == nullptr)
+	{
+		return NULL;
+	}
+
+	java_loader_impl_local_frame frame(env);
+
 	jclass clscls = java_cls->concls;
 
 	if (clscls != nullptr)
 	{
 		const char *fType = static_cast<std::string *>(type_derived(fieldType))->c_str();
-		jfieldID fID = java_impl->env->GetStaticFieldID(clscls, key, fType);
+		jfieldID fID = java_field->fieldID;
 
 		if (fID != nullptr)
 		{
@@ -1040,63 +1226,60 @@ value java_class_interface_static_get(klass cls, class_impl impl, struct accesso
 			switch (id)
 			{
 				case TYPE_BOOL: {
-					jboolean gotVal = java_impl->env->GetStaticBooleanField(clscls, fID);
+					jboolean gotVal = env->GetStaticBooleanField(clscls, fID);
 					return value_create_bool((boolean)gotVal);
 				}
 
 				case TYPE_CHAR: {
-					jchar gotVal = java_impl->env->GetStaticCharField(clscls, fID);
+					jchar gotVal = env->GetStaticCharField(clscls, fID);
 					return value_create_char((char)gotVal);
 				}
 
 				case TYPE_SHORT: {
-					jshort gotVal = java_impl->env->GetStaticShortField(clscls, fID);
+					jshort gotVal = env->GetStaticShortField(clscls, fID);
 					return value_create_short((short)gotVal);
 				}
 
 				case TYPE_INT: {
-					jint gotVal = java_impl->env->GetStaticIntField(clscls, fID);
+					jint gotVal = env->GetStaticIntField(clscls, fID);
 					return value_create_int((int)gotVal);
 				}
 
 				case TYPE_LONG: {
-					jlong gotVal = java_impl->env->GetStaticLongField(clscls, fID);
+					jlong gotVal = env->GetStaticLongField(clscls, fID);
 					return value_create_long((long)gotVal);
 				}
 
 				case TYPE_FLOAT: {
-					jfloat gotVal = java_impl->env->GetStaticFloatField(clscls, fID);
+					jfloat gotVal = env->GetStaticFloatField(clscls, fID);
 					return value_create_float((float)gotVal);
 				}
 
 				case TYPE_DOUBLE: {
-					jdouble gotVal = java_impl->env->GetStaticDoubleField(clscls, fID);
+					jdouble gotVal = env->GetStaticDoubleField(clscls, fID);
 					return value_create_double((double)gotVal);
 				}
 
 				case TYPE_STRING: {
-					jstring gotVal = (jstring)java_impl->env->GetStaticObjectField(clscls, fID);
-					const char *gotValConv = java_impl->env->GetStringUTFChars(gotVal, NULL);
+					jstring gotVal = (jstring)env->GetStaticObjectField(clscls, fID);
+					const char *gotValConv = env->GetStringUTFChars(gotVal, NULL);
 					return value_create_string(gotValConv, strlen(gotValConv));
 				}
 
 				case TYPE_OBJECT: {
-					jobject gotVal = java_impl->env->GetStaticObjectField(clscls, fID);
-					jclass cls = (jclass)java_impl->env->GetObjectClass(gotVal);
-					jmethodID mid_getName = java_impl->env->GetMethodID(cls, "getName", "()Ljava/lang/String;");
-					jstring name = (jstring)java_impl->env->CallObjectMethod(cls, mid_getName);
-					const char *cls_name = java_impl->env->GetStringUTFChars(name, NULL);
+					jobject gotVal = env->GetStaticObjectField(clscls, fID);
+					jclass cls = (jclass)env->GetObjectClass(gotVal);
+					jstring name = (jstring)env->CallObjectMethod(cls, java_impl->class_get_name_id);
+					const char *cls_name = env->GetStringUTFChars(name, NULL);
 					/* TODO */
 					// object obj = object_create()
 					return value_create_object(NULL /* obj */);
 				}
 
 				case TYPE_CLASS: {
-					jobject gotVal = java_impl->env->GetStaticObjectField(clscls, fID);
-					jclass cls = (jclass)java_impl->env->GetObjectClass(gotVal);
-					jmethodID mid_getName = java_impl->env->GetMethodID(cls, "getName", "()Ljava/lang/String;");
-					jstring name = (jstring)java_impl->env->CallObjectMethod(gotVal, mid_getName);
-					const char *cls_name = java_impl->env->GetStringUTFChars(name, NULL);
+					jobject gotVal = env->GetStaticObjectField(clscls, fID);
+					jstring name = (jstring)env->CallObjectMethod(gotVal, java_impl->class_get_name_id);
+					const char *cls_name = env->GetStringUTFChars(name, NULL);
 					value cls_val = loader_impl_get_value(java_cls->impl, cls_name);
 					return value_type_copy(cls_val);
 				}
@@ -1106,13 +1289,13 @@ value java_class_interface_static_get(klass cls, class_impl impl, struct accesso
 
 					if (!strcmp(fType, "[Z"))
 					{
-						jbooleanArray gotVal = (jbooleanArray)java_impl->env->GetStaticObjectField(clscls, fID);
-						size_t array_size = (size_t)java_impl->env->GetArrayLength(gotVal);
+						jbooleanArray gotVal = (jbooleanArray)env->GetStaticObjectField(clscls, fID);
+						size_t array_size = (size_t)env->GetArrayLength(gotVal);
 
 						void *v = value_create_array(NULL, (size_t)array_size);
 						value *array_value = value_to_array(v);
 
-						jboolean *body = java_impl->env->GetBooleanArrayElements(gotVal, 0);
+						jboolean *body = env->GetBooleanArrayElements(gotVal, 0);
 						for (size_t i = 0; i < array_size; i++)
 							array_value[i] = value_create_bool(body[i]);
 
@@ -1120,13 +1303,13 @@ value java_class_interface_static_get(klass cls, class_impl impl, struct accesso
 					}
 					else if (!strcmp(fType, "[C"))
 					{
-						jcharArray gotVal = (jcharArray)java_impl->env->GetStaticObjectField(clscls, fID);
-						size_t array_size = (size_t)java_impl->env->GetArrayLength(gotVal);
+						jcharArray gotVal = (jcharArray)env->GetStaticObjectField(clscls, fID);
+						size_t array_size = (size_t)env->GetArrayLength(gotVal);
 
 						void *v = value_create_array(NULL, (size_t)array_size);
 						value *array_value = value_to_array(v);
 
-						jchar *body = java_impl->env->GetCharArrayElements(gotVal, 0);
+						jchar *body = env->GetCharArrayElements(gotVal, 0);
 						for (size_t i = 0; i < array_size; i++)
 							array_value[i] = value_create_char(body[i]);
 
@@ -1134,13 +1317,13 @@ value java_class_interface_static_get(klass cls, class_impl impl, struct accesso
 					}
 					else if (!strcmp(fType, "[S"))
 					{
-						jshortArray gotVal = (jshortArray)java_impl->env->GetStaticObjectField(clscls, fID);
-						size_t array_size = (size_t)java_impl->env->GetArrayLength(gotVal);
+						jshortArray gotVal = (jshortArray)env->GetStaticObjectField(clscls, fID);
+						size_t array_size = (size_t)env->GetArrayLength(gotVal);
 
 						void *v = value_create_array(NULL, (size_t)array_size);
 						value *array_value = value_to_array(v);
 
-						jshort *body = java_impl->env->GetShortArrayElements(gotVal, 0);
+						jshort *body = env->GetShortArrayElements(gotVal, 0);
 						for (size_t i = 0; i < array_size; i++)
 							array_value[i] = value_create_short(body[i]);
 
@@ -1148,13 +1331,13 @@ value java_class_interface_static_get(klass cls, class_impl impl, struct accesso
 					}
 					else if (!strcmp(fType, "[I"))
 					{
-						jintArray gotVal = (jintArray)java_impl->env->GetStaticObjectField(clscls, fID);
-						size_t array_size = (size_t)java_impl->env->GetArrayLength(gotVal);
+						jintArray gotVal = (jintArray)env->GetStaticObjectField(clscls, fID);
+						size_t array_size = (size_t)env->GetArrayLength(gotVal);
 
 						void *v = value_create_array(NULL, (size_t)array_size);
 						value *array_value = value_to_array(v);
 
-						jint *body = java_impl->env->GetIntArrayElements(gotVal, 0);
+						jint *body = env->GetIntArrayElements(gotVal, 0);
 						for (size_t i = 0; i < array_size; i++)
 							array_value[i] = value_create_int(body[i]);
 
@@ -1162,13 +1345,13 @@ value java_class_interface_static_get(klass cls, class_impl impl, struct accesso
 					}
 					else if (!strcmp(fType, "[J"))
 					{
-						jlongArray gotVal = (jlongArray)java_impl->env->GetStaticObjectField(clscls, fID);
-						size_t array_size = (size_t)java_impl->env->GetArrayLength(gotVal);
+						jlongArray gotVal = (jlongArray)env->GetStaticObjectField(clscls, fID);
+						size_t array_size = (size_t)env->GetArrayLength(gotVal);
 
 						void *v = value_create_array(NULL, (size_t)array_size);
 						value *array_value = value_to_array(v);
 
-						jlong *body = java_impl->env->GetLongArrayElements(gotVal, 0);
+						jlong *body = env->GetLongArrayElements(gotVal, 0);
 						for (size_t i = 0; i < array_size; i++)
 							array_value[i] = value_create_long(body[i]);
 
@@ -1176,13 +1359,13 @@ value java_class_interface_static_get(klass cls, class_impl impl, struct accesso
 					}
 					else if (!strcmp(fType, "[F"))
 					{
-						jfloatArray gotVal = (jfloatArray)java_impl->env->GetStaticObjectField(clscls, fID);
-						size_t array_size = (size_t)java_impl->env->GetArrayLength(gotVal);
+						jfloatArray gotVal = (jfloatArray)env->GetStaticObjectField(clscls, fID);
+						size_t array_size = (size_t)env->GetArrayLength(gotVal);
 
 						void *v = value_create_array(NULL, (size_t)array_size);
 						value *array_value = value_to_array(v);
 
-						jfloat *body = java_impl->env->GetFloatArrayElements(gotVal, 0);
+						jfloat *body = env->GetFloatArrayElements(gotVal, 0);
 						for (size_t i = 0; i < array_size; i++)
 							array_value[i] = value_create_float(body[i]);
 
@@ -1190,13 +1373,13 @@ value java_class_interface_static_get(klass cls, class_impl impl, struct accesso
 					}
 					else if (!strcmp(fType, "[D"))
 					{
-						jdoubleArray gotVal = (jdoubleArray)java_impl->env->GetStaticObjectField(clscls, fID);
-						size_t array_size = (size_t)java_impl->env->GetArrayLength(gotVal);
+						jdoubleArray gotVal = (jdoubleArray)env->GetStaticObjectField(clscls, fID);
+						size_t array_size = (size_t)env->GetArrayLength(gotVal);
 
 						void *v = value_create_array(NULL, (size_t)array_size);
 						value *array_value = value_to_array(v);
 
-						jdouble *body = java_impl->env->GetDoubleArrayElements(gotVal, 0);
+						jdouble *body = env->GetDoubleArrayElements(gotVal, 0);
 						for (size_t i = 0; i < array_size; i++)
 							array_value[i] = value_create_double(body[i]);
 
@@ -1204,8 +1387,8 @@ value java_class_interface_static_get(klass cls, class_impl impl, struct accesso
 					}
 					else if (fType[0] == '[' && fType[1] == 'L')
 					{
-						jobjectArray gotVal = (jobjectArray)java_impl->env->GetStaticObjectField(clscls, fID);
-						size_t array_size = (size_t)java_impl->env->GetArrayLength(gotVal);
+						jobjectArray gotVal = (jobjectArray)env->GetStaticObjectField(clscls, fID);
+						size_t array_size = (size_t)env->GetArrayLength(gotVal);
 						std::string subtype_str = array_get_subtype(fType);
 						type subtype = java_loader_impl_type(java_cls->impl, subtype_str.c_str(), fType);
 
@@ -1217,8 +1400,8 @@ value java_class_interface_static_get(klass cls, class_impl impl, struct accesso
 							case TYPE_STRING: {
 								for (size_t i = 0; i < array_size; i++)
 								{
-									jstring cur_ele = (jstring)java_impl->env->GetObjectArrayElement(gotVal, i);
-									const char *cur_element = java_impl->env->GetStringUTFChars(cur_ele, NULL);
+									jstring cur_ele = (jstring)env->GetObjectArrayElement(gotVal, i);
+									const char *cur_element = env->GetStringUTFChars(cur_ele, NULL);
 									array_value[i] = value_create_string(cur_element, strlen(cur_element));
 								}
 
@@ -1227,11 +1410,10 @@ value java_class_interface_static_get(klass cls, class_impl impl, struct accesso
 							case TYPE_OBJECT: {
 								for (size_t i = 0; i < array_size; i++)
 								{
-									jobject cur_ele = (jobject)java_impl->env->GetObjectArrayElement(gotVal, i);
-									jclass cls = (jclass)java_impl->env->GetObjectClass(cur_ele);
-									jmethodID mid_getName = java_impl->env->GetMethodID(cls, "getName", "()Ljava/lang/String;");
-									jstring name = (jstring)java_impl->env->CallObjectMethod(cls, mid_getName);
-									const char *cls_name = java_impl->env->GetStringUTFChars(name, NULL);
+									jobject cur_ele = (jobject)env->GetObjectArrayElement(gotVal, i);
+									jclass cls = (jclass)env->GetObjectClass(cur_ele);
+									jstring name = (jstring)env->CallObjectMethod(cls, java_impl->class_get_name_id);
+									const char *cls_name = env->GetStringUTFChars(name, NULL);
 									/* TODO */
 									// object obj = object_create()
 									array_value[i] = value_create_object(NULL /* obj */);
@@ -1242,11 +1424,9 @@ value java_class_interface_static_get(klass cls, class_impl impl, struct accesso
 							case TYPE_CLASS: {
 								for (size_t i = 0; i < array_size; i++)
 								{
-									jobject cur_ele = java_impl->env->GetObjectArrayElement(gotVal, i);
-									jclass cls = (jclass)java_impl->env->GetObjectClass(cur_ele);
-									jmethodID mid_getName = java_impl->env->GetMethodID(cls, "getName", "()Ljava/lang/String;");
-									jstring name = (jstring)java_impl->env->CallObjectMethod(cur_ele, mid_getName);
-									const char *cls_name = java_impl->env->GetStringUTFChars(name, NULL);
+									jobject cur_ele = env->GetObjectArrayElement(gotVal, i);
+									jstring name = (jstring)env->CallObjectMethod(cur_ele, java_impl->class_get_name_id);
+									const char *cls_name = env->GetStringUTFChars(name, NULL);
 									value cls_val = loader_impl_get_value(java_cls->impl, cls_name);
 									array_value[i] = value_type_copy(cls_val);
 								}
@@ -1275,16 +1455,25 @@ int java_class_interface_static_set(klass cls, class_impl impl, struct accessor_
 	(void)cls;
 
 	attribute attr = accessor->data.attr;
-	const char *key = (const char *)attribute_name(attr);
 	type fieldType = (type)attribute_type(attr);
 	loader_impl_java_class java_cls = static_cast<loader_impl_java_class>(impl);
 	loader_impl_java java_impl = java_cls->java_impl;
+	loader_impl_java_field java_field = static_cast<loader_impl_java_field>(attribute_data(attr));
+	JNIEnv *env = java_loader_impl_env(java_impl);
+
+	if (env == nullptr)
+	{
+		return 1;
+	}
+
+	java_loader_impl_local_frame frame(env);
+
 	jclass clscls = java_cls->concls;
 
 	if (clscls != nullptr)
 	{
 		const char *fType = static_cast<std::string *>(type_derived(fieldType))->c_str();
-		jfieldID fID = java_cls->java_impl->env->GetStaticFieldID(clscls, key, fType);
+		jfieldID fID = java_field->fieldID;
 
 		if (fID != nullptr)
 		{
@@ -1294,50 +1483,50 @@ int java_class_interface_static_set(klass cls, class_impl impl, struct accessor_
 			{
 				case TYPE_BOOL: {
 					jboolean val = (jboolean)value_to_bool(v);
-					java_impl->env->SetStaticBooleanField(clscls, fID, val);
+					env->SetStaticBooleanField(clscls, fID, val);
 					return 0;
 				}
 
 				case TYPE_CHAR: {
 					jchar val = (jchar)value_to_char(v);
-					java_impl->env->SetStaticCharField(clscls, fID, val);
+					env->SetStaticCharField(clscls, fID, val);
 					return 0;
 				}
 
 				case TYPE_SHORT: {
 					jshort val = (jshort)value_to_short(v);
-					java_impl->env->SetStaticShortField(clscls, fID, val);
+					env->SetStaticShortField(clscls, fID, val);
 					return 0;
 				}
 
 				case TYPE_INT: {
 					jint val = (jint)value_to_int(v);
-					java_impl->env->SetStaticIntField(clscls, fID, val);
+					env->SetStaticIntField(clscls, fID, val);
 					return 0;
 				}
 
 				case TYPE_LONG: {
 					jlong val = (jlong)value_to_long(v);
-					java_impl->env->SetStaticLongField(clscls, fID, val);
+					env->SetStaticLongField(clscls, fID, val);
 					return 0;
 				}
 
 				case TYPE_FLOAT: {
 					jfloat val = (jfloat)value_to_float(v);
-					java_impl->env->SetStaticFloatField(clscls, fID, val);
+					env->SetStaticFloatField(clscls, fID, val);
 					return 0;
 				}
 
 				case TYPE_DOUBLE: {
 					jdouble val = (jdouble)value_to_double(v);
-					java_impl->env->SetStaticDoubleField(clscls, fID, val);
+					env->SetStaticDoubleField(clscls, fID, val);
 					return 0;
 				}
 
 				case TYPE_STRING: {
 					const char *strV = value_to_string(v);
-					jstring val = java_impl->env->NewStringUTF(strV);
-					java_impl->env->SetStaticObjectField(clscls, fID, val);
+					jstring val = env->NewStringUTF(strV);
+					env->SetStaticObjectField(clscls, fID, val);
 					return 0;
 				}
 
@@ -1347,97 +1536,97 @@ int java_class_interface_static_set(klass cls, class_impl impl, struct accessor_
 
 					if (!strcmp(fType, "[Z"))
 					{
-						jbooleanArray setArr = java_impl->env->NewBooleanArray((jsize)array_size);
+						jbooleanArray setArr = env->NewBooleanArray((jsize)array_size);
 
 						jboolean *fill = (jboolean *)malloc(array_size * sizeof(jboolean));
 						for (size_t i = 0; i < array_size; i++)
 							fill[i] = (jboolean)value_to_bool(array_value[i]);
 
-						java_impl->env->SetBooleanArrayRegion(setArr, 0, array_size, fill);
-						java_impl->env->SetStaticObjectField(clscls, fID, setArr);
+						env->SetBooleanArrayRegion(setArr, 0, array_size, fill);
+						env->SetStaticObjectField(clscls, fID, setArr);
 						free(fill);
 					}
 					else if (!strcmp(fType, "[C"))
 					{
-						jcharArray setArr = java_impl->env->NewCharArray((jsize)array_size);
+						jcharArray setArr = env->NewCharArray((jsize)array_size);
 
 						jchar *fill = (jchar *)malloc(array_size * sizeof(jchar));
 						for (size_t i = 0; i < array_size; i++)
 							fill[i] = (jchar)value_to_char(array_value[i]);
 
-						java_impl->env->SetCharArrayRegion(setArr, 0, array_size, fill);
-						java_impl->env->SetStaticObjectField(clscls, fID, setArr);
+						env->SetCharArrayRegion(setArr, 0, array_size, fill);
+						env->SetStaticObjectField(clscls, fID, setArr);
 						free(fill);
 					}
 					else if (!strcmp(fType, "[S"))
 					{
-						jshortArray setArr = java_impl->env->NewShortArray((jsize)array_size);
+						jshortArray setArr = env->NewShortArray((jsize)array_size);
 
 						jshort *fill = (jshort *)malloc(array_size * sizeof(jshort));
 						for (size_t i = 0; i < array_size; i++)
 							fill[i] = (jshort)value_to_short(array_value[i]);
 
-						java_impl->env->SetShortArrayRegion(setArr, 0, array_size, fill);
-						java_impl->env->SetStaticObjectField(clscls, fID, setArr);
+						env->SetShortArrayRegion(setArr, 0, array_size, fill);
+						env->SetStaticObjectField(clscls, fID, setArr);
 						free(fill);
 					}
 					else if (!strcmp(fType, "[I"))
 					{
-						jintArray setArr = java_impl->env->NewIntArray((jsize)array_size);
+						jintArray setArr = env->NewIntArray((jsize)array_size);
 
 						jint *fill = (jint *)malloc(array_size * sizeof(jint));
 						for (size_t i = 0; i < array_size; i++)
 							fill[i] = (jint)value_to_int(array_value[i]);
 
-						java_impl->env->SetIntArrayRegion(setArr, 0, array_size, fill);
-						java_impl->env->SetStaticObjectField(clscls, fID, setArr);
+						env->SetIntArrayRegion(setArr, 0, array_size, fill);
+						env->SetStaticObjectField(clscls, fID, setArr);
 						free(fill);
 					}
 					else if (!strcmp(fType, "[J"))
 					{
-						jlongArray setArr = java_impl->env->NewLongArray((jsize)array_size);
+						jlongArray setArr = env->NewLongArray((jsize)array_size);
 
 						jlong *fill = (jlong *)malloc(array_size * sizeof(jlong));
 						for (size_t i = 0; i < array_size; i++)
 							fill[i] = (jlong)value_to_long(array_value[i]);
 
-						java_impl->env->SetLongArrayRegion(setArr, 0, array_size, fill);
-						java_impl->env->SetStaticObjectField(clscls, fID, setArr);
+						env->SetLongArrayRegion(setArr, 0, array_size, fill);
+						env->SetStaticObjectField(clscls, fID, setArr);
 						free(fill);
 					}
 					else if (!strcmp(fType, "[F"))
 					{
-						jfloatArray setArr = java_impl->env->NewFloatArray((jsize)array_size);
+						jfloatArray setArr = env->NewFloatArray((jsize)array_size);
 
 						jfloat *fill = (jfloat *)malloc(array_size * sizeof(jfloat));
 						for (size_t i = 0; i < array_size; i++)
 							fill[i] = (jfloat)value_to_float(array_value[i]);
 
-						java_impl->env->SetFloatArrayRegion(setArr, 0, array_size, fill);
-						java_impl->env->SetStaticObjectField(clscls, fID, setArr);
+						env->SetFloatArrayRegion(setArr, 0, array_size, fill);
+						env->SetStaticObjectField(clscls, fID, setArr);
 						free(fill);
 					}
 					else if (!strcmp(fType, "[D"))
 					{
-						jdoubleArray setArr = java_impl->env->NewDoubleArray((jsize)array_size);
+						jdoubleArray setArr = env->NewDoubleArray((jsize)array_size);
 
 						jdouble *fill = (jdouble *)malloc(array_size * sizeof(jdouble));
 						for (size_t i = 0; i < array_size; i++)
 							fill[i] = (jdouble)value_to_double(array_value[i]);
 
-						java_impl->env->SetDoubleArrayRegion(setArr, 0, array_size, fill);
-						java_impl->env->SetStaticObjectField(clscls, fID, setArr);
+						env->SetDoubleArrayRegion(setArr, 0, array_size, fill);
+						env->SetStaticObjectField(clscls, fID, setArr);
 						free(fill);
 					}
 					else if (!strcmp(fType, "[Ljava/lang/String;"))
 					{
 						// TODO: Implement this for any kind of object, make it recursive
-						jobjectArray arr = java_impl->env->NewObjectArray((jsize)array_size, java_impl->env->FindClass("java/lang/String"), java_impl->env->NewStringUTF(""));
+						jobjectArray arr = env->NewObjectArray((jsize)array_size, java_impl->string_cls, env->NewStringUTF(""));
 
 						for (size_t i = 0; i < array_size; i++)
-							java_impl->env->SetObjectArrayElement(arr, (jsize)i, java_impl->env->NewStringUTF(value_to_string(array_value[i])));
+							env->SetObjectArrayElement(arr, (jsize)i, env->NewStringUTF(value_to_string(array_value[i])));
 
-						java_impl->env->SetStaticObjectField(clscls, fID, arr);
+						env->SetStaticObjectField(clscls, fID, arr);
 					}
 
 					return 0;
@@ -1460,12 +1649,18 @@ value java_class_interface_static_invoke(klass cls, class_impl impl, method m, c
 
 	loader_impl_java_class java_cls = static_cast<loader_impl_java_class>(impl);
 	loader_impl_java java_impl = java_cls->java_impl;
+	JNIEnv *env = java_loader_impl_env(java_impl);
+
+	if (env == nullptr)
+	{
+		return NULL;
+	}
+
+	java_loader_impl_local_frame frame(env);
+
 	jclass clscls = java_cls->concls;
 
 	loader_impl_java_method java_method = (loader_impl_java_method)method_data(m);
-	const char *methodSignature = java_method->methodSignature;
-
-	char *methodName = (char *)method_name(m);
 
 	signature sg = method_signature(m);
 	type t = signature_get_return(sg);
@@ -1474,58 +1669,58 @@ value java_class_interface_static_invoke(klass cls, class_impl impl, method m, c
 	if (argc > 0)
 	{
 		constructorArgs = new jvalue[argc];
-		getJValArray(constructorArgs, args, argc, java_cls->java_impl->env); // Create a jvalue array that can be passed to JNI
+		getJValArray(constructorArgs, args, argc, java_cls->java_impl); // Create a jvalue array that can be passed to JNI
 	}
 
-	jmethodID function_invoke_id = java_impl->env->GetStaticMethodID(clscls, methodName, methodSignature);
+	jmethodID function_invoke_id = java_method->methodID;
 
 	if (function_invoke_id != nullptr)
 	{
 		switch (type_index(t))
 		{
 			case TYPE_NULL: {
-				java_impl->env->CallStaticVoidMethodA(clscls, function_invoke_id, constructorArgs);
+				env->CallStaticVoidMethodA(clscls, function_invoke_id, constructorArgs);
 				return value_create_null();
 			}
 
 			case TYPE_BOOL: {
-				jboolean returnVal = (jboolean)java_impl->env->CallStaticBooleanMethodA(clscls, function_invoke_id, constructorArgs);
+				jboolean returnVal = (jboolean)env->CallStaticBooleanMethodA(clscls, function_invoke_id, constructorArgs);
 				return value_create_bool(returnVal);
 			}
 
 			case TYPE_CHAR: {
-				jchar returnVal = (jchar)java_impl->env->CallStaticCharMethodA(clscls, function_invoke_id, constructorArgs);
+				jchar returnVal = (jchar)env->CallStaticCharMethodA(clscls, function_invoke_id, constructorArgs);
 				return value_create_char(returnVal);
 			}
 
 			case TYPE_SHORT: {
-				jshort returnVal = (jshort)java_impl->env->CallStaticShortMethodA(clscls, function_invoke_id, constructorArgs);
+				jshort returnVal = (jshort)env->CallStaticShortMethodA(clscls, function_invoke_id, constructorArgs);
 				return value_create_short(returnVal);
 			}
 
 			case TYPE_INT: {
-				jint returnVal = (jint)java_impl->env->CallStaticIntMethodA(clscls, function_invoke_id, constructorArgs);
+				jint returnVal = (jint)env->CallStaticIntMethodA(clscls, function_invoke_id, constructorArgs);
 				return value_create_int(returnVal);
 			}
 
 			case TYPE_LONG: {
-				jlong returnVal = (jlong)java_impl->env->CallStaticLongMethodA(clscls, function_invoke_id, constructorArgs);
+				jlong returnVal = (jlong)env->CallStaticLongMethodA(clscls, function_invoke_id, constructorArgs);
 				return value_create_long(returnVal);
 			}
 
 			case TYPE_FLOAT: {
-				jfloat returnVal = (jfloat)java_impl->env->CallStaticFloatMethodA(clscls, function_invoke_id, constructorArgs);
+				jfloat returnVal = (jfloat)env->CallStaticFloatMethodA(clscls, function_invoke_id, constructorArgs);
 				return value_create_float(returnVal);
 			}
 
 			case TYPE_DOUBLE: {
-				jdouble returnVal = (jdouble)java_impl->env->CallStaticDoubleMethodA(clscls, function_invoke_id, constructorArgs);
+				jdouble returnVal = (jdouble)env->CallStaticDoubleMethodA(clscls, function_invoke_id, constructorArgs);
 				return value_create_double(returnVal);
 			}
 
 			case TYPE_STRING: {
-				jstring returnVal = (jstring)java_impl->env->CallStaticObjectMethodA(clscls, function_invoke_id, constructorArgs);
-				const char *returnString = java_impl->env->GetStringUTFChars(returnVal, NULL);
+				jstring returnVal = (jstring)env->CallStaticObjectMethodA(clscls, function_invoke_id, constructorArgs);
+				const char *returnString = env->GetStringUTFChars(returnVal, NULL);
 				return value_create_string(returnString, strlen(returnString));
 			}
 		}
@@ -1556,7 +1751,19 @@ void java_class_interface_destroy(klass cls, class_impl impl)
 	(void)cls;
 
 	if (java_cls != nullptr)
+	{
+		if (java_cls->concls != nullptr)
+		{
+			JNIEnv *env = java_loader_impl_env(java_cls->java_impl);
+
+			if (env != nullptr)
+			{
+				env->DeleteGlobalRef(java_cls->concls);
+			}
+		}
+
 		delete java_cls;
+	}
 }
 
 class_interface java_class_interface_singleton(void)
@@ -1574,6 +1781,89 @@ class_interface java_class_interface_singleton(void)
 	return &java_class_interface;
 }
 
+static int java_loader_impl_initialize_ids(loader_impl_java java_impl)
+{
+	JNIEnv *env = java_loader_impl_env(java_impl);
+
+	/* Resolve once the classes and methods used by the loader, so they are not looked up by name on each call */
+	jclass bootstrap_cls = env->FindClass("bootstrap");
+	jclass string_cls = env->FindClass("java/lang/String");
+	jclass class_cls = env->FindClass("java/lang/Class");
+
+	if (bootstrap_cls == nullptr || string_cls == nullptr || class_cls == nullptr)
+	{
+		env->ExceptionClear();
+		log_write("metacall", LOG_LEVEL_ERROR, "Java Loader failed to find the bootstrap classes");
+		return 1;
+	}
+
+	java_impl->bootstrap_cls = (jclass)env->NewGlobalRef(bootstrap_cls);
+	java_impl->string_cls = (jclass)env->NewGlobalRef(string_cls);
+	java_impl->class_get_name_id = env->GetMethodID(class_cls, "getName", "()Ljava/lang/String;");
+
+	env->DeleteLocalRef(bootstrap_cls);
+	env->DeleteLocalRef(string_cls);
+	env->DeleteLocalRef(class_cls);
+
+	if (java_impl->class_get_name_id == nullptr)
+	{
+		env->ExceptionClear();
+		log_write("metacall", LOG_LEVEL_ERROR, "Java Loader failed to find the method java.lang.Class.getName");
+		return 1;
+	}
+
+	struct
+	{
+		jmethodID *id;
+		const char *name;
+		const char *signature;
+	} bootstrap_methods[] = {
+		{ &java_impl->execution_path_id, "java_bootstrap_execution_path", "(Ljava/lang/String;)I" },
+		{ &java_impl->find_class_id, "FindClass", "(Ljava/lang/String;)Ljava/lang/Class;" },
+		{ &java_impl->load_from_file_id, "loadFromFile", "([Ljava/lang/String;)[Ljava/lang/Class;" },
+		{ &java_impl->load_from_memory_id, "load_from_memory", "(Ljava/lang/String;Ljava/lang/String;)[Ljava/lang/Class;" },
+		{ &java_impl->load_from_package_id, "load_from_package", "(Ljava/lang/String;)[Ljava/lang/Class;" },
+		{ &java_impl->get_class_name_id, "java_bootstrap_get_class_name", "(Ljava/lang/Class;)Ljava/lang/String;" },
+		{ &java_impl->discover_fields_id, "java_bootstrap_discover_fields", "(Ljava/lang/Class;)[Ljava/lang/reflect/Field;" },
+		{ &java_impl->discover_fields_details_id, "java_bootstrap_discover_fields_details", "(Ljava/lang/reflect/Field;)[Ljava/lang/String;" },
+		{ &java_impl->discover_methods_id, "java_bootstrap_discover_methods", "(Ljava/lang/Class;)[Ljava/lang/reflect/Method;" },
+		{ &java_impl->discover_method_details_id, "java_bootstrap_discover_method_details", "(Ljava/lang/reflect/Method;)[Ljava/lang/String;" },
+		{ &java_impl->discover_method_args_size_id, "java_bootstrap_discover_method_args_size", "(Ljava/lang/reflect/Method;)I" },
+		{ &java_impl->discover_method_parameters_id, "java_bootstrap_discover_method_parameters", "(Ljava/lang/reflect/Method;)[[Ljava/lang/String;" }
+	};
+
+	size_t size = sizeof(bootstrap_methods) / sizeof(bootstrap_methods[0]);
+
+	for (size_t i = 0; i < size; i++)
+	{
+		*bootstrap_methods[i].id = env->GetStaticMethodID(java_impl->bootstrap_cls, bootstrap_methods[i].name, bootstrap_methods[i].signature);
+
+		if (*bootstrap_methods[i].id == nullptr)
+		{
+			env->ExceptionClear();
+			log_write("metacall", LOG_LEVEL_ERROR, "Java Loader failed to find the bootstrap method %s", bootstrap_methods[i].name);
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static void java_loader_impl_destroy_ids(loader_impl_java java_impl, JNIEnv *env)
+{
+	if (java_impl->bootstrap_cls != nullptr)
+	{
+		env->DeleteGlobalRef(java_impl->bootstrap_cls);
+		java_impl->bootstrap_cls = nullptr;
+	}
+
+	if (java_impl->string_cls != nullptr)
+	{
+		env->DeleteGlobalRef(java_impl->string_cls);
+		java_impl->string_cls = nullptr;
+	}
+}
+
 loader_impl_data java_loader_impl_initialize(loader_impl impl, configuration config)
 {
 	loader_impl_java java_impl;
@@ -1602,7 +1892,9 @@ loader_impl_data java_loader_impl_initialize(loader_impl impl, configuration con
 		vm_args.options = options;
 		vm_args.ignoreUnrecognized = false; // Invalid options make the JVM init fail
 
-		jint rc = JNI_CreateJavaVM(&java_impl->jvm, (void **)&java_impl->env, &vm_args);
+		JNIEnv *env = nullptr;
+
+		jint rc = JNI_CreateJavaVM(&java_impl->jvm, (void **)&env, &vm_args);
 
 		delete[] options;
 
@@ -1612,6 +1904,16 @@ loader_impl_data java_loader_impl_initialize(loader_impl impl, configuration con
 			return NULL;
 		}
 
+		java_loader_impl_jvm.store(java_impl->jvm);
+
+		if (java_loader_impl_initialize_ids(java_impl) != 0)
+		{
+			java_loader_impl_destroy_ids(java_impl, env);
+			java_loader_impl_jvm_destroy(java_impl);
+			delete java_impl;
+			return NULL;
+		}
+
 		static struct
 		{
 			type_id id;
@@ -1656,18 +1958,14 @@ loader_impl_data java_loader_impl_initialize(loader_impl impl, configuration con
 int java_loader_impl_execution_path(loader_impl impl, const loader_path path)
 {
 	loader_impl_java java_impl = static_cast<loader_impl_java>(loader_impl_get(impl));
-	if (java_impl != NULL)
+	JNIEnv *env = java_impl != NULL ? java_loader_impl_env(java_impl) : nullptr;
+
+	if (env != nullptr)
 	{
-		jclass classPtr = java_impl->env->FindClass("bootstrap");
-		if (classPtr != nullptr)
-		{
-			jmethodID execPathCall = java_impl->env->GetStaticMethodID(classPtr, "java_bootstrap_execution_path", "(Ljava/lang/String;)I");
-			if (execPathCall != nullptr)
-			{
-				jint result = (jint)java_impl->env->CallStaticIntMethod(classPtr, execPathCall, java_impl->env->NewStringUTF(path));
-				return result;
-			}
-		}
+		java_loader_impl_local_frame frame(env);
+
+		jint result = (jint)env->CallStaticIntMethod(java_impl->bootstrap_cls, java_impl->execution_path_id, env->NewStringUTF(path));
+		return result;
 	}
 
 	return 1;
@@ -1680,38 +1978,38 @@ loader_handle java_loader_impl_load_from_file(loader_impl impl, const loader_pat
 	if (java_handle != nullptr)
 	{
 		loader_impl_java java_impl = static_cast<loader_impl_java>(loader_impl_get(impl));
-		jobjectArray arr = java_impl->env->NewObjectArray((jsize)size, java_impl->env->FindClass("java/lang/String"), java_impl->env->NewStringUTF(""));
+		JNIEnv *env = java_loader_impl_env(java_impl);
 
-		for (size_t i = 0; i < size; i++) // Create JNI compatible array of paths
+		if (env == nullptr)
 		{
-			java_impl->env->SetObjectArrayElement(arr, (jsize)i, java_impl->env->NewStringUTF(paths[i]));
+			delete java_handle;
+			return NULL;
 		}
+		jobjectArray arr = env->NewObjectArray((jsize)size, java_impl->string_cls, env->NewStringUTF(""));
 
-		jclass classPtr = java_impl->env->FindClass("bootstrap");
-		if (classPtr != nullptr)
+		for (size_t i = 0; i < size; i++) // Create JNI compatible array of paths
 		{
-			jmethodID mid = java_impl->env->GetStaticMethodID(classPtr, "loadFromFile", "([Ljava/lang/String;)[Ljava/lang/Class;");
-
-			if (mid != nullptr)
-			{
-				jobjectArray result = (jobjectArray)java_impl->env->CallStaticObjectMethod(classPtr, mid, arr);
+			env->SetObjectArrayElement(arr, (jsize)i, env->NewStringUTF(paths[i]));
+		}
 
-				java_handle->handle = result;
-				java_handle->size = java_impl->env->GetArrayLength(result);
+		jobjectArray result = (jobjectArray)env->CallStaticObjectMethod(java_impl->bootstrap_cls, java_impl->load_from_file_id, arr);
 
-				java_impl->env->DeleteLocalRef(arr); // Remove the jObjectArray from memory
+		java_handle->size = env->GetArrayLength(result);
 
-				// Check for errors
-				if (java_handle->size != size)
-				{
-					java_impl->env->DeleteLocalRef(result);
-					delete java_handle;
-					return NULL;
-				}
+		env->DeleteLocalRef(arr); // Remove the jObjectArray from memory
 
-				return static_cast<loader_handle>(java_handle);
-			}
+		// Check for errors
+		if (java_handle->size != size)
+		{
+			env->DeleteLocalRef(result);
+			delete java_handle;
+			return NULL;
 		}
+
+		java_handle->handle = (jobjectArray)env->NewGlobalRef(result); // Discover may run in a different thread
+		env->DeleteLocalRef(result);
+
+		return static_cast<loader_handle>(java_handle);
 	}
 
 	return NULL;
@@ -1726,21 +2024,21 @@ loader_handle java_loader_impl_load_from_memory(loader_impl impl, const loader_n
 	if (java_handle != nullptr)
 	{
 		loader_impl_java java_impl = static_cast<loader_impl_java>(loader_impl_get(impl));
+		JNIEnv *env = java_loader_impl_env(java_impl);
 
-		jclass classPtr = java_impl->env->FindClass("bootstrap");
-		if (classPtr != nullptr)
+		if (env == nullptr)
 		{
-			jmethodID mid = java_impl->env->GetStaticMethodID(classPtr, "load_from_memory", "(Ljava/lang/String;Ljava/lang/String;)[Ljava/lang/Class;");
-			if (mid != nullptr)
-			{
-				jobjectArray result = (jobjectArray)java_impl->env->CallStaticObjectMethod(classPtr, mid, java_impl->env->NewStringUTF(name), java_impl->env->NewStringUTF(buffer));
+			delete java_handle;
+			return NULL;
+		}
 
-				java_handle->handle = result;
-				java_handle->size = java_impl->env->GetArrayLength(result);
+		jobjectArray result = (jobjectArray)env->CallStaticObjectMethod(java_impl->bootstrap_cls, java_impl->load_from_memory_id, env->NewStringUTF(name), env->NewStringUTF(buffer));
 
-				return static_cast<loader_handle>(java_handle);
-			}
-		}
+		java_handle->handle = (jobjectArray)env->NewGlobalRef(result); // Discover may run in a different thread
+		java_handle->size = env->GetArrayLength(result);
+		env->DeleteLocalRef(result);
+
+		return static_cast<loader_handle>(java_handle);
 	}
 
 	return NULL;
@@ -1756,27 +2054,27 @@ loader_handle java_loader_impl_load_from_package(loader_impl impl, const loader_
 	if (java_handle != nullptr)
 	{
 		loader_impl_java java_impl = static_cast<loader_impl_java>(loader_impl_get(impl));
+		JNIEnv *env = java_loader_impl_env(java_impl);
 
-		jclass classPtr = java_impl->env->FindClass("bootstrap");
-		if (classPtr != nullptr)
+		if (env == nullptr)
 		{
-			jmethodID mid = java_impl->env->GetStaticMethodID(classPtr, "load_from_package", "(Ljava/lang/String;)[Ljava/lang/Class;");
-			if (mid != nullptr)
-			{
-				jobjectArray result = (jobjectArray)java_impl->env->CallStaticObjectMethod(classPtr, mid, java_impl->env->NewStringUTF(path));
-
-				if (result == NULL)
-				{
-					delete java_handle;
-					return NULL;
-				}
+			delete java_handle;
+			return NULL;
+		}
 
-				java_handle->handle = result;
-				java_handle->size = java_impl->env->GetArrayLength(result);
+		jobjectArray result = (jobjectArray)env->CallStaticObjectMethod(java_impl->bootstrap_cls, java_impl->load_from_package_id, env->NewStringUTF(path));
 
-				return static_cast<loader_handle>(java_handle);
-			}
+		if (result == NULL)
+		{
+			delete java_handle;
+			return NULL;
 		}
+
+		java_handle->handle = (jobjectArray)env->NewGlobalRef(result); // Discover may run in a different thread
+		java_handle->size = env->GetArrayLength(result);
+		env->DeleteLocalRef(result);
+
+		return static_cast<loader_handle>(java_handle);
 	}
 
 	return NULL;
@@ -1786,10 +2084,15 @@ int java_loader_impl_clear(loader_impl impl, loader_handle handle)
 {
 	loader_impl_java_handle java_handle = static_cast<loader_impl_java_handle>(handle);
 
-	(void)impl;
-
 	if (java_handle != NULL)
 	{
+		JNIEnv *env = java_loader_impl_env(static_cast<loader_impl_java>(loader_impl_get(impl)));
+
+		if (env != nullptr && java_handle->handle != nullptr)
+		{
+			env->DeleteGlobalRef(java_handle->handle);
+		}
+
 		delete java_handle;
 
 		return 0;
@@ -1820,206 +2123,221 @@ int java_loader_impl_discover(loader_impl impl, loader_handle handle, context ct
 		return 1;
 	}
 
-	jclass classPtr = java_impl->env->FindClass("bootstrap");
+	JNIEnv *env = java_loader_impl_env(java_impl);
 
-	if (classPtr != nullptr)
+	if (env == nullptr)
 	{
-		jmethodID cls_name_bootstrap = java_impl->env->GetStaticMethodID(classPtr, "java_bootstrap_get_class_name", "(Ljava/lang/Class;)Ljava/lang/String;");
+		return 1;
+	}
 
-		if (cls_name_bootstrap != nullptr)
-		{
-			jsize handleSize = java_impl->env->GetArrayLength(java_handle->handle);
+	jsize handleSize = env->GetArrayLength(java_handle->handle);
 
-			if (handleSize == 0)
-			{
-				log_write("metacall", LOG_LEVEL_ERROR, "Trying to discover a handle without any class");
-				return 1;
-			}
+	if (handleSize == 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Trying to discover a handle without any class");
+		return 1;
+	}
 
-			for (jsize handle_index = 0; handle_index < handleSize; ++handle_index)
-			{
-				jobject r = java_impl->env->GetObjectArrayElement(java_handle->handle, handle_index);
+	for (jsize handle_index = 0; handle_index < handleSize; ++handle_index)
+	{
+		jobject r = env->GetObjectArrayElement(java_handle->handle, handle_index);
 
-				if (r != nullptr)
-				{
-					jstring result = (jstring)java_impl->env->CallStaticObjectMethod(classPtr, cls_name_bootstrap, r);
-					const char *cls_name = java_impl->env->GetStringUTFChars(result, NULL);
+		if (r != nullptr)
+		{
+			jstring result = (jstring)env->CallStaticObjectMethod(java_impl->bootstrap_cls, java_impl->get_class_name_id, r);
+			const char *cls_name = env->GetStringUTFChars(result, NULL);
 
-					loader_impl_java_class java_cls = new loader_impl_java_class_type();
+			loader_impl_java_class java_cls = new loader_impl_java_class_type();
 
-					java_cls->name = cls_name;
-					java_cls->cls = r;
-					java_cls->impl = impl;
-					java_cls->java_impl = java_impl;
+			/* The class is resolved with bootstrap.FindClass, as the constructors did on each call before, but only once,
+			so the statics, the constructors and the instances use the same class and the ids resolved for it */
+			jclass found = (jclass)env->CallStaticObjectMethod(java_impl->bootstrap_cls, java_impl->find_class_id, result);
 
-					klass c = class_create(cls_name, ACCESSOR_TYPE_STATIC, java_cls, &java_class_interface_singleton);
+			if (found == nullptr)
+			{
+				env->ExceptionClear();
+				log_write("metacall", LOG_LEVEL_WARNING, "Java Loader could not find the class %s in the execution paths, using the class of the handle", cls_name);
+			}
 
-					jmethodID cls_field_array = java_impl->env->GetStaticMethodID(classPtr, "java_bootstrap_discover_fields", "(Ljava/lang/Class;)[Ljava/lang/reflect/Field;");
-					if (cls_field_array != nullptr)
-					{
-						jobjectArray fieldArray = (jobjectArray)java_impl->env->CallStaticObjectMethod(classPtr, cls_field_array, r);
-						jsize fieldArraySize = java_impl->env->GetArrayLength(fieldArray);
+			java_cls->name = cls_name;
+			java_cls->cls = r;
+			java_cls->concls = (jclass)env->NewGlobalRef(found != nullptr ? found : r);
 
-						jmethodID cls_field_details = java_impl->env->GetStaticMethodID(classPtr, "java_bootstrap_discover_fields_details", "(Ljava/lang/reflect/Field;)[Ljava/lang/String;");
+			if (found != nullptr)
+			{
+				env->DeleteLocalRef(found);
+			}
+			java_cls->impl = impl;
+			java_cls->java_impl = java_impl;
 
-						for (jsize field_index = 0; field_index < fieldArraySize; ++field_index)
-						{
-							jobject curField = java_impl->env->GetObjectArrayElement(fieldArray, field_index);
-							jobjectArray fieldDetails = (jobjectArray)java_impl->env->CallStaticObjectMethod(classPtr, cls_field_details, curField);
+			klass c = class_create(cls_name, ACCESSOR_TYPE_STATIC, java_cls, &java_class_interface_singleton);
 
-							jstring fname = (jstring)java_impl->env->GetObjectArrayElement(fieldDetails, 0);
-							const char *field_name = java_impl->env->GetStringUTFChars(fname, NULL);
+			jobjectArray fieldArray = (jobjectArray)env->CallStaticObjectMethod(java_impl->bootstrap_cls, java_impl->discover_fields_id, r);
+			jsize fieldArraySize = env->GetArrayLength(fieldArray);
 
-							jstring ftype = (jstring)java_impl->env->GetObjectArrayElement(fieldDetails, 1);
-							const char *field_type = java_impl->env->GetStringUTFChars(ftype, NULL);
+			for (jsize field_index = 0; field_index < fieldArraySize; ++field_index)
+			{
+				jobject curField = env->GetObjectArrayElement(fieldArray, field_index);
+				jobjectArray fieldDetails = (jobjectArray)env->CallStaticObjectMethod(java_impl->bootstrap_cls, java_impl->discover_fields_details_id, curField);
 
-							jstring fvisibility = (jstring)java_impl->env->GetObjectArrayElement(fieldDetails, 2);
-							const char *field_visibility = java_impl->env->GetStringUTFChars(fvisibility, NULL);
+				jstring fname = (jstring)env->GetObjectArrayElement(fieldDetails, 0);
+				const char *field_name = env->GetStringUTFChars(fname, NULL);
 
-							jstring fstatic = (jstring)java_impl->env->GetObjectArrayElement(fieldDetails, 3);
-							const char *field_static = java_impl->env->GetStringUTFChars(fstatic, NULL);
+				jstring ftype = (jstring)env->GetObjectArrayElement(fieldDetails, 1);
+				const char *field_type = env->GetStringUTFChars(ftype, NULL);
 
-							jstring fSignature = (jstring)java_impl->env->GetObjectArrayElement(fieldDetails, 4);
-							const char *field_signature = java_impl->env->GetStringUTFChars(fSignature, NULL);
+				jstring fvisibility = (jstring)env->GetObjectArrayElement(fieldDetails, 2);
+				const char *field_visibility = env->GetStringUTFChars(fvisibility, NULL);
 
-							loader_impl_java_field java_field = new loader_impl_java_field_type();
-							java_field->fieldName = field_name;
-							java_field->fieldObj = curField;
+				jstring fstatic = (jstring)env->GetObjectArrayElement(fieldDetails, 3);
+				const char *field_static = env->GetStringUTFChars(fstatic, NULL);
 
-							type t = java_loader_impl_type(impl, field_type, field_signature);
+				jstring fSignature = (jstring)env->GetObjectArrayElement(fieldDetails, 4);
+				const char *field_signature = env->GetStringUTFChars(fSignature, NULL);
 
-							if (t != NULL)
-							{
-								attribute attr = attribute_create(c, field_name, t, java_field, getFieldVisibility(field_visibility), NULL);
+				loader_impl_java_field java_field = new loader_impl_java_field_type();
+				java_field->fieldName = field_name;
+				java_field->fieldObj = curField;
 
-								if (!strcmp(field_static, "static"))
-									class_register_static_attribute(c, attr);
-								else
-									class_register_attribute(c, attr);
-							}
-							else
-							{
-								log_write("metacall", LOG_LEVEL_ERROR, "Attribute %s could not be discovered, the type is not supported", field_name);
-							}
-						}
-					}
+				if (!strcmp(field_static, "static"))
+					java_field->fieldID = env->GetStaticFieldID(java_cls->concls, field_name, field_signature);
+				else
+					java_field->fieldID = env->GetFieldID(java_cls->concls, field_name, field_signature);
 
-					jmethodID cls_method_array = java_impl->env->GetStaticMethodID(classPtr, "java_bootstrap_discover_methods", "(Ljava/lang/Class;)[Ljava/lang/reflect/Method;");
+				if (java_field->fieldID == nullptr)
+				{
+					env->ExceptionClear();
+					log_write("metacall", LOG_LEVEL_ERROR, "Attribute %s could not be resolved with signature %s", field_name, field_signature);
+				}
 
-					if (cls_method_array != nullptr)
-					{
-						jobjectArray methodArray = (jobjectArray)java_impl->env->CallStaticObjectMethod(classPtr, cls_method_array, r);
-						jsize methodArraySize = java_impl->env->GetArrayLength(methodArray);
+				type t = java_loader_impl_type(impl, field_type, field_signature);
 
-						jmethodID cls_method_details = java_impl->env->GetStaticMethodID(classPtr, "java_bootstrap_discover_method_details", "(Ljava/lang/reflect/Method;)[Ljava/lang/String;");
+				if (t != NULL)
+				{
+					attribute attr = attribute_create(c, field_name, t, java_field, getFieldVisibility(field_visibility), NULL);
 
-						for (jsize method_index = 0; method_index < methodArraySize; ++method_index)
-						{
-							jobject curMethod = java_impl->env->GetObjectArrayElement(methodArray, method_index);
-							jobjectArray methodDetails = (jobjectArray)java_impl->env->CallStaticObjectMethod(classPtr, cls_method_details, curMethod);
+					if (!strcmp(field_static, "static"))
+						class_register_static_attribute(c, attr);
+					else
+						class_register_attribute(c, attr);
+				}
+				else
+				{
+					log_write("metacall", LOG_LEVEL_ERROR, "Attribute %s could not be discovered, the type is not supported", field_name);
+				}
+			}
 
-							jstring mName = (jstring)java_impl->env->GetObjectArrayElement(methodDetails, 0);
-							const char *m_name = java_impl->env->GetStringUTFChars(mName, NULL);
+			jobjectArray methodArray = (jobjectArray)env->CallStaticObjectMethod(java_impl->bootstrap_cls, java_impl->discover_methods_id, r);
+			jsize methodArraySize = env->GetArrayLength(methodArray);
 
-							jstring mReturnType = (jstring)java_impl->env->GetObjectArrayElement(methodDetails, 1);
-							const char *m_return_type = java_impl->env->GetStringUTFChars(mReturnType, NULL);
+			for (jsize method_index = 0; method_index < methodArraySize; ++method_index)
+			{
+				jobject curMethod = env->GetObjectArrayElement(methodArray, method_index);
+				jobjectArray methodDetails = (jobjectArray)env->CallStaticObjectMethod(java_impl->bootstrap_cls, java_impl->discover_method_details_id, curMethod);
 
-							jstring mReturnTypeSig = (jstring)java_impl->env->GetObjectArrayElement(methodDetails, 2);
-							const char *m_return_type_sig = java_impl->env->GetStringUTFChars(mReturnTypeSig, NULL);
+				jstring mName = (jstring)env->GetObjectArrayElement(methodDetails, 0);
+				const char *m_name = env->GetStringUTFChars(mName, NULL);
 
-							jstring mVisibility = (jstring)java_impl->env->GetObjectArrayElement(methodDetails, 3);
-							const char *m_visibility = java_impl->env->GetStringUTFChars(mVisibility, NULL);
+				jstring mReturnType = (jstring)env->GetObjectArrayElement(methodDetails, 1);
+				const char *m_return_type = env->GetStringUTFChars(mReturnType, NULL);
 
-							jstring mStatic = (jstring)java_impl->env->GetObjectArrayElement(methodDetails, 4);
-							const char *m_static = java_impl->env->GetStringUTFChars(mStatic, NULL);
+				jstring mReturnTypeSig = (jstring)env->GetObjectArrayElement(methodDetails, 2);
+				const char *m_return_type_sig = env->GetStringUTFChars(mReturnTypeSig, NULL);
 
-							jstring mSignature = (jstring)java_impl->env->GetObjectArrayElement(methodDetails, 5);
-							const char *m_sig = java_impl->env->GetStringUTFChars(mSignature, NULL);
+				jstring mVisibility = (jstring)env->GetObjectArrayElement(methodDetails, 3);
+				const char *m_visibility = env->GetStringUTFChars(mVisibility, NULL);
 
-							jmethodID cls_method_args_size = java_impl->env->GetStaticMethodID(classPtr, "java_bootstrap_discover_method_args_size", "(Ljava/lang/reflect/Method;)I");
-							jint args_count = (jint)java_impl->env->CallStaticIntMethod(classPtr, cls_method_args_size, curMethod);
+				jstring mStatic = (jstring)env->GetObjectArrayElement(methodDetails, 4);
+				const char *m_static = env->GetStringUTFChars(mStatic, NULL);
 
-							loader_impl_java_method java_method = new loader_impl_java_method_type();
-							java_method->methodObj = curMethod;
-							java_method->methodSignature = m_sig;
+				jstring mSignature = (jstring)env->GetObjectArrayElement(methodDetails, 5);
+				const char *m_sig = env->GetStringUTFChars(mSignature, NULL);
 
-							// CREATING A NEW METHOD
-							method m = method_create(c, m_name, (size_t)args_count, java_method, getFieldVisibility(m_visibility), SYNCHRONOUS, NULL);
+				jint args_count = (jint)env->CallStaticIntMethod(java_impl->bootstrap_cls, java_impl->discover_method_args_size_id, curMethod);
 
-							// REGISTERING THE METHOD PARAMETER WITH INDEX
-							signature s = method_signature(m);
+				loader_impl_java_method java_method = new loader_impl_java_method_type();
+				java_method->methodObj = curMethod;
+				java_method->methodSignature = m_sig;
 
-							jmethodID cls_method_parameter_list = java_impl->env->GetStaticMethodID(classPtr, "java_bootstrap_discover_method_parameters", "(Ljava/lang/reflect/Method;)[[Ljava/lang/String;");
-							jobjectArray methodParameterList = (jobjectArray)java_impl->env->CallStaticObjectMethod(classPtr, cls_method_parameter_list, curMethod);
+				if (!strcmp(m_static, "static"))
+					java_method->methodID = env->GetStaticMethodID(java_cls->concls, m_name, m_sig);
+				else
+					java_method->methodID = env->GetMethodID(java_cls->concls, m_name, m_sig);
 
-							if (methodParameterList)
-							{
-								jsize parameterLength = java_impl->env->GetArrayLength(methodParameterList);
+				if (java_method->methodID == nullptr)
+				{
+					env->ExceptionClear();
+					log_write("metacall", LOG_LEVEL_ERROR, "Method %s could not be resolved with signature %s", m_name, m_sig);
+				}
 
-								for (jsize pIndex = 0; pIndex < parameterLength; pIndex++)
-								{
-									jobjectArray cparameter = (jobjectArray)java_impl->env->GetObjectArrayElement(methodParameterList, pIndex);
+				// CREATING A NEW METHOD
+				method m = method_create(c, m_name, (size_t)args_count, java_method, getFieldVisibility(m_visibility), SYNCHRONOUS, NULL);
 
-									jstring pName = (jstring)java_impl->env->GetObjectArrayElement(cparameter, 0);
-									const char *p_name = java_impl->env->GetStringUTFChars(pName, NULL);
+				// REGISTERING THE METHOD PARAMETER WITH INDEX
+				signature s = method_signature(m);
 
-									jstring pSig = (jstring)java_impl->env->GetObjectArrayElement(cparameter, 1);
-									const char *p_sig = java_impl->env->GetStringUTFChars(pSig, NULL);
+				jobjectArray methodParameterList = (jobjectArray)env->CallStaticObjectMethod(java_impl->bootstrap_cls, java_impl->discover_method_parameters_id, curMethod);
 
-									type pt = java_loader_impl_type(impl, p_name, p_sig);
+				if (methodParameterList)
+				{
+					jsize parameterLength = env->GetArrayLength(methodParameterList);
 
-									if (pt != NULL)
-									{
-										// Parameter names cannot be inspected with Reflection in Java (https://stackoverflow.com/questions/2237803/can-i-obtain-method-parameter-name-using-java-reflection)
-										signature_set(s, (size_t)pIndex, "", pt);
-									}
-									else
-									{
-										log_write("metacall", LOG_LEVEL_ERROR, "The parameter type %s in method %s could not be registered, the type is not supported", p_name, m_name);
-									}
-								}
-							}
+					for (jsize pIndex = 0; pIndex < parameterLength; pIndex++)
+					{
+						jobjectArray cparameter = (jobjectArray)env->GetObjectArrayElement(methodParameterList, pIndex);
 
-							// REGISTERING THE METHOD RETURN PARAMETER
-							type rt = java_loader_impl_type(impl, m_return_type, m_return_type_sig);
+						jstring pName = (jstring)env->GetObjectArrayElement(cparameter, 0);
+						const char *p_name = env->GetStringUTFChars(pName, NULL);
 
-							if (rt != NULL)
-							{
-								signature_set_return(s, rt);
-							}
-							else
-							{
-								log_write("metacall", LOG_LEVEL_ERROR, "The return type %s in method %s could not be registered, the type is not supported", m_return_type, m_name);
-							}
+						jstring pSig = (jstring)env->GetObjectArrayElement(cparameter, 1);
+						const char *p_sig = env->GetStringUTFChars(pSig, NULL);
 
-							// METHOD REGISTERATION
-							if (!strcmp(m_static, "static"))
-								class_register_static_method(c, m);
-							else
-								class_register_method(c, m);
+						type pt = java_loader_impl_type(impl, p_name, p_sig);
+
+						if (pt != NULL)
+						{
+							// Parameter names cannot be inspected with Reflection in Java (https://stackoverflow.com/questions/2237803/can-i-obtain-method-parameter-name-using-java-reflection)
+							signature_set(s, (size_t)pIndex, "", pt);
+						}
+						else
+						{
+							log_write("metacall", LOG_LEVEL_ERROR, "The parameter type %s in method %s could not be registered, the type is not supported", p_name, m_name);
 						}
 					}
+				}
 
-					jmethodID cls_constructor_array = java_impl->env->GetStaticMethodID(classPtr, "java_bootstrap_discover_constructors", "(Ljava/lang/Class;)[Ljava/lang/reflect/Constructor;");
+				// REGISTERING THE METHOD RETURN PARAMETER
+				type rt = java_loader_impl_type(impl, m_return_type, m_return_type_sig);
 
-					if (cls_constructor_array != nullptr)
-					{
-						// TODO: Implement constructors
-					}
+				if (rt != NULL)
+				{
+					signature_set_return(s, rt);
+				}
+				else
+				{
+					log_write("metacall", LOG_LEVEL_ERROR, "The return type %s in method %s could not be registered, the type is not supported", m_return_type, m_name);
+				}
 
-					scope sp = context_scope(ctx);
-					value v = value_create_class(c);
+				// METHOD REGISTERATION
+				if (!strcmp(m_static, "static"))
+					class_register_static_method(c, m);
+				else
+					class_register_method(c, m);
+			}
 
-					if (scope_define(sp, cls_name, v) != 0)
-					{
-						value_type_destroy(v);
-						return 1;
-					}
-				}
+			// TODO: Implement constructors (java_bootstrap_discover_constructors), their ids are resolved on demand by the class constructor
 
-				// java_impl->env->DeleteLocalRef(r); // Remove the jObjectArray element from memory
+			scope sp = context_scope(ctx);
+			value v = value_create_class(c);
+
+			if (scope_define(sp, cls_name, v) != 0)
+			{
+				value_type_destroy(v);
+				return 1;
 			}
 		}
+
+		// env->DeleteLocalRef(r); // Remove the jObjectArray element from memory
 	}
 
 	return 0;
@@ -2031,18 +2349,20 @@ int java_loader_impl_destroy(loader_impl impl)
 
 	if (java_impl != NULL)
 	{
-		jint rc = java_impl->jvm->AttachCurrentThread((void **)&java_impl->env, NULL);
+		JNIEnv *env = java_loader_impl_env(java_impl);
 
-		if (rc != JNI_OK)
+		if (env == nullptr)
 		{
 			// TODO: Handle error
-			log_write("metacall", LOG_LEVEL_ERROR, "JNI failed to attach to the current thread");
+			return 1;
 		}
 
 		/* Destroy children loaders */
 		loader_unload_children(impl);
 
-		java_impl->jvm->DestroyJavaVM();
+		java_loader_impl_destroy_ids(java_impl, env);
+
+		java_loader_impl_jvm_destroy(java_impl);
 
 		delete java_impl;
 
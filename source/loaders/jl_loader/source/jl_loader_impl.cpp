@@ -137,7 +137,8 @@ function_interface function_jl_singleton(void)
 		&function_jl_interface_create,
 		&function_jl_interface_invoke,
 		&function_jl_interface_await,
-		&function_jl_interface_destroy
+		&function_jl_interface_destroy,
+		NULL
 	};
 
 	return &jl_function_interface;
@@ -28,211 +28,329 @@
 #include <reflect/reflect_scope.h>
 #include <reflect/reflect_type.h>
 
+#include <adt/adt_vector.h>
+
+#include <portability/portability_compiler_detection.h>
+#include <portability/portability_path.h>
+
+#include <threading/threading_atomic.h>
+#include <threading/threading_mutex.h>
+#include <threading/threading_thread_id.h>
+
 #include <log/log.h>
 
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 /*
 	Note that the expected include convention is #include "lua.h"
 	and not #include <lua/lua.h>. This is because, the lua location is not
 	standardized and may exist in locations other than lua/
 */
+#include "lauxlib.h"
 #include "lua.h"
+#include "lualib.h"
 
-typedef struct loader_impl_lua_type
+#if LUA_VERSION_NUM < 502
+	#define lua_pushglobaltable(L) lua_pushvalue(L, LUA_GLOBALSINDEX)
+#endif
+
+/* Number of Lua states used when the loader configuration does not define states */
+#define LUA_LOADER_IMPL_STATES_DEFAULT 1
+
+typedef struct loader_impl_lua_state_type
 {
 	lua_State *vm;
+	struct threading_mutex_type mutex;
+	atomic_uintmax_t owner; /* Id of the thread holding the mutex, zero if nobody holds it */
+	size_t depth;			/* Number of nested acquisitions of the owner thread */
+
+} * loader_impl_lua_state;
+
+typedef struct loader_impl_lua_type
+{
+	/* Lua states are fully isolated, so each one holds its own copy of every
+	handle and they can run in parallel as long as each one is used by a single
+	thread at a time; the mutex of each state guarantees that */
+	loader_impl_lua_state states;
+	size_t size;
+	vector execution_paths;
 
 } * loader_impl_lua;
 
 typedef struct loader_impl_lua_handle_type
 {
-	/* TODO: This probably won't be needed as Lua does not use any
-		descriptor for the handles (aka scripts), all of them are loaded
-		into global scope and they do not have references
-	*/
-	void *handle_lua_data;
+	/* Lua scripts are loaded into the global scope, so the handle only keeps
+	the names of the global functions defined by the script */
+	vector functions;
 
 } * loader_impl_lua_handle;
 
 typedef struct loader_impl_lua_function_type
 {
-	/* TODO */
+	loader_impl_lua lua_impl;
 	loader_impl_lua_handle lua_handle;
-	void *function_lua_data;
 
 } * loader_impl_lua_function;
 
-int function_lua_interface_create(function func, function_impl impl)
+#if defined(PORTABILITY_THREAD_LOCAL)
+/* Counter used for assigning the states to the threads in round-robin */
+static atomic_uintmax_t lua_loader_impl_state_counter = 0;
+
+/* Index of the state of the current thread plus one, zero if it has not been assigned yet */
+static PORTABILITY_THREAD_LOCAL uintmax_t lua_loader_impl_state_index = 0;
+#endif
+
+static int lua_loader_impl_state_acquire(loader_impl_lua_state state)
 {
-	(void)func;
-	(void)impl;
+	uintmax_t id = (uintmax_t)thread_id_get_current();
+
+	/* A thread that already holds the state (i.e: a call that reenters the loader
+	from the same thread) keeps using it instead of waiting for itself */
+	if (atomic_load(&state->owner) == id)
+	{
+		++state->depth;
+		return 0;
+	}
+
+	if (threading_mutex_lock(&state->mutex) != 0)
+	{
+		return 1;
+	}
+
+	atomic_store(&state->owner, id);
+	state->depth = 1;
 
 	return 0;
 }
 
-function_return function_lua_interface_invoke(function func, function_impl impl, function_args args, size_t size)
+static void lua_loader_impl_state_release(loader_impl_lua_state state)
 {
-	loader_impl_lua_function lua_function = (loader_impl_lua_function)impl;
+	if (--state->depth == 0)
+	{
+		atomic_store(&state->owner, 0);
+		threading_mutex_unlock(&state->mutex);
+	}
+}
 
-	signature s = function_signature(func);
+static loader_impl_lua_state lua_loader_impl_state_lock(loader_impl_lua lua_impl)
+{
+	/* Each thread runs always in the same state, so the globals set by its calls are kept between them */
+#if defined(PORTABILITY_THREAD_LOCAL)
+	loader_impl_lua_state state;
 
-	const char *name = function_name(func);
+	if (lua_loader_impl_state_index == 0)
+	{
+		/* Thread ids are not sequential, so the states are handed out in round-robin on the first call of each thread */
+		lua_loader_impl_state_index = atomic_fetch_add(&lua_loader_impl_state_counter, 1) + 1;
+	}
 
-	type ret_type = signature_get_return(s);
+	state = &lua_impl->states[(lua_loader_impl_state_index - 1) % lua_impl->size];
+#else
+	loader_impl_lua_state state = &lua_impl->states[thread_id_get_current() % lua_impl->size];
+#endif
 
-	(void)lua_function;
+	if (lua_loader_impl_state_acquire(state) != 0)
+	{
+		return NULL;
+	}
 
-	log_write("metacall", LOG_LEVEL_DEBUG, "Invoking lua function %s", name);
+	return state;
+}
 
-	/* TODO: Convert properly the arguments */
-	if (size > 0)
+static void lua_loader_impl_push_value(lua_State *vm, value v)
+{
+	type_id id = value_type_id(v);
+
+	switch (id)
 	{
-		size_t args_count;
+		case TYPE_BOOL: {
+			lua_pushboolean(vm, value_to_bool(v) == 0L ? 0 : 1);
+			break;
+		}
+		case TYPE_CHAR: {
+			lua_pushinteger(vm, (lua_Integer)value_to_char(v));
+			break;
+		}
+		case TYPE_SHORT: {
+			lua_pushinteger(vm, (lua_Integer)value_to_short(v));
+			break;
+		}
+		case TYPE_INT: {
+			lua_pushinteger(vm, (lua_Integer)value_to_int(v));
+			break;
+		}
+		case TYPE_LONG: {
+			lua_pushinteger(vm, (lua_Integer)value_to_long(v));
+			break;
+		}
+		case TYPE_FLOAT: {
+			lua_pushnumber(vm, (lua_Number)value_to_float(v));
+			break;
+		}
+		case TYPE_DOUBLE: {
+			lua_pushnumber(vm, (lua_Number)value_to_double(v));
+			break;
+		}
+		case TYPE_STRING: {
+			lua_pushlstring(vm, value_to_string(v), value_type_size(v) - 1);
+			break;
+		}
+		case TYPE_PTR: {
+			lua_pushlightuserdata(vm, value_to_ptr(v));
+			break;
+		}
+		case TYPE_NULL: {
+			lua_pushnil(vm);
+			break;
+		}
+		default: {
+			log_write("metacall", LOG_LEVEL_ERROR, "Unrecognized value type %d in Lua argument, using nil instead", id);
+			lua_pushnil(vm);
+			break;
+		}
+	}
+}
 
-		for (args_count = 0; args_count < size; ++args_count)
-		{
-			/* This is only in case Lua adds types in the signature */
-			type t = signature_get_type(s, args_count);
+static value lua_loader_impl_number_value(lua_State *vm, int index, type_id id)
+{
+	switch (id)
+	{
+		case TYPE_CHAR:
+			return value_create_char((char)lua_tointeger(vm, index));
+		case TYPE_SHORT:
+			return value_create_short((short)lua_tointeger(vm, index));
+		case TYPE_INT:
+			return value_create_int((int)lua_tointeger(vm, index));
+		case TYPE_LONG:
+			return value_create_long((long)lua_tointeger(vm, index));
+		case TYPE_FLOAT:
+			return value_create_float((float)lua_tonumber(vm, index));
+		default:
+			return value_create_double((double)lua_tonumber(vm, index));
+	}
+}
 
-			type_id id = TYPE_INVALID;
+static value lua_loader_impl_return_value(lua_State *vm, int index, signature s, function_args args, size_t size)
+{
+	switch (lua_type(vm, index))
+	{
+		case LUA_TNIL:
+		case LUA_TNONE: {
+			return value_create_null();
+		}
+		case LUA_TBOOLEAN: {
+			return value_create_bool(lua_toboolean(vm, index) == 0 ? 0L : 1L);
+		}
+		case LUA_TNUMBER: {
+			/* Lua numbers are untyped, so use the return type if any, otherwise the type of the first numeric argument */
+			type ret_type = signature_get_return(s);
+			type_id id = TYPE_DOUBLE;
 
-			if (t == NULL)
+			if (ret_type != NULL)
 			{
-				id = value_type_id((value)args[args_count]);
+				id = type_index(ret_type);
 			}
 			else
 			{
-				id = type_index(t);
-			}
-
-			log_write("metacall", LOG_LEVEL_DEBUG, "Type %p, %d", (void *)t, id);
-
-			if (id == TYPE_BOOL)
-			{
-				boolean *value_ptr = (boolean *)(args[args_count]);
-
-				log_write("metacall", LOG_LEVEL_DEBUG, "Boolean value: %d", *value_ptr);
+				size_t iterator;
+
+				for (iterator = 0; iterator < size; ++iterator)
+				{
+					type_id arg_id = value_type_id((value)args[iterator]);
+
+					if (arg_id >= TYPE_CHAR && arg_id <= TYPE_DOUBLE)
+					{
+						id = arg_id;
+						break;
+					}
+				}
+
+#if LUA_VERSION_NUM >= 503
+				if (iterator == size && lua_isinteger(vm, index))
+				{
+					id = TYPE_LONG;
+				}
+#endif
 			}
-			else if (id == TYPE_CHAR)
-			{
-				char *value_ptr = (char *)(args[args_count]);
-
-				log_write("metacall", LOG_LEVEL_DEBUG, "Char value: %c", *value_ptr);
-			}
-			else if (id == TYPE_SHORT)
-			{
-				short *value_ptr = (short *)(args[args_count]);
 
-				log_write("metacall", LOG_LEVEL_DEBUG, "Short value: %d", *value_ptr);
-			}
-			else if (id == TYPE_INT)
-			{
-				int *value_ptr = (int *)(args[args_count]);
+			return lua_loader_impl_number_value(vm, index, id);
+		}
+		case LUA_TSTRING: {
+			size_t length = 0;
+			const char *str = lua_tolstring(vm, index, &length);
 
-				log_write("metacall", LOG_LEVEL_DEBUG, "Int value: %d", *value_ptr);
-			}
-			else if (id == TYPE_LONG)
-			{
-				long *value_ptr = (long *)(args[args_count]);
+			return value_create_string(str, length);
+		}
+		case LUA_TLIGHTUSERDATA: {
+			return value_create_ptr(lua_touserdata(vm, index));
+		}
+		default: {
+			log_write("metacall", LOG_LEVEL_ERROR, "Unsupported Lua return type %s", lua_typename(vm, lua_type(vm, index)));
+			return NULL;
+		}
+	}
+}
 
-				log_write("metacall", LOG_LEVEL_DEBUG, "Long value: %ld", *value_ptr);
-			}
-			else if (id == TYPE_FLOAT)
-			{
-				float *value_ptr = (float *)(args[args_count]);
+int function_lua_interface_create(function func, function_impl impl)
+{
+	(void)func;
+	(void)impl;
 
-				log_write("metacall", LOG_LEVEL_DEBUG, "Float value: %f", *value_ptr);
-			}
-			else if (id == TYPE_DOUBLE)
-			{
-				double *value_ptr = (double *)(args[args_count]);
+	return 0;
+}
 
-				log_write("metacall", LOG_LEVEL_DEBUG, "Double value: %f", *value_ptr);
-			}
-			else if (id == TYPE_STRING)
-			{
-				const char *value_ptr = (const char *)(args[args_count]);
+function_return function_lua_interface_invoke(function func, function_impl impl, function_args args, size_t size)
+{
+	loader_impl_lua_function lua_function = (loader_impl_lua_function)impl;
+	loader_impl_lua_state state = lua_loader_impl_state_lock(lua_function->lua_impl);
+	const char *name = function_name(func);
+	value ret = NULL;
+	size_t iterator;
 
-				log_write("metacall", LOG_LEVEL_DEBUG, "String value: %s", value_ptr);
-			}
-			else if (id == TYPE_PTR)
-			{
-				void *value_ptr = (void *)(args[args_count]);
+	if (state == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Lua function %s invoke failed to acquire a Lua state", name);
+		return NULL;
+	}
 
-				log_write("metacall", LOG_LEVEL_DEBUG, "Pointer value: %p", value_ptr);
-			}
-			else
-			{
-				log_write("metacall", LOG_LEVEL_ERROR, "Unrecognized value: %p", args[args_count]);
-			}
-		}
+	lua_getglobal(state->vm, name);
 
-		log_write("metacall", LOG_LEVEL_DEBUG, "Calling lua function with arguments (%lu)", size);
+	if (lua_isfunction(state->vm, -1) == 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Lua function %s is not defined in the Lua state", name);
+		lua_pop(state->vm, 1);
+		goto unlock;
 	}
-	else
+
+	if (lua_checkstack(state->vm, (int)size) == 0)
 	{
-		log_write("metacall", LOG_LEVEL_DEBUG, "Calling lua function without arguments");
+		log_write("metacall", LOG_LEVEL_ERROR, "Lua function %s invoke failed to grow the stack for %" PRIuS " arguments", name, size);
+		lua_pop(state->vm, 1);
+		goto unlock;
 	}
 
-	/* TODO: Execute the call */
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		lua_loader_impl_push_value(state->vm, (value)args[iterator]);
+	}
 
-	/* TODO: Convert properly the return value */
-	if (ret_type != NULL)
+	if (lua_pcall(state->vm, (int)size, 1, 0) != 0)
 	{
-		type_id id = type_index(ret_type);
+		log_write("metacall", LOG_LEVEL_ERROR, "Lua function %s invoke error: %s", name, lua_tostring(state->vm, -1));
+		lua_pop(state->vm, 1);
+		goto unlock;
+	}
 
-		log_write("metacall", LOG_LEVEL_DEBUG, "Return type %p, %d", (void *)ret_type, id);
+	ret = lua_loader_impl_return_value(state->vm, -1, function_signature(func), args, size);
 
-		if (id == TYPE_BOOL)
-		{
-			boolean b = 1;
+	lua_pop(state->vm, 1);
 
-			return value_create_bool(b);
-		}
-		else if (id == TYPE_CHAR)
-		{
-			return value_create_char('A');
-		}
-		else if (id == TYPE_SHORT)
-		{
-			return value_create_short(124);
-		}
-		else if (id == TYPE_INT)
-		{
-			return value_create_int(1234);
-		}
-		else if (id == TYPE_LONG)
-		{
-			return value_create_long(90000L);
-		}
-		else if (id == TYPE_FLOAT)
-		{
-			return value_create_float(0.2f);
-		}
-		else if (id == TYPE_DOUBLE)
-		{
-			return value_create_double(3.1416);
-		}
-		else if (id == TYPE_STRING)
-		{
-			static const char str[] = "Hello World";
+unlock:
+	lua_loader_impl_state_release(state);
 
-			return value_create_string(str, sizeof(str) - 1);
-		}
-		else if (id == TYPE_PTR)
-		{
-			static int int_val = 15;
-
-			return value_create_ptr(&int_val);
-		}
-		else
-		{
-			log_write("metacall", LOG_LEVEL_ERROR, "Unrecognized return type");
-		}
-	}
-
-	return NULL;
+	return ret;
 }
 
 function_return function_lua_interface_await(function func, function_impl impl, function_args args, size_t size, function_resolve_callback resolve_callback, function_reject_callback reject_callback, void *context)
@@ -268,7 +386,8 @@ function_interface function_lua_singleton(void)
 		&function_lua_interface_create,
 		&function_lua_interface_invoke,
 		&function_lua_interface_await,
-		&function_lua_interface_destroy
+		&function_lua_interface_destroy,
+		NULL
 	};
 
 	return &lua_interface;
@@ -315,11 +434,40 @@ int lua_loader_impl_initialize_types(loader_impl impl)
 	return 0;
 }
 
+static size_t lua_loader_impl_states_size(configuration config)
+{
+	value states = config != NULL ? configuration_value(config, "states") : NULL;
+
+	if (states != NULL)
+	{
+		if (value_type_id(states) == TYPE_INT && value_to_int(states) > 0)
+		{
+			return (size_t)value_to_int(states);
+		}
+
+		log_write("metacall", LOG_LEVEL_WARNING, "Invalid Lua loader states configuration, using %d Lua state(s)", LUA_LOADER_IMPL_STATES_DEFAULT);
+	}
+
+	return LUA_LOADER_IMPL_STATES_DEFAULT;
+}
+
+static void lua_loader_impl_states_destroy(loader_impl_lua lua_impl, size_t size)
+{
+	size_t iterator;
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		lua_close(lua_impl->states[iterator].vm);
+		threading_mutex_destroy(&lua_impl->states[iterator].mutex);
+	}
+
+	free(lua_impl->states);
+}
+
 loader_impl_data lua_loader_impl_initialize(loader_impl impl, configuration config)
 {
 	loader_impl_lua lua_impl;
-
-	(void)config;
+	size_t iterator;
 
 	lua_impl = malloc(sizeof(struct loader_impl_lua_type));
 
@@ -330,181 +478,577 @@ loader_impl_data lua_loader_impl_initialize(loader_impl impl, configuration conf
 
 	if (lua_loader_impl_initialize_types(impl) != 0)
 	{
-		free(lua_impl);
+		goto error_types;
+	}
 
-		return NULL;
+	lua_impl->execution_paths = vector_create(sizeof(loader_path));
+
+	if (lua_impl->execution_paths == NULL)
+	{
+		goto error_types;
 	}
 
-	/* Initialize Lua VM */
-	lua_impl->vm = luaL_newstate();
+	/* Initialize the pool of Lua VMs */
+	lua_impl->size = lua_loader_impl_states_size(config);
+	lua_impl->states = malloc(sizeof(struct loader_impl_lua_state_type) * lua_impl->size);
 
-	if (lua_impl->vm == NULL)
+	if (lua_impl->states == NULL)
 	{
-		free(lua_impl);
+		goto error_states;
+	}
 
-		return NULL;
+	for (iterator = 0; iterator < lua_impl->size; ++iterator)
+	{
+		loader_impl_lua_state state = &lua_impl->states[iterator];
+
+		state->vm = luaL_newstate();
+
+		if (state->vm == NULL)
+		{
+			goto error_state;
+		}
+
+		if (threading_mutex_initialize(&state->mutex) != 0)
+		{
+			lua_close(state->vm);
+			goto error_state;
+		}
+
+		atomic_store(&state->owner, 0);
+		state->depth = 0;
+
+		/* Open all standard libraries into current Lua state */
+		luaL_openlibs(state->vm);
 	}
 
-	/* Open all standard libraries into current Lua state */
-	luaL_openlibs(lua_impl->vm);
+	log_write("metacall", LOG_LEVEL_DEBUG, "Lua loader initialized with %" PRIuS " Lua state(s)", lua_impl->size);
 
 	/* Register initialization */
 	loader_initialization_register(impl);
 
 	return lua_impl;
+
+error_state:
+	lua_loader_impl_states_destroy(lua_impl, iterator);
+error_states:
+	vector_destroy(lua_impl->execution_paths);
+error_types:
+	free(lua_impl);
+	return NULL;
 }
 
 int lua_loader_impl_execution_path(loader_impl impl, const loader_path path)
 {
-	/* TODO */
-	(void)impl;
-	(void)path;
+	loader_impl_lua lua_impl = loader_impl_get(impl);
+	loader_path *execution_path;
+
+	vector_push_back_empty(lua_impl->execution_paths);
+
+	execution_path = vector_back(lua_impl->execution_paths);
+
+	strncpy(*execution_path, path, LOADER_PATH_SIZE - 1);
+
+	(*execution_path)[LOADER_PATH_SIZE - 1] = '\0';
 
 	return 0;
 }
 
-loader_handle lua_loader_impl_load_from_file(loader_impl impl, const loader_path paths[], size_t size)
+static loader_impl_lua_handle lua_loader_impl_handle_create(void)
 {
 	loader_impl_lua_handle handle = malloc(sizeof(struct loader_impl_lua_handle_type));
 
-	(void)impl;
+	if (handle == NULL)
+	{
+		return NULL;
+	}
+
+	handle->functions = vector_create(sizeof(char *));
+
+	if (handle->functions == NULL)
+	{
+		free(handle);
+		return NULL;
+	}
+
+	return handle;
+}
+
+static void lua_loader_impl_handle_destroy(loader_impl_lua_handle handle)
+{
+	size_t iterator, size = vector_size(handle->functions);
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		char **name = vector_at(handle->functions, iterator);
+
+		free(*name);
+	}
+
+	vector_destroy(handle->functions);
+
+	free(handle);
+}
+
+static void lua_loader_impl_globals_snapshot(lua_State *vm)
+{
+	/* Push a table with all global functions, in order to find out later which ones a script defines */
+	lua_newtable(vm);
+	lua_pushglobaltable(vm);
+	lua_pushnil(vm);
 
-	if (handle != NULL)
+	while (lua_next(vm, -2) != 0)
 	{
-		size_t iterator;
+		if (lua_type(vm, -2) == LUA_TSTRING && lua_isfunction(vm, -1))
+		{
+			lua_pushvalue(vm, -2);
+			lua_insert(vm, -2);
+			lua_rawset(vm, -5);
+		}
+		else
+		{
+			lua_pop(vm, 1);
+		}
+	}
+
+	lua_pop(vm, 1);
+}
+
+static int lua_loader_impl_globals_diff(lua_State *vm, loader_impl_lua_handle handle)
+{
+	/* Store the name of the global functions that are new or have changed since the snapshot on top of the stack */
+	int result = 0;
 
-		/* TODO */
+	lua_pushglobaltable(vm);
+	lua_pushnil(vm);
 
-		for (iterator = 0; iterator < size; ++iterator)
+	while (lua_next(vm, -2) != 0)
+	{
+		if (lua_type(vm, -2) == LUA_TSTRING && lua_isfunction(vm, -1))
 		{
-			log_write("metacall", LOG_LEVEL_DEBUG, "Lua module %s loaded from file", paths[iterator]);
+			lua_pushvalue(vm, -2);
+			lua_rawget(vm, -5);
+
+			if (lua_rawequal(vm, -1, -2) == 0)
+			{
+				size_t length = 0;
+				const char *key = lua_tolstring(vm, -3, &length);
+				char *name = malloc(length + 1);
+
+				if (name == NULL)
+				{
+					result = 1;
+				}
+				else
+				{
+					memcpy(name, key, length + 1);
+					vector_push_back(handle->functions, &name);
+				}
+			}
+
+			lua_pop(vm, 1);
 		}
 
-		handle->handle_lua_data = NULL;
+		lua_pop(vm, 1);
+	}
+
+	/* Pop the globals table and the snapshot */
+	lua_pop(vm, 2);
 
-		return (loader_handle)handle;
+	return result;
+}
+
+static void lua_loader_impl_globals_restore(lua_State *vm)
+{
+	/* Set back the global functions that are new or have changed since the snapshot on top of the stack */
+	lua_pushglobaltable(vm);
+	lua_pushnil(vm);
+
+	while (lua_next(vm, -2) != 0)
+	{
+		if (lua_type(vm, -2) == LUA_TSTRING && lua_isfunction(vm, -1))
+		{
+			lua_pushvalue(vm, -2);
+			lua_rawget(vm, -5);
+
+			if (lua_rawequal(vm, -1, -2) == 0)
+			{
+				/* Assigning an existing field during the traversal is allowed, even if it is nil */
+				lua_pushvalue(vm, -3);
+				lua_insert(vm, -2);
+				lua_rawset(vm, -5);
+			}
+			else
+			{
+				lua_pop(vm, 1);
+			}
+		}
+
+		lua_pop(vm, 1);
 	}
 
-	return NULL;
+	lua_pop(vm, 1);
 }
 
-loader_handle lua_loader_impl_load_from_memory(loader_impl impl, const loader_name name, const char *buffer, size_t size)
+static int lua_loader_impl_load_chunk(loader_impl_lua lua_impl, loader_impl_lua_handle handle, const char *name, const char *buffer, size_t size)
+{
+	/* Load the script into every state of the pool, so any of them can run its functions */
+	int *snapshots = malloc(sizeof(int) * lua_impl->size);
+	size_t iterator, loaded = 0;
+	int result = 0;
+
+	if (snapshots == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Lua module %s failed to allocate the globals snapshots", name);
+		return 1;
+	}
+
+	for (iterator = 0; iterator < lua_impl->size; ++iterator)
+	{
+		loader_impl_lua_state state = &lua_impl->states[iterator];
+
+		if (lua_loader_impl_state_acquire(state) != 0)
+		{
+			result = 1;
+			break;
+		}
+
+		/* Keep a snapshot of the globals of each state in the registry, so they can be
+		restored if the script fails to load in any of the states of the pool */
+		lua_loader_impl_globals_snapshot(state->vm);
+		snapshots[iterator] = luaL_ref(state->vm, LUA_REGISTRYINDEX);
+		++loaded;
+
+		if (buffer != NULL)
+		{
+			result = luaL_loadbuffer(state->vm, buffer, size, name);
+		}
+		else
+		{
+			result = luaL_loadfile(state->vm, name);
+		}
+
+		if (result == 0)
+		{
+			result = lua_pcall(state->vm, 0, 0, 0);
+		}
+
+		if (result != 0)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Lua module %s failed to load: %s", name, lua_tostring(state->vm, -1));
+
+			lua_pop(state->vm, 1);
+		}
+		else if (iterator == 0)
+		{
+			/* The diff pops the snapshot */
+			lua_rawgeti(state->vm, LUA_REGISTRYINDEX, snapshots[iterator]);
+
+			if (lua_loader_impl_globals_diff(state->vm, handle) != 0)
+			{
+				log_write("metacall", LOG_LEVEL_ERROR, "Lua module %s failed to allocate the function names", name);
+
+				result = 1;
+			}
+		}
+
+		lua_loader_impl_state_release(state);
+
+		if (result != 0)
+		{
+			break;
+		}
+	}
+
+	/* Release the snapshots, if the script failed in any state undo the globals it defined in all of them */
+	for (iterator = 0; iterator < loaded; ++iterator)
+	{
+		loader_impl_lua_state state = &lua_impl->states[iterator];
+
+		if (lua_loader_impl_state_acquire(state) != 0)
+		{
+			result = 1;
+			continue;
+		}
+
+		if (result != 0)
+		{
+			lua_rawgeti(state->vm, LUA_REGISTRYINDEX, snapshots[iterator]);
+			lua_loader_impl_globals_restore(state->vm);
+			lua_pop(state->vm, 1);
+		}
+
+		luaL_unref(state->vm, LUA_REGISTRYINDEX, snapshots[iterator]);
+
+		lua_loader_impl_state_release(state);
+	}
+
+	free(snapshots);
+
+	return result;
+}
+
+static int lua_loader_impl_load_path(loader_impl_lua lua_impl, loader_impl_lua_handle handle, const loader_path path)
+{
+	size_t path_size = strnlen(path, LOADER_PATH_SIZE) + 1;
+	size_t iterator, size = vector_size(lua_impl->execution_paths);
+
+	if (portability_path_is_absolute(path, path_size) == 0)
+	{
+		return lua_loader_impl_load_chunk(lua_impl, handle, path, NULL, 0);
+	}
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		loader_path *execution_path = vector_at(lua_impl->execution_paths, iterator);
+		loader_path absolute_path;
+		FILE *file;
+
+		portability_path_join(*execution_path, strnlen(*execution_path, LOADER_PATH_SIZE) + 1, path, path_size, absolute_path, LOADER_PATH_SIZE);
+
+		file = fopen(absolute_path, "r");
+
+		if (file != NULL)
+		{
+			fclose(file);
+
+			return lua_loader_impl_load_chunk(lua_impl, handle, absolute_path, NULL, 0);
+		}
+	}
+
+	/* Fall back to the working directory */
+	return lua_loader_impl_load_chunk(lua_impl, handle, path, NULL, 0);
+}
+
+loader_handle lua_loader_impl_load_from_file(loader_impl impl, const loader_path paths[], size_t size)
 {
 	loader_impl_lua lua_impl = loader_impl_get(impl);
-	loader_impl_lua_handle handle = malloc(sizeof(struct loader_impl_lua_handle_type));
+	loader_impl_lua_handle handle = lua_loader_impl_handle_create();
+	size_t iterator;
 
-	if (handle != NULL)
+	if (handle == NULL)
 	{
-		if (luaL_loadbuffer(lua_impl->vm, buffer, size, name) != 0)
+		return NULL;
+	}
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		if (lua_loader_impl_load_path(lua_impl, handle, paths[iterator]) != 0)
 		{
-			log_write("metacall", LOG_LEVEL_Error, "Lua module %s failed to load: %s", name, lua_tostring(lua_impl->vm, -1));
-			free(handle);
+			lua_loader_impl_handle_destroy(handle);
+
 			return NULL;
 		}
 
-		log_write("metacall", LOG_LEVEL_DEBUG, "Lua module %s. loaded from memory", name);
-
-		return (loader_handle)handle;
+		log_write("metacall", LOG_LEVEL_DEBUG, "Lua module %s loaded from file", paths[iterator]);
 	}
 
-	return NULL;
+	return (loader_handle)handle;
 }
 
-loader_handle lua_loader_impl_load_from_package(loader_impl impl, const loader_path path)
+loader_handle lua_loader_impl_load_from_memory(loader_impl impl, const loader_name name, const char *buffer, size_t size)
 {
-	loader_impl_lua_handle handle = malloc(sizeof(struct loader_impl_lua_handle_type));
+	loader_impl_lua lua_impl = loader_impl_get(impl);
+	loader_impl_lua_handle handle = lua_loader_impl_handle_create();
 
-	(void)impl;
+	if (handle == NULL)
+	{
+		return NULL;
+	}
 
-	if (handle != NULL)
+	/* The buffer size includes the null terminator */
+	if (size > 0 && buffer[size - 1] == '\0')
 	{
-		/* TODO */
+		--size;
+	}
 
-		log_write("metacall", LOG_LEVEL_DEBUG, "Lua module %s loaded from package", path);
+	if (lua_loader_impl_load_chunk(lua_impl, handle, name, buffer, size) != 0)
+	{
+		lua_loader_impl_handle_destroy(handle);
 
-		handle->handle_lua_data = NULL;
+		return NULL;
+	}
 
-		return (loader_handle)handle;
+	log_write("metacall", LOG_LEVEL_DEBUG, "Lua module %s loaded from memory", name);
+
+	return (loader_handle)handle;
+}
+
+loader_handle lua_loader_impl_load_from_package(loader_impl impl, const loader_path path)
+{
+	loader_impl_lua lua_impl = loader_impl_get(impl);
+	loader_impl_lua_handle handle = lua_loader_impl_handle_create();
+
+	if (handle == NULL)
+	{
+		return NULL;
 	}
 
-	return NULL;
+	/* Precompiled Lua chunks (luac) are loaded in the same way as scripts */
+	if (lua_loader_impl_load_path(lua_impl, handle, path) != 0)
+	{
+		lua_loader_impl_handle_destroy(handle);
+
+		return NULL;
+	}
+
+	log_write("metacall", LOG_LEVEL_DEBUG, "Lua module %s loaded from package", path);
+
+	return (loader_handle)handle;
 }
 
 int lua_loader_impl_clear(loader_impl impl, loader_handle handle)
 {
+	loader_impl_lua lua_impl = loader_impl_get(impl);
 	loader_impl_lua_handle lua_handle = (loader_impl_lua_handle)handle;
+	size_t iterator, size;
 
-	(void)impl;
+	if (lua_handle == NULL)
+	{
+		return 1;
+	}
+
+	size = vector_size(lua_handle->functions);
 
-	if (lua_handle != NULL)
+	/* Remove the functions of the handle from all the states */
+	for (iterator = 0; iterator < lua_impl->size; ++iterator)
 	{
-		/* TODO */
+		loader_impl_lua_state state = &lua_impl->states[iterator];
+		size_t index;
 
-		free(lua_handle);
+		if (lua_loader_impl_state_acquire(state) != 0)
+		{
+			return 1;
+		}
 
-		return 0;
+		for (index = 0; index < size; ++index)
+		{
+			char **name = vector_at(lua_handle->functions, index);
+
+			lua_pushnil(state->vm);
+			lua_setglobal(state->vm, *name);
+		}
+
+		lua_loader_impl_state_release(state);
 	}
 
-	return 1;
+	lua_loader_impl_handle_destroy(lua_handle);
+
+	return 0;
 }
 
-loader_impl_lua_function lua_function_create(loader_impl_lua_handle lua_handle)
+loader_impl_lua_function lua_function_create(loader_impl_lua lua_impl, loader_impl_lua_handle lua_handle)
 {
 	loader_impl_lua_function lua_function = malloc(sizeof(struct loader_impl_lua_function_type));
 
 	if (lua_function != NULL)
 	{
-		/* TODO */
-
+		lua_function->lua_impl = lua_impl;
 		lua_function->lua_handle = lua_handle;
 
-		lua_function->function_lua_data = NULL;
-
 		return lua_function;
 	}
 
 	return NULL;
 }
 
-int lua_loader_impl_discover(loader_impl impl, loader_handle handle, context ctx)
+static int lua_loader_impl_discover_function(loader_impl_lua lua_impl, loader_impl_lua_handle lua_handle, lua_State *vm, const char *name, scope sp)
 {
-	loader_impl_lua lua_impl = loader_impl_get(impl);
+	loader_impl_lua_function lua_function;
+	size_t args_count = 0, iterator;
+	function f;
+	signature s;
+	value v;
 
-	loader_impl_lua_handle lua_handle = (loader_impl_lua_handle)handle;
+	lua_getglobal(vm, name);
 
-	loader_impl_lua_function lua_function;
+	if (lua_isfunction(vm, -1) == 0)
+	{
+		lua_pop(vm, 1);
+		return 0;
+	}
 
-	scope sp = context_scope(ctx);
+#if LUA_VERSION_NUM >= 502
+	{
+		lua_Debug ar;
 
-	(void)lua_impl;
+		lua_pushvalue(vm, -1);
 
-	log_write("metacall", LOG_LEVEL_DEBUG, "Lua module %p discovering", handle);
+		if (lua_getinfo(vm, ">u", &ar) != 0)
+		{
+			args_count = (size_t)ar.nparams;
+		}
+	}
+#endif
+
+	lua_function = lua_function_create(lua_impl, lua_handle);
+
+	if (lua_function == NULL)
+	{
+		lua_pop(vm, 1);
+		return 1;
+	}
 
-	/* TODO: Introspect all functions */
+	f = function_create(name, args_count, lua_function, &function_lua_singleton);
 
-	/* This is an example of how to create a function */
-	lua_function = lua_function_create(lua_handle);
+	if (f == NULL)
+	{
+		free(lua_function);
+		lua_pop(vm, 1);
+		return 1;
+	}
 
-	if (lua_function != NULL)
+	s = function_signature(f);
+
+	for (iterator = 0; iterator < args_count; ++iterator)
 	{
-		function f = function_create("my_empty_func", 0, lua_function, &function_lua_singleton);
+		/* With a null state, lua_getlocal returns the parameter names of the function on top of the stack */
+		const char *parameter_name = lua_getlocal(vm, NULL, (int)iterator + 1);
 
-		signature s = function_signature(f);
+		signature_set(s, iterator, parameter_name, NULL);
+	}
 
-		signature_set_return(s, loader_impl_type(impl, "Integer"));
+	lua_pop(vm, 1);
 
-		value v = value_create_function(f);
+	v = value_create_function(f);
 
-		if (scope_define(sp, function_name(f), v) != 0)
-		{
-			value_type_destroy(v);
-			return 1;
-		}
+	if (scope_define(sp, function_name(f), v) != 0)
+	{
+		value_type_destroy(v);
+		return 1;
 	}
 
 	return 0;
 }
 
+int lua_loader_impl_discover(loader_impl impl, loader_handle handle, context ctx)
+{
+	loader_impl_lua lua_impl = loader_impl_get(impl);
+	loader_impl_lua_handle lua_handle = (loader_impl_lua_handle)handle;
+	loader_impl_lua_state state = &lua_impl->states[0];
+	scope sp = context_scope(ctx);
+	size_t iterator, size = vector_size(lua_handle->functions);
+	int result = 0;
+
+	log_write("metacall", LOG_LEVEL_DEBUG, "Lua module %p discovering", handle);
+
+	/* All states hold the same scripts, so introspect only the first one */
+	if (lua_loader_impl_state_acquire(state) != 0)
+	{
+		return 1;
+	}
+
+	for (iterator = 0; iterator < size && result == 0; ++iterator)
+	{
+		char **name = vector_at(lua_handle->functions, iterator);
+
+		result = lua_loader_impl_discover_function(lua_impl, lua_handle, state->vm, *name, sp);
+	}
+
+	lua_loader_impl_state_release(state);
+
+	return result;
+}
+
 int lua_loader_impl_destroy(loader_impl impl)
 {
 	loader_impl_lua lua_impl = loader_impl_get(impl);
@@ -514,8 +1058,10 @@ int lua_loader_impl_destroy(loader_impl impl)
 		/* Destroy children loaders */
 		loader_unload_children(impl);
 
-		/* Destroy Lua VM */
-		lua_close(lua_impl->vm);
+		/* Destroy the pool of Lua VMs */
+		lua_loader_impl_states_destroy(lua_impl, lua_impl->size);
+
+		vector_destroy(lua_impl->execution_paths);
 
 		free(lua_impl);
 
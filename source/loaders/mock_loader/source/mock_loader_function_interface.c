@@ -47,7 +47,8 @@ function_interface function_mock_singleton(void)
 		&function_mock_interface_create,
 		&function_mock_interface_invoke,
 		&function_mock_interface_await,
-		&function_mock_interface_destroy
+		&function_mock_interface_destroy,
+		NULL
 	};
 
 	return &mock_interface;
@@ -212,6 +212,19 @@ union loader_impl_handle_safe_cast
 	uv_handle_t *handle;
 };
 
+/* Lock-free multi-producer single-consumer queue of requests submitted from other threads,
+the producers push their requests into an intrusive stack and the JavaScript thread takes
+all of them at once, so a single wake up of the event loop executes the whole batch */
+template <typename T>
+struct loader_impl_async_safe_queue_type
+{
+	loader_impl_node node_impl;
+	std::atomic<T *> head;
+};
+
+typedef loader_impl_async_safe_queue_type<struct loader_impl_async_func_call_safe_type> *loader_impl_async_func_call_queue;
+typedef loader_impl_async_safe_queue_type<struct loader_impl_async_func_await_safe_type> *loader_impl_async_func_await_queue;
+
 struct loader_impl_node_type
 {
 	/* TODO: The current implementation may not support multi-isolate environments. We should test it. */
@@ -243,12 +256,12 @@ struct loader_impl_node_type
 	loader_impl_async_discover_safe discover_safe;
 	napi_threadsafe_function threadsafe_discover;
 
-	napi_value func_call_safe_ptr;
-	loader_impl_async_func_call_safe func_call_safe;
+	napi_value func_call_queue_ptr;
+	loader_impl_async_func_call_queue func_call_queue;
 	napi_threadsafe_function threadsafe_func_call;
 
-	napi_value func_await_safe_ptr;
-	loader_impl_async_func_await_safe func_await_safe;
+	napi_value func_await_queue_ptr;
+	loader_impl_async_func_await_queue func_await_queue;
 	napi_threadsafe_function threadsafe_func_await;
 
 	napi_value func_destroy_safe_ptr;
@@ -311,6 +324,13 @@ typedef struct loader_impl_node_future_type
 	loader_impl_node node_impl;
 	napi_ref promise_ref;
 
+	/* The futures returned by awaits from other threads are pending until the JavaScript thread
+	creates their promise, the awaits registered meanwhile are stored and applied once it is linked */
+	uv_mutex_t mutex;
+	bool pending;
+	bool orphan; /* Destroyed by its owner while pending, it is released when linked */
+	loader_impl_async_future_await_safe awaits;
+
 } * loader_impl_node_future;
 
 struct loader_impl_async_initialize_safe_type
@@ -372,6 +392,8 @@ struct loader_impl_async_func_call_safe_type
 	size_t size;
 	napi_value recv;
 	function_return ret;
+	loader_impl_async_func_call_safe next; /* Next call in the submission queue */
+	uv_sem_t completed;					   /* Signaled from the JavaScript thread once the call has been executed */
 };
 
 struct loader_impl_async_func_await_safe_type
@@ -386,6 +408,8 @@ struct loader_impl_async_func_await_safe_type
 	void *context;
 	napi_value recv;
 	function_return ret;
+	loader_impl_node_future pending;		/* Future returned to the caller before the promise exists, null when awaiting from the JavaScript thread */
+	loader_impl_async_func_await_safe next; /* Next await in the submission queue */
 };
 
 struct loader_impl_async_future_await_safe_type
@@ -398,6 +422,8 @@ struct loader_impl_async_future_await_safe_type
 	void *context;
 	napi_value recv;
 	future_return ret;
+	loader_impl_node_future pending;		  /* Future returned for an await registered before the promise existed */
+	loader_impl_async_future_await_safe next; /* Next await registered on the same pending future */
 };
 
 typedef napi_value (*function_resolve_trampoline)(loader_impl_node, napi_env, function_resolve_callback, napi_value, napi_value, void *);
@@ -469,6 +495,10 @@ static void future_node_interface_destroy(future f, future_impl impl);
 
 static future_interface future_node_singleton(void);
 
+static value node_loader_impl_future_value(loader_impl_node node_impl, bool pending, loader_impl_node_future *node_future_ptr);
+
+static void node_loader_impl_future_link(napi_env env, loader_impl_node_future node_future, napi_value promise);
+
 /* JavaScript Thread Safe */
 static void node_loader_impl_initialize_safe(napi_env env, loader_impl_async_initialize_safe initialize_safe);
 
@@ -484,6 +514,10 @@ static napi_value node_loader_impl_async_func_call_safe(napi_env env, napi_callb
 
 static void node_loader_impl_func_await_safe(napi_env env, loader_impl_async_func_await_safe func_await_safe);
 
+static void node_loader_impl_func_await_release(loader_impl_async_func_await_safe func_await_safe);
+
+static void node_loader_impl_func_await_drain(napi_env env, napi_value recv, loader_impl_async_func_await_queue func_await_queue);
+
 static napi_value node_loader_impl_async_func_await_safe(napi_env env, napi_callback_info info);
 
 static void node_loader_impl_func_destroy_safe(napi_env env, loader_impl_async_func_destroy_safe func_destroy_safe);
@@ -928,34 +962,16 @@ value node_loader_impl_napi_to_value(loader_impl_node node_impl, napi_env env, n
 		}
 		else if (napi_is_promise(env, v, &result) == napi_ok && result == true)
 		{
-			loader_impl_node_future node_future = static_cast<loader_impl_node_future>(malloc(sizeof(struct loader_impl_node_future_type)));
-
-			future f;
-
-			if (node_future == NULL)
-			{
-				return static_cast<function_return>(NULL);
-			}
-
-			f = future_create(node_future, &future_node_singleton);
-
-			if (f == NULL)
-			{
-				free(node_future);
+			loader_impl_node_future node_future = NULL;
 
-				return static_cast<function_return>(NULL);
-			}
-
-			ret = value_create_future(f);
+			ret = node_loader_impl_future_value(node_impl, false, &node_future);
 
 			if (ret == NULL)
 			{
-				future_destroy(f);
+				return static_cast<function_return>(NULL);
 			}
 
 			/* Create reference to promise */
-			node_future->node_impl = node_impl;
-
 			status = napi_create_reference(env, v, 1, &node_future->promise_ref);
 
 			node_loader_impl_exception(env, status);
@@ -1356,6 +1372,101 @@ int function_node_interface_create(function func, function_impl impl)
 	return (node_func->argv == NULL);
 }
 
+template <typename T>
+static void node_loader_impl_async_safe_queue_cancel(loader_impl_async_safe_queue_type<T> *queue, void (*cancel)(T *))
+{
+	T *pending = queue->head.exchange(NULL, std::memory_order_acquire);
+
+	while (pending != NULL)
+	{
+		T *next = pending->next;
+
+		cancel(pending);
+
+		pending = next;
+	}
+}
+
+template <typename T>
+static int node_loader_impl_async_safe_queue_push(loader_impl_async_safe_queue_type<T> *queue, T *safe, napi_threadsafe_function threadsafe_function, void (*cancel)(T *))
+{
+	T *head = queue->head.load(std::memory_order_relaxed);
+	napi_status status;
+
+	/* Push the request into the queue */
+	do
+	{
+		safe->next = head;
+	} while (queue->head.compare_exchange_weak(head, safe, std::memory_order_release, std::memory_order_relaxed) == false);
+
+	/* Only the request that found the queue empty wakes up the JavaScript thread, the rest join its batch */
+	if (head != NULL)
+	{
+		return 0;
+	}
+
+	/* Acquire the thread safe function in order to do the call */
+	status = napi_acquire_threadsafe_function(threadsafe_function);
+
+	if (status != napi_ok)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid to aquire thread safe function of the submission queue in NodeJS loader");
+	}
+
+	/* Execute the thread safe call in a nonblocking manner */
+	napi_status call_status = napi_call_threadsafe_function(threadsafe_function, nullptr, napi_tsfn_nonblocking);
+
+	if (call_status != napi_ok)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid to call to thread safe function of the submission queue in NodeJS loader");
+	}
+
+	/* Release call safe function */
+	status = napi_release_threadsafe_function(threadsafe_function, napi_tsfn_release);
+
+	if (status != napi_ok)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid to release thread safe function of the submission queue in NodeJS loader");
+	}
+
+	if (call_status != napi_ok)
+	{
+		/* The event loop is not going to drain the queue, cancel this batch so no request is lost */
+		node_loader_impl_async_safe_queue_cancel(queue, cancel);
+
+		return 1;
+	}
+
+	return 0;
+}
+
+template <typename T>
+static T *node_loader_impl_async_safe_queue_take(loader_impl_async_safe_queue_type<T> *queue)
+{
+	/* Take all the submitted requests at once (it may be empty if a previous wake up already drained them) */
+	T *pending = queue->head.exchange(NULL, std::memory_order_acquire);
+	T *batch = NULL;
+
+	/* The queue is a stack, reverse it in order to execute the requests in submission order */
+	while (pending != NULL)
+	{
+		T *next = pending->next;
+
+		pending->next = batch;
+		batch = pending;
+		pending = next;
+	}
+
+	return batch;
+}
+
+static void node_loader_impl_func_call_cancel(loader_impl_async_func_call_safe func_call_safe)
+{
+	func_call_safe->ret = NULL;
+
+	uv_sem_post(&func_call_safe->completed);
+}
+
 function_return function_node_interface_invoke(function func, function_impl impl, function_args args, size_t size)
 {
 	loader_impl_node_function node_func = (loader_impl_node_function)impl;
@@ -1363,78 +1474,62 @@ function_return function_node_interface_invoke(function func, function_impl impl
 	if (node_func != NULL)
 	{
 		loader_impl_node node_impl = node_func->node_impl;
-		function_return ret = NULL;
-		napi_status status;
-
-		/* Set up call safe arguments */
-		node_impl->func_call_safe->node_impl = node_impl;
-		node_impl->func_call_safe->func = func;
-		node_impl->func_call_safe->node_func = node_func;
-		node_impl->func_call_safe->args = static_cast<void **>(args);
-		node_impl->func_call_safe->size = size;
-		node_impl->func_call_safe->recv = NULL;
-		node_impl->func_call_safe->ret = NULL;
+		loader_impl_async_func_call_safe_type func_call_safe;
+
+		/* Set up call safe arguments, each call owns its record so concurrent calls do not overlap */
+		func_call_safe.node_impl = node_impl;
+		func_call_safe.func = func;
+		func_call_safe.node_func = node_func;
+		func_call_safe.args = static_cast<void **>(args);
+		func_call_safe.size = size;
+		func_call_safe.recv = NULL;
+		func_call_safe.ret = NULL;
+		func_call_safe.next = NULL;
 
 		/* Check if we are in the JavaScript thread */
 		if (node_impl->js_thread_id == std::this_thread::get_id())
 		{
 			/* We are already in the V8 thread, we can call safely */
-			node_loader_impl_func_call_safe(node_impl->env, node_impl->func_call_safe);
-
-			/* Set up return of the function call */
-			ret = node_impl->func_call_safe->ret;
+			node_loader_impl_func_call_safe(node_impl->env, &func_call_safe);
 		}
-		/* Lock the mutex and set the parameters */
-		else if (node_impl->locked.load() == false && uv_mutex_trylock(&node_impl->mutex) == 0)
+		/* Submit the call into the queue and wait for its completion */
+		else if (uv_sem_init(&func_call_safe.completed, 0) == 0)
 		{
-			node_impl->locked.store(true);
-
-			/* Acquire the thread safe function in order to do the call */
-			status = napi_acquire_threadsafe_function(node_impl->threadsafe_func_call);
-
-			if (status != napi_ok)
-			{
-				log_write("metacall", LOG_LEVEL_ERROR, "Invalid to aquire thread safe function invoke function in NodeJS loader");
-			}
-
-			/* Execute the thread safe call in a nonblocking manner */
-			status = napi_call_threadsafe_function(node_impl->threadsafe_func_call, nullptr, napi_tsfn_nonblocking);
-
-			if (status != napi_ok)
-			{
-				log_write("metacall", LOG_LEVEL_ERROR, "Invalid to call to thread safe function invoke function in NodeJS loader");
-			}
-
-			/* Release call safe function */
-			status = napi_release_threadsafe_function(node_impl->threadsafe_func_call, napi_tsfn_release);
+			/* Keep the function alive while it is queued, a clear from other thread may release it meanwhile */
+			function_increment_reference(func);
 
-			if (status != napi_ok)
+			if (node_loader_impl_async_safe_queue_push(node_impl->func_call_queue, &func_call_safe, node_impl->threadsafe_func_call, &node_loader_impl_func_call_cancel) != 0)
 			{
-				log_write("metacall", LOG_LEVEL_ERROR, "Invalid to release thread safe function invoke function in NodeJS loader");
+				log_write("metacall", LOG_LEVEL_ERROR, "Failed to submit the call in function_node_interface_invoke, the call has not been executed");
 			}
 
-			/* Wait for the execution of the safe call */
-			uv_cond_wait(&node_impl->cond, &node_impl->mutex);
-
-			/* Set up return of the function call */
-			ret = node_impl->func_call_safe->ret;
+			/* Wait for the execution of the safe call (or its cancellation) */
+			uv_sem_wait(&func_call_safe.completed);
 
-			node_impl->locked.store(false);
+			uv_sem_destroy(&func_call_safe.completed);
 
-			/* Unlock the mutex */
-			uv_mutex_unlock(&node_impl->mutex);
+			function_destroy(func);
 		}
 		else
 		{
-			log_write("metacall", LOG_LEVEL_ERROR, "Potential deadlock detected in function_node_interface_invoke, the call has not been executed in order to avoid the deadlock");
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid completion signal initialization in function_node_interface_invoke, the call has not been executed");
 		}
 
-		return ret;
+		/* Set up return of the function call */
+		return func_call_safe.ret;
 	}
 
 	return NULL;
 }
 
+static void node_loader_impl_func_await_cancel(loader_impl_async_func_await_safe func_await_safe)
+{
+	/* The future returned by the await is linked without promise, so the awaits registered on it are discarded */
+	node_loader_impl_future_link(NULL, func_await_safe->pending, nullptr);
+
+	node_loader_impl_func_await_release(func_await_safe);
+}
+
 function_return function_node_interface_await(function func, function_impl impl, function_args args, size_t size, function_resolve_callback resolve_callback, function_reject_callback reject_callback, void *context)
 {
 	loader_impl_node_function node_func = (loader_impl_node_function)impl;
@@ -1442,73 +1537,92 @@ function_return function_node_interface_await(function func, function_impl impl,
 	if (node_func != NULL)
 	{
 		loader_impl_node node_impl = node_func->node_impl;
-		function_return ret = NULL;
-		napi_status status;
-
-		/* Set up await safe arguments */
-		node_impl->func_await_safe->node_impl = node_impl;
-		node_impl->func_await_safe->func = func;
-		node_impl->func_await_safe->node_func = node_func;
-		node_impl->func_await_safe->args = static_cast<void **>(args);
-		node_impl->func_await_safe->size = size;
-		node_impl->func_await_safe->resolve_callback = resolve_callback;
-		node_impl->func_await_safe->reject_callback = reject_callback;
-		node_impl->func_await_safe->context = context;
-		node_impl->func_await_safe->recv = NULL;
-		node_impl->func_await_safe->ret = NULL;
+		loader_impl_async_func_await_safe func_await_safe;
+		function_return ret;
+		size_t iterator;
 
 		/* Check if we are in the JavaScript thread */
 		if (node_impl->js_thread_id == std::this_thread::get_id())
 		{
+			loader_impl_async_func_await_safe_type func_await_safe_sync;
+
+			/* Set up await safe arguments */
+			func_await_safe_sync.node_impl = node_impl;
+			func_await_safe_sync.func = func;
+			func_await_safe_sync.node_func = node_func;
+			func_await_safe_sync.args = static_cast<void **>(args);
+			func_await_safe_sync.size = size;
+			func_await_safe_sync.resolve_callback = resolve_callback;
+			func_await_safe_sync.reject_callback = reject_callback;
+			func_await_safe_sync.context = context;
+			func_await_safe_sync.recv = NULL;
+			func_await_safe_sync.ret = NULL;
+			func_await_safe_sync.pending = NULL;
+			func_await_safe_sync.next = NULL;
+
 			/* We are already in the V8 thread, we can call safely */
-			node_loader_impl_func_await_safe(node_impl->env, node_impl->func_await_safe);
+			node_loader_impl_func_await_safe(node_impl->env, &func_await_safe_sync);
 
-			/* Set up return of the function call */
-			ret = node_impl->func_await_safe->ret;
+			return func_await_safe_sync.ret;
 		}
-		/* Lock the mutex and set the parameters */
-		else if (node_impl->locked.load() == false && uv_mutex_trylock(&node_impl->mutex) == 0)
-		{
-			node_impl->locked.store(true);
 
-			/* Acquire the thread safe function in order to do the call */
-			status = napi_acquire_threadsafe_function(node_impl->threadsafe_func_await);
+		/* Submit the await into the queue without waiting for the JavaScript thread, the record is owned by the queue
+		and the returned future stays pending until the JavaScript thread creates the promise and links it */
+		func_await_safe = static_cast<loader_impl_async_func_await_safe>(malloc(sizeof(struct loader_impl_async_func_await_safe_type)));
 
-			if (status != napi_ok)
-			{
-				log_write("metacall", LOG_LEVEL_ERROR, "Invalid to aquire thread safe function await function in NodeJS loader");
-			}
+		if (func_await_safe == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid await allocation in function_node_interface_await, the call has not been executed");
+			return NULL;
+		}
 
-			/* Execute the thread safe call in a nonblocking manner */
-			status = napi_call_threadsafe_function(node_impl->threadsafe_func_await, nullptr, napi_tsfn_nonblocking);
+		/* The arguments are copied because the caller releases them as soon as the await returns */
+		func_await_safe->args = size > 0 ? static_cast<void **>(malloc(sizeof(void *) * size)) : NULL;
 
-			if (status != napi_ok)
-			{
-				log_write("metacall", LOG_LEVEL_ERROR, "Invalid to call to thread safe function await function in NodeJS loader");
-			}
+		if (size > 0 && func_await_safe->args == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid await arguments allocation in function_node_interface_await, the call has not been executed");
+			free(func_await_safe);
+			return NULL;
+		}
 
-			/* Release call safe function */
-			status = napi_release_threadsafe_function(node_impl->threadsafe_func_await, napi_tsfn_release);
+		ret = node_loader_impl_future_value(node_impl, true, &func_await_safe->pending);
 
-			if (status != napi_ok)
-			{
-				log_write("metacall", LOG_LEVEL_ERROR, "Invalid to release thread safe function await function in NodeJS loader");
-			}
+		if (ret == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid future creation in function_node_interface_await, the call has not been executed");
+			free(func_await_safe->args);
+			free(func_await_safe);
+			return NULL;
+		}
 
-			/* Wait for the execution of the safe call */
-			uv_cond_wait(&node_impl->cond, &node_impl->mutex);
+		for (iterator = 0; iterator < size; ++iterator)
+		{
+			func_await_safe->args[iterator] = value_type_copy(static_cast<value *>(args)[iterator]);
+		}
 
-			/* Set up return of the function call */
-			ret = node_impl->func_await_safe->ret;
+		func_await_safe->node_impl = node_impl;
+		func_await_safe->func = func;
+		func_await_safe->node_func = node_func;
+		func_await_safe->size = size;
+		func_await_safe->resolve_callback = resolve_callback;
+		func_await_safe->reject_callback = reject_callback;
+		func_await_safe->context = context;
+		func_await_safe->recv = NULL;
+		func_await_safe->ret = NULL;
+		func_await_safe->next = NULL;
+
+		/* Keep the function alive while it is queued, a clear from other thread may release it meanwhile */
+		function_increment_reference(func);
+
+		if (node_loader_impl_async_safe_queue_push(node_impl->func_await_queue, func_await_safe, node_impl->threadsafe_func_await, &node_loader_impl_func_await_cancel) != 0)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Failed to submit the call in function_node_interface_await, the call has not been executed");
 
-			node_impl->locked.store(false);
+			/* The record has been released by the cancellation, which also linked the future without promise */
+			value_type_destroy(ret);
 
-			/* Unlock call safe mutex */
-			uv_mutex_unlock(&node_impl->mutex);
-		}
-		else
-		{
-			log_write("metacall", LOG_LEVEL_ERROR, "Potential deadlock detected in function_node_interface_await, the call has not been executed in order to avoid the deadlock");
+			return NULL;
 		}
 
 		return ret;
@@ -1597,7 +1711,8 @@ function_interface function_node_singleton()
 		&function_node_interface_create,
 		&function_node_interface_invoke,
 		&function_node_interface_await,
-		&function_node_interface_destroy
+		&function_node_interface_destroy,
+		NULL
 	};
 
 	return &node_function_interface;
@@ -1621,6 +1736,54 @@ future_return future_node_interface_await(future f, future_impl impl, future_res
 		function_return ret = NULL;
 		napi_status status;
 
+		uv_mutex_lock(&node_future->mutex);
+
+		/* The promise has not been created yet, store the await and return a pending future for its result */
+		if (node_future->pending == true)
+		{
+			loader_impl_async_future_await_safe future_await_safe = static_cast<loader_impl_async_future_await_safe>(malloc(sizeof(struct loader_impl_async_future_await_safe_type)));
+
+			if (future_await_safe != NULL)
+			{
+				ret = node_loader_impl_future_value(node_impl, true, &future_await_safe->pending);
+
+				if (ret == NULL)
+				{
+					free(future_await_safe);
+				}
+				else
+				{
+					future_await_safe->node_impl = node_impl;
+					future_await_safe->f = f;
+					future_await_safe->node_future = node_future;
+					future_await_safe->resolve_callback = resolve_callback;
+					future_await_safe->reject_callback = reject_callback;
+					future_await_safe->context = context;
+					future_await_safe->recv = NULL;
+					future_await_safe->ret = NULL;
+					future_await_safe->next = node_future->awaits;
+					node_future->awaits = future_await_safe;
+				}
+			}
+
+			uv_mutex_unlock(&node_future->mutex);
+
+			if (ret == NULL)
+			{
+				log_write("metacall", LOG_LEVEL_ERROR, "Invalid allocation of a pending await in future_node_interface_await, the await has not been registered");
+			}
+
+			return ret;
+		}
+
+		uv_mutex_unlock(&node_future->mutex);
+
+		if (node_future->promise_ref == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid await of a future without promise in future_node_interface_await, its await call has failed or has been cancelled");
+			return NULL;
+		}
+
 		/* Set up await safe arguments */
 		node_impl->future_await_safe->node_impl = node_impl;
 		node_impl->future_await_safe->f = f;
@@ -1630,6 +1793,8 @@ future_return future_node_interface_await(future f, future_impl impl, future_res
 		node_impl->future_await_safe->context = context;
 		node_impl->future_await_safe->recv = NULL;
 		node_impl->future_await_safe->ret = NULL;
+		node_impl->future_await_safe->pending = NULL;
+		node_impl->future_await_safe->next = NULL;
 
 		/* Check if we are in the JavaScript thread */
 		if (node_impl->js_thread_id == std::this_thread::get_id())
@@ -1697,7 +1862,21 @@ void future_node_interface_destroy(future f, future_impl impl)
 
 	if (node_future != NULL)
 	{
-		if (loader_is_destroyed(node_future->node_impl->impl) != 0)
+		uv_mutex_lock(&node_future->mutex);
+
+		/* A pending future is released by the JavaScript thread when its promise is linked */
+		if (node_future->pending == true)
+		{
+			node_future->orphan = true;
+
+			uv_mutex_unlock(&node_future->mutex);
+
+			return;
+		}
+
+		uv_mutex_unlock(&node_future->mutex);
+
+		if (node_future->promise_ref != NULL && loader_is_destroyed(node_future->node_impl->impl) != 0)
 		{
 			loader_impl_node node_impl = node_future->node_impl;
 			napi_status status;
@@ -1756,6 +1935,8 @@ void future_node_interface_destroy(future f, future_impl impl)
 			}
 		}
 
+		uv_mutex_destroy(&node_future->mutex);
+
 		/* Free node future */
 		free(node_future);
 	}
@@ -1772,6 +1953,131 @@ future_interface future_node_singleton()
 	return &node_future_interface;
 }
 
+value node_loader_impl_future_value(loader_impl_node node_impl, bool pending, loader_impl_node_future *node_future_ptr)
+{
+	loader_impl_node_future node_future = static_cast<loader_impl_node_future>(malloc(sizeof(struct loader_impl_node_future_type)));
+	future f;
+	value ret;
+
+	if (node_future == NULL)
+	{
+		return NULL;
+	}
+
+	if (uv_mutex_init(&node_future->mutex) != 0)
+	{
+		free(node_future);
+		return NULL;
+	}
+
+	node_future->node_impl = node_impl;
+	node_future->promise_ref = NULL;
+	node_future->pending = false;
+	node_future->orphan = false;
+	node_future->awaits = NULL;
+
+	f = future_create(node_future, &future_node_singleton);
+
+	if (f == NULL)
+	{
+		uv_mutex_destroy(&node_future->mutex);
+		free(node_future);
+		return NULL;
+	}
+
+	ret = value_create_future(f);
+
+	if (ret == NULL)
+	{
+		future_destroy(f);
+		return NULL;
+	}
+
+	/* Mark it as pending once it has been created, so a failed creation releases it directly */
+	node_future->pending = pending;
+
+	*node_future_ptr = node_future;
+
+	return ret;
+}
+
+void node_loader_impl_future_link(napi_env env, loader_impl_node_future node_future, napi_value promise)
+{
+	loader_impl_async_future_await_safe pending, awaits = NULL;
+	bool is_promise = false, orphan;
+
+	/* The promise is null when the await could not be executed or it has been cancelled */
+	if (promise != nullptr && napi_is_promise(env, promise, &is_promise) != napi_ok)
+	{
+		is_promise = false;
+	}
+
+	uv_mutex_lock(&node_future->mutex);
+
+	if (is_promise == true)
+	{
+		napi_status status = napi_create_reference(env, promise, 1, &node_future->promise_ref);
+
+		node_loader_impl_exception(env, status);
+	}
+
+	node_future->pending = false;
+	orphan = node_future->orphan;
+	pending = node_future->awaits;
+	node_future->awaits = NULL;
+
+	uv_mutex_unlock(&node_future->mutex);
+
+	if (node_future->promise_ref == NULL && pending != NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "NodeJS await has no promise, the awaits registered on its future are discarded");
+	}
+
+	/* The awaits are stored in reverse order, apply them in registration order */
+	while (pending != NULL)
+	{
+		loader_impl_async_future_await_safe next = pending->next;
+
+		pending->next = awaits;
+		awaits = pending;
+		pending = next;
+	}
+
+	while (awaits != NULL)
+	{
+		loader_impl_async_future_await_safe future_await_safe = awaits;
+
+		awaits = awaits->next;
+
+		/* Links the pending future of the await to the promise returned by it */
+		if (node_future->promise_ref != NULL)
+		{
+			node_loader_impl_future_await_safe(env, future_await_safe);
+		}
+
+		if (future_await_safe->pending != NULL)
+		{
+			node_loader_impl_future_link(env, future_await_safe->pending, nullptr);
+		}
+
+		free(future_await_safe);
+	}
+
+	if (orphan == true)
+	{
+		if (node_future->promise_ref != NULL)
+		{
+			napi_status status = napi_delete_reference(env, node_future->promise_ref);
+
+			node_loader_impl_exception(env, status);
+		}
+
+		uv_mutex_destroy(&node_future->mutex);
+
+		free(node_future);
+	}
+}
+
 void node_loader_impl_initialize_safe(napi_env env, loader_impl_async_initialize_safe initialize_safe)
 {
 	static const char initialize_str[] = "initialize";
@@ -2041,33 +2347,36 @@ void node_loader_impl_func_call_safe(napi_env env, loader_impl_async_func_call_s
 
 napi_value node_loader_impl_async_func_call_safe(napi_env env, napi_callback_info info)
 {
-	loader_impl_async_safe_cast<loader_impl_async_func_call_safe> func_call_cast = { NULL };
+	loader_impl_async_safe_cast<loader_impl_async_func_call_queue> func_call_queue_cast = { NULL };
 	napi_status status;
 	napi_value recv;
 
-	status = napi_get_cb_info(env, info, nullptr, nullptr, &recv, &func_call_cast.ptr);
+	status = napi_get_cb_info(env, info, nullptr, nullptr, &recv, &func_call_queue_cast.ptr);
 
 	node_loader_impl_exception(env, status);
 
-	/* Lock the call safe mutex and get the parameters */
-	uv_mutex_lock(&func_call_cast.safe->node_impl->mutex);
-
-	/* Store function recv for reentrant calls */
-	func_call_cast.safe->recv = recv;
+	/* Take all the submitted calls at once */
+	loader_impl_async_func_call_safe batch = node_loader_impl_async_safe_queue_take(func_call_queue_cast.safe);
 
 	/* Store environment for reentrant calls */
-	func_call_cast.safe->node_impl->env = env;
+	func_call_queue_cast.safe->node_impl->env = env;
 
-	/* Call to the implementation function */
-	node_loader_impl_func_call_safe(env, func_call_cast.safe);
+	while (batch != NULL)
+	{
+		loader_impl_async_func_call_safe func_call_safe = batch;
 
-	/* Clear environment */
-	// func_call_cast.safe->node_impl->env = NULL;
+		/* Get the next call before signaling, the record is owned by the caller and it is released after the signal */
+		batch = batch->next;
 
-	/* Signal function call condition */
-	uv_cond_signal(&func_call_cast.safe->node_impl->cond);
+		/* Store function recv for reentrant calls */
+		func_call_safe->recv = recv;
 
-	uv_mutex_unlock(&func_call_cast.safe->node_impl->mutex);
+		/* Call to the implementation function */
+		node_loader_impl_func_call_safe(env, func_call_safe);
+
+		/* Signal the completion of the call */
+		uv_sem_post(&func_call_safe->completed);
+	}
 
 	return nullptr;
 }
@@ -2279,7 +2588,7 @@ void node_loader_impl_func_await_safe(napi_env env, loader_impl_async_func_await
 				node_loader_impl_exception(env, status);
 
 				/* Call to function */
-				napi_value global, await_return;
+				napi_value global, await_return = nullptr;
 
 				status = napi_get_reference_value(env, func_await_safe->node_impl->global_ref, &global);
 
@@ -2294,8 +2603,17 @@ void node_loader_impl_func_await_safe(napi_env env, loader_impl_async_func_await
 
 				node_loader_impl_exception(env, status);
 
-				/* Proccess the await return */
-				func_await_safe->ret = node_loader_impl_napi_to_value(func_await_safe->node_impl, env, func_await_safe->recv, await_return);
+				/* Proccess the await return, the future already returned to other thread is linked to the promise */
+				if (func_await_safe->pending != NULL)
+				{
+					node_loader_impl_future_link(env, func_await_safe->pending, await_return);
+
+					func_await_safe->pending = NULL;
+				}
+				else
+				{
+					func_await_safe->ret = node_loader_impl_napi_to_value(func_await_safe->node_impl, env, func_await_safe->recv, await_return);
+				}
 
 				if (args_size > signature_args_size)
 				{
@@ -2311,34 +2629,65 @@ void node_loader_impl_func_await_safe(napi_env env, loader_impl_async_func_await
 	node_loader_impl_exception(env, status);
 }
 
-napi_value node_loader_impl_async_func_await_safe(napi_env env, napi_callback_info info)
+void node_loader_impl_func_await_drain(napi_env env, napi_value recv, loader_impl_async_func_await_queue func_await_queue)
 {
-	napi_value recv;
-	loader_impl_async_safe_cast<loader_impl_async_func_await_safe> func_await_cast = { NULL };
+	/* Take all the submitted awaits at once */
+	loader_impl_async_func_await_safe batch = node_loader_impl_async_safe_queue_take(func_await_queue);
 
-	napi_status status = napi_get_cb_info(env, info, nullptr, nullptr, &recv, &func_await_cast.ptr);
+	/* Store environment for reentrant calls */
+	func_await_queue->node_impl->env = env;
 
-	node_loader_impl_exception(env, status);
+	while (batch != NULL)
+	{
+		loader_impl_async_func_await_safe func_await_safe = batch;
 
-	/* Lock node implementation mutex */
-	uv_mutex_lock(&func_await_cast.safe->node_impl->mutex);
+		/* Get the next await before releasing the record, it is owned by the queue */
+		batch = batch->next;
 
-	/* Store function recv for reentrant calls */
-	func_await_cast.safe->recv = recv;
+		/* Store function recv for reentrant calls */
+		func_await_safe->recv = recv;
 
-	/* Store environment for reentrant calls */
-	func_await_cast.safe->node_impl->env = env;
+		/* Call to the implementation function, it links the pending future to the promise */
+		node_loader_impl_func_await_safe(env, func_await_safe);
 
-	/* Call to the implementation function */
-	node_loader_impl_func_await_safe(env, func_await_cast.safe);
+		/* The promise could not be created, link the future without it so it is not pending forever */
+		if (func_await_safe->pending != NULL)
+		{
+			node_loader_impl_future_link(env, func_await_safe->pending, nullptr);
+		}
 
-	/* Clear environment */
-	// func_await_cast.safe->node_impl->env = NULL;
+		node_loader_impl_func_await_release(func_await_safe);
+	}
+}
 
-	/* Signal function await condition */
-	uv_cond_signal(&func_await_cast.safe->node_impl->cond);
+void node_loader_impl_func_await_release(loader_impl_async_func_await_safe func_await_safe)
+{
+	size_t iterator;
+
+	/* Release the copies of the arguments and the reference to the function taken when it was submitted */
+	for (iterator = 0; iterator < func_await_safe->size; ++iterator)
+	{
+		value_type_destroy(func_await_safe->args[iterator]);
+	}
+
+	free(func_await_safe->args);
 
-	uv_mutex_unlock(&func_await_cast.safe->node_impl->mutex);
+	function_destroy(func_await_safe->func);
+
+	free(func_await_safe);
+}
+
+napi_value node_loader_impl_async_func_await_safe(napi_env env, napi_callback_info info)
+{
+	napi_value recv;
+	loader_impl_async_safe_cast<loader_impl_async_func_await_queue> func_await_queue_cast = { NULL };
+
+	napi_status status = napi_get_cb_info(env, info, nullptr, nullptr, &recv, &func_await_queue_cast.ptr);
+
+	node_loader_impl_exception(env, status);
+
+	/* Execute the whole batch of submitted awaits */
+	node_loader_impl_func_await_drain(env, recv, func_await_queue_cast.safe);
 
 	return nullptr;
 }
@@ -2478,7 +2827,7 @@ void node_loader_impl_future_await_safe(napi_env env, loader_impl_async_future_a
 				node_loader_impl_exception(env, status);
 
 				/* Call to function */
-				napi_value global, await_return;
+				napi_value global, await_return = nullptr;
 
 				status = napi_get_reference_value(env, future_await_safe->node_impl->global_ref, &global);
 
@@ -2493,8 +2842,17 @@ void node_loader_impl_future_await_safe(napi_env env, loader_impl_async_future_a
 
 				node_loader_impl_exception(env, status);
 
-				/* Proccess the await return */
-				future_await_safe->ret = node_loader_impl_napi_to_value(future_await_safe->node_impl, env, future_await_safe->recv, await_return);
+				/* Proccess the await return, an await registered while pending links its own pending future */
+				if (future_await_safe->pending != NULL)
+				{
+					node_loader_impl_future_link(env, future_await_safe->pending, await_return);
+
+					future_await_safe->pending = NULL;
+				}
+				else
+				{
+					future_await_safe->ret = node_loader_impl_napi_to_value(future_await_safe->node_impl, env, future_await_safe->recv, await_return);
+				}
 			}
 		}
 	}
@@ -3887,26 +4245,32 @@ void *node_loader_impl_register(void *node_impl_ptr, void *env_ptr, void *functi
 		{
 			static const char threadsafe_func_name_str[] = "node_loader_impl_async_func_call_safe";
 
-			node_loader_impl_thread_safe_function_initialize<loader_impl_async_func_call_safe_type>(
+			node_loader_impl_thread_safe_function_initialize<loader_impl_async_safe_queue_type<loader_impl_async_func_call_safe_type>>(
 				env,
 				threadsafe_func_name_str, sizeof(threadsafe_func_name_str),
 				&node_loader_impl_async_func_call_safe,
-				(loader_impl_async_func_call_safe_type **)(&node_impl->func_call_safe),
-				&node_impl->func_call_safe_ptr,
+				&node_impl->func_call_queue,
+				&node_impl->func_call_queue_ptr,
 				&node_impl->threadsafe_func_call);
+
+			node_impl->func_call_queue->node_impl = node_impl;
+			node_impl->func_call_queue->head.store(NULL);
 		}
 
 		/* Safe function await */
 		{
 			static const char threadsafe_func_name_str[] = "node_loader_impl_async_func_await_safe";
 
-			node_loader_impl_thread_safe_function_initialize<loader_impl_async_func_await_safe_type>(
+			node_loader_impl_thread_safe_function_initialize<loader_impl_async_safe_queue_type<loader_impl_async_func_await_safe_type>>(
 				env,
 				threadsafe_func_name_str, sizeof(threadsafe_func_name_str),
 				&node_loader_impl_async_func_await_safe,
-				(loader_impl_async_func_await_safe_type **)(&node_impl->func_await_safe),
-				&node_impl->func_await_safe_ptr,
+				&node_impl->func_await_queue,
+				&node_impl->func_await_queue_ptr,
 				&node_impl->threadsafe_func_await);
+
+			node_impl->func_await_queue->node_impl = node_impl;
+			node_impl->func_await_queue->head.store(NULL);
 		}
 
 		/* Safe function destroy */
@@ -4961,6 +5325,9 @@ void node_loader_impl_destroy_safe(napi_env env, loader_impl_async_destroy_safe
 
 	node_loader_impl_exception(env, status);
 
+	/* Start the awaits still pending in the submission queue, so their promises are waited below */
+	node_loader_impl_func_await_drain(env, nullptr, node_impl->func_await_queue);
+
 	/* Check if there are async handles, destroy if the queue is empty, otherwise request the destroy */
 	if (node_loader_impl_user_async_handles_count(node_impl) <= 0 || node_impl->event_loop_empty.load() == true)
 	{
@@ -5147,6 +5514,9 @@ void node_loader_impl_destroy_safe_impl(loader_impl_node node_impl, napi_env env
 			status = napi_release_threadsafe_function(node_impl->threadsafe_func_call, napi_tsfn_abort);
 
 			node_loader_impl_exception(env, status);
+
+			/* Cancel the calls that were submitted but not drained, from now on the submissions fail with closing status */
+			node_loader_impl_async_safe_queue_cancel(node_impl->func_call_queue, &node_loader_impl_func_call_cancel);
 		}
 
 		/* Safe function await */
@@ -5154,6 +5524,9 @@ void node_loader_impl_destroy_safe_impl(loader_impl_node node_impl, napi_env env
 			status = napi_release_threadsafe_function(node_impl->threadsafe_func_await, napi_tsfn_abort);
 
 			node_loader_impl_exception(env, status);
+
+			/* Cancel the awaits submitted after the drain of the destroy, from now on the submissions fail with closing status */
+			node_loader_impl_async_safe_queue_cancel(node_impl->func_await_queue, &node_loader_impl_func_await_cancel);
 		}
 
 		/* Safe function destroy */
@@ -5347,8 +5720,8 @@ int node_loader_impl_destroy(loader_impl impl)
 	delete node_impl->load_from_memory_safe;
 	delete node_impl->clear_safe;
 	delete node_impl->discover_safe;
-	delete node_impl->func_call_safe;
-	delete node_impl->func_await_safe;
+	delete node_impl->func_call_queue;
+	delete node_impl->func_await_queue;
 	delete node_impl->func_destroy_safe;
 	delete node_impl->future_await_safe;
 	delete node_impl->future_delete_safe;
@@ -42,6 +42,12 @@
 
 #include <Python.h>
 
+#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64)
+	#include <windows.h>
+#else
+	#include <pthread.h>
+#endif
+
 #define PY_LOADER_IMPL_FUNCTION_TYPE_INVOKE_FUNC "__py_loader_impl_function_type_invoke__"
 #define PY_LOADER_IMPL_FINALIZER_FUNC			 "__py_loader_impl_finalizer__"
 
@@ -51,10 +57,44 @@
 	#define DEBUG_ENABLED 0
 #endif
 
+/* Vectorcall is available since Python 3.8 (PEP 590), in 3.8 it is exposed with underscore */
+#if PY_VERSION_HEX >= 0x03080000
+	#define PY_LOADER_IMPL_VECTORCALL 1
+	#if PY_VERSION_HEX < 0x03090000
+		#define PyObject_Vectorcall _PyObject_Vectorcall
+	#endif
+#else
+	#define PY_LOADER_IMPL_VECTORCALL 0
+#endif
+
+/* Maximum number of arguments passed through the stack in the vectorcall path */
+#define PY_LOADER_IMPL_VECTORCALL_STACK_SIZE 0x10
+
+typedef PyObject *(*py_loader_impl_value_to_capi_func)(loader_impl, type_id, value);
+
+typedef value (*py_loader_impl_capi_to_value_func)(loader_impl, PyObject *, type_id);
+
+typedef struct loader_impl_py_function_plan_arg_type
+{
+	type_id id;									   /* TYPE_INVALID if the argument is not annotated */
+	py_loader_impl_value_to_capi_func to_capi; /* NULL if the type must be inspected on each call */
+
+} * loader_impl_py_function_plan_arg;
+
+typedef struct loader_impl_py_function_plan_type
+{
+	size_t args_size;
+	loader_impl_py_function_plan_arg args;
+	type_id ret_id;
+	py_loader_impl_capi_to_value_func to_value;
+
+} * loader_impl_py_function_plan;
+
 typedef struct loader_impl_py_function_type
 {
 	PyObject *func;
-	PyObject **values; // Cache and re-use the values array
+	PyObject **values;				   // Cache and re-use the values array
+	loader_impl_py_function_plan plan; // Conversion plan, built lazily from the signature on the first call
 	loader_impl impl;
 } * loader_impl_py_function;
 
@@ -97,6 +137,7 @@ typedef struct loader_impl_py_handle_type
 
 struct loader_impl_py_type
 {
+	PyThreadState *main_tstate; /* Released after initialization, NULL if Python was initialized by the host */
 	PyObject *inspect_module;
 	PyObject *inspect_signature;
 	PyObject *inspect_getattr_static;
@@ -127,6 +168,8 @@ struct loader_impl_py_type
 	PyObject *gc_debug_leak;
 	PyObject *gc_debug_stats;
 #endif
+
+	int buffer_memoryview; /* Pass buffers as memory views of the value instead of copying them into bytes */
 };
 
 typedef struct loader_impl_py_function_type_invoke_state_type
@@ -192,6 +235,18 @@ static void py_loader_impl_value_ptr_finalize(value v, void *data);
 
 static int py_loader_impl_finalize(loader_impl_py py_impl);
 
+static PyGILState_STATE py_loader_impl_gil_ensure(void);
+
+static int py_loader_impl_thread_state_initialize(void);
+
+static void py_loader_impl_thread_state_destroy(void);
+
+#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64)
+static VOID WINAPI py_loader_impl_thread_state_exit(PVOID data);
+#else
+static void py_loader_impl_thread_state_exit(void *data);
+#endif
+
 static PyObject *py_loader_impl_load_from_memory_compile(loader_impl_py py_impl, const loader_name name, const char *buffer);
 
 static PyMethodDef py_loader_impl_function_type_invoke_defs[] = {
@@ -285,6 +340,86 @@ static PyTypeObject py_loader_impl_dict_type = {
 	0,										   /* tp_vectorcall */
 };
 
+struct py_loader_impl_buffer_obj
+{
+	PyObject_HEAD
+		value v;
+};
+
+struct py_loader_impl_buffer_borrow_type
+{
+	loader_impl impl;
+	Py_buffer view;
+};
+
+static void py_loader_impl_buffer_dealloc(struct py_loader_impl_buffer_obj *self);
+
+static int py_loader_impl_buffer_getbuffer(struct py_loader_impl_buffer_obj *self, Py_buffer *view, int flags);
+
+static PyObject *py_loader_impl_buffer_wrap(value v);
+
+static value py_loader_impl_buffer_unwrap(PyObject *obj);
+
+static value py_loader_impl_buffer_borrow(loader_impl impl, PyObject *obj);
+
+static void py_loader_impl_buffer_borrow_release(value v, void *data);
+
+static PyBufferProcs py_loader_impl_buffer_procs = {
+	(getbufferproc)py_loader_impl_buffer_getbuffer,	/* bf_getbuffer */
+	0												/* bf_releasebuffer */
+};
+
+static PyTypeObject py_loader_impl_buffer_type = {
+	PyVarObject_HEAD_INIT(NULL, 0) "BufferWrapper",
+	sizeof(struct py_loader_impl_buffer_obj),
+	0,
+	(destructor)py_loader_impl_buffer_dealloc,			/* tp_dealloc */
+	0,													/* tp_vectorcall_offset */
+	0,													/* tp_getattr */
+	0,													/* tp_setattr */
+	0,													/* tp_as_async */
+	0,													/* tp_repr */
+	0,													/* tp_as_number */
+	0,													/* tp_as_sequence */
+	0,													/* tp_as_mapping */
+	0,													/* tp_hash */
+	0,													/* tp_call */
+	0,													/* tp_str */
+	0,													/* tp_getattro */
+	0,													/* tp_setattro */
+	&py_loader_impl_buffer_procs,						/* tp_as_buffer */
+	Py_TPFLAGS_DEFAULT,									/* tp_flags */
+	PyDoc_STR("Read-only memory of a MetaCall buffer"),	/* tp_doc */
+	0,													/* tp_traverse */
+	0,													/* tp_clear */
+	0,													/* tp_richcompare */
+	0,													/* tp_weaklistoffset */
+	0,													/* tp_iter */
+	0,													/* tp_iternext */
+	0,													/* tp_methods */
+	0,													/* tp_members */
+	0,													/* tp_getset */
+	0,													/* tp_base */
+	0,													/* tp_dict */
+	0,													/* tp_descr_get */
+	0,													/* tp_descr_set */
+	0,													/* tp_dictoffset */
+	0,													/* tp_init */
+	0,													/* tp_alloc */
+	0,													/* tp_new */
+	0,													/* tp_free */
+	0,													/* tp_is_gc */
+	0,													/* tp_bases */
+	0,													/* tp_mro */
+	0,													/* tp_cache */
+	0,													/* tp_subclasses */
+	0,													/* tp_weaklist */
+	0,													/* tp_del */
+	0,													/* tp_version_tag */
+	0,													/* tp_finalize */
+	0,													/* tp_vectorcall */
+};
+
 /* Implements: if __name__ == "__main__": */
 static int py_loader_impl_run_main = 1;
 static char *py_loader_impl_main_module = NULL;
@@ -292,6 +427,88 @@ static char *py_loader_impl_main_module = NULL;
 /* Holds reference to the original PyCFunction.tp_dealloc method */
 static void (*py_loader_impl_pycfunction_dealloc)(PyObject *) = NULL;
 
+/* Marks the native threads that keep their thread state between calls, so it is deleted when they exit */
+#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64)
+static DWORD py_loader_impl_thread_state_key = FLS_OUT_OF_INDEXES;
+#else
+static pthread_key_t py_loader_impl_thread_state_key;
+static int py_loader_impl_thread_state_key_created = 1;
+#endif
+
+int py_loader_impl_thread_state_initialize(void)
+{
+#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64)
+	py_loader_impl_thread_state_key = FlsAlloc(&py_loader_impl_thread_state_exit);
+
+	return py_loader_impl_thread_state_key == FLS_OUT_OF_INDEXES;
+#else
+	py_loader_impl_thread_state_key_created = pthread_key_create(&py_loader_impl_thread_state_key, &py_loader_impl_thread_state_exit);
+
+	return py_loader_impl_thread_state_key_created;
+#endif
+}
+
+void py_loader_impl_thread_state_destroy(void)
+{
+	/* The key must be deleted before unloading the loader, otherwise the threads would exit into unmapped code */
+#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64)
+	if (py_loader_impl_thread_state_key != FLS_OUT_OF_INDEXES)
+	{
+		FlsFree(py_loader_impl_thread_state_key);
+		py_loader_impl_thread_state_key = FLS_OUT_OF_INDEXES;
+	}
+#else
+	if (py_loader_impl_thread_state_key_created == 0)
+	{
+		pthread_key_delete(py_loader_impl_thread_state_key);
+		py_loader_impl_thread_state_key_created = 1;
+	}
+#endif
+}
+
+#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64)
+VOID WINAPI py_loader_impl_thread_state_exit(PVOID data)
+#else
+void py_loader_impl_thread_state_exit(void *data)
+#endif
+{
+	/* The thread states are freed by Python when it is finalized, so they are only deleted while it is alive */
+	if (data != NULL && Py_IsInitialized() != 0 && PyGILState_GetThisThreadState() != NULL)
+	{
+		/* Drop the reference taken by this ensure and then the one that kept the thread state pinned, */
+		/* the last release deletes the thread state and releases the GIL */
+		(void)PyGILState_Ensure();
+		PyGILState_Release(PyGILState_LOCKED);
+		PyGILState_Release(PyGILState_UNLOCKED);
+	}
+}
+
+PyGILState_STATE py_loader_impl_gil_ensure(void)
+{
+	/* Native threads not created by Python keep their thread state between calls instead of creating it on each call, */
+	/* it is deleted when the thread exits, if the key can not be created each call creates and deletes its own state */
+	if (PyGILState_GetThisThreadState() == NULL)
+	{
+#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64)
+		if (py_loader_impl_thread_state_key != FLS_OUT_OF_INDEXES)
+		{
+			(void)PyGILState_Ensure();
+			(void)PyEval_SaveThread();
+			FlsSetValue(py_loader_impl_thread_state_key, (PVOID)&py_loader_impl_thread_state_key);
+		}
+#else
+		if (py_loader_impl_thread_state_key_created == 0)
+		{
+			(void)PyGILState_Ensure();
+			(void)PyEval_SaveThread();
+			pthread_setspecific(py_loader_impl_thread_state_key, (void *)&py_loader_impl_thread_state_key);
+		}
+#endif
+	}
+
+	return PyGILState_Ensure();
+}
+
 PyObject *py_loader_impl_dict_sizeof(struct py_loader_impl_dict_obj *self, void *Py_UNUSED(unused))
 {
 	Py_ssize_t res;
@@ -332,6 +549,118 @@ void py_loader_impl_dict_dealloc(struct py_loader_impl_dict_obj *self)
 	PyDict_Type.tp_dealloc((PyObject *)self);
 }
 
+void py_loader_impl_buffer_dealloc(struct py_loader_impl_buffer_obj *self)
+{
+	/* Release the reference acquired when wrapping, the owner may have destroyed the value already */
+	value_type_destroy(self->v);
+
+	PyObject_Del(self);
+}
+
+int py_loader_impl_buffer_getbuffer(struct py_loader_impl_buffer_obj *self, Py_buffer *view, int flags)
+{
+	/* This forces that you wont never be able to pass a buffer as a pointer to metacall without be wrapped into a value type */
+	/* If a pointer is passed this will produce a garbage read from outside of the memory range of the parameter */
+	return PyBuffer_FillInfo(view, (PyObject *)self, value_to_buffer(self->v), (Py_ssize_t)value_type_size(self->v), 1, flags);
+}
+
+PyObject *py_loader_impl_buffer_wrap(value v)
+{
+	struct py_loader_impl_buffer_obj *wrapper = PyObject_New(struct py_loader_impl_buffer_obj, &py_loader_impl_buffer_type);
+
+	if (wrapper == NULL)
+	{
+		return NULL;
+	}
+
+	/* The wrapper pins the value, so the memory view can outlive the call without copying the data */
+	value_ref_inc(v);
+	wrapper->v = v;
+
+	PyObject *view = PyMemoryView_FromObject((PyObject *)wrapper);
+
+	/* The memory view holds its own reference to the wrapper */
+	Py_DECREF(wrapper);
+
+	return view;
+}
+
+value py_loader_impl_buffer_unwrap(PyObject *obj)
+{
+	if (!PyMemoryView_Check(obj))
+	{
+		return NULL;
+	}
+
+	Py_buffer *view = PyMemoryView_GET_BUFFER(obj);
+
+	if (view->obj == NULL || Py_TYPE(view->obj) != &py_loader_impl_buffer_type)
+	{
+		return NULL;
+	}
+
+	struct py_loader_impl_buffer_obj *wrapper = (struct py_loader_impl_buffer_obj *)view->obj;
+
+	/* Slices or non-contiguous views only refer to a part of the value, so they must be copied */
+	if (view->buf != value_to_buffer(wrapper->v) || (size_t)view->len != value_type_size(wrapper->v) || !PyBuffer_IsContiguous(view, 'C'))
+	{
+		return NULL;
+	}
+
+	/* A memory view of a MetaCall buffer returns the same value, shared with the original owner */
+	value_ref_inc(wrapper->v);
+
+	return wrapper->v;
+}
+
+value py_loader_impl_buffer_borrow(loader_impl impl, PyObject *obj)
+{
+	struct py_loader_impl_buffer_borrow_type *borrow = malloc(sizeof(struct py_loader_impl_buffer_borrow_type));
+	value v;
+
+	if (borrow == NULL)
+	{
+		return NULL;
+	}
+
+	/* Only writable and contiguous memory can be shared, the rest of exporters must be copied */
+	if (PyObject_GetBuffer(obj, &borrow->view, PyBUF_CONTIG) != 0)
+	{
+		PyErr_Clear();
+		free(borrow);
+		return NULL;
+	}
+
+	borrow->impl = impl;
+
+	/* The view keeps a reference to the exporter, so the memory is valid until the value is destroyed */
+	v = value_create_buffer_borrow(borrow->view.buf, (size_t)borrow->view.len, &py_loader_impl_buffer_borrow_release, borrow);
+
+	if (v == NULL)
+	{
+		PyBuffer_Release(&borrow->view);
+		free(borrow);
+	}
+
+	return v;
+}
+
+void py_loader_impl_buffer_borrow_release(value v, void *data)
+{
+	struct py_loader_impl_buffer_borrow_type *borrow = (struct py_loader_impl_buffer_borrow_type *)data;
+
+	(void)v;
+
+	if (loader_is_destroyed(borrow->impl) != 0)
+	{
+		PyGILState_STATE gstate = py_loader_impl_gil_ensure();
+		PyBuffer_Release(&borrow->view);
+		PyGILState_Release(gstate);
+	}
+
+	free(borrow);
+}
+
 PyObject *py_loader_impl_finalizer_wrap_map(PyObject *obj, value v)
 {
 	PyObject *args = PyTuple_New(1);
@@ -396,11 +725,9 @@ void py_loader_impl_value_invoke_state_finalize(value v, void *data)
 
 	if (loader_is_destroyed(invoke_state->impl) != 0 && capsule != NULL)
 	{
-		PyThreadState *tstate = PyEval_SaveThread();
-		PyGILState_STATE gstate = PyGILState_Ensure();
+		PyGILState_STATE gstate = py_loader_impl_gil_ensure();
 		Py_DECREF(capsule);
 		PyGILState_Release(gstate);
-		PyEval_RestoreThread(tstate);
 	}
 
 	free(invoke_state);
@@ -441,11 +768,9 @@ void type_py_interface_destroy(type t, type_impl impl)
 
 	if (Py_IsInitialized() != 0)
 	{
-		PyThreadState *tstate = PyEval_SaveThread();
-		PyGILState_STATE gstate = PyGILState_Ensure();
+		PyGILState_STATE gstate = py_loader_impl_gil_ensure();
 		Py_DECREF(builtin);
 		PyGILState_Release(gstate);
-		PyEval_RestoreThread(tstate);
 	}
 }
 
@@ -486,6 +811,9 @@ int function_py_interface_create(function func, function_impl impl)
 		py_func->values = NULL;
 	}
 
+	/* The signature is not discovered yet, the plan is built on the first call */
+	py_func->plan = NULL;
+
 	return 0;
 }
 
@@ -507,11 +835,9 @@ void future_py_interface_destroy(future f, future_impl impl)
 	{
 		if (loader_is_destroyed(py_future->impl) != 0)
 		{
-			PyThreadState *tstate = PyEval_SaveThread();
-			PyGILState_STATE gstate = PyGILState_Ensure();
+			PyGILState_STATE gstate = py_loader_impl_gil_ensure();
 			Py_DECREF(py_future->future);
 			PyGILState_Release(gstate);
-			PyEval_RestoreThread(tstate);
 		}
 
 		free(py_future);
@@ -548,6 +874,7 @@ value py_object_interface_get(object obj, object_impl impl, struct accessor_type
 	(void)obj;
 
 	loader_impl_py_object py_object = (loader_impl_py_object)impl;
+	PyGILState_STATE gstate = py_loader_impl_gil_ensure();
 	PyObject *pyobject_object = py_object->obj;
 	PyObject *key_py_str = PyUnicode_FromString(attribute_name(accessor->data.attr));
 	PyObject *generic_attr = PyObject_GenericGetAttr(pyobject_object, key_py_str);
@@ -556,6 +883,8 @@ value py_object_interface_get(object obj, object_impl impl, struct accessor_type
 	value v = py_loader_impl_capi_to_value(impl, generic_attr, py_loader_impl_capi_to_value_type(py_object->impl, generic_attr));
 	Py_XDECREF(generic_attr);
 
+	PyGILState_Release(gstate);
+
 	return v;
 }
 
@@ -564,6 +893,7 @@ int py_object_interface_set(object obj, object_impl impl, struct accessor_type *
 	(void)obj;
 
 	loader_impl_py_object py_object = (loader_impl_py_object)impl;
+	PyGILState_STATE gstate = py_loader_impl_gil_ensure();
 	PyObject *pyobject_object = py_object->obj;
 	PyObject *key_py_str = PyUnicode_FromString(attribute_name(accessor->data.attr));
 	PyObject *pyvalue = py_loader_impl_value_to_capi(py_object->impl, value_type_id(v), v);
@@ -571,6 +901,8 @@ int py_object_interface_set(object obj, object_impl impl, struct accessor_type *
 
 	Py_DECREF(key_py_str);
 
+	PyGILState_Release(gstate);
+
 	return retval;
 }
 
@@ -585,11 +917,13 @@ value py_object_interface_method_invoke(object obj, object_impl impl, method m,
 		return NULL;
 	}
 
+	PyGILState_STATE gstate = py_loader_impl_gil_ensure();
+	value ret = NULL;
 	PyObject *args_tuple = PyTuple_New(argc);
 
 	if (args_tuple == NULL)
 	{
-		return NULL;
+		goto release;
 	}
 
 	for (size_t i = 0; i < argc; i++)
@@ -603,13 +937,16 @@ value py_object_interface_method_invoke(object obj, object_impl impl, method m,
 
 	if (python_object == NULL)
 	{
-		return NULL;
+		goto release;
 	}
 
-	value ret = py_loader_impl_capi_to_value(impl, python_object, py_loader_impl_capi_to_value_type(obj_impl->impl, python_object));
+	ret = py_loader_impl_capi_to_value(impl, python_object, py_loader_impl_capi_to_value_type(obj_impl->impl, python_object));
 
 	Py_XDECREF(python_object);
 
+release:
+	PyGILState_Release(gstate);
+
 	return ret;
 }
 
@@ -648,8 +985,7 @@ void py_object_interface_destroy(object obj, object_impl impl)
 	{
 		if (loader_is_destroyed(py_object->impl) != 0)
 		{
-			PyThreadState *tstate = PyEval_SaveThread();
-			PyGILState_STATE gstate = PyGILState_Ensure();
+			PyGILState_STATE gstate = py_loader_impl_gil_ensure();
 			Py_XDECREF(py_object->obj);
 
 			if (py_object->obj_class != NULL)
@@ -657,7 +993,6 @@ void py_object_interface_destroy(object obj, object_impl impl)
 				value_type_destroy(py_object->obj_class);
 			}
 			PyGILState_Release(gstate);
-			PyEval_RestoreThread(tstate);
 		}
 
 		free(py_object);
@@ -711,10 +1046,14 @@ object py_class_interface_constructor(klass cls, class_impl impl, const char *na
 	py_obj->impl = py_cls->impl;
 	py_obj->obj_class = NULL;
 
+	PyGILState_STATE gstate = py_loader_impl_gil_ensure();
 	PyObject *args_tuple = PyTuple_New(argc);
 
 	if (args_tuple == NULL)
+	{
+		PyGILState_Release(gstate);
 		return NULL;
+	}
 
 	for (size_t i = 0; i < argc; i++)
 	{
@@ -728,6 +1067,7 @@ object py_class_interface_constructor(klass cls, class_impl impl, const char *na
 
 	if (python_object == NULL)
 	{
+		PyGILState_Release(gstate);
 		object_destroy(obj);
 		return NULL;
 	}
@@ -735,6 +1075,8 @@ object py_class_interface_constructor(klass cls, class_impl impl, const char *na
 	Py_INCREF(py_cls->cls);
 	py_obj->obj = python_object;
 
+	PyGILState_Release(gstate);
+
 	return obj;
 }
 
@@ -751,6 +1093,7 @@ value py_class_interface_static_get(klass cls, class_impl impl, struct accessor_
 		return NULL;
 	}
 
+	PyGILState_STATE gstate = py_loader_impl_gil_ensure();
 	PyObject *key_py_str = PyUnicode_FromString(attr_name);
 	PyObject *generic_attr = PyObject_GenericGetAttr(pyobject_class, key_py_str);
 	Py_XDECREF(key_py_str);
@@ -758,6 +1101,8 @@ value py_class_interface_static_get(klass cls, class_impl impl, struct accessor_
 	value v = py_loader_impl_capi_to_value(impl, generic_attr, py_loader_impl_capi_to_value_type(py_class->impl, generic_attr));
 	Py_XDECREF(generic_attr);
 
+	PyGILState_Release(gstate);
+
 	return v;
 }
 
@@ -767,7 +1112,6 @@ int py_class_interface_static_set(klass cls, class_impl impl, struct accessor_ty
 
 	loader_impl_py_class py_class = (loader_impl_py_class)impl;
 	PyObject *pyobject_class = py_class->cls;
-	PyObject *pyvalue = py_loader_impl_value_to_capi(py_class->impl, value_type_id(v), v);
 	char *attr_name = attribute_name(accessor->data.attr);
 
 	if (attr_name == NULL)
@@ -775,11 +1119,15 @@ int py_class_interface_static_set(klass cls, class_impl impl, struct accessor_ty
 		return 1;
 	}
 
+	PyGILState_STATE gstate = py_loader_impl_gil_ensure();
+	PyObject *pyvalue = py_loader_impl_value_to_capi(py_class->impl, value_type_id(v), v);
 	PyObject *key_py_str = PyUnicode_FromString(attr_name);
 	int retval = PyObject_GenericSetAttr(pyobject_class, key_py_str, pyvalue);
 
 	Py_DECREF(key_py_str);
 
+	PyGILState_Release(gstate);
+
 	return retval;
 }
 
@@ -798,19 +1146,22 @@ value py_class_interface_static_invoke(klass cls, class_impl impl, method m, cla
 	}
 
 	char *static_method_name = method_name(m);
+	PyGILState_STATE gstate = py_loader_impl_gil_ensure();
+	value ret = NULL;
 
 	PyObject *method = PyObject_GetAttrString(cls_impl->cls, static_method_name);
 
 	if (method == NULL)
 	{
-		return NULL;
+		goto release;
 	}
 
 	PyObject *args_tuple = PyTuple_New(argc);
 
 	if (args_tuple == NULL)
 	{
-		return NULL;
+		Py_DECREF(method);
+		goto release;
 	}
 
 	for (size_t i = 0; i < argc; i++)
@@ -825,10 +1176,15 @@ value py_class_interface_static_invoke(klass cls, class_impl impl, method m, cla
 
 	if (python_object == NULL)
 	{
-		return NULL;
+		goto release;
 	}
 
-	return py_loader_impl_capi_to_value(impl, python_object, py_loader_impl_capi_to_value_type(cls_impl->impl, python_object));
+	ret = py_loader_impl_capi_to_value(impl, python_object, py_loader_impl_capi_to_value_type(cls_impl->impl, python_object));
+
+release:
+	PyGILState_Release(gstate);
+
+	return ret;
 }
 
 value py_class_interface_static_await(klass cls, class_impl impl, method m, class_args args, size_t size, class_resolve_callback resolve, class_reject_callback reject, void *ctx)
@@ -856,11 +1212,9 @@ void py_class_interface_destroy(klass cls, class_impl impl)
 	{
 		if (loader_is_destroyed(py_class->impl) != 0)
 		{
-			PyThreadState *tstate = PyEval_SaveThread();
-			PyGILState_STATE gstate = PyGILState_Ensure();
+			PyGILState_STATE gstate = py_loader_impl_gil_ensure();
 			Py_XDECREF(py_class->cls);
 			PyGILState_Release(gstate);
-			PyEval_RestoreThread(tstate);
 		}
 
 		free(py_class);
@@ -987,6 +1341,13 @@ type_id py_loader_impl_capi_to_value_type(loader_impl impl, PyObject *obj)
 	{
 		return TYPE_BUFFER;
 	}
+#if PY_MAJOR_VERSION == 3
+	else if (PyObject_CheckBuffer(obj))
+	{
+		/* Any other exporter of the buffer protocol (bytearray, memoryview, numpy arrays...) */
+		return TYPE_BUFFER;
+	}
+#endif
 	else if (PyList_Check(obj) || PyTuple_Check(obj))
 	{
 		return TYPE_ARRAY;
@@ -1097,18 +1458,44 @@ value py_loader_impl_capi_to_value(loader_impl impl, PyObject *obj, type_id id)
 	}
 	else if (id == TYPE_BUFFER)
 	{
-		char *str = NULL;
-
-		Py_ssize_t length = 0;
-
 #if PY_MAJOR_VERSION == 2
 
 		/* TODO */
 
 #elif PY_MAJOR_VERSION == 3
-		if (PyBytes_AsStringAndSize(obj, &str, &length) != -1)
+		if (PyBytes_Check(obj))
 		{
-			v = value_create_buffer((const void *)str, (size_t)length + 1);
+			char *str = NULL;
+
+			Py_ssize_t length = 0;
+
+			if (PyBytes_AsStringAndSize(obj, &str, &length) != -1)
+			{
+				v = value_create_buffer((const void *)str, (size_t)length + 1);
+			}
+		}
+		else if ((v = py_loader_impl_buffer_unwrap(obj)) == NULL && (v = py_loader_impl_buffer_borrow(impl, obj)) == NULL)
+		{
+			Py_buffer view;
+
+			/* Read-only or non-contiguous exporters of the buffer protocol are copied once, straight into the value in C order */
+			if (PyObject_GetBuffer(obj, &view, PyBUF_FULL_RO) != 0)
+			{
+				py_loader_impl_error_print(loader_impl_get(impl));
+				PyErr_Clear();
+				return NULL;
+			}
+
+			v = value_type_create(NULL, (size_t)view.len, TYPE_BUFFER);
+
+			if (v != NULL && PyBuffer_ToContiguous(value_to_buffer(v), &view, view.len, 'C') != 0)
+			{
+				value_type_destroy(v);
+				v = NULL;
+				PyErr_Clear();
+			}
+
+			PyBuffer_Release(&view);
 		}
 #endif
 	}
@@ -1465,18 +1852,22 @@ PyObject *py_loader_impl_value_to_capi(loader_impl impl, type_id id, value v)
 	}
 	else if (id == TYPE_BUFFER)
 	{
-		/* This forces that you wont never be able to pass a buffer as a pointer to metacall without be wrapped into a value type */
-		/* If a pointer is passed this will produce a garbage read from outside of the memory range of the parameter */
-		size_t size = value_type_size(v);
-
-		const char *buffer = value_to_buffer(v);
-
 #if PY_MAJOR_VERSION == 2
 
 		/* TODO */
 
 #elif PY_MAJOR_VERSION == 3
-		return PyBytes_FromStringAndSize(buffer, (Py_ssize_t)size);
+		loader_impl_py py_impl = loader_impl_get(impl);
+
+		/* Buffers can be exposed as read-only memory views of the value, without copying the data */
+		if (py_impl->buffer_memoryview == 1)
+		{
+			return py_loader_impl_buffer_wrap(v);
+		}
+
+		/* This forces that you wont never be able to pass a buffer as a pointer to metacall without be wrapped into a value type */
+		/* If a pointer is passed this will produce a garbage read from outside of the memory range of the parameter */
+		return PyBytes_FromStringAndSize(value_to_buffer(v), (Py_ssize_t)value_type_size(v));
 #endif
 	}
 	else if (id == TYPE_ARRAY)
@@ -1610,8 +2001,10 @@ PyObject *py_loader_impl_value_to_capi(loader_impl impl, type_id id, value v)
 	return NULL;
 }
 
-PyObject *py_task_callback_handler_impl_unsafe(PyThreadState *tstate, PyGILState_STATE gstate, PyObject *pyfuture)
+PyObject *py_task_callback_handler_impl_unsafe(PyObject *pyfuture)
 {
+	PyThreadState *tstate;
+
 	PyObject *capsule = PyObject_GetAttrString(pyfuture, "__metacall_capsule");
 	if (capsule == NULL)
 	{
@@ -1638,11 +2031,10 @@ PyObject *py_task_callback_handler_impl_unsafe(PyThreadState *tstate, PyGILState
 
 		Py_DECREF(result);
 
-		PyGILState_Release(gstate);
-		PyEval_RestoreThread(tstate);
-		ret = callback_state->resolve_callback(v, callback_state->context);
+		/* Run the callback without the GIL, it can be reacquired by the callback in this thread or any other */
 		tstate = PyEval_SaveThread();
-		gstate = PyGILState_Ensure();
+		ret = callback_state->resolve_callback(v, callback_state->context);
+		PyEval_RestoreThread(tstate);
 	}
 	else
 	{
@@ -1672,11 +2064,9 @@ PyObject *py_task_callback_handler_impl_unsafe(PyThreadState *tstate, PyGILState
 			v = value_create_null();
 		}
 
-		PyGILState_Release(gstate);
-		PyEval_RestoreThread(tstate);
-		ret = callback_state->reject_callback(v, callback_state->context);
 		tstate = PyEval_SaveThread();
-		gstate = PyGILState_Ensure();
+		ret = callback_state->reject_callback(v, callback_state->context);
+		PyEval_RestoreThread(tstate);
 	}
 
 	loader_impl impl = callback_state->impl;
@@ -1698,48 +2088,293 @@ PyObject *py_task_callback_handler_impl_unsafe(PyThreadState *tstate, PyGILState
 
 PyObject *py_task_callback_handler_impl(PyObject *self, PyObject *pyfuture)
 {
-	PyThreadState *tstate = PyEval_SaveThread();
-	PyGILState_STATE gstate = PyGILState_Ensure();
+	PyGILState_STATE gstate = py_loader_impl_gil_ensure();
 
 	/* self will always be NULL */
 	(void)self;
 
-	PyObject *result = py_task_callback_handler_impl_unsafe(tstate, gstate, pyfuture);
+	PyObject *result = py_task_callback_handler_impl_unsafe(pyfuture);
 
 	PyGILState_Release(gstate);
-	PyEval_RestoreThread(tstate);
 
 	return result;
 }
 
+static PyObject *py_loader_impl_value_to_capi_bool(loader_impl impl, type_id id, value v)
+{
+	(void)impl;
+	(void)id;
+
+	return PyBool_FromLong(value_to_bool(v) == 0 ? 0L : 1L);
+}
+
+#if PY_MAJOR_VERSION == 3
+static PyObject *py_loader_impl_value_to_capi_int(loader_impl impl, type_id id, value v)
+{
+	(void)impl;
+	(void)id;
+
+	return PyLong_FromLong((long)value_to_int(v));
+}
+#endif
+
+static PyObject *py_loader_impl_value_to_capi_long(loader_impl impl, type_id id, value v)
+{
+	(void)impl;
+	(void)id;
+
+	return PyLong_FromLong(value_to_long(v));
+}
+
+static PyObject *py_loader_impl_value_to_capi_double(loader_impl impl, type_id id, value v)
+{
+	(void)impl;
+	(void)id;
+
+	return PyFloat_FromDouble(value_to_double(v));
+}
+
+static value py_loader_impl_capi_to_value_long(loader_impl impl, PyObject *obj, type_id id)
+{
+	(void)impl;
+	(void)id;
+
+	return value_create_long(PyLong_AsLong(obj));
+}
+
+static value py_loader_impl_capi_to_value_double(loader_impl impl, PyObject *obj, type_id id)
+{
+	(void)impl;
+	(void)id;
+
+	return value_create_double(PyFloat_AsDouble(obj));
+}
+
+static py_loader_impl_value_to_capi_func py_loader_impl_plan_to_capi(type_id id)
+{
+	switch (id)
+	{
+		case TYPE_BOOL:
+			return &py_loader_impl_value_to_capi_bool;
+#if PY_MAJOR_VERSION == 3
+		case TYPE_INT:
+			return &py_loader_impl_value_to_capi_int;
+#endif
+		case TYPE_LONG:
+			return &py_loader_impl_value_to_capi_long;
+		case TYPE_DOUBLE:
+			return &py_loader_impl_value_to_capi_double;
+		default:
+			return &py_loader_impl_value_to_capi;
+	}
+}
+
+static py_loader_impl_capi_to_value_func py_loader_impl_plan_to_value(type_id id)
+{
+	switch (id)
+	{
+		case TYPE_LONG:
+			return &py_loader_impl_capi_to_value_long;
+		case TYPE_DOUBLE:
+			return &py_loader_impl_capi_to_value_double;
+		default:
+			return &py_loader_impl_capi_to_value;
+	}
+}
+
+static loader_impl_py_function_plan py_loader_impl_function_plan(signature s)
+{
+	const size_t args_size = signature_count(s);
+	type ret_type = signature_get_return(s);
+	loader_impl_py_function_plan plan = malloc(sizeof(struct loader_impl_py_function_plan_type));
+
+	if (plan == NULL)
+	{
+		return NULL;
+	}
+
+	plan->args_size = args_size;
+
+	if (args_size > 0)
+	{
+		plan->args = malloc(sizeof(struct loader_impl_py_function_plan_arg_type) * args_size);
+
+		if (plan->args == NULL)
+		{
+			free(plan);
+			return NULL;
+		}
+
+		for (size_t iterator = 0; iterator < args_size; ++iterator)
+		{
+			type t = signature_get_type(s, iterator);
+
+			if (t == NULL)
+			{
+				plan->args[iterator].id = TYPE_INVALID;
+				plan->args[iterator].to_capi = NULL;
+			}
+			else
+			{
+				plan->args[iterator].id = type_index(t);
+				plan->args[iterator].to_capi = py_loader_impl_plan_to_capi(plan->args[iterator].id);
+			}
+		}
+	}
+	else
+	{
+		plan->args = NULL;
+	}
+
+	if (ret_type == NULL)
+	{
+		plan->ret_id = TYPE_INVALID;
+		plan->to_value = NULL;
+	}
+	else
+	{
+		plan->ret_id = type_index(ret_type);
+		plan->to_value = py_loader_impl_plan_to_value(plan->ret_id);
+	}
+
+	return plan;
+}
+
+static void py_loader_impl_function_plan_destroy(loader_impl_py_function_plan plan)
+{
+	if (plan != NULL)
+	{
+		if (plan->args != NULL)
+		{
+			free(plan->args);
+		}
+
+		free(plan);
+	}
+}
+
+static PyObject *py_loader_impl_function_plan_arg(loader_impl impl, loader_impl_py_function_plan plan, size_t index, value v)
+{
+	if (index < plan->args_size && plan->args[index].to_capi != NULL)
+	{
+		return plan->args[index].to_capi(impl, plan->args[index].id, v);
+	}
+
+	return py_loader_impl_value_to_capi(impl, value_type_id(v), v);
+}
+
+static value py_loader_impl_function_plan_ret(loader_impl impl, loader_impl_py_function_plan plan, PyObject *result)
+{
+	if (plan->to_value != NULL)
+	{
+		return plan->to_value(impl, result, plan->ret_id);
+	}
+
+	return py_loader_impl_capi_to_value(impl, result, py_loader_impl_capi_to_value_type(impl, result));
+}
+
 function_return function_py_interface_invoke(function func, function_impl impl, function_args args, size_t args_size)
 {
 	loader_impl_py_function py_func = (loader_impl_py_function)impl;
 	signature s = function_signature(func);
-	const size_t signature_args_size = signature_count(s);
-	type ret_type = signature_get_return(s);
 	loader_impl_py py_impl = loader_impl_get(py_func->impl);
-	PyThreadState *tstate = PyEval_SaveThread();
-	PyGILState_STATE gstate = PyGILState_Ensure();
+	PyGILState_STATE gstate = py_loader_impl_gil_ensure();
 	value v = NULL;
 
+	/* The signature does not change after discovering, so the plan is built once and cached, */
+	/* free-threaded builds do not serialize the calls with the GIL so it is built in a critical section */
+#if defined(Py_GIL_DISABLED)
+	Py_BEGIN_CRITICAL_SECTION(py_func->func);
+#endif
+	if (py_func->plan == NULL)
+	{
+		py_func->plan = py_loader_impl_function_plan(s);
+	}
+#if defined(Py_GIL_DISABLED)
+	Py_END_CRITICAL_SECTION();
+#endif
+
+	if (py_func->plan == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid conversion plan allocation in Python function call");
+		goto finalize;
+	}
+
 	/* Possibly a recursive call */
 	if (Py_EnterRecursiveCall(" while executing a function in Python Loader") != 0)
 	{
 		goto finalize;
 	}
 
+#if PY_LOADER_IMPL_VECTORCALL
+	/* The first slot is reserved so the callee can prepend the bound instance without copying the arguments */
+	PyObject *stack[PY_LOADER_IMPL_VECTORCALL_STACK_SIZE + 1];
+	PyObject **vector = args_size > PY_LOADER_IMPL_VECTORCALL_STACK_SIZE ? malloc(sizeof(PyObject *) * (args_size + 1)) : stack;
+	size_t args_count;
+
+	if (vector == NULL)
+	{
+		Py_LeaveRecursiveCall();
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid argument allocation in Python function call");
+		goto finalize;
+	}
+
+	for (args_count = 0; args_count < args_size; ++args_count)
+	{
+		vector[args_count + 1] = py_loader_impl_function_plan_arg(py_func->impl, py_func->plan, args_count, args[args_count]);
+
+		if (vector[args_count + 1] == NULL)
+		{
+			break;
+		}
+	}
+
+	PyObject *result = NULL;
+
+	if (args_count == args_size)
+	{
+		result = PyObject_Vectorcall(py_func->func, &vector[1], args_size | PY_VECTORCALL_ARGUMENTS_OFFSET, NULL);
+	}
+	else if (PyErr_Occurred() == NULL)
+	{
+		PyErr_Format(PyExc_TypeError, "Invalid conversion of the argument %" PRIuS " in Python function call", args_count);
+	}
+
+	/* End of recursive call */
+	Py_LeaveRecursiveCall();
+
+	if (PyErr_Occurred() != NULL)
+	{
+		v = py_loader_impl_error_value(py_impl);
+
+		if (v == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Fatal error when trying to fetch an exeption");
+		}
+	}
+
+	/* Vectorcall borrows the arguments, so they must be released after the call */
+	for (size_t iterator = 0; iterator < args_count; ++iterator)
+	{
+		Py_DECREF(vector[iterator + 1]);
+	}
+
+	if (vector != stack)
+	{
+		free(vector);
+	}
+#else
+	const size_t signature_args_size = signature_count(s);
 	PyObject *tuple_args = PyTuple_New(args_size);
 
+
 	/* Allocate dynamically more space for values in case of variable arguments */
 	bool is_var_args = args_size > signature_args_size || py_func->values == NULL;
 	PyObject **values = is_var_args ? malloc(sizeof(PyObject *) * args_size) : py_func->values;
 
 	for (size_t args_count = 0; args_count < args_size; ++args_count)
 	{
-		type t = args_count < signature_args_size ? signature_get_type(s, args_count) : NULL;
-		type_id id = t == NULL ? value_type_id((value)args[args_count]) : type_index(t);
-		values[args_count] = py_loader_impl_value_to_capi(py_func->impl, id, args[args_count]);
+		values[args_count] = py_loader_impl_function_plan_arg(py_func->impl, py_func->plan, args_count, args[args_count]);
 
 		if (values[args_count] != NULL)
 		{
@@ -1768,19 +2403,18 @@ function_return function_py_interface_invoke(function func, function_impl impl,
 	{
 		free(values);
 	}
+#endif
 
 	if (result == NULL || v != NULL)
 	{
 		goto finalize;
 	}
 
-	type_id id = ret_type == NULL ? py_loader_impl_capi_to_value_type(py_func->impl, result) : type_index(ret_type);
-	v = py_loader_impl_capi_to_value(py_func->impl, result, id);
+	v = py_loader_impl_function_plan_ret(py_func->impl, py_func->plan, result);
 
 	Py_DECREF(result);
 finalize:
 	PyGILState_Release(gstate);
-	PyEval_RestoreThread(tstate);
 	return v;
 }
 
@@ -1794,13 +2428,9 @@ function_return function_py_interface_await(function func, function_impl impl, f
 	PyObject *pyfuture = NULL;
 	size_t args_count;
 	loader_impl_py py_impl = loader_impl_get(py_func->impl);
-	PyThreadState *tstate = PyEval_SaveThread();
-	PyGILState_STATE gstate = PyGILState_Ensure();
+	PyGILState_STATE gstate = py_loader_impl_gil_ensure();
 	PyObject *tuple_args;
 
-	/* Allocate dynamically more space for values in case of variable arguments */
-	void **values = args_size > signature_args_size ? malloc(sizeof(void *) * args_size) : py_func->values;
-
 	tuple_args = PyTuple_New(args_size);
 
 	for (args_count = 0; args_count < args_size; ++args_count)
@@ -1818,11 +2448,12 @@ function_return function_py_interface_await(function func, function_impl impl, f
 			id = type_index(t);
 		}
 
-		values[args_count] = py_loader_impl_value_to_capi(py_func->impl, id, args[args_count]);
+		/* The tuple is built directly, the values array of the function may be in use by other threads */
+		PyObject *arg = py_loader_impl_value_to_capi(py_func->impl, id, args[args_count]);
 
-		if (values[args_count] != NULL)
+		if (arg != NULL)
 		{
-			PyTuple_SetItem(tuple_args, args_count, values[args_count]);
+			PyTuple_SetItem(tuple_args, args_count, arg);
 		}
 	}
 
@@ -1885,12 +2516,6 @@ function_return function_py_interface_await(function func, function_impl impl, f
 	pyfuture = PyObject_Call(py_impl->thread_background_send, args_tuple, NULL);
 	Py_DECREF(args_tuple);
 
-	/* Variable arguments */
-	if (args_size > signature_args_size)
-	{
-		free(values);
-	}
-
 	if (pyfuture != NULL)
 	{
 		value v = NULL;
@@ -1912,7 +2537,6 @@ function_return function_py_interface_await(function func, function_impl impl, f
 		Py_DECREF(tuple_args);
 
 		PyGILState_Release(gstate);
-		PyEval_RestoreThread(tstate);
 
 		return v;
 	}
@@ -1927,7 +2551,6 @@ error:
 	Py_DECREF(tuple_args);
 
 	PyGILState_Release(gstate);
-	PyEval_RestoreThread(tstate);
 
 	return NULL;
 }
@@ -1944,13 +2567,13 @@ void function_py_interface_destroy(function func, function_impl impl)
 			free(py_func->values);
 		}
 
+		py_loader_impl_function_plan_destroy(py_func->plan);
+
 		if (loader_is_destroyed(py_func->impl) != 0)
 		{
-			PyThreadState *tstate = PyEval_SaveThread();
-			PyGILState_STATE gstate = PyGILState_Ensure();
+			PyGILState_STATE gstate = py_loader_impl_gil_ensure();
 			Py_DECREF(py_func->func);
 			PyGILState_Release(gstate);
-			PyEval_RestoreThread(tstate);
 		}
 
 		free(py_func);
@@ -1963,7 +2586,8 @@ function_interface function_py_singleton(void)
 		&function_py_interface_create,
 		&function_py_interface_invoke,
 		&function_py_interface_await,
-		&function_py_interface_destroy
+		&function_py_interface_destroy,
+		NULL
 	};
 
 	return &py_function_interface;
@@ -2664,7 +3288,6 @@ static void PyCFunction_dealloc(PyObject *obj)
 loader_impl_data py_loader_impl_initialize(loader_impl impl, configuration config)
 {
 	(void)impl;
-	(void)config;
 
 	loader_impl_py py_impl = malloc(sizeof(struct loader_impl_py_type));
 	int traceback_initialized = 1;
@@ -2677,6 +3300,19 @@ loader_impl_data py_loader_impl_initialize(loader_impl impl, configuration confi
 		goto error_alloc_py_impl;
 	}
 
+	/* Buffers are copied into bytes unless the memory views are enabled in the configuration */
+	value buffer_memoryview = configuration_value(config, "buffer_memoryview");
+
+	py_impl->buffer_memoryview = (buffer_memoryview != NULL && value_type_id(buffer_memoryview) == TYPE_BOOL && value_to_bool(buffer_memoryview) != 0);
+
+	if (py_loader_impl_thread_state_initialize() != 0)
+	{
+		log_write("metacall", LOG_LEVEL_WARNING, "Python loader could not create the thread state key, native threads will create a thread state on each call");
+	}
+
+	/* MetaCall can be embedded into an already running Python (i.e: through the port) */
+	int host_initialized = Py_IsInitialized();
+
 	Py_InitializeEx(0);
 
 	if (Py_IsInitialized() == 0)
@@ -2691,7 +3327,6 @@ loader_impl_data py_loader_impl_initialize(loader_impl impl, configuration confi
 	}
 #endif
 
-	PyThreadState *tstate = PyEval_SaveThread();
 	PyGILState_STATE gstate = PyGILState_Ensure();
 
 	/* Hook the deallocation of PyCFunction */
@@ -2774,8 +3409,15 @@ loader_impl_data py_loader_impl_initialize(loader_impl impl, configuration confi
 		goto error_after_asyncio_module;
 	}
 
+	if (PyType_Ready(&py_loader_impl_buffer_type) < 0)
+	{
+		goto error_after_asyncio_module;
+	}
+
 	PyGILState_Release(gstate);
-	PyEval_RestoreThread(tstate);
+
+	/* Release the GIL held since Py_InitializeEx, so any thread can enter into Python with PyGILState_Ensure */
+	py_impl->main_tstate = host_initialized == 0 ? PyEval_SaveThread() : NULL;
 
 	/* Register initialization */
 	loader_initialization_register(impl);
@@ -2820,9 +3462,9 @@ error_after_traceback_and_gc:
 error_after_argv:
 error_after_sys_executable:
 	PyGILState_Release(gstate);
-	PyEval_RestoreThread(tstate);
 	(void)py_loader_impl_finalize(py_impl);
 error_init_py:
+	py_loader_impl_thread_state_destroy();
 	free(py_impl);
 error_alloc_py_impl:
 	return NULL;
@@ -2838,8 +3480,7 @@ int py_loader_impl_execution_path(loader_impl impl, const loader_path path)
 	}
 
 	int result = 0;
-	PyThreadState *tstate = PyEval_SaveThread();
-	PyGILState_STATE gstate = PyGILState_Ensure();
+	PyGILState_STATE gstate = py_loader_impl_gil_ensure();
 	PyObject *system_paths = PySys_GetObject("path");
 	PyObject *current_path = PyUnicode_DecodeFSDefault(path);
 
@@ -2868,7 +3509,6 @@ int py_loader_impl_execution_path(loader_impl impl, const loader_path path)
 clear_current_path:
 	Py_DECREF(current_path);
 	PyGILState_Release(gstate);
-	PyEval_RestoreThread(tstate);
 	return result;
 }
 
@@ -2937,8 +3577,7 @@ void py_loader_impl_module_destroy(loader_impl_py_handle_module module)
 
 void py_loader_impl_handle_destroy(loader_impl_py_handle py_handle)
 {
-	PyThreadState *tstate = PyEval_SaveThread();
-	PyGILState_STATE gstate = PyGILState_Ensure();
+	PyGILState_STATE gstate = py_loader_impl_gil_ensure();
 
 	for (size_t iterator = 0; iterator < py_handle->size; ++iterator)
 	{
@@ -2946,7 +3585,6 @@ void py_loader_impl_handle_destroy(loader_impl_py_handle py_handle)
 	}
 
 	PyGILState_Release(gstate);
-	PyEval_RestoreThread(tstate);
 	free(py_handle->modules);
 	free(py_handle);
 }
@@ -3158,8 +3796,7 @@ loader_handle py_loader_impl_load_from_file(loader_impl impl, const loader_path
 		goto error_create_handle;
 	}
 
-	PyThreadState *tstate = PyEval_SaveThread();
-	PyGILState_STATE gstate = PyGILState_Ensure();
+	PyGILState_STATE gstate = py_loader_impl_gil_ensure();
 
 	/* Possibly a recursive call */
 	if (Py_EnterRecursiveCall(" while loading a module from file in Python Loader") != 0)
@@ -3242,7 +3879,6 @@ loader_handle py_loader_impl_load_from_file(loader_impl impl, const loader_path
 	Py_LeaveRecursiveCall();
 
 	PyGILState_Release(gstate);
-	PyEval_RestoreThread(tstate);
 
 	return (loader_handle)py_handle;
 
@@ -3254,7 +3890,6 @@ error_import_module:
 	}
 error_recursive_call:
 	PyGILState_Release(gstate);
-	PyEval_RestoreThread(tstate);
 	py_loader_impl_handle_destroy(py_handle);
 error_create_handle:
 	return NULL;
@@ -3288,8 +3923,7 @@ loader_handle py_loader_impl_load_from_memory(loader_impl impl, const loader_nam
 		goto error_create_handle;
 	}
 
-	PyThreadState *tstate = PyEval_SaveThread();
-	PyGILState_STATE gstate = PyGILState_Ensure();
+	PyGILState_STATE gstate = py_loader_impl_gil_ensure();
 
 	/* Possibly a recursive call */
 	if (Py_EnterRecursiveCall(" while loading a module from memory in Python Loader") != 0)
@@ -3313,7 +3947,6 @@ loader_handle py_loader_impl_load_from_memory(loader_impl impl, const loader_nam
 	Py_LeaveRecursiveCall();
 
 	PyGILState_Release(gstate);
-	PyEval_RestoreThread(tstate);
 
 	log_write("metacall", LOG_LEVEL_DEBUG, "Python loader (%p) importing %s from memory module at (%p)", (void *)impl, name, (void *)py_handle->modules[0].instance);
 
@@ -3325,7 +3958,6 @@ error_import_module:
 		PyErr_Clear();
 	}
 	PyGILState_Release(gstate);
-	PyEval_RestoreThread(tstate);
 	py_loader_impl_handle_destroy(py_handle);
 error_create_handle:
 	return NULL;
@@ -3934,8 +4566,7 @@ static int py_loader_impl_validate_object(loader_impl impl, PyObject *obj, objec
 int py_loader_impl_discover_module(loader_impl impl, PyObject *module, context ctx)
 {
 	int ret = 1;
-	PyThreadState *tstate = PyEval_SaveThread();
-	PyGILState_STATE gstate = PyGILState_Ensure();
+	PyGILState_STATE gstate = py_loader_impl_gil_ensure();
 
 	if (module == NULL || !PyModule_Check(module))
 	{
@@ -4024,7 +4655,6 @@ int py_loader_impl_discover_module(loader_impl impl, PyObject *module, context c
 
 cleanup:
 	PyGILState_Release(gstate);
-	PyEval_RestoreThread(tstate);
 	return ret;
 }
 
@@ -4247,8 +4877,8 @@ int py_loader_impl_destroy(loader_impl impl)
 	/* Destroy children loaders */
 	loader_unload_children(impl);
 
-	PyThreadState *tstate = PyEval_SaveThread();
-	PyGILState_STATE gstate = PyGILState_Ensure();
+	/* The GIL is held until Python is finalized */
+	(void)PyGILState_Ensure();
 
 	/* Stop event loop for async calls */
 	PyObject *args_tuple = PyTuple_New(1);
@@ -4294,11 +4924,19 @@ int py_loader_impl_destroy(loader_impl impl)
 	}
 #endif
 
-	PyGILState_Release(gstate);
-	PyEval_RestoreThread(tstate);
+	/* Python must be finalized while holding the GIL, the thread that initialized Python gets back its own thread state */
+	/* in the ensure above, and the rest of threads get a new one, in that case the thread state of the initialization */
+	/* is deleted, otherwise the threading module would wait forever for the main thread during the finalization */
+	if (py_impl->main_tstate != NULL && PyThreadState_Get() != py_impl->main_tstate)
+	{
+		PyThreadState_Clear(py_impl->main_tstate);
+		PyThreadState_Delete(py_impl->main_tstate);
+	}
 
 	int result = py_loader_impl_finalize(py_impl);
 
+	py_loader_impl_thread_state_destroy();
+
 	/* Unhook the deallocation of PyCFunction */
 	PyCFunction_Type.tp_dealloc = py_loader_impl_pycfunction_dealloc;
 
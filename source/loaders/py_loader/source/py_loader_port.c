@@ -783,6 +783,14 @@ PyMODINIT_FUNC PY_LOADER_PORT_NAME_FUNC()
 	if (module == NULL)
 	{
 		module = PyModule_Create(&metacall_definition);
+
+#if defined(Py_GIL_DISABLED)
+		/* The port does not rely on the GIL, otherwise importing it would enable the GIL again in free-threaded builds */
+		if (module != NULL)
+		{
+			PyUnstable_Module_SetGIL(module, Py_MOD_GIL_NOT_USED);
+		}
+#endif
 	}
 
 	return module;
@@ -571,7 +571,8 @@ function_interface function_rb_singleton(void)
 		&function_rb_interface_create,
 		&function_rb_interface_invoke,
 		&function_rb_interface_await,
-		&function_rb_interface_destroy
+		&function_rb_interface_destroy,
+		NULL
 	};
 
 	return &rb_interface;
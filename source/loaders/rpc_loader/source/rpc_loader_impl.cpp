@@ -27,6 +27,7 @@
 
 #include <reflect/reflect_context.h>
 #include <reflect/reflect_function.h>
+#include <reflect/reflect_future.h>
 #include <reflect/reflect_scope.h>
 #include <reflect/reflect_type.h>
 
@@ -43,16 +44,52 @@
 
 #include <algorithm>
 #include <fstream>
+#include <future>
 #include <map>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
+/* Maximum amount of simultaneous connections to the same host, the rest of the transfers are queued */
+#define RPC_LOADER_IMPL_MAX_HOST_CONNECTIONS 8L
+
+/* Timeout in milliseconds for the multi handle to wait for socket activity */
+#define RPC_LOADER_IMPL_POLL_TIMEOUT 1000
+
+typedef struct loader_impl_rpc_write_data_type
+{
+	std::string buffer;
+
+} * loader_impl_rpc_write_data;
+
+struct loader_impl_rpc_request_type;
+
+typedef void (*loader_impl_rpc_request_complete)(struct loader_impl_rpc_request_type *, CURLcode);
+
+typedef struct loader_impl_rpc_request_type
+{
+	CURL *curl;
+	loader_impl_rpc_write_data_type write_data;
+	loader_impl_rpc_request_complete complete;
+	void *data;
+
+} * loader_impl_rpc_request;
+
 typedef struct loader_impl_rpc_type
 {
-	CURL *discover_curl;
-	CURL *invoke_curl;
+	CURLM *multi;
+	std::thread multi_thread;
+	std::mutex multi_mutex;
+	std::vector<loader_impl_rpc_request> pending;
+	bool stop;
+	std::mutex pool_mutex;
+	std::vector<CURL *> pool;
+	struct curl_slist *headers;
+	std::string serial;
+	bool http2;
 	void *allocator;
 	std::map<type_id, type> types;
 	std::set<std::string> execution_paths;
@@ -69,19 +106,73 @@ typedef struct loader_impl_rpc_function_type
 {
 	loader_impl_rpc rpc_impl;
 	std::string url;
+	std::string base_url;
+	std::string name;
 
 } * loader_impl_rpc_function;
 
-typedef struct loader_impl_rpc_write_data_type
+typedef enum loader_impl_rpc_future_state_id
 {
-	std::string buffer;
+	LOADER_IMPL_RPC_FUTURE_PENDING,
+	LOADER_IMPL_RPC_FUTURE_RESOLVED,
+	LOADER_IMPL_RPC_FUTURE_REJECTED
 
-} * loader_impl_rpc_write_data;
+} loader_impl_rpc_future_state;
+
+struct loader_impl_rpc_future_type;
+
+typedef struct loader_impl_rpc_future_callback_type
+{
+	future_resolve_callback resolve_callback;
+	future_reject_callback reject_callback;
+	void *context;
+	struct loader_impl_rpc_future_type *chained;
+
+} * loader_impl_rpc_future_callback;
+
+typedef struct loader_impl_rpc_future_type
+{
+	std::mutex mutex;
+	loader_impl_rpc_future_state state;
+	value result;
+	std::vector<loader_impl_rpc_future_callback_type> callbacks;
+	size_t references;
+
+} * loader_impl_rpc_future;
+
+typedef struct loader_impl_rpc_await_type
+{
+	loader_impl_rpc rpc_impl;
+	loader_impl_rpc_future future;
+	loader_impl_rpc_request_type request;
+	std::string url;
+	char *buffer;
+	function_resolve_callback resolve_callback;
+	function_reject_callback reject_callback;
+	void *context;
+
+} * loader_impl_rpc_await;
 
 static size_t rpc_loader_impl_write_data(void *buffer, size_t size, size_t nmemb, void *userp);
+static CURL *rpc_loader_impl_pool_acquire(loader_impl_rpc rpc_impl);
+static void rpc_loader_impl_pool_release(loader_impl_rpc rpc_impl, CURL *curl);
+static void rpc_loader_impl_multi_loop(loader_impl_rpc rpc_impl);
+static int rpc_loader_impl_request_submit(loader_impl_rpc rpc_impl, loader_impl_rpc_request request, const std::string &url, const char *body, size_t size);
+static void rpc_loader_impl_request_complete(loader_impl_rpc_request request, CURLcode result);
+static CURLcode rpc_loader_impl_request(loader_impl_rpc rpc_impl, const std::string &url, const char *body, size_t size, loader_impl_rpc_write_data_type &write_data);
+static void rpc_loader_impl_await_complete(loader_impl_rpc_request request, CURLcode result);
+static loader_impl_rpc_future rpc_loader_impl_future_create(size_t references);
+static void rpc_loader_impl_future_release(loader_impl_rpc_future rpc_future);
+static void rpc_loader_impl_future_settle(loader_impl_rpc_future rpc_future, loader_impl_rpc_future_state state, value v);
+static void rpc_loader_impl_future_invoke(loader_impl_rpc_future_callback callback, loader_impl_rpc_future_state state, value v);
+static char *rpc_loader_impl_serialize_args(loader_impl_rpc rpc_impl, function_args args, size_t size, size_t *body_request_size);
+static char *rpc_loader_impl_serialize_batch(loader_impl_rpc rpc_impl, function_impl impls[], void **args[], size_t sizes[], const std::vector<size_t> &calls, size_t *body_request_size);
+static std::map<std::string, void *> rpc_loader_impl_value_to_map(void *v);
 static int rpc_loader_impl_discover_value(loader_impl_rpc rpc_impl, std::string &url, value v, context ctx);
 static int rpc_loader_impl_initialize_types(loader_impl impl, loader_impl_rpc rpc_impl);
 
+future_interface future_rpc_singleton(void);
+
 size_t rpc_loader_impl_write_data(void *buffer, size_t size, size_t nmemb, void *userp)
 {
 	loader_impl_rpc_write_data write_data = static_cast<loader_impl_rpc_write_data>(userp);
@@ -97,6 +188,442 @@ size_t rpc_loader_impl_write_data(void *buffer, size_t size, size_t nmemb, void
 	return data_len;
 }
 
+CURL *rpc_loader_impl_pool_acquire(loader_impl_rpc rpc_impl)
+{
+	{
+		std::lock_guard<std::mutex> lock(rpc_impl->pool_mutex);
+
+		if (!rpc_impl->pool.empty())
+		{
+			CURL *curl = rpc_impl->pool.back();
+
+			rpc_impl->pool.pop_back();
+
+			return curl;
+		}
+	}
+
+	/* Grow the pool on demand, the handles are kept alive until the loader is destroyed */
+	CURL *curl = curl_easy_init();
+
+	if (curl == NULL)
+	{
+		return NULL;
+	}
+
+	curl_easy_setopt(curl, CURLOPT_VERBOSE, 0L);
+	curl_easy_setopt(curl, CURLOPT_HEADER, 0L);
+	curl_easy_setopt(curl, CURLOPT_HTTPHEADER, rpc_impl->headers);
+	curl_easy_setopt(curl, CURLOPT_USERAGENT, "librpc_loader/0.1");
+	curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, rpc_loader_impl_write_data);
+	curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
+	curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+
+	/* HTTP/2 is negotiated over TLS, plain HTTP endpoints keep using persistent HTTP/1.1 connections */
+	curl_easy_setopt(curl, CURLOPT_HTTP_VERSION, rpc_impl->http2 == true ? CURL_HTTP_VERSION_2TLS : CURL_HTTP_VERSION_1_1);
+
+	if (rpc_impl->http2 == true)
+	{
+		/* Wait for an existing connection to confirm multiplexing instead of opening a new one */
+		curl_easy_setopt(curl, CURLOPT_PIPEWAIT, 1L);
+	}
+
+	return curl;
+}
+
+void rpc_loader_impl_pool_release(loader_impl_rpc rpc_impl, CURL *curl)
+{
+	std::lock_guard<std::mutex> lock(rpc_impl->pool_mutex);
+
+	rpc_impl->pool.push_back(curl);
+}
+
+void rpc_loader_impl_multi_loop(loader_impl_rpc rpc_impl)
+{
+	std::set<loader_impl_rpc_request> running_requests;
+	std::vector<loader_impl_rpc_request> pending;
+	bool stop = false;
+
+	for (;;)
+	{
+		int running = 0, queued = 0;
+		CURLMsg *msg;
+
+		{
+			std::lock_guard<std::mutex> lock(rpc_impl->multi_mutex);
+
+			stop = rpc_impl->stop;
+
+			pending.swap(rpc_impl->pending);
+		}
+
+		/* The multi handle is not thread safe, so only this thread attaches the transfers */
+		for (auto request : pending)
+		{
+			CURLMcode code = curl_multi_add_handle(rpc_impl->multi, request->curl);
+
+			if (code != CURLM_OK)
+			{
+				log_write("metacall", LOG_LEVEL_ERROR, "Could not add the request to the CURL multi handle [%s]", curl_multi_strerror(code));
+				request->complete(request, CURLE_FAILED_INIT);
+				continue;
+			}
+
+			running_requests.insert(request);
+		}
+
+		pending.clear();
+
+		if (stop == true)
+		{
+			break;
+		}
+
+		curl_multi_perform(rpc_impl->multi, &running);
+
+		while ((msg = curl_multi_info_read(rpc_impl->multi, &queued)) != NULL)
+		{
+			if (msg->msg == CURLMSG_DONE)
+			{
+				CURL *curl = msg->easy_handle;
+				CURLcode result = msg->data.result;
+				char *private_data = NULL;
+
+				curl_easy_getinfo(curl, CURLINFO_PRIVATE, &private_data);
+
+				/* The message is invalidated after removing the handle, the connection stays in the multi cache */
+				curl_multi_remove_handle(rpc_impl->multi, curl);
+
+				loader_impl_rpc_request request = reinterpret_cast<loader_impl_rpc_request>(private_data);
+
+				running_requests.erase(request);
+
+				request->complete(request, result);
+			}
+		}
+
+		curl_multi_poll(rpc_impl->multi, NULL, 0, RPC_LOADER_IMPL_POLL_TIMEOUT, NULL);
+	}
+
+	/* Abort the transfers that are still running when the loader is destroyed */
+	for (auto request : running_requests)
+	{
+		curl_multi_remove_handle(rpc_impl->multi, request->curl);
+
+		request->complete(request, CURLE_ABORTED_BY_CALLBACK);
+	}
+}
+
+int rpc_loader_impl_request_submit(loader_impl_rpc rpc_impl, loader_impl_rpc_request request, const std::string &url, const char *body, size_t size)
+{
+	request->curl = rpc_loader_impl_pool_acquire(rpc_impl);
+
+	if (request->curl == NULL)
+	{
+		return 1;
+	}
+
+	curl_easy_setopt(request->curl, CURLOPT_URL, url.c_str());
+
+	if (body != NULL)
+	{
+		curl_easy_setopt(request->curl, CURLOPT_POSTFIELDS, body);
+		curl_easy_setopt(request->curl, CURLOPT_POSTFIELDSIZE, static_cast<long>(size));
+	}
+	else
+	{
+		curl_easy_setopt(request->curl, CURLOPT_HTTPGET, 1L);
+	}
+
+	curl_easy_setopt(request->curl, CURLOPT_WRITEDATA, static_cast<loader_impl_rpc_write_data>(&request->write_data));
+	curl_easy_setopt(request->curl, CURLOPT_PRIVATE, static_cast<void *>(request));
+
+	{
+		std::lock_guard<std::mutex> lock(rpc_impl->multi_mutex);
+
+		/* Once the loader is being destroyed the multi thread does not drain the queue anymore, so the request would never complete */
+		if (rpc_impl->stop == true)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Could not submit the request to the API endpoint %s, the RPC loader is being destroyed", url.c_str());
+			rpc_loader_impl_pool_release(rpc_impl, request->curl);
+			return 1;
+		}
+
+		rpc_impl->pending.push_back(request);
+	}
+
+	curl_multi_wakeup(rpc_impl->multi);
+
+	return 0;
+}
+
+void rpc_loader_impl_request_complete(loader_impl_rpc_request request, CURLcode result)
+{
+	static_cast<std::promise<CURLcode> *>(request->data)->set_value(result);
+}
+
+CURLcode rpc_loader_impl_request(loader_impl_rpc rpc_impl, const std::string &url, const char *body, size_t size, loader_impl_rpc_write_data_type &write_data)
+{
+	loader_impl_rpc_request_type request;
+	std::promise<CURLcode> promise;
+	std::future<CURLcode> result = promise.get_future();
+
+	/* Await callbacks run in the multi thread, blocking it would never complete the request */
+	if (std::this_thread::get_id() == rpc_impl->multi_thread.get_id())
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Synchronous call to the API endpoint %s from an await callback is not allowed", url.c_str());
+		return CURLE_FAILED_INIT;
+	}
+
+	request.complete = &rpc_loader_impl_request_complete;
+	request.data = static_cast<void *>(&promise);
+
+	if (rpc_loader_impl_request_submit(rpc_impl, &request, url, body, size) != 0)
+	{
+		return CURLE_FAILED_INIT;
+	}
+
+	CURLcode res = result.get();
+
+	rpc_loader_impl_pool_release(rpc_impl, request.curl);
+
+	write_data.buffer.swap(request.write_data.buffer);
+
+	return res;
+}
+
+void rpc_loader_impl_await_complete(loader_impl_rpc_request request, CURLcode result)
+{
+	loader_impl_rpc_await rpc_await = static_cast<loader_impl_rpc_await>(request->data);
+	loader_impl_rpc rpc_impl = rpc_await->rpc_impl;
+	value v = NULL, ret = NULL;
+
+	rpc_loader_impl_pool_release(rpc_impl, request->curl);
+
+	metacall_allocator_free(rpc_impl->allocator, rpc_await->buffer);
+
+	if (result == CURLE_OK)
+	{
+		/* Deserialize the call result data */
+		const size_t write_data_size = request->write_data.buffer.length() + 1;
+
+		v = metacall_deserialize(rpc_impl->serial.c_str(), request->write_data.buffer.c_str(), write_data_size, rpc_impl->allocator);
+
+		if (v == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Could not deserialize the await result from API endpoint %s", rpc_await->url.c_str());
+		}
+	}
+	else
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Could not await to the API endpoint %s [%s]", rpc_await->url.c_str(), curl_easy_strerror(result));
+	}
+
+	loader_impl_rpc_future_state state = v != NULL ? LOADER_IMPL_RPC_FUTURE_RESOLVED : LOADER_IMPL_RPC_FUTURE_REJECTED;
+
+	if (v != NULL)
+	{
+		if (rpc_await->resolve_callback != NULL)
+		{
+			ret = rpc_await->resolve_callback(v, rpc_await->context);
+		}
+	}
+	else
+	{
+		const char *error = result == CURLE_OK ? "Invalid result from the API endpoint" : curl_easy_strerror(result);
+
+		v = metacall_value_create_string(error, strlen(error));
+
+		if (rpc_await->reject_callback != NULL)
+		{
+			ret = rpc_await->reject_callback(v, rpc_await->context);
+		}
+	}
+
+	if (ret != NULL && ret != v)
+	{
+		metacall_value_destroy(ret);
+	}
+
+	/* The future takes the ownership of the result, so it can be awaited after the request has finished */
+	rpc_loader_impl_future_settle(rpc_await->future, state, v);
+
+	rpc_loader_impl_future_release(rpc_await->future);
+
+	delete rpc_await;
+}
+
+loader_impl_rpc_future rpc_loader_impl_future_create(size_t references)
+{
+	loader_impl_rpc_future rpc_future = new loader_impl_rpc_future_type();
+
+	rpc_future->state = LOADER_IMPL_RPC_FUTURE_PENDING;
+	rpc_future->result = NULL;
+	rpc_future->references = references;
+
+	return rpc_future;
+}
+
+void rpc_loader_impl_future_release(loader_impl_rpc_future rpc_future)
+{
+	{
+		std::lock_guard<std::mutex> lock(rpc_future->mutex);
+
+		if (--rpc_future->references > 0)
+		{
+			return;
+		}
+	}
+
+	if (rpc_future->result != NULL)
+	{
+		value_type_destroy(rpc_future->result);
+	}
+
+	delete rpc_future;
+}
+
+void rpc_loader_impl_future_settle(loader_impl_rpc_future rpc_future, loader_impl_rpc_future_state state, value v)
+{
+	std::vector<loader_impl_rpc_future_callback_type> callbacks;
+
+	{
+		std::lock_guard<std::mutex> lock(rpc_future->mutex);
+
+		rpc_future->state = state;
+		rpc_future->result = v;
+
+		callbacks.swap(rpc_future->callbacks);
+	}
+
+	/* The callbacks are executed without holding the lock, so they can await the same future again */
+	for (auto &callback : callbacks)
+	{
+		rpc_loader_impl_future_invoke(&callback, state, v);
+	}
+}
+
+void rpc_loader_impl_future_invoke(loader_impl_rpc_future_callback callback, loader_impl_rpc_future_state state, value v)
+{
+	value ret = NULL;
+
+	if (state == LOADER_IMPL_RPC_FUTURE_RESOLVED)
+	{
+		if (callback->resolve_callback != NULL)
+		{
+			ret = callback->resolve_callback(v, callback->context);
+		}
+	}
+	else
+	{
+		if (callback->reject_callback != NULL)
+		{
+			ret = callback->reject_callback(v, callback->context);
+		}
+	}
+
+	/* The value returned by the callback is the result of the chained future */
+	if (ret == v)
+	{
+		ret = value_type_copy(v);
+	}
+	else if (ret == NULL)
+	{
+		ret = value_create_null();
+	}
+
+	rpc_loader_impl_future_settle(callback->chained, LOADER_IMPL_RPC_FUTURE_RESOLVED, ret);
+
+	rpc_loader_impl_future_release(callback->chained);
+}
+
+char *rpc_loader_impl_serialize_args(loader_impl_rpc rpc_impl, function_args args, size_t size, size_t *body_request_size)
+{
+	value v = metacall_value_create_array(NULL, size);
+
+	if (size > 0)
+	{
+		void **v_array = metacall_value_to_array(v);
+
+		for (size_t arg = 0; arg < size; ++arg)
+		{
+			v_array[arg] = args[arg];
+		}
+	}
+
+	char *buffer = metacall_serialize(rpc_impl->serial.c_str(), v, body_request_size, rpc_impl->allocator);
+
+	/* Destroy the value without destroying the contents of the array */
+	value_destroy(v);
+
+	return buffer;
+}
+
+char *rpc_loader_impl_serialize_batch(loader_impl_rpc rpc_impl, function_impl impls[], void **args[], size_t sizes[], const std::vector<size_t> &calls, size_t *body_request_size)
+{
+	static const char id_str[] = "id";
+	static const char method_str[] = "method";
+	static const char params_str[] = "params";
+	static const size_t pairs_size = 3;
+
+	const size_t size = calls.size();
+	value v = value_create_array(NULL, size);
+	value *v_array = value_to_array(v);
+
+	/* Build a JSON-RPC style batch, where the id is the position of the call in the batch and the arguments are borrowed */
+	for (size_t iterator = 0; iterator < size; ++iterator)
+	{
+		const size_t call = calls[iterator];
+		loader_impl_rpc_function rpc_function = static_cast<loader_impl_rpc_function>(impls[call]);
+		value params = value_create_array(NULL, sizes[call]);
+		value *params_array = value_to_array(params);
+
+		for (size_t arg = 0; arg < sizes[call]; ++arg)
+		{
+			params_array[arg] = args[call][arg];
+		}
+
+		value id[] = { value_create_string(id_str, sizeof(id_str) - 1), value_create_long(static_cast<long>(call)) };
+		value method[] = { value_create_string(method_str, sizeof(method_str) - 1), value_create_string(rpc_function->name.c_str(), rpc_function->name.length()) };
+		value params_pair[] = { value_create_string(params_str, sizeof(params_str) - 1), params };
+		value pairs[] = { value_create_array(id, 2), value_create_array(method, 2), value_create_array(params_pair, 2) };
+
+		v_array[iterator] = value_create_map(pairs, pairs_size);
+	}
+
+	char *buffer = metacall_serialize(rpc_impl->serial.c_str(), v, body_request_size, rpc_impl->allocator);
+
+	/* Destroy the batch without destroying the arguments, they are the last value of each call */
+	for (size_t iterator = 0; iterator < size; ++iterator)
+	{
+		value *pairs = value_to_map(v_array[iterator]);
+
+		for (size_t pair = 0; pair < pairs_size; ++pair)
+		{
+			value *tuple = value_to_array(pairs[pair]);
+
+			value_type_destroy(tuple[0]);
+
+			if (pair == pairs_size - 1)
+			{
+				value_destroy(tuple[1]);
+			}
+			else
+			{
+				value_type_destroy(tuple[1]);
+			}
+
+			value_destroy(pairs[pair]);
+		}
+
+		value_destroy(v_array[iterator]);
+	}
+
+	value_destroy(v);
+
+	return buffer;
+}
+
 int type_rpc_interface_create(type t, type_impl impl)
 {
 	/* TODO */
@@ -125,6 +652,80 @@ type_interface type_rpc_singleton(void)
 	return &rpc_type_interface;
 }
 
+int future_rpc_interface_create(future f, future_impl impl)
+{
+	(void)f;
+	(void)impl;
+
+	return 0;
+}
+
+future_return future_rpc_interface_await(future f, future_impl impl, future_resolve_callback resolve_callback, future_reject_callback reject_callback, void *context)
+{
+	loader_impl_rpc_future rpc_future = static_cast<loader_impl_rpc_future>(impl);
+
+	(void)f;
+
+	/* The chained future is referenced by the returned value and by the callback until it is executed */
+	loader_impl_rpc_future chained = rpc_loader_impl_future_create(2);
+
+	future chained_future = future_create(chained, &future_rpc_singleton);
+
+	if (chained_future == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid future creation in future_rpc_interface_await");
+		delete chained;
+		return NULL;
+	}
+
+	value ret = value_create_future(chained_future);
+
+	if (ret == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid future value creation in future_rpc_interface_await");
+		future_destroy(chained_future);
+		rpc_loader_impl_future_release(chained);
+		return NULL;
+	}
+
+	loader_impl_rpc_future_callback_type callback = { resolve_callback, reject_callback, context, chained };
+
+	{
+		std::lock_guard<std::mutex> lock(rpc_future->mutex);
+
+		/* Register the callback while the request is in flight, the multi thread executes it on completion */
+		if (rpc_future->state == LOADER_IMPL_RPC_FUTURE_PENDING)
+		{
+			rpc_future->callbacks.push_back(callback);
+
+			return ret;
+		}
+	}
+
+	/* The result does not change once settled, so it can be read without the lock */
+	rpc_loader_impl_future_invoke(&callback, rpc_future->state, rpc_future->result);
+
+	return ret;
+}
+
+void future_rpc_interface_destroy(future f, future_impl impl)
+{
+	(void)f;
+
+	rpc_loader_impl_future_release(static_cast<loader_impl_rpc_future>(impl));
+}
+
+future_interface future_rpc_singleton(void)
+{
+	static struct future_interface_type rpc_future_interface = {
+		&future_rpc_interface_create,
+		&future_rpc_interface_await,
+		&future_rpc_interface_destroy
+	};
+
+	return &rpc_future_interface;
+}
+
 int function_rpc_interface_create(function func, function_impl impl)
 {
 	/* TODO */
@@ -139,25 +740,11 @@ function_return function_rpc_interface_invoke(function func, function_impl impl,
 {
 	loader_impl_rpc_function rpc_function = static_cast<loader_impl_rpc_function>(impl);
 	loader_impl_rpc rpc_impl = rpc_function->rpc_impl;
-	value v = metacall_value_create_array(NULL, size);
 	size_t body_request_size = 0;
 
 	(void)func;
 
-	if (size > 0)
-	{
-		void **v_array = metacall_value_to_array(v);
-
-		for (size_t arg = 0; arg < size; ++arg)
-		{
-			v_array[arg] = args[arg];
-		}
-	}
-
-	char *buffer = metacall_serialize(metacall_serial(), v, &body_request_size, rpc_impl->allocator);
-
-	/* Destroy the value without destroying the contents of the array */
-	value_destroy(v);
+	char *buffer = rpc_loader_impl_serialize_args(rpc_impl, args, size, &body_request_size);
 
 	if (body_request_size == 0)
 	{
@@ -165,29 +752,24 @@ function_return function_rpc_interface_invoke(function func, function_impl impl,
 		return NULL;
 	}
 
-	/* Execute a POST to the endpoint */
+	/* Execute a POST to the endpoint, concurrent callers share the connections of the multi handle */
 	loader_impl_rpc_write_data_type write_data;
 
-	curl_easy_setopt(rpc_impl->invoke_curl, CURLOPT_URL, rpc_function->url.c_str());
-	curl_easy_setopt(rpc_impl->invoke_curl, CURLOPT_POSTFIELDS, buffer);
-	curl_easy_setopt(rpc_impl->invoke_curl, CURLOPT_POSTFIELDSIZE, body_request_size - 1);
-	curl_easy_setopt(rpc_impl->invoke_curl, CURLOPT_WRITEDATA, static_cast<loader_impl_rpc_write_data>(&write_data));
-
-	CURLcode res = curl_easy_perform(rpc_impl->invoke_curl);
+	CURLcode res = rpc_loader_impl_request(rpc_impl, rpc_function->url, buffer, body_request_size - 1, write_data);
 
 	/* Clear the request buffer */
 	metacall_allocator_free(rpc_function->rpc_impl->allocator, buffer);
 
 	if (res != CURLE_OK)
 	{
-		log_write("metacall", LOG_LEVEL_ERROR, "Could not call to the API endpoint %s [%]", rpc_function->url.c_str(), curl_easy_strerror(res));
+		log_write("metacall", LOG_LEVEL_ERROR, "Could not call to the API endpoint %s [%s]", rpc_function->url.c_str(), curl_easy_strerror(res));
 		return NULL;
 	}
 
 	/* Deserialize the call result data */
 	const size_t write_data_size = write_data.buffer.length() + 1;
 
-	void *result_value = metacall_deserialize(metacall_serial(), write_data.buffer.c_str(), write_data_size, rpc_impl->allocator);
+	void *result_value = metacall_deserialize(rpc_impl->serial.c_str(), write_data.buffer.c_str(), write_data_size, rpc_impl->allocator);
 
 	if (result_value == NULL)
 	{
@@ -199,17 +781,227 @@ function_return function_rpc_interface_invoke(function func, function_impl impl,
 
 function_return function_rpc_interface_await(function func, function_impl impl, function_args args, size_t size, function_resolve_callback resolve_callback, function_reject_callback reject_callback, void *context)
 {
-	/* TODO */
+	loader_impl_rpc_function rpc_function = static_cast<loader_impl_rpc_function>(impl);
+	loader_impl_rpc rpc_impl = rpc_function->rpc_impl;
+	size_t body_request_size = 0;
 
 	(void)func;
-	(void)impl;
-	(void)args;
-	(void)size;
-	(void)resolve_callback;
-	(void)reject_callback;
-	(void)context;
 
-	return NULL;
+	/* Arguments are serialized before returning, so the caller can destroy them while the request is in flight */
+	char *buffer = rpc_loader_impl_serialize_args(rpc_impl, args, size, &body_request_size);
+
+	if (body_request_size == 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid serialization of the values to the endpoint %s", rpc_function->url.c_str());
+		return NULL;
+	}
+
+	/* The future is referenced by the returned value and by the request, so any of them can finish first */
+	loader_impl_rpc_future rpc_future = rpc_loader_impl_future_create(2);
+
+	future f = future_create(rpc_future, &future_rpc_singleton);
+
+	if (f == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid future creation in function_rpc_interface_await, the call has not been executed");
+		delete rpc_future;
+		metacall_allocator_free(rpc_impl->allocator, buffer);
+		return NULL;
+	}
+
+	value ret = value_create_future(f);
+
+	if (ret == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid future value creation in function_rpc_interface_await, the call has not been executed");
+		future_destroy(f);
+		delete rpc_future;
+		metacall_allocator_free(rpc_impl->allocator, buffer);
+		return NULL;
+	}
+
+	loader_impl_rpc_await rpc_await = new loader_impl_rpc_await_type();
+
+	/* The URL is copied because the function can be cleared before the response arrives */
+	rpc_await->rpc_impl = rpc_impl;
+	rpc_await->future = rpc_future;
+	rpc_await->url = rpc_function->url;
+	rpc_await->buffer = buffer;
+	rpc_await->resolve_callback = resolve_callback;
+	rpc_await->reject_callback = reject_callback;
+	rpc_await->context = context;
+	rpc_await->request.complete = &rpc_loader_impl_await_complete;
+	rpc_await->request.data = static_cast<void *>(rpc_await);
+
+	if (rpc_loader_impl_request_submit(rpc_impl, &rpc_await->request, rpc_await->url, buffer, body_request_size - 1) != 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Could not create the request to the API endpoint %s", rpc_function->url.c_str());
+		metacall_allocator_free(rpc_impl->allocator, buffer);
+		rpc_loader_impl_future_release(rpc_future);
+		delete rpc_await;
+		value_type_destroy(ret);
+		return NULL;
+	}
+
+	return ret;
+}
+
+int function_rpc_interface_batch(function funcs[], function_impl impls[], void **args[], size_t sizes[], size_t count, function_return rets[])
+{
+	std::map<std::string, std::vector<size_t>> endpoints;
+	loader_impl_rpc rpc_impl = static_cast<loader_impl_rpc_function>(impls[0])->rpc_impl;
+	int result = 0;
+
+	(void)funcs;
+
+	if (std::this_thread::get_id() == rpc_impl->multi_thread.get_id())
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Synchronous batch call from an await callback is not allowed");
+		return 1;
+	}
+
+	/* Group the calls by endpoint, each endpoint receives all its calls in a single request */
+	for (size_t iterator = 0; iterator < count; ++iterator)
+	{
+		endpoints[static_cast<loader_impl_rpc_function>(impls[iterator])->base_url].push_back(iterator);
+	}
+
+	/* The bodies and requests are allocated before submitting, so they are not moved while in flight */
+	const size_t size = endpoints.size();
+	std::vector<std::string> urls(size), bodies(size);
+	std::vector<loader_impl_rpc_request_type> requests(size);
+	std::vector<std::promise<CURLcode>> promises(size);
+	std::vector<bool> submitted(size, false);
+	std::vector<const std::vector<size_t> *> calls(size);
+	size_t endpoint = 0;
+
+	for (auto &it : endpoints)
+	{
+		size_t body_size = 0;
+
+		calls[endpoint] = &it.second;
+		char *buffer = rpc_loader_impl_serialize_batch(rpc_impl, impls, args, sizes, it.second, &body_size);
+
+		if (body_size == 0)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid serialization of the batch to the endpoint %s", it.first.c_str());
+			result = 1;
+		}
+		else
+		{
+			bodies[endpoint].assign(buffer, body_size - 1);
+		}
+
+		if (buffer != NULL)
+		{
+			metacall_allocator_free(rpc_impl->allocator, buffer);
+		}
+
+		urls[endpoint] = it.first + "batch";
+		requests[endpoint].complete = &rpc_loader_impl_request_complete;
+		requests[endpoint].data = static_cast<void *>(&promises[endpoint]);
+
+		if (result == 0)
+		{
+			if (rpc_loader_impl_request_submit(rpc_impl, &requests[endpoint], urls[endpoint], bodies[endpoint].c_str(), bodies[endpoint].length()) != 0)
+			{
+				log_write("metacall", LOG_LEVEL_ERROR, "Could not create the request to the API endpoint %s", urls[endpoint].c_str());
+				result = 1;
+			}
+			else
+			{
+				submitted[endpoint] = true;
+			}
+		}
+
+		++endpoint;
+	}
+
+	/* Wait for all the endpoints and demultiplex the results by id */
+	for (endpoint = 0; endpoint < size; ++endpoint)
+	{
+		if (submitted[endpoint] == false)
+		{
+			continue;
+		}
+
+		CURLcode res = promises[endpoint].get_future().get();
+
+		rpc_loader_impl_pool_release(rpc_impl, requests[endpoint].curl);
+
+		if (res != CURLE_OK)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Could not call to the API endpoint %s [%s]", urls[endpoint].c_str(), curl_easy_strerror(res));
+			result = 1;
+			continue;
+		}
+
+		const std::string &buffer = requests[endpoint].write_data.buffer;
+
+		void *response = metacall_deserialize(rpc_impl->serial.c_str(), buffer.c_str(), buffer.length() + 1, rpc_impl->allocator);
+
+		if (response == NULL || metacall_value_id(response) != METACALL_ARRAY)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Could not deserialize the batch result from API endpoint %s", urls[endpoint].c_str());
+
+			if (response != NULL)
+			{
+				metacall_value_destroy(response);
+			}
+
+			result = 1;
+			continue;
+		}
+
+		void **response_array = metacall_value_to_array(response);
+
+		for (size_t iterator = 0; iterator < metacall_value_count(response); ++iterator)
+		{
+			if (metacall_value_id(response_array[iterator]) != METACALL_MAP)
+			{
+				result = 1;
+				continue;
+			}
+
+			std::map<std::string, void *> call_map = rpc_loader_impl_value_to_map(response_array[iterator]);
+			auto id = call_map.find("id"), call_result = call_map.find("result");
+
+			if (id == call_map.end())
+			{
+				result = 1;
+				continue;
+			}
+
+			void *id_v = metacall_value_copy(id->second);
+			size_t call = static_cast<size_t>(metacall_value_cast_long(&id_v));
+
+			metacall_value_destroy(id_v);
+
+			/* The results start as null, so a call already set means a repeated id or an id of another endpoint */
+			if (call >= count || call_result == call_map.end() || rets[call] != NULL)
+			{
+				log_write("metacall", LOG_LEVEL_ERROR, "Invalid call result in the batch from API endpoint %s", urls[endpoint].c_str());
+				result = 1;
+				continue;
+			}
+
+			rets[call] = metacall_value_copy(call_result->second);
+		}
+
+		metacall_value_destroy(response);
+
+		/* The server may omit some calls, each one of them must have received its result */
+		for (size_t call : *calls[endpoint])
+		{
+			if (rets[call] == NULL)
+			{
+				log_write("metacall", LOG_LEVEL_ERROR, "Missing result of the call %" PRIuS " in the batch from API endpoint %s", call, urls[endpoint].c_str());
+				result = 1;
+			}
+		}
+	}
+
+	return result;
 }
 
 void function_rpc_interface_destroy(function func, function_impl impl)
@@ -227,7 +1019,8 @@ function_interface function_rpc_singleton(void)
 		&function_rpc_interface_create,
 		&function_rpc_interface_invoke,
 		&function_rpc_interface_await,
-		&function_rpc_interface_destroy
+		&function_rpc_interface_destroy,
+		&function_rpc_interface_batch
 	};
 
 	return &rpc_function_interface;
@@ -281,14 +1074,52 @@ loader_impl_data rpc_loader_impl_initialize(loader_impl impl, configuration conf
 {
 	loader_impl_rpc rpc_impl = new loader_impl_rpc_type();
 
-	(void)impl;
-	(void)config;
-
 	if (rpc_impl == nullptr)
 	{
 		return NULL;
 	}
 
+	long max_host_connections = RPC_LOADER_IMPL_MAX_HOST_CONNECTIONS;
+
+	rpc_impl->headers = NULL;
+	rpc_impl->serial = metacall_serial();
+	rpc_impl->http2 = false;
+	rpc_impl->stop = false;
+
+	if (config != NULL)
+	{
+		value max_host_connections_value = configuration_value(config, "max_host_connections");
+		value http2_value = configuration_value(config, "http2");
+		value serial_value = configuration_value(config, "serial");
+
+		if (max_host_connections_value != NULL && value_type_id(max_host_connections_value) == TYPE_INT)
+		{
+			max_host_connections = static_cast<long>(value_to_int(max_host_connections_value));
+		}
+
+		if (http2_value != NULL && value_type_id(http2_value) == TYPE_BOOL)
+		{
+			rpc_impl->http2 = value_to_bool(http2_value) != 0L;
+		}
+
+		if (serial_value != NULL && value_type_id(serial_value) == TYPE_STRING)
+		{
+			rpc_impl->serial = value_to_string(serial_value);
+		}
+	}
+
+	/* The serial encodes the requests and decodes the responses, the endpoints must use the same format */
+	serial s = serial_create(rpc_impl->serial.c_str());
+
+	if (s == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Could not load the serial %s of the RPC loader", rpc_impl->serial.c_str());
+
+		delete rpc_impl;
+
+		return NULL;
+	}
+
 	struct metacall_allocator_std_type std_ctx = { &std::malloc, &std::realloc, &std::free };
 
 	rpc_impl->allocator = metacall_allocator_create(METACALL_ALLOCATOR_STD, (void *)&std_ctx);
@@ -304,32 +1135,52 @@ loader_impl_data rpc_loader_impl_initialize(loader_impl impl, configuration conf
 
 	curl_global_init(CURL_GLOBAL_ALL);
 
-	/* Initialize discover CURL object */
-	rpc_impl->discover_curl = curl_easy_init();
+	/* Headers shared by all the pooled easy handles, the media type is taken from the extension of the serial */
+	const std::string extension = serial_extension(s);
+	const std::string media_type = "application/" + extension;
+
+	std::vector<std::string> headers = {
+		"Accept: " + media_type,
+		"Content-Type: " + media_type
+	};
 
-	if (rpc_impl->discover_curl == NULL)
+	if (extension == "json")
 	{
-		log_write("metacall", LOG_LEVEL_ERROR, "Could not create CURL inspect object");
+		headers.push_back("charset: utf-8");
+	}
 
-		metacall_allocator_destroy(rpc_impl->allocator);
+	for (const std::string &header : headers)
+	{
+		struct curl_slist *list = curl_slist_append(rpc_impl->headers, header.c_str());
 
-		delete rpc_impl;
+		if (list == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Could not create the CURL headers");
 
-		return NULL;
-	}
+			curl_slist_free_all(rpc_impl->headers);
 
-	curl_easy_setopt(rpc_impl->discover_curl, CURLOPT_VERBOSE, 0L);
-	curl_easy_setopt(rpc_impl->discover_curl, CURLOPT_HEADER, 0L);
-	curl_easy_setopt(rpc_impl->discover_curl, CURLOPT_WRITEFUNCTION, rpc_loader_impl_write_data);
+			curl_global_cleanup();
 
-	/* Initialize invoke CURL object */
-	rpc_impl->invoke_curl = curl_easy_init();
+			metacall_allocator_destroy(rpc_impl->allocator);
+
+			delete rpc_impl;
+
+			return NULL;
+		}
 
-	if (rpc_impl->invoke_curl == NULL)
+		rpc_impl->headers = list;
+	}
+
+	/* Initialize the multi handle, it owns the connection cache shared by all the pooled easy handles */
+	rpc_impl->multi = curl_multi_init();
+
+	if (rpc_impl->multi == NULL)
 	{
-		log_write("metacall", LOG_LEVEL_ERROR, "Could not create CURL invoke object");
+		log_write("metacall", LOG_LEVEL_ERROR, "Could not create CURL multi object");
+
+		curl_slist_free_all(rpc_impl->headers);
 
-		curl_easy_cleanup(rpc_impl->discover_curl);
+		curl_global_cleanup();
 
 		metacall_allocator_destroy(rpc_impl->allocator);
 
@@ -338,29 +1189,18 @@ loader_impl_data rpc_loader_impl_initialize(loader_impl impl, configuration conf
 		return NULL;
 	}
 
-	static struct curl_slist *headers = NULL;
-
-	if (headers == NULL)
-	{
-		headers = curl_slist_append(headers, "Accept: application/json");
-		headers = curl_slist_append(headers, "Content-Type: application/json");
-		headers = curl_slist_append(headers, "charset: utf-8");
-	}
-
-	curl_easy_setopt(rpc_impl->invoke_curl, CURLOPT_VERBOSE, 0L);
-	curl_easy_setopt(rpc_impl->invoke_curl, CURLOPT_HEADER, 0L);
-	curl_easy_setopt(rpc_impl->invoke_curl, CURLOPT_CUSTOMREQUEST, "POST");
-	curl_easy_setopt(rpc_impl->invoke_curl, CURLOPT_HTTPHEADER, headers);
-	curl_easy_setopt(rpc_impl->invoke_curl, CURLOPT_USERAGENT, "librpc_loader/0.1");
-	curl_easy_setopt(rpc_impl->invoke_curl, CURLOPT_WRITEFUNCTION, rpc_loader_impl_write_data);
+	curl_multi_setopt(rpc_impl->multi, CURLMOPT_MAX_HOST_CONNECTIONS, max_host_connections);
+	curl_multi_setopt(rpc_impl->multi, CURLMOPT_PIPELINING, rpc_impl->http2 == true ? CURLPIPE_MULTIPLEX : CURLPIPE_NOTHING);
 
 	if (rpc_loader_impl_initialize_types(impl, rpc_impl) != 0)
 	{
 		log_write("metacall", LOG_LEVEL_ERROR, "Could not create CURL object");
 
-		curl_easy_cleanup(rpc_impl->discover_curl);
+		curl_multi_cleanup(rpc_impl->multi);
+
+		curl_slist_free_all(rpc_impl->headers);
 
-		curl_easy_cleanup(rpc_impl->invoke_curl);
+		curl_global_cleanup();
 
 		metacall_allocator_destroy(rpc_impl->allocator);
 
@@ -369,6 +1209,9 @@ loader_impl_data rpc_loader_impl_initialize(loader_impl impl, configuration conf
 		return NULL;
 	}
 
+	/* Drive all the transfers from a single thread, callers block until their own request is done */
+	rpc_impl->multi_thread = std::thread(rpc_loader_impl_multi_loop, rpc_impl);
+
 	/* Register initialization */
 	loader_initialization_register(impl);
 
@@ -587,6 +1430,8 @@ int rpc_loader_impl_discover_value(loader_impl_rpc rpc_impl, std::string &url, v
 				loader_impl_rpc_function rpc_func = new loader_impl_rpc_function_type();
 
 				rpc_func->url = url + (is_async ? "await/" : "call/") + func_name;
+				rpc_func->base_url = url;
+				rpc_func->name = func_name;
 				rpc_func->rpc_impl = rpc_impl;
 
 				function f = function_create(func_name, args_count, rpc_func, &function_rpc_singleton);
@@ -644,10 +1489,7 @@ int rpc_loader_impl_discover(loader_impl impl, loader_handle handle, context ctx
 
 		std::string inspect_url = rpc_handle->urls[iterator] + "inspect";
 
-		curl_easy_setopt(rpc_impl->discover_curl, CURLOPT_URL, inspect_url.c_str());
-		curl_easy_setopt(rpc_impl->discover_curl, CURLOPT_WRITEDATA, static_cast<loader_impl_rpc_write_data>(&write_data));
-
-		CURLcode res = curl_easy_perform(rpc_impl->discover_curl);
+		CURLcode res = rpc_loader_impl_request(rpc_impl, inspect_url, NULL, 0, write_data);
 
 		if (res != CURLE_OK)
 		{
@@ -658,7 +1500,7 @@ int rpc_loader_impl_discover(loader_impl impl, loader_handle handle, context ctx
 		/* Deserialize the inspect data */
 		const size_t size = write_data.buffer.length() + 1;
 
-		void *inspect_value = metacall_deserialize(metacall_serial(), write_data.buffer.c_str(), size, rpc_impl->allocator);
+		void *inspect_value = metacall_deserialize(rpc_impl->serial.c_str(), write_data.buffer.c_str(), size, rpc_impl->allocator);
 
 		if (inspect_value == NULL)
 		{
@@ -684,14 +1526,30 @@ int rpc_loader_impl_destroy(loader_impl impl)
 	/* Destroy children loaders */
 	loader_unload_children(impl);
 
-	metacall_allocator_destroy(rpc_impl->allocator);
+	/* Stop the multi thread, the awaits still in flight are rejected */
+	{
+		std::lock_guard<std::mutex> lock(rpc_impl->multi_mutex);
+
+		rpc_impl->stop = true;
+	}
 
-	curl_easy_cleanup(rpc_impl->discover_curl);
+	curl_multi_wakeup(rpc_impl->multi);
 
-	curl_easy_cleanup(rpc_impl->invoke_curl);
+	rpc_impl->multi_thread.join();
+
+	for (CURL *curl : rpc_impl->pool)
+	{
+		curl_easy_cleanup(curl);
+	}
+
+	curl_multi_cleanup(rpc_impl->multi);
+
+	curl_slist_free_all(rpc_impl->headers);
 
 	curl_global_cleanup();
 
+	metacall_allocator_destroy(rpc_impl->allocator);
+
 	delete rpc_impl;
 
 	return 0;
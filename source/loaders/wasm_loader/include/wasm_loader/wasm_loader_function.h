@@ -25,6 +25,8 @@
 
 #include <reflect/reflect_function.h>
 
+#include <stdbool.h>
+
 #include <wasm.h>
 
 #ifdef __cplusplus
@@ -33,8 +35,21 @@ extern "C" {
 
 typedef struct loader_impl_wasm_function_type *loader_impl_wasm_function;
 
+// Exports of a module used for passing buffers and strings through its linear
+// memory, any of them is NULL if the module does not export it
+typedef struct loader_impl_wasm_memory_type
+{
+	wasm_memory_t *memory;		// Exported as "memory"
+	const wasm_func_t *alloc;	// Exported as "metacall_alloc", with type (i32 size) -> (i32 pointer)
+	const wasm_func_t *dealloc;	// Exported as "metacall_free", with type (i32 pointer, i32 size) -> ()
+} loader_impl_wasm_memory;
+
 WASM_LOADER_API function_interface function_wasm_singleton(void);
-WASM_LOADER_API loader_impl_wasm_function loader_impl_wasm_function_create(const wasm_func_t *func);
+// Functions returning a (i32 pointer, i32 size) pair are only read as buffers when buffer_result is set,
+// which happens when the module also exports them with the "metacall_buffer:" prefix (i.e: "metacall_buffer:name")
+#define WASM_LOADER_BUFFER_RESULT_PREFIX "metacall_buffer:"
+
+WASM_LOADER_API loader_impl_wasm_function loader_impl_wasm_function_create(const wasm_func_t *func, const loader_impl_wasm_memory *memory, bool buffer_result);
 
 #ifdef __cplusplus
 }
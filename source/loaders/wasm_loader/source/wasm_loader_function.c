@@ -5,13 +5,25 @@
 
 #include <log/log.h>
 
+#include <stdint.h>
+#include <string.h>
+
 #include <wasm.h>
 
 struct loader_impl_wasm_function_type
 {
 	const wasm_func_t *func;
+	loader_impl_wasm_memory memory;
+	bool buffer_result;
 };
 
+// Region of the linear memory allocated for passing a buffer or a string
+typedef struct loader_impl_wasm_allocation_type
+{
+	int32_t ptr;
+	int32_t size;
+} loader_impl_wasm_allocation;
+
 static function_return function_wasm_interface_invoke(function func, function_impl impl, function_args args, size_t args_size);
 static void function_wasm_interface_destroy(function func, function_impl impl);
 
@@ -25,13 +37,14 @@ function_interface function_wasm_singleton(void)
 		// not fully implemented in Wasmtime
 		// (see https://docs.wasmtime.dev/stability-wasm-proposals-support.html)
 		NULL,
-		&function_wasm_interface_destroy
+		&function_wasm_interface_destroy,
+		NULL
 	};
 
 	return &wasm_function_interface;
 }
 
-loader_impl_wasm_function loader_impl_wasm_function_create(const wasm_func_t *func)
+loader_impl_wasm_function loader_impl_wasm_function_create(const wasm_func_t *func, const loader_impl_wasm_memory *memory, bool buffer_result)
 {
 	loader_impl_wasm_function func_impl = malloc(sizeof(struct loader_impl_wasm_function_type));
 	if (func_impl == NULL)
@@ -43,6 +56,9 @@ loader_impl_wasm_function loader_impl_wasm_function_create(const wasm_func_t *fu
 	// Ugly hack to subvert the type system and initialize a const member
 	*(wasm_func_t **)&func_impl->func = (wasm_func_t *)func;
 
+	func_impl->memory = *memory;
+	func_impl->buffer_result = buffer_result;
+
 	return func_impl;
 }
 
@@ -124,8 +140,140 @@ static void log_trap(const wasm_trap_t *trap)
 	wasm_byte_vec_delete(&message);
 }
 
-static value call_func(const signature sig, const wasm_func_t *func, const wasm_val_vec_t args)
+// Buffers and strings are passed to Wasm as two i32 parameters, the pointer and the
+// size of a region of the linear memory obtained from the "metacall_alloc" export.
+// The data is copied straight from the value into the memory of the instance, and the
+// region is released with the "metacall_free" export (if any) after the call.
+static int memory_in_bounds(const loader_impl_wasm_memory *memory, int32_t ptr, int32_t size)
+{
+	return ptr >= 0 && size >= 0 && (size_t)ptr + (size_t)size <= wasm_memory_data_size(memory->memory);
+}
+
+static int memory_alloc(const loader_impl_wasm_memory *memory, const void *data, size_t size, loader_impl_wasm_allocation *allocation)
+{
+	if (memory->memory == NULL || memory->alloc == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "WebAssembly loader: Passing buffers or strings requires the module to export \"memory\" and \"metacall_alloc\"");
+		return 1;
+	}
+
+	if (size > INT32_MAX)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "WebAssembly loader: Buffer of %" PRIuS " bytes does not fit into the linear memory", size);
+		return 1;
+	}
+
+	allocation->ptr = 0;
+	allocation->size = (int32_t)size;
+
+	if (size == 0)
+	{
+		return 0;
+	}
+
+	wasm_val_t alloc_args[1] = { WASM_I32_VAL(allocation->size) };
+	wasm_val_t alloc_results[1] = { WASM_I32_VAL(0) };
+	wasm_val_vec_t args_vec = WASM_ARRAY_VEC(alloc_args);
+	wasm_val_vec_t results_vec = WASM_ARRAY_VEC(alloc_results);
+
+	wasm_trap_t *trap = wasm_func_call(memory->alloc, &args_vec, &results_vec);
+
+	if (trap != NULL)
+	{
+		log_trap(trap);
+		wasm_trap_delete(trap);
+		return 1;
+	}
+
+	// The allocator may grow the memory, so the bounds are checked after calling it
+	if (alloc_results[0].of.i32 == 0 || !memory_in_bounds(memory, alloc_results[0].of.i32, allocation->size))
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "WebAssembly loader: Failed to allocate %" PRIuS " bytes in the linear memory", size);
+		return 1;
+	}
+
+	allocation->ptr = alloc_results[0].of.i32;
+
+	memcpy(wasm_memory_data(memory->memory) + allocation->ptr, data, size);
+
+	return 0;
+}
+
+static void memory_free(const loader_impl_wasm_memory *memory, const loader_impl_wasm_allocation *allocation)
 {
+	if (memory->dealloc == NULL || allocation->ptr == 0)
+	{
+		return;
+	}
+
+	wasm_val_t free_args[2] = { WASM_I32_VAL(allocation->ptr), WASM_I32_VAL(allocation->size) };
+	wasm_val_vec_t args_vec = WASM_ARRAY_VEC(free_args);
+	wasm_val_vec_t results_vec = WASM_EMPTY_VEC;
+
+	wasm_trap_t *trap = wasm_func_call(memory->dealloc, &args_vec, &results_vec);
+
+	if (trap != NULL)
+	{
+		log_trap(trap);
+		wasm_trap_delete(trap);
+	}
+}
+
+static int memory_alloc_value(const loader_impl_wasm_memory *memory, value val, loader_impl_wasm_allocation *allocation)
+{
+	size_t size = value_type_size(val);
+
+	if (value_type_id(val) == TYPE_STRING)
+	{
+		// The null terminator is not passed, only the characters
+		return memory_alloc(memory, value_to_string(val), size > 0 ? size - 1 : 0, allocation);
+	}
+
+	return memory_alloc(memory, value_to_buffer(val), size, allocation);
+}
+
+static bool memory_overlaps(const loader_impl_wasm_allocation *region, const loader_impl_wasm_allocation *allocation)
+{
+	const size_t region_begin = (size_t)region->ptr, region_end = region_begin + (size_t)region->size;
+	const size_t allocation_begin = (size_t)allocation->ptr, allocation_end = allocation_begin + (size_t)allocation->size;
+
+	// Empty regions pointing into (or right after) the allocation are slices of it too
+	return allocation->ptr != 0 && ((region_begin >= allocation_begin && region_begin <= allocation_end) ||
+									   (allocation_begin >= region_begin && allocation_begin < region_end));
+}
+
+static value memory_to_buffer(const loader_impl_wasm_memory *memory, const wasm_val_vec_t *results, const loader_impl_wasm_allocation *allocations, size_t allocations_size)
+{
+	loader_impl_wasm_allocation allocation = { results->data[0].of.i32, results->data[1].of.i32 };
+
+	if (!memory_in_bounds(memory, allocation.ptr, allocation.size))
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "WebAssembly loader: Returned buffer is out of the bounds of the linear memory");
+		return NULL;
+	}
+
+	// Reflect buffers own their memory, so the region is copied once into the value
+	value ret = value_create_buffer(wasm_memory_data(memory->memory) + allocation.ptr, (size_t)allocation.size);
+
+	// The ownership of the returned region is released, unless it is a slice of an argument,
+	// in that case the region belongs to the argument and it is released after the call
+	for (size_t idx = 0; idx < allocations_size; idx++)
+	{
+		if (memory_overlaps(&allocation, &allocations[idx]))
+		{
+			return ret;
+		}
+	}
+
+	memory_free(memory, &allocation);
+
+	return ret;
+}
+
+static value call_func(const signature sig, loader_impl_wasm_function wasm_func, const wasm_val_vec_t args, const loader_impl_wasm_allocation *allocations, size_t allocations_size)
+{
+	const wasm_func_t *func = wasm_func->func;
+
 	// No way to check if vector allocation fails
 	wasm_val_vec_t results;
 	wasm_val_vec_new_uninitialized(&results, wasm_func_result_arity(func));
@@ -145,6 +293,10 @@ static value call_func(const signature sig, const wasm_func_t *func, const wasm_
 		log_trap(trap);
 		wasm_trap_delete(trap);
 	}
+	else if (wasm_func->buffer_result)
+	{
+		ret = memory_to_buffer(&wasm_func->memory, &results, allocations, allocations_size);
+	}
 	else if (signature_get_return(sig) != NULL)
 	{
 		ret = wasm_results_to_reflect_type(&results);
@@ -158,45 +310,96 @@ static function_return function_wasm_interface_invoke(function func, function_im
 {
 	loader_impl_wasm_function wasm_func = (loader_impl_wasm_function)impl;
 	signature sig = function_signature(func);
+	const size_t params_size = signature_count(sig);
 
-	if (args_size != signature_count(sig))
+	if (params_size == 0)
 	{
-		log_write("metacall", LOG_LEVEL_ERROR, "WebAssembly loader: Invalid number of arguments (%d expected, %d given) in call to function %s", args_size, signature_count(sig), function_name(func));
-		return NULL;
-	}
+		if (args_size != 0)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "WebAssembly loader: Invalid number of arguments (%d expected, %d given) in call to function %s", params_size, args_size, function_name(func));
+			return NULL;
+		}
 
-	if (args_size == 0)
-	{
 		const wasm_val_vec_t args_vec = WASM_EMPTY_VEC;
 
-		return call_func(sig, wasm_func->func, args_vec);
+		return call_func(sig, wasm_func, args_vec, NULL, 0);
 	}
 	else
 	{
-		wasm_val_t wasm_args[args_size];
+		// Each argument takes one parameter, except buffers and strings which take two
+		wasm_val_t wasm_args[params_size];
+		loader_impl_wasm_allocation allocations[params_size / 2 + 1];
+		size_t param_idx = 0, allocations_size = 0;
+		value ret = NULL;
 
 		for (size_t idx = 0; idx < args_size; idx++)
 		{
-			type param_type = signature_get_type(sig, idx);
-			type_id param_type_id = type_index(param_type);
 			type_id arg_type_id = value_type_id(args[idx]);
 
+			if (param_idx == params_size)
+			{
+				log_write("metacall", LOG_LEVEL_ERROR, "WebAssembly loader: Invalid number of arguments (%d parameters expected, %d arguments given) in call to function %s", params_size, args_size, function_name(func));
+				goto free_allocations;
+			}
+
+			if (arg_type_id == TYPE_BUFFER || arg_type_id == TYPE_STRING)
+			{
+				if (param_idx + 1 == params_size ||
+					type_index(signature_get_type(sig, param_idx)) != TYPE_INT ||
+					type_index(signature_get_type(sig, param_idx + 1)) != TYPE_INT)
+				{
+					log_write("metacall", LOG_LEVEL_ERROR, "WebAssembly loader: Invalid type for argument %d (expected (i32, i32) parameters for %s) in call to function %s", idx, type_id_name(arg_type_id), function_name(func));
+					goto free_allocations;
+				}
+
+				loader_impl_wasm_allocation *allocation = &allocations[allocations_size];
+
+				if (memory_alloc_value(&wasm_func->memory, args[idx], allocation) != 0)
+				{
+					goto free_allocations;
+				}
+
+				++allocations_size;
+
+				wasm_args[param_idx++] = (wasm_val_t)WASM_I32_VAL(allocation->ptr);
+				wasm_args[param_idx++] = (wasm_val_t)WASM_I32_VAL(allocation->size);
+
+				continue;
+			}
+
+			type param_type = signature_get_type(sig, param_idx);
+			type_id param_type_id = type_index(param_type);
+
 			if (param_type_id != arg_type_id)
 			{
 				log_write("metacall", LOG_LEVEL_ERROR, "WebAssembly loader: Invalid type for argument %d (expected %s, was %s) in call to function %s", idx, type_id_name(param_type_id), type_id_name(arg_type_id), function_name(func));
-				return NULL;
+				goto free_allocations;
 			}
 
-			if (reflect_to_wasm_type(args[idx], &wasm_args[idx]) != 0)
+			if (reflect_to_wasm_type(args[idx], &wasm_args[param_idx++]) != 0)
 			{
 				log_write("metacall", LOG_LEVEL_ERROR, "WebAssembly loader: Unsupported type for argument %d in call to function %s", idx, function_name(func));
-				return NULL;
+				goto free_allocations;
 			}
 		}
 
+		if (param_idx != params_size)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "WebAssembly loader: Invalid number of arguments (%d parameters expected, %d arguments given) in call to function %s", params_size, args_size, function_name(func));
+			goto free_allocations;
+		}
+
 		const wasm_val_vec_t args_vec = WASM_ARRAY_VEC(wasm_args);
 
-		return call_func(sig, wasm_func->func, args_vec);
+		ret = call_func(sig, wasm_func, args_vec, allocations, allocations_size);
+
+	free_allocations:
+		for (size_t idx = 0; idx < allocations_size; idx++)
+		{
+			memory_free(&wasm_func->memory, &allocations[idx]);
+		}
+
+		return ret;
 	}
 }
 
@@ -3,6 +3,8 @@
 
 #include <log/log.h>
 
+#include <string.h>
+
 struct loader_impl_wasm_module_type
 {
 	loader_name name;
@@ -60,16 +62,11 @@ void wasm_loader_handle_destroy(loader_impl_wasm_handle handle)
 	free(handle);
 }
 
-int wasm_loader_handle_add_module(loader_impl_wasm_handle handle, const loader_name name, wasm_store_t *store, const wasm_byte_vec_t *binary)
+int wasm_loader_handle_add_module(loader_impl_wasm_handle handle, const loader_name name, wasm_store_t *store, wasm_module_t *module_impl)
 {
+	// The handle takes ownership of the module, even if adding it fails
 	loader_impl_wasm_module module;
-	module.module = wasm_module_new(store, binary);
-
-	if (module.module == NULL)
-	{
-		log_write("metacall", LOG_LEVEL_ERROR, "WebAssembly loader: Failed to create module");
-		goto error_module_new;
-	}
+	module.module = module_impl;
 
 	if (initialize_module_imports(handle, &module) != 0)
 	{
@@ -92,7 +89,6 @@ int wasm_loader_handle_add_module(loader_impl_wasm_handle handle, const loader_n
 
 error_initialize_imports:
 	wasm_module_delete(module.module);
-error_module_new:
 	return 1;
 }
 
@@ -167,7 +163,47 @@ static char *get_export_type_name(const wasm_exporttype_t *export_type)
 	return null_terminated_name;
 }
 
-static int discover_function(loader_impl impl, scope scp, const wasm_externtype_t *extern_type, const char *name, const wasm_extern_t *extern_val)
+static bool is_export_name(const wasm_exporttype_t *export_type, const char *name);
+
+static bool is_buffer_result_marker(const wasm_exporttype_t *export_type)
+{
+	const wasm_name_t *export_name = wasm_exporttype_name(export_type);
+	const size_t size = sizeof(WASM_LOADER_BUFFER_RESULT_PREFIX) - 1;
+
+	return export_name->size > size && strncmp(export_name->data, WASM_LOADER_BUFFER_RESULT_PREFIX, size) == 0;
+}
+
+static bool has_buffer_result(const loader_impl_wasm_module *module, const wasm_externtype_t *extern_type, const char *name)
+{
+	// The module opts in to return a buffer by exporting the function again as "metacall_buffer:name"
+	const size_t prefix_size = sizeof(WASM_LOADER_BUFFER_RESULT_PREFIX) - 1, name_size = strlen(name) + 1;
+	char marker[prefix_size + name_size];
+
+	memcpy(marker, WASM_LOADER_BUFFER_RESULT_PREFIX, prefix_size);
+	memcpy(&marker[prefix_size], name, name_size);
+
+	for (size_t i = 0; i < module->export_types.size; i++)
+	{
+		if (!is_export_name(module->export_types.data[i], marker))
+		{
+			continue;
+		}
+
+		const wasm_valtype_vec_t *results = wasm_functype_results(wasm_externtype_as_functype_const(extern_type));
+
+		if (results->size != 2 || wasm_valtype_kind(results->data[0]) != WASM_I32 || wasm_valtype_kind(results->data[1]) != WASM_I32)
+		{
+			log_write("metacall", LOG_LEVEL_WARNING, "WebAssembly loader: Ignoring \"%s\" export of module %s, the function must return a (i32, i32) pair", marker, module->name);
+			return false;
+		}
+
+		return true;
+	}
+
+	return false;
+}
+
+static int discover_function(loader_impl impl, scope scp, const loader_impl_wasm_module *module, const wasm_externtype_t *extern_type, const char *name, const wasm_extern_t *extern_val, const loader_impl_wasm_memory *memory)
 {
 	if (scope_get(scp, name) != NULL)
 	{
@@ -180,7 +216,9 @@ static int discover_function(loader_impl impl, scope scp, const wasm_externtype_
 	const wasm_valtype_vec_t *params = wasm_functype_params(func_type);
 	const wasm_valtype_vec_t *results = wasm_functype_results(func_type);
 
-	loader_impl_wasm_function func_impl = loader_impl_wasm_function_create(wasm_extern_as_func_const(extern_val));
+	const bool buffer_result = has_buffer_result(module, extern_type, name);
+
+	loader_impl_wasm_function func_impl = loader_impl_wasm_function_create(wasm_extern_as_func_const(extern_val), memory, buffer_result);
 	if (func_impl == NULL)
 	{
 		return 1;
@@ -189,7 +227,11 @@ static int discover_function(loader_impl impl, scope scp, const wasm_externtype_
 	function func = function_create(name, params->size, func_impl, &function_wasm_singleton);
 	signature sig = function_signature(func);
 
-	if (results->size > 0)
+	if (buffer_result)
+	{
+		signature_set_return(sig, loader_impl_type(impl, "buffer"));
+	}
+	else if (results->size > 0)
 	{
 		type ret_type = results->size == 1 ? valkind_to_type(impl, wasm_valtype_kind(results->data[0])) : loader_impl_type(impl, "array");
 		signature_set_return(sig, ret_type);
@@ -212,7 +254,7 @@ static int discover_function(loader_impl impl, scope scp, const wasm_externtype_
 	return 0;
 }
 
-static int discover_export(loader_impl impl, scope scp, const wasm_exporttype_t *export_type, const wasm_extern_t *export)
+static int discover_export(loader_impl impl, scope scp, const loader_impl_wasm_module *module, const wasm_exporttype_t *export_type, const wasm_extern_t *export, const loader_impl_wasm_memory *memory)
 {
 	int ret = 1;
 
@@ -227,9 +269,10 @@ static int discover_export(loader_impl impl, scope scp, const wasm_exporttype_t
 		goto error_export_name_alloc;
 	}
 
-	if (kind == WASM_EXTERN_FUNC)
+	// The exports marking buffer results are not functions on their own
+	if (kind == WASM_EXTERN_FUNC && !is_buffer_result_marker(export_type))
 	{
-		if (discover_function(impl, scp, extern_type, export_name, export) != 0)
+		if (discover_function(impl, scp, module, extern_type, export_name, export, memory) != 0)
 		{
 			goto error_discover_function;
 		}
@@ -243,15 +286,98 @@ error_export_name_alloc:
 	return ret;
 }
 
+static bool is_export_name(const wasm_exporttype_t *export_type, const char *name)
+{
+	const wasm_name_t *export_name = wasm_exporttype_name(export_type);
+	const size_t size = strlen(name);
+
+	return export_name->size == size && strncmp(export_name->data, name, size) == 0;
+}
+
+static bool is_i32_functype(const wasm_externtype_t *extern_type, size_t params_size, size_t results_size)
+{
+	const wasm_functype_t *func_type = wasm_externtype_as_functype_const(extern_type);
+	const wasm_valtype_vec_t *params = wasm_functype_params(func_type);
+	const wasm_valtype_vec_t *results = wasm_functype_results(func_type);
+
+	if (params->size != params_size || results->size != results_size)
+	{
+		return false;
+	}
+
+	for (size_t i = 0; i < params->size; i++)
+	{
+		if (wasm_valtype_kind(params->data[i]) != WASM_I32)
+		{
+			return false;
+		}
+	}
+
+	for (size_t i = 0; i < results->size; i++)
+	{
+		if (wasm_valtype_kind(results->data[i]) != WASM_I32)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static void discover_memory(const loader_impl_wasm_module *module, loader_impl_wasm_memory *memory)
+{
+	memory->memory = NULL;
+	memory->alloc = NULL;
+	memory->dealloc = NULL;
+
+	for (size_t i = 0; i < module->export_types.size; i++)
+	{
+		const wasm_exporttype_t *export_type = module->export_types.data[i];
+		const wasm_externtype_t *extern_type = wasm_exporttype_type(export_type);
+		const wasm_externkind_t kind = wasm_externtype_kind(extern_type);
+		wasm_extern_t *export = module->exports.data[i];
+
+		if (kind == WASM_EXTERN_MEMORY && is_export_name(export_type, "memory"))
+		{
+			memory->memory = wasm_extern_as_memory(export);
+		}
+		else if (kind == WASM_EXTERN_FUNC && is_export_name(export_type, "metacall_alloc"))
+		{
+			if (is_i32_functype(extern_type, 1, 1))
+			{
+				memory->alloc = wasm_extern_as_func(export);
+			}
+			else
+			{
+				log_write("metacall", LOG_LEVEL_WARNING, "WebAssembly loader: Ignoring \"metacall_alloc\" export of module %s, its type must be (i32) -> (i32)", module->name);
+			}
+		}
+		else if (kind == WASM_EXTERN_FUNC && is_export_name(export_type, "metacall_free"))
+		{
+			if (is_i32_functype(extern_type, 2, 0))
+			{
+				memory->dealloc = wasm_extern_as_func(export);
+			}
+			else
+			{
+				log_write("metacall", LOG_LEVEL_WARNING, "WebAssembly loader: Ignoring \"metacall_free\" export of module %s, its type must be (i32, i32) -> ()", module->name);
+			}
+		}
+	}
+}
+
 static int discover_module(loader_impl impl, scope scp, const loader_impl_wasm_module *module)
 {
+	loader_impl_wasm_memory memory;
+	discover_memory(module, &memory);
+
 	for (size_t i = 0; i < module->export_types.size; i++)
 	{
 		// There is a 1-to-1 correspondence between between the instance
 		// exports and the module exports, so we can use the same index.
 		const wasm_exporttype_t *export_type = module->export_types.data[i];
 		const wasm_extern_t *export = module->exports.data[i];
-		if (discover_export(impl, scp, export_type, export) != 0)
+		if (discover_export(impl, scp, module, export_type, export, &memory) != 0)
 		{
 			log_write("metacall", LOG_LEVEL_ERROR, "WebAssembly loader: Module discovery failed");
 			return 1;
@@ -25,6 +25,8 @@
 #include <loader/loader.h>
 #include <loader/loader_impl.h>
 
+#include <configuration/configuration.h>
+
 #include <portability/portability_path.h>
 
 #include <reflect/reflect_context.h>
@@ -33,7 +35,11 @@
 
 #include <log/log.h>
 
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #ifdef WASMTIME
 	#include <wasmtime.h>
@@ -41,27 +47,49 @@
 
 #define COUNT_OF(array) (sizeof(array) / sizeof(array[0]))
 
+// Version of the layout of the cache files, it must be increased when the header changes
+#define CACHE_VERSION 1
+#define CACHE_MAGIC "MCWASM"
+
+#ifndef WASM_LOADER_RUNTIME_VERSION
+	#define WASM_LOADER_RUNTIME_VERSION ""
+#endif
+
 typedef struct loader_impl_wasm_type
 {
 	wasm_engine_t *engine;
 	wasm_store_t *store;
 	vector paths;
+	loader_path cache_path; // Empty if the compiled module cache is disabled
+	uint64_t cache_key;		// Hash of the runtime and engine configuration the modules are compiled with
 } * loader_impl_wasm;
 
+typedef struct cache_header_type
+{
+	char magic[sizeof(CACHE_MAGIC)];
+	uint8_t version;
+	uint64_t key;
+	uint64_t size;
+	uint64_t checksum;
+} cache_header;
+
 static int initialize_types(loader_impl impl);
+static wasm_engine_t *create_engine(configuration config);
+static void initialize_cache(loader_impl_wasm impl, configuration config);
 
 static FILE *open_file_absolute(const loader_path path, size_t *file_size);
 static FILE *open_file_relative(loader_impl_wasm impl, const loader_path path, size_t *file_size);
 static char *read_buffer_from_file(loader_impl impl, const loader_path path, size_t *file_size);
 
 static int try_wat2wasm(const char *buffer, size_t size, wasm_byte_vec_t *binary);
+static int is_precompiled_module(const loader_path path);
+static wasm_module_t *compile_module(loader_impl_wasm impl, const wasm_byte_vec_t *binary);
+static wasm_module_t *deserialize_module(loader_impl_wasm impl, const wasm_byte_vec_t *serialized);
 static int load_module_from_package(loader_impl impl, loader_impl_wasm_handle handle, const loader_path path);
 static int load_module_from_file(loader_impl impl, loader_impl_wasm_handle handle, const loader_path path);
 
 loader_impl_data wasm_loader_impl_initialize(loader_impl impl, configuration config)
 {
-	(void)config;
-
 	loader_impl_wasm wasm_impl = malloc(sizeof(struct loader_impl_wasm_type));
 
 	if (wasm_impl == NULL)
@@ -76,8 +104,7 @@ loader_impl_data wasm_loader_impl_initialize(loader_impl impl, configuration con
 		goto error_types_init;
 	}
 
-	// TODO: Use wasm_engine_new_with_config function for passing in config?
-	wasm_impl->engine = wasm_engine_new();
+	wasm_impl->engine = create_engine(config);
 
 	if (wasm_impl->engine == NULL)
 	{
@@ -101,6 +128,8 @@ loader_impl_data wasm_loader_impl_initialize(loader_impl impl, configuration con
 		goto error_paths_creation;
 	}
 
+	initialize_cache(wasm_impl, config);
+
 	loader_initialization_register(impl);
 	log_write("metacall", LOG_LEVEL_DEBUG, "WebAssembly loader initialized correctly");
 
@@ -177,7 +206,14 @@ loader_handle wasm_loader_impl_load_from_memory(loader_impl impl, const loader_n
 		}
 	}
 
-	if (wasm_loader_handle_add_module(handle, name, wasm_impl->store, &binary) != 0)
+	wasm_module_t *module = compile_module(wasm_impl, &binary);
+
+	if (module == NULL)
+	{
+		goto error_load_module;
+	}
+
+	if (wasm_loader_handle_add_module(handle, name, wasm_impl->store, module) != 0)
 	{
 		goto error_load_module;
 	}
@@ -257,6 +293,7 @@ static int initialize_types(loader_impl impl)
 		{ TYPE_FLOAT, "f32" },
 		{ TYPE_DOUBLE, "f64" },
 		{ TYPE_ARRAY, "array" },
+		{ TYPE_BUFFER, "buffer" },
 	};
 
 	const size_t size = COUNT_OF(type_names);
@@ -280,6 +317,108 @@ static int initialize_types(loader_impl impl)
 	return 0;
 }
 
+static wasm_engine_t *create_engine(configuration config)
+{
+	wasm_config_t *engine_config = wasm_config_new();
+
+	if (engine_config == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "WebAssembly loader: Failed to create engine configuration");
+		return NULL;
+	}
+
+#ifdef WASMTIME
+	if (config != NULL)
+	{
+		static struct
+		{
+			const char *name;
+			wasmtime_opt_level_t level;
+		} opt_levels[] = {
+			{ "none", WASMTIME_OPT_LEVEL_NONE },
+			{ "speed", WASMTIME_OPT_LEVEL_SPEED },
+			{ "speed_and_size", WASMTIME_OPT_LEVEL_SPEED_AND_SIZE },
+		};
+
+		value opt_level = configuration_value(config, "opt_level");
+
+		if (opt_level != NULL && value_type_id(opt_level) == TYPE_STRING)
+		{
+			const char *opt_level_name = value_to_string(opt_level);
+			size_t i;
+
+			for (i = 0; i < COUNT_OF(opt_levels); i++)
+			{
+				if (strcmp(opt_levels[i].name, opt_level_name) == 0)
+				{
+					wasmtime_config_cranelift_opt_level_set(engine_config, opt_levels[i].level);
+					break;
+				}
+			}
+
+			if (i == COUNT_OF(opt_levels))
+			{
+				log_write("metacall", LOG_LEVEL_WARNING, "WebAssembly loader: Unknown optimization level \"%s\", using the default one", opt_level_name);
+			}
+		}
+	}
+#else
+	(void)config;
+#endif
+
+	// The engine takes ownership of the configuration
+	return wasm_engine_new_with_config(engine_config);
+}
+
+static void cache_hash(uint64_t *hash, const void *data, size_t size)
+{
+	// FNV-1a
+	for (size_t i = 0; i < size; i++)
+	{
+		*hash ^= ((const uint8_t *)data)[i];
+		*hash *= 0x100000001b3ULL;
+	}
+}
+
+static void cache_hash_str(uint64_t *hash, const char *str)
+{
+	// Include the null terminator so concatenated strings do not collide
+	cache_hash(hash, str, strlen(str) + 1);
+}
+
+static void initialize_cache(loader_impl_wasm impl, configuration config)
+{
+	impl->cache_path[0] = '\0';
+	impl->cache_key = 0xcbf29ce484222325ULL;
+
+	if (config == NULL)
+	{
+		return;
+	}
+
+	value cache_path = configuration_value(config, "cache_path");
+
+	if (cache_path != NULL && value_type_id(cache_path) == TYPE_STRING)
+	{
+		value opt_level = configuration_value(config, "opt_level");
+		const char *opt_level_name = (opt_level != NULL && value_type_id(opt_level) == TYPE_STRING) ? value_to_string(opt_level) : "";
+		uint8_t version = CACHE_VERSION, pointer_size = (uint8_t)sizeof(void *);
+
+		strncpy(impl->cache_path, value_to_string(cache_path), LOADER_PATH_SIZE - 1);
+		impl->cache_path[LOADER_PATH_SIZE - 1] = '\0';
+
+		// The key covers everything that changes the compiled code apart from the module itself,
+		// so a module compiled by another runtime or engine configuration is never looked up
+		cache_hash_str(&impl->cache_key, CACHE_MAGIC);
+		cache_hash(&impl->cache_key, &version, sizeof(version));
+		cache_hash(&impl->cache_key, &pointer_size, sizeof(pointer_size));
+		cache_hash_str(&impl->cache_key, WASM_LOADER_RUNTIME_VERSION);
+		cache_hash_str(&impl->cache_key, opt_level_name);
+
+		log_write("metacall", LOG_LEVEL_DEBUG, "WebAssembly loader: Caching compiled modules in %s", impl->cache_path);
+	}
+}
+
 static FILE *open_file_absolute(const loader_path path, size_t *file_size)
 {
 	FILE *file = fopen(path, "rb");
@@ -406,6 +545,182 @@ static int try_wat2wasm(const char *buffer, size_t size, wasm_byte_vec_t *binary
 #endif
 }
 
+static int is_precompiled_module(const loader_path path)
+{
+	static const char PRECOMPILED_EXTENSION[] = "cwasm";
+
+	loader_tag extension;
+	(void)portability_path_get_extension(path, strnlen(path, LOADER_PATH_SIZE) + 1, extension, LOADER_TAG_SIZE);
+
+	return strcmp(extension, PRECOMPILED_EXTENSION) == 0;
+}
+
+static char *read_cache_file(const char *cache_file, uint64_t key, size_t *size)
+{
+	size_t file_size;
+	FILE *file = open_file_absolute(cache_file, &file_size);
+
+	if (file == NULL)
+	{
+		return NULL;
+	}
+
+	cache_header header;
+	char *buffer = NULL;
+
+	// The file is only accepted if it was written for this key and its contents are complete and unmodified,
+	// the checksum detects truncated or corrupted files but it does not protect against a malicious writer
+	if (file_size < sizeof(cache_header) || fread(&header, sizeof(cache_header), 1, file) != 1 ||
+		memcmp(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0 || header.version != CACHE_VERSION ||
+		header.key != key || header.size != file_size - sizeof(cache_header))
+	{
+		goto error_header;
+	}
+
+	*size = (size_t)header.size;
+	buffer = malloc(*size);
+
+	if (buffer == NULL || fread(buffer, 1, *size, file) != *size)
+	{
+		goto error_read;
+	}
+
+	uint64_t checksum = 0xcbf29ce484222325ULL;
+	cache_hash(&checksum, buffer, *size);
+
+	if (checksum != header.checksum)
+	{
+		goto error_read;
+	}
+
+	fclose(file);
+	return buffer;
+
+error_read:
+	free(buffer);
+error_header:
+	log_write("metacall", LOG_LEVEL_DEBUG, "WebAssembly loader: Discarding invalid cache file %s", cache_file);
+	fclose(file);
+	return NULL;
+}
+
+static void write_cache_file(loader_impl_wasm impl, const char *cache_file, uint64_t key, const wasm_byte_vec_t *serialized)
+{
+	cache_header header;
+
+	memset(&header, 0, sizeof(cache_header));
+	memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+	header.version = CACHE_VERSION;
+	header.key = key;
+	header.size = serialized->size;
+	header.checksum = 0xcbf29ce484222325ULL;
+	cache_hash(&header.checksum, serialized->data, serialized->size);
+
+	// Write into a temporary file owned by this loader and move it afterwards, so other
+	// loaders or processes sharing the same cache never read a partially written module
+	loader_path temp_file;
+	snprintf(temp_file, LOADER_PATH_SIZE, "%s.%" PRIxPTR ".tmp", cache_file, (uintptr_t)impl);
+
+	FILE *file = fopen(temp_file, "wb");
+
+	if (file == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_WARNING, "WebAssembly loader: Failed to create cache file %s", temp_file);
+		return;
+	}
+
+	int result = fwrite(&header, sizeof(cache_header), 1, file) != 1 ||
+				 fwrite(serialized->data, 1, serialized->size, file) != serialized->size;
+
+	if (fclose(file) != 0 || result != 0 || rename(temp_file, cache_file) != 0)
+	{
+		log_write("metacall", LOG_LEVEL_WARNING, "WebAssembly loader: Failed to write cache file %s", cache_file);
+		(void)remove(temp_file);
+	}
+}
+
+static wasm_module_t *compile_module(loader_impl_wasm impl, const wasm_byte_vec_t *binary)
+{
+	if (impl->cache_path[0] == '\0')
+	{
+		wasm_module_t *module = wasm_module_new(impl->store, binary);
+
+		if (module == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "WebAssembly loader: Failed to create module");
+		}
+
+		return module;
+	}
+
+	// Compiled modules are stored by the hash of the engine configuration and their binary
+	uint64_t key = impl->cache_key;
+	cache_hash(&key, binary->data, binary->size);
+
+	loader_name cache_name;
+	snprintf(cache_name, LOADER_NAME_SIZE, "%016" PRIx64 "-%" PRIuS ".cwasm", key, binary->size);
+
+	loader_path cache_file;
+	(void)portability_path_join(impl->cache_path, strnlen(impl->cache_path, LOADER_PATH_SIZE) + 1, cache_name, strnlen(cache_name, LOADER_NAME_SIZE) + 1, cache_file, LOADER_PATH_SIZE);
+
+	size_t size;
+	char *buffer = read_cache_file(cache_file, key, &size);
+
+	if (buffer != NULL)
+	{
+		wasm_byte_vec_t serialized;
+		wasm_byte_vec_new(&serialized, size, buffer);
+		free(buffer);
+
+		// Deserialization still fails if the runtime rejects the module for any other
+		// reason, in that case it is compiled again and overwritten
+		wasm_module_t *module = wasm_module_deserialize(impl->store, &serialized);
+		wasm_byte_vec_delete(&serialized);
+
+		if (module != NULL)
+		{
+			log_write("metacall", LOG_LEVEL_DEBUG, "WebAssembly loader: Loaded compiled module from cache file %s", cache_file);
+			return module;
+		}
+
+		log_write("metacall", LOG_LEVEL_DEBUG, "WebAssembly loader: Discarding incompatible cache file %s", cache_file);
+	}
+
+	wasm_module_t *module = wasm_module_new(impl->store, binary);
+
+	if (module == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "WebAssembly loader: Failed to create module");
+		return NULL;
+	}
+
+	wasm_byte_vec_t serialized;
+	wasm_byte_vec_new_empty(&serialized);
+	wasm_module_serialize(module, &serialized);
+
+	if (serialized.size > 0)
+	{
+		write_cache_file(impl, cache_file, key, &serialized);
+	}
+
+	wasm_byte_vec_delete(&serialized);
+
+	return module;
+}
+
+static wasm_module_t *deserialize_module(loader_impl_wasm impl, const wasm_byte_vec_t *serialized)
+{
+	// Precompiled modules contain native code, so they must come from a trusted source
+	wasm_module_t *module = wasm_module_deserialize(impl->store, serialized);
+
+	if (module == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "WebAssembly loader: Failed to deserialize precompiled module, it may have been compiled by another runtime version or configuration");
+	}
+
+	return module;
+}
+
 static int load_module_from_package(loader_impl impl, loader_impl_wasm_handle handle, const loader_path path)
 {
 	int ret = 1;
@@ -425,7 +740,14 @@ static int load_module_from_package(loader_impl impl, loader_impl_wasm_handle ha
 	portability_path_get_name(path, strnlen(path, LOADER_PATH_SIZE) + 1, module_name, LOADER_NAME_SIZE);
 
 	loader_impl_wasm wasm_impl = loader_impl_get(impl);
-	if (wasm_loader_handle_add_module(handle, module_name, wasm_impl->store, &binary) != 0)
+	wasm_module_t *module = is_precompiled_module(path) ? deserialize_module(wasm_impl, &binary) : compile_module(wasm_impl, &binary);
+
+	if (module == NULL)
+	{
+		goto error_add_module;
+	}
+
+	if (wasm_loader_handle_add_module(handle, module_name, wasm_impl->store, module) != 0)
 	{
 		goto error_add_module;
 	}
@@ -443,6 +765,12 @@ static int load_module_from_file(loader_impl impl, loader_impl_wasm_handle handl
 {
 	static const loader_tag TEXT_EXTENSION = "wat";
 
+	// Precompiled modules do not need any conversion, so load them as packages
+	if (is_precompiled_module(path))
+	{
+		return load_module_from_package(impl, handle, path);
+	}
+
 	int ret = 1;
 
 	size_t size;
@@ -463,7 +791,14 @@ static int load_module_from_file(loader_impl impl, loader_impl_wasm_handle handl
 	(void)portability_path_get_module_name(path, strnlen(path, LOADER_PATH_SIZE) + 1, TEXT_EXTENSION, sizeof(TEXT_EXTENSION), module_name, LOADER_NAME_SIZE);
 
 	loader_impl_wasm wasm_impl = loader_impl_get(impl);
-	if (wasm_loader_handle_add_module(handle, module_name, wasm_impl->store, &binary) != 0)
+	wasm_module_t *module = compile_module(wasm_impl, &binary);
+
+	if (module == NULL)
+	{
+		goto error_add_module;
+	}
+
+	if (wasm_loader_handle_add_module(handle, module_name, wasm_impl->store, module) != 0)
 	{
 		goto error_add_module;
 	}
@@ -31,7 +31,7 @@ typedef struct log_aspect_schedule_impl_type *log_aspect_schedule_impl;
 
 typedef int (*log_aspect_schedule_execute_cb)(log_policy, log_aspect_schedule_data);
 
-typedef int (*log_aspect_schedule_execute)(log_aspect, log_aspect_schedule_execute_cb, log_aspect_schedule_data);
+typedef int (*log_aspect_schedule_execute)(log_aspect, log_aspect_schedule_execute_cb, log_aspect_schedule_data, size_t);
 
 /* -- Member Data -- */
 
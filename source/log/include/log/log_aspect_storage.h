@@ -28,7 +28,7 @@ struct log_aspect_storage_impl_type;
 
 typedef struct log_aspect_storage_impl_type *log_aspect_storage_impl;
 
-typedef int (*log_aspect_storage_append)(log_aspect, const log_record);
+typedef int (*log_aspect_storage_append)(log_aspect, const enum log_level_id, const void *, const size_t);
 typedef int (*log_aspect_storage_flush)(log_aspect);
 
 /* -- Member Data -- */
@@ -30,6 +30,7 @@ struct log_aspect_stream_impl_type;
 typedef struct log_aspect_stream_impl_type *log_aspect_stream_impl;
 
 typedef int (*log_aspect_stream_write)(log_aspect, const log_record_ctor);
+typedef int (*log_aspect_stream_output)(log_aspect, const void *, const size_t);
 typedef int (*log_aspect_stream_flush)(log_aspect);
 
 /* -- Member Data -- */
@@ -37,6 +38,7 @@ typedef int (*log_aspect_stream_flush)(log_aspect);
 struct log_aspect_stream_impl_type
 {
 	log_aspect_stream_write write;
+	log_aspect_stream_output output;
 	log_aspect_stream_flush flush;
 };
 
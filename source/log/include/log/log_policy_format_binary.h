@@ -19,6 +19,26 @@
 extern "C" {
 #endif
 
+/* -- Definitions -- */
+
+/*
+* Binary record layout, all integers are stored in big endian:
+*	[0]  uint8_t  version
+*	[1]  uint8_t  level
+*	[2]  uint16_t reserved
+*	[4]  uint32_t function length
+*	[8]  uint32_t file length
+*	[12] uint32_t message length
+*	[16] uint64_t time (seconds since epoch)
+*	[24] uint64_t thread id
+*	[32] uint64_t line
+*	[40] function, file and message, each one followed by a null character
+*
+* As with the text format, the streams do not write the last null character
+*/
+#define LOG_POLICY_FORMAT_BINARY_VERSION	 0x01
+#define LOG_POLICY_FORMAT_BINARY_HEADER_SIZE 0x28
+
 /* -- Methods -- */
 
 LOG_API log_policy_interface log_policy_format_binary_interface(void);
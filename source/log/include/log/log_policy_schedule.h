@@ -29,6 +29,15 @@ enum log_policy_schedule_id
 	LOG_POLICY_SCHEDULE_SIZE
 };
 
+enum log_policy_schedule_async_overflow_id
+{
+	LOG_POLICY_SCHEDULE_ASYNC_OVERFLOW_DROP = 0x00,
+	LOG_POLICY_SCHEDULE_ASYNC_OVERFLOW_BLOCK = 0x01,
+	LOG_POLICY_SCHEDULE_ASYNC_OVERFLOW_COUNT = 0x02,
+
+	LOG_POLICY_SCHEDULE_ASYNC_OVERFLOW_SIZE
+};
+
 /* -- Forward Declarations -- */
 
 struct log_policy_schedule_impl_type;
@@ -42,7 +51,7 @@ typedef struct log_policy_schedule_impl_type *log_policy_schedule_impl;
 typedef int (*log_policy_schedule_execute_cb)(log_policy, log_policy_schedule_data);
 
 typedef int (*log_policy_schedule_lock)(log_policy);
-typedef int (*log_policy_schedule_execute)(log_policy, log_policy_schedule_execute_cb, log_policy_schedule_data);
+typedef int (*log_policy_schedule_execute)(log_policy, log_policy_schedule_execute_cb, log_policy_schedule_data, size_t);
 typedef int (*log_policy_schedule_unlock)(log_policy);
 
 /* -- Member Data -- */
@@ -60,6 +69,10 @@ LOG_API log_policy_interface log_policy_schedule(const log_policy_id policy_sche
 
 LOG_API log_policy log_policy_schedule_async(void);
 
+LOG_API log_policy log_policy_schedule_async_queue(size_t capacity, enum log_policy_schedule_async_overflow_id overflow);
+
+LOG_API size_t log_policy_schedule_async_dropped(log_policy policy);
+
 LOG_API log_policy log_policy_schedule_sync(void);
 
 #ifdef __cplusplus
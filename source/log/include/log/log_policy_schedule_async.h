@@ -14,15 +14,39 @@
 #include <log/log_api.h>
 
 #include <log/log_policy.h>
+#include <log/log_policy_schedule.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/* -- Forward Declarations -- */
+
+struct log_policy_schedule_async_ctor_type;
+
+/* -- Type Definitions -- */
+
+typedef struct log_policy_schedule_async_ctor_type *log_policy_schedule_async_ctor;
+
+/* -- Member Data -- */
+
+/*
+* The capacity is the number of records that can be queued before the
+* writer thread drains them, it is rounded up to a power of two (zero uses
+* the default), the overflow defines what happens to a record when it is full
+*/
+struct log_policy_schedule_async_ctor_type
+{
+	size_t capacity;
+	enum log_policy_schedule_async_overflow_id overflow;
+};
+
 /* -- Methods -- */
 
 LOG_API log_policy_interface log_policy_schedule_async_interface(void);
 
+LOG_API size_t log_policy_schedule_async_dropped_count(log_policy policy);
+
 #ifdef __cplusplus
 }
 #endif
@@ -38,7 +38,7 @@ struct log_policy_storage_impl_type;
 
 typedef struct log_policy_storage_impl_type *log_policy_storage_impl;
 
-typedef int (*log_policy_storage_append)(log_policy, const log_record);
+typedef int (*log_policy_storage_append)(log_policy, const enum log_level_id, const void *, const size_t);
 typedef int (*log_policy_storage_flush)(log_policy);
 
 /* -- Member Data -- */
@@ -55,8 +55,12 @@ LOG_API log_policy_interface log_policy_storage(const log_policy_id policy_stora
 
 LOG_API log_policy log_policy_storage_batch(size_t size);
 
+LOG_API log_policy log_policy_storage_batch_threshold(size_t size, enum log_level_id level, unsigned int interval);
+
 LOG_API log_policy log_policy_storage_sequential(void);
 
+LOG_NO_EXPORT int log_policy_storage_output(log_policy policy, const void *buffer, const size_t size);
+
 #ifdef __cplusplus
 }
 #endif
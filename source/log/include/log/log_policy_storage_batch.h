@@ -29,9 +29,18 @@ typedef struct log_policy_storage_batch_ctor_type *log_policy_storage_batch_ctor
 
 /* -- Member Data -- */
 
+/*
+* Records are accumulated until the buffer of the given size is full, a record
+* with a level equal or greater than the level threshold arrives, or the interval
+* (in milliseconds) since the last flush expires, then they are written at once,
+* a non zero interval starts a timer thread so idle batches are flushed too,
+* a zero interval disables it
+*/
 struct log_policy_storage_batch_ctor_type
 {
 	size_t size;
+	enum log_level_id level;
+	unsigned int interval;
 };
 
 /* -- Methods -- */
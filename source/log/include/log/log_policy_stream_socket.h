@@ -23,6 +23,16 @@ extern "C" {
 
 #include <stdint.h>
 
+/* -- Definitions -- */
+
+enum log_policy_stream_socket_protocol_id
+{
+	LOG_POLICY_STREAM_SOCKET_UDP = 0x00,
+	LOG_POLICY_STREAM_SOCKET_TCP = 0x01,
+
+	LOG_POLICY_STREAM_SOCKET_PROTOCOL_SIZE
+};
+
 /* -- Forward Declarations -- */
 
 struct log_policy_stream_socket_ctor_type;
@@ -33,10 +43,16 @@ typedef struct log_policy_stream_socket_ctor_type *log_policy_stream_socket_ctor
 
 /* -- Member Data -- */
 
+/*
+* With UDP each record is sent as a datagram, with TCP each record is sent as a frame
+* prefixed by its length (uint32_t in big endian), in both cases sends do not block,
+* records that cannot be sent are retained and retried in the next write or flush
+*/
 struct log_policy_stream_socket_ctor_type
 {
 	const char *ip;
 	uint16_t port;
+	enum log_policy_stream_socket_protocol_id protocol;
 };
 
 /* -- Methods -- */
@@ -25,6 +25,7 @@ struct log_aspect_schedule_notify_data_type
 {
 	log_aspect_schedule_execute_cb callback;
 	log_aspect_schedule_data data;
+	size_t size;
 };
 
 /* -- Private Methods -- */
@@ -33,7 +34,7 @@ static log_aspect_data log_aspect_schedule_create(log_aspect aspect, const log_a
 
 static int log_aspect_schedule_impl_execute_cb(log_aspect aspect, log_policy policy, log_aspect_notify_data notify_data);
 
-static int log_aspect_schedule_impl_execute(log_aspect aspect, log_aspect_schedule_execute_cb callback, log_aspect_schedule_data data);
+static int log_aspect_schedule_impl_execute(log_aspect aspect, log_aspect_schedule_execute_cb callback, log_aspect_schedule_data data, size_t size);
 
 static int log_aspect_schedule_destroy(log_aspect aspect);
 
@@ -71,15 +72,16 @@ static int log_aspect_schedule_impl_execute_cb(log_aspect aspect, log_policy pol
 
 	(void)aspect;
 
-	return schedule_impl->execute(policy, args->callback, args->data);
+	return schedule_impl->execute(policy, args->callback, args->data, args->size);
 }
 
-static int log_aspect_schedule_impl_execute(log_aspect aspect, log_aspect_schedule_execute_cb callback, log_aspect_schedule_data data)
+static int log_aspect_schedule_impl_execute(log_aspect aspect, log_aspect_schedule_execute_cb callback, log_aspect_schedule_data data, size_t size)
 {
 	struct log_aspect_schedule_notify_data_type notify_data;
 
 	notify_data.callback = callback;
 	notify_data.data = data;
+	notify_data.size = size;
 
 	return log_aspect_notify_first(aspect, &log_aspect_schedule_impl_execute_cb, &notify_data);
 }
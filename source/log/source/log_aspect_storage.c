@@ -15,7 +15,9 @@
 
 struct log_aspect_storage_append_type
 {
-	log_record record;
+	enum log_level_id level;
+	const void *buffer;
+	size_t size;
 };
 
 /* -- Private Methods -- */
@@ -24,7 +26,7 @@ static log_aspect_data log_aspect_storage_create(log_aspect aspect, const log_as
 
 static int log_aspect_storage_impl_append_cb(log_aspect aspect, log_policy policy, log_aspect_notify_data notify_data);
 
-static int log_aspect_storage_impl_append(log_aspect aspect, const log_record record);
+static int log_aspect_storage_impl_append(log_aspect aspect, const enum log_level_id level, const void *buffer, const size_t size);
 
 static int log_aspect_storage_impl_flush_cb(log_aspect aspect, log_policy policy, log_aspect_notify_data notify_data);
 
@@ -67,14 +69,16 @@ static int log_aspect_storage_impl_append_cb(log_aspect aspect, log_policy polic
 
 	(void)aspect;
 
-	return storage_impl->append(policy, append_args->record);
+	return storage_impl->append(policy, append_args->level, append_args->buffer, append_args->size);
 }
 
-static int log_aspect_storage_impl_append(log_aspect aspect, const log_record record)
+static int log_aspect_storage_impl_append(log_aspect aspect, const enum log_level_id level, const void *buffer, const size_t size)
 {
 	struct log_aspect_storage_append_type notify_data;
 
-	notify_data.record = record;
+	notify_data.level = level;
+	notify_data.buffer = buffer;
+	notify_data.size = size;
 
 	return log_aspect_notify_all(aspect, &log_aspect_storage_impl_append_cb, (log_aspect_notify_data)&notify_data);
 }
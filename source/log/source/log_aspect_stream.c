@@ -17,9 +17,15 @@
 #include <log/log_aspect_format.h>
 #include <log/log_policy_format.h>
 
+#include <log/log_aspect_storage.h>
+
 #include <log/log_impl.h>
 #include <log/log_record.h>
 
+/* -- Definitions -- */
+
+#define LOG_ASPECT_STREAM_BUFFER_SIZE 0x0200
+
 /* -- Forward Declarations -- */
 
 struct log_aspect_stream_execute_cb_data_type;
@@ -36,15 +42,20 @@ typedef struct log_aspect_stream_write_cb_data_type *log_aspect_stream_write_cb_
 
 struct log_aspect_stream_write_cb_data_type
 {
-	log_impl impl;
-	log_record record;
+	const void *buffer;
+	size_t size;
 };
 
+/*
+* The record is serialized in the caller thread and the resulting text is stored
+* right after this header, so the schedule policy can copy the whole block and
+* run the stream write later (or in another thread) without touching the record
+*/
 struct log_aspect_stream_execute_cb_data_type
 {
-	log_impl impl;
 	log_aspect aspect;
-	log_record_ctor record_ctor;
+	enum log_level_id level;
+	size_t size;
 };
 
 /* -- Private Methods -- */
@@ -55,6 +66,18 @@ static int log_aspect_stream_impl_write_cb(log_aspect aspect, log_policy policy,
 
 static int log_aspect_stream_impl_write(log_aspect aspect, const log_record_ctor record_ctor);
 
+static int log_aspect_stream_impl_output(log_aspect aspect, const void *buffer, const size_t size);
+
+static int log_aspect_stream_impl_output(log_aspect aspect, const void *buffer, const size_t size)
+{
+	struct log_aspect_stream_write_cb_data_type write_data;
+
+	write_data.buffer = buffer;
+	write_data.size = size;
+
+	return log_aspect_notify_all(aspect, &log_aspect_stream_impl_write_cb, (log_aspect_notify_data)&write_data);
+}
+
 static int log_aspect_stream_impl_flush_cb(log_aspect aspect, log_policy policy, log_aspect_notify_data notify_data);
 
 static int log_aspect_stream_impl_flush(log_aspect aspect);
@@ -67,6 +90,7 @@ log_aspect_interface log_aspect_stream_interface(void)
 {
 	static struct log_aspect_stream_impl_type log_aspect_stream_impl_obj = {
 		&log_aspect_stream_impl_write,
+		&log_aspect_stream_impl_output,
 		&log_aspect_stream_impl_flush
 	};
 
@@ -94,114 +118,104 @@ static int log_aspect_stream_impl_write_cb(log_aspect aspect, log_policy policy,
 
 	log_policy_stream_impl stream_impl = log_policy_derived(policy);
 
-	log_aspect format = log_impl_aspect(write_args->impl, LOG_ASPECT_FORMAT);
-
-	log_aspect_format_impl format_impl = log_aspect_derived(format);
-
-	size_t size = format_impl->size(format, write_args->record);
-
 	(void)aspect;
 
-	if (size == 0)
+	if (stream_impl->write(policy, write_args->buffer, write_args->size) != 0)
 	{
 		return 1;
 	}
 
-	/* TODO: remove this, use storage policy instead */
-	{
-		void *buffer = malloc(size);
-
-		int result = 1;
-
-		if (buffer == NULL)
-		{
-			return 1;
-		}
+	return stream_impl->flush(policy);
+}
 
-		if (format_impl->serialize(format, write_args->record, buffer, size) != 0)
-		{
-			free(buffer);
+static int log_aspect_stream_impl_write_execute_cb(log_policy policy, log_aspect_schedule_data data)
+{
+	log_aspect_stream_execute_cb_data execute_data = data;
 
-			return 1;
-		}
+	log_aspect storage = log_impl_aspect(log_aspect_parent(execute_data->aspect), LOG_ASPECT_STORAGE);
 
-		if (stream_impl->write(policy, buffer, size) == 0)
-		{
-			result = stream_impl->flush(policy);
-		}
+	(void)policy;
 
-		free(buffer);
+	/* The storage decides when the record reaches the streams, without it the record is written immediately */
+	if (storage != NULL)
+	{
+		log_aspect_storage_impl storage_impl = log_aspect_derived(storage);
 
-		return result;
+		return storage_impl->append(storage, execute_data->level, (const void *)&execute_data[1], execute_data->size);
 	}
+
+	return log_aspect_stream_impl_output(execute_data->aspect, (const void *)&execute_data[1], execute_data->size);
 }
 
-static int log_aspect_stream_impl_write_execute_cb(log_policy policy, log_aspect_schedule_data data)
+static int log_aspect_stream_impl_write(log_aspect aspect, const log_record_ctor record_ctor)
 {
-	log_aspect_stream_execute_cb_data execute_data = data;
-
-	log_policy_schedule_impl schedule_impl = log_policy_derived(policy);
+	log_impl impl = log_aspect_parent(aspect);
 
-	log_handle handle = log_impl_handle(execute_data->impl);
+	log_aspect schedule = log_impl_aspect(impl, LOG_ASPECT_SCHEDULE);
 
-	log_record record;
+	log_aspect_schedule_impl schedule_impl = log_aspect_derived(schedule);
 
-	int result;
+	log_aspect format = log_impl_aspect(impl, LOG_ASPECT_FORMAT);
 
-	struct log_aspect_stream_write_cb_data_type write_data;
+	log_aspect_format_impl format_impl = log_aspect_derived(format);
 
-	if (schedule_impl->lock(policy) != 0)
+	union
 	{
-		return 1;
-	}
+		struct log_aspect_stream_execute_cb_data_type header;
+		unsigned char bytes[LOG_ASPECT_STREAM_BUFFER_SIZE];
+	} stack_data;
 
-	record = log_handle_push(handle, execute_data->record_ctor);
+	log_aspect_stream_execute_cb_data data = &stack_data.header;
 
-	if (schedule_impl->unlock(policy) != 0)
-	{
-		return 1;
-	}
+	log_record record = log_record_create(record_ctor);
 
-	if (record == NULL)
-	{
-		return 1;
-	}
-
-	write_data.impl = execute_data->impl;
-	write_data.record = record;
+	size_t size, data_size;
 
-	result = log_aspect_notify_all(execute_data->aspect, &log_aspect_stream_impl_write_cb, (log_aspect_notify_data)&write_data);
+	int result = 1;
 
-	if (schedule_impl->lock(policy) != 0)
+	if (record == NULL)
 	{
 		return 1;
 	}
 
-	log_handle_pop(handle);
+	size = format_impl->size(format, record);
 
-	if (schedule_impl->unlock(policy) != 0)
+	if (size == 0)
 	{
-		return 1;
+		goto record_error;
 	}
 
-	return result;
-}
+	data_size = sizeof(struct log_aspect_stream_execute_cb_data_type) + size;
 
-static int log_aspect_stream_impl_write(log_aspect aspect, const log_record_ctor record_ctor)
-{
-	log_impl impl = log_aspect_parent(aspect);
+	if (data_size > sizeof(stack_data))
+	{
+		data = malloc(data_size);
 
-	log_aspect schedule = log_impl_aspect(impl, LOG_ASPECT_SCHEDULE);
+		if (data == NULL)
+		{
+			goto record_error;
+		}
+	}
 
-	log_aspect_schedule_impl schedule_impl = log_aspect_derived(schedule);
+	if (format_impl->serialize(format, record, (void *)&data[1], size) != 0)
+	{
+		goto serialize_error;
+	}
 
-	struct log_aspect_stream_execute_cb_data_type data;
+	data->aspect = aspect;
+	data->level = record_ctor->level;
+	data->size = size;
 
-	data.impl = impl;
-	data.aspect = aspect;
-	data.record_ctor = record_ctor;
+	result = schedule_impl->execute(schedule, &log_aspect_stream_impl_write_execute_cb, (log_aspect_schedule_data)data, data_size);
 
-	return schedule_impl->execute(schedule, &log_aspect_stream_impl_write_execute_cb, (log_aspect_schedule_data)&data);
+serialize_error:
+	if (data != &stack_data.header)
+	{
+		free(data);
+	}
+record_error:
+	log_record_destroy(record);
+	return result;
 }
 
 static int log_aspect_stream_impl_flush_cb(log_aspect aspect, log_policy policy, log_aspect_notify_data notify_data)
@@ -216,7 +230,19 @@ static int log_aspect_stream_impl_flush_cb(log_aspect aspect, log_policy policy,
 
 static int log_aspect_stream_impl_flush(log_aspect aspect)
 {
-	return log_aspect_notify_all(aspect, &log_aspect_stream_impl_flush_cb, NULL);
+	log_aspect storage = log_impl_aspect(log_aspect_parent(aspect), LOG_ASPECT_STORAGE);
+
+	int result = 0;
+
+	/* Move the records retained by the storage into the streams before flushing them */
+	if (storage != NULL)
+	{
+		log_aspect_storage_impl storage_impl = log_aspect_derived(storage);
+
+		result = storage_impl->flush(storage);
+	}
+
+	return result | log_aspect_notify_all(aspect, &log_aspect_stream_impl_flush_cb, NULL);
 }
 
 static int log_aspect_stream_destroy(log_aspect aspect)
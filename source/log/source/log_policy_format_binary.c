@@ -11,6 +11,23 @@
 #include <log/log_policy_format.h>
 #include <log/log_policy_format_binary.h>
 
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/* -- Macros -- */
+
+#ifndef va_copy
+	#if defined(__va_copy)
+		#define va_copy(dest, src) __va_copy((dest), (src))
+	#elif defined(__builtin_va_copy)
+		#define va_copy(dest, src) __builtin_va_copy((dest), (src))
+	#else
+		#define va_copy(dest, src) ((void)memcpy(&(dest), &(src), sizeof(va_list)))
+	#endif
+#endif
+
 /* -- Forward Declarations -- */
 
 struct log_policy_format_binary_data_type;
@@ -30,6 +47,10 @@ struct log_policy_format_binary_data_type
 
 static int log_policy_format_binary_create(log_policy policy, const log_policy_ctor ctor);
 
+static size_t log_policy_format_binary_message_length(const log_record record);
+
+static unsigned char *log_policy_format_binary_write_integer(unsigned char *buffer, uint64_t value, size_t bytes);
+
 static size_t log_policy_format_binary_size(log_policy policy, const log_record record);
 
 static size_t log_policy_format_binary_serialize(log_policy policy, const log_record record, void *buffer, const size_t size);
@@ -73,27 +94,97 @@ static int log_policy_format_binary_create(log_policy policy, const log_policy_c
 	return 0;
 }
 
-static size_t log_policy_format_binary_size(log_policy policy, const log_record record)
+static size_t log_policy_format_binary_message_length(const log_record record)
 {
-	const size_t mock_binary_size = 1;
+	struct log_record_va_list_type *variable_args = log_record_variable_args(record);
+
+	if (variable_args != NULL)
+	{
+		va_list args_copy;
+
+		int length;
+
+		va_copy(args_copy, variable_args->data);
+
+		length = vsnprintf(NULL, 0, log_record_message(record), args_copy);
+
+		va_end(args_copy);
+
+		return length < 0 ? 0 : (size_t)length;
+	}
+
+	return strlen(log_record_message(record));
+}
+
+static unsigned char *log_policy_format_binary_write_integer(unsigned char *buffer, uint64_t value, size_t bytes)
+{
+	size_t iterator;
+
+	for (iterator = 0; iterator < bytes; ++iterator)
+	{
+		buffer[iterator] = (unsigned char)(value >> ((bytes - iterator - 1) * 8));
+	}
+
+	return &buffer[bytes];
+}
 
+static size_t log_policy_format_binary_size(log_policy policy, const log_record record)
+{
 	(void)policy;
-	(void)record;
 
-	/* TODO: implement properly this */
-	return mock_binary_size;
+	return LOG_POLICY_FORMAT_BINARY_HEADER_SIZE +
+		   strlen(log_record_func(record)) + 1 +
+		   strlen(log_record_file(record)) + 1 +
+		   log_policy_format_binary_message_length(record) + 1;
 }
 
 static size_t log_policy_format_binary_serialize(log_policy policy, const log_record record, void *buffer, const size_t size)
 {
-	log_policy_format_binary_data binary_data = log_policy_instance(policy);
+	const char *func = log_record_func(record);
+	const char *file = log_record_file(record);
+	size_t func_length = strlen(func);
+	size_t file_length = strlen(file);
+	size_t message_length = log_policy_format_binary_message_length(record);
+	struct log_record_va_list_type *variable_args = log_record_variable_args(record);
+	unsigned char *iterator = buffer;
 
-	(void)binary_data;
-	(void)record;
-	(void)size;
+	(void)policy;
+
+	if (size != LOG_POLICY_FORMAT_BINARY_HEADER_SIZE + func_length + file_length + message_length + 3)
+	{
+		return 0;
+	}
 
-	/* TODO: implement properly this */
-	*((char *)buffer) = '\0';
+	iterator = log_policy_format_binary_write_integer(iterator, LOG_POLICY_FORMAT_BINARY_VERSION, sizeof(uint8_t));
+	iterator = log_policy_format_binary_write_integer(iterator, (uint64_t)log_record_level(record), sizeof(uint8_t));
+	iterator = log_policy_format_binary_write_integer(iterator, 0, sizeof(uint16_t));
+	iterator = log_policy_format_binary_write_integer(iterator, (uint64_t)func_length, sizeof(uint32_t));
+	iterator = log_policy_format_binary_write_integer(iterator, (uint64_t)file_length, sizeof(uint32_t));
+	iterator = log_policy_format_binary_write_integer(iterator, (uint64_t)message_length, sizeof(uint32_t));
+	iterator = log_policy_format_binary_write_integer(iterator, (uint64_t)*log_record_time(record), sizeof(uint64_t));
+	iterator = log_policy_format_binary_write_integer(iterator, log_record_thread_id(record), sizeof(uint64_t));
+	iterator = log_policy_format_binary_write_integer(iterator, (uint64_t)log_record_line(record), sizeof(uint64_t));
+
+	memcpy(iterator, func, func_length + 1);
+	iterator += func_length + 1;
+
+	memcpy(iterator, file, file_length + 1);
+	iterator += file_length + 1;
+
+	if (variable_args != NULL)
+	{
+		va_list args_copy;
+
+		va_copy(args_copy, variable_args->data);
+
+		vsnprintf((char *)iterator, message_length + 1, log_record_message(record), args_copy);
+
+		va_end(args_copy);
+	}
+	else
+	{
+		memcpy(iterator, log_record_message(record), message_length + 1);
+	}
 
 	return size;
 }
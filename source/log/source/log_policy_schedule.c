@@ -29,6 +29,21 @@ log_policy log_policy_schedule_async(void)
 	return log_policy_create(LOG_ASPECT_SCHEDULE, log_policy_schedule(LOG_POLICY_SCHEDULE_ASYNC), NULL);
 }
 
+log_policy log_policy_schedule_async_queue(size_t capacity, enum log_policy_schedule_async_overflow_id overflow)
+{
+	struct log_policy_schedule_async_ctor_type async_ctor;
+
+	async_ctor.capacity = capacity;
+	async_ctor.overflow = overflow;
+
+	return log_policy_create(LOG_ASPECT_SCHEDULE, log_policy_schedule(LOG_POLICY_SCHEDULE_ASYNC), &async_ctor);
+}
+
+size_t log_policy_schedule_async_dropped(log_policy policy)
+{
+	return log_policy_schedule_async_dropped_count(policy);
+}
+
 log_policy log_policy_schedule_sync(void)
 {
 	return log_policy_create(LOG_ASPECT_SCHEDULE, log_policy_schedule(LOG_POLICY_SCHEDULE_SYNC), NULL);
@@ -11,20 +11,74 @@
 #include <log/log_policy_schedule.h>
 #include <log/log_policy_schedule_async.h>
 
+#include <threading/threading_atomic.h>
+#include <threading/threading_condition.h>
+#include <threading/threading_mutex.h>
+#include <threading/threading_thread.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* -- Definitions -- */
+
+#define LOG_POLICY_SCHEDULE_ASYNC_CAPACITY	0x0200
+#define LOG_POLICY_SCHEDULE_ASYNC_SLOT_SIZE 0x0200
+#define LOG_POLICY_SCHEDULE_ASYNC_TIMEOUT	100
+
 /* -- Forward Declarations -- */
 
+struct log_policy_schedule_async_slot_type;
+
 struct log_policy_schedule_async_data_type;
 
 /* -- Type Definitions -- */
 
+typedef struct log_policy_schedule_async_slot_type *log_policy_schedule_async_slot;
+
 typedef struct log_policy_schedule_async_data_type *log_policy_schedule_async_data;
 
 /* -- Member Data -- */
 
+/*
+* Each slot of the ring stores a copy of the record data, records up to the slot size
+* are copied inline so a write from the producer side does not need to allocate memory
+*/
+struct log_policy_schedule_async_slot_type
+{
+	atomic_size_t sequence;
+	log_policy_schedule_execute_cb callback;
+	log_policy_schedule_data data;
+	union
+	{
+		unsigned char bytes[LOG_POLICY_SCHEDULE_ASYNC_SLOT_SIZE];
+		uintmax_t align_int;
+		long double align_float;
+		void *align_ptr;
+	} buffer;
+};
+
+/*
+* Bounded multiple producer single consumer queue (Dmitry Vyukov), producers
+* reserve a slot with a compare and swap over the enqueue position and publish
+* it by updating the slot sequence, the writer thread is the only consumer
+*/
 struct log_policy_schedule_async_data_type
 {
-	/* TODO: this must be implemented with free-lock */
-	void *mutex;
+	log_policy policy;
+	log_policy_schedule_async_slot slots;
+	size_t mask;
+	atomic_size_t enqueue;
+	size_t dequeue;
+	enum log_policy_schedule_async_overflow_id overflow;
+	atomic_size_t dropped;
+	atomic_size_t blocked;
+	atomic_int running;
+	atomic_int sleeping;
+	struct threading_condition_type condition;
+	struct threading_condition_type space;
+	struct threading_mutex_type mutex;
+	struct threading_thread_type thread;
 };
 
 /* -- Private Methods -- */
@@ -33,12 +87,20 @@ static int log_policy_schedule_async_create(log_policy policy, const log_policy_
 
 static int log_policy_schedule_async_lock(log_policy policy);
 
-static int log_policy_schedule_async_execute(log_policy policy, log_policy_schedule_execute_cb callback, log_policy_schedule_data data);
+static int log_policy_schedule_async_execute(log_policy policy, log_policy_schedule_execute_cb callback, log_policy_schedule_data data, size_t size);
 
 static int log_policy_schedule_async_unlock(log_policy policy);
 
 static int log_policy_schedule_async_destroy(log_policy policy);
 
+static int log_policy_schedule_async_enqueue(log_policy_schedule_async_data async_data, log_policy_schedule_execute_cb callback, log_policy_schedule_data data, size_t size);
+
+static size_t log_policy_schedule_async_dequeue(log_policy_schedule_async_data async_data);
+
+static int log_policy_schedule_async_empty(log_policy_schedule_async_data async_data);
+
+static void log_policy_schedule_async_writer(void *data);
+
 /* -- Methods -- */
 
 log_policy_interface log_policy_schedule_async_interface(void)
@@ -58,57 +120,321 @@ log_policy_interface log_policy_schedule_async_interface(void)
 	return &policy_interface_schedule;
 }
 
+size_t log_policy_schedule_async_dropped_count(log_policy policy)
+{
+	log_policy_schedule_async_data async_data;
+
+	if (policy == NULL || log_policy_behavior(policy) != log_policy_schedule_async_interface())
+	{
+		return 0;
+	}
+
+	async_data = log_policy_instance(policy);
+
+	return atomic_load_explicit(&async_data->dropped, memory_order_relaxed);
+}
+
 static int log_policy_schedule_async_create(log_policy policy, const log_policy_ctor ctor)
 {
+	log_policy_schedule_async_ctor async_ctor = ctor;
+
 	log_policy_schedule_async_data async_data = malloc(sizeof(struct log_policy_schedule_async_data_type));
 
-	(void)ctor;
+	size_t capacity = LOG_POLICY_SCHEDULE_ASYNC_CAPACITY, iterator;
 
 	if (async_data == NULL)
 	{
 		return 1;
 	}
 
-	async_data->mutex = NULL;
+	async_data->overflow = LOG_POLICY_SCHEDULE_ASYNC_OVERFLOW_DROP;
+
+	if (async_ctor != NULL)
+	{
+		if (async_ctor->capacity > 1)
+		{
+			capacity = 2;
+
+			while (capacity < async_ctor->capacity)
+			{
+				capacity <<= 1;
+			}
+		}
+
+		if (async_ctor->overflow < LOG_POLICY_SCHEDULE_ASYNC_OVERFLOW_SIZE)
+		{
+			async_data->overflow = async_ctor->overflow;
+		}
+	}
+
+	async_data->slots = malloc(sizeof(struct log_policy_schedule_async_slot_type) * capacity);
+
+	if (async_data->slots == NULL)
+	{
+		goto alloc_slots_error;
+	}
+
+	for (iterator = 0; iterator < capacity; ++iterator)
+	{
+		atomic_init(&async_data->slots[iterator].sequence, iterator);
+	}
+
+	async_data->policy = policy;
+	async_data->mask = capacity - 1;
+	async_data->dequeue = 0;
+
+	atomic_init(&async_data->enqueue, 0);
+	atomic_init(&async_data->dropped, 0);
+	atomic_init(&async_data->blocked, 0);
+	atomic_init(&async_data->running, 1);
+	atomic_init(&async_data->sleeping, 0);
+
+	if (threading_mutex_initialize(&async_data->mutex) != 0)
+	{
+		goto mutex_error;
+	}
+
+	if (threading_condition_initialize(&async_data->condition) != 0)
+	{
+		goto condition_error;
+	}
+
+	if (threading_condition_initialize(&async_data->space) != 0)
+	{
+		goto space_error;
+	}
+
+	if (threading_thread_create(&async_data->thread, &log_policy_schedule_async_writer, async_data) != 0)
+	{
+		goto thread_error;
+	}
 
 	log_policy_instantiate(policy, async_data, LOG_POLICY_SCHEDULE_ASYNC);
 
 	return 0;
+
+thread_error:
+	threading_condition_destroy(&async_data->space);
+space_error:
+	threading_condition_destroy(&async_data->condition);
+condition_error:
+	threading_mutex_destroy(&async_data->mutex);
+mutex_error:
+	free(async_data->slots);
+alloc_slots_error:
+	free(async_data);
+	return 1;
 }
 
 static int log_policy_schedule_async_lock(log_policy policy)
 {
-	(void)policy;
+	log_policy_schedule_async_data async_data = log_policy_instance(policy);
+
+	return threading_mutex_lock(&async_data->mutex);
+}
+
+static int log_policy_schedule_async_enqueue(log_policy_schedule_async_data async_data, log_policy_schedule_execute_cb callback, log_policy_schedule_data data, size_t size)
+{
+	size_t position = atomic_load_explicit(&async_data->enqueue, memory_order_relaxed);
+
+	log_policy_schedule_async_slot slot;
+
+	for (;;)
+	{
+		intptr_t diff;
+
+		slot = &async_data->slots[position & async_data->mask];
+
+		diff = (intptr_t)atomic_load_explicit(&slot->sequence, memory_order_acquire) - (intptr_t)position;
+
+		if (diff == 0)
+		{
+			if (atomic_compare_exchange_weak_explicit(&async_data->enqueue, &position, position + 1, memory_order_relaxed, memory_order_relaxed))
+			{
+				break;
+			}
+		}
+		else if (diff < 0)
+		{
+			/* The queue is full */
+			return 1;
+		}
+		else
+		{
+			position = atomic_load_explicit(&async_data->enqueue, memory_order_relaxed);
+		}
+	}
 
-	/* mutex_lock(mutex); */
+	slot->callback = callback;
+
+	if (size <= LOG_POLICY_SCHEDULE_ASYNC_SLOT_SIZE)
+	{
+		slot->data = slot->buffer.bytes;
+	}
+	else
+	{
+		slot->data = malloc(size);
+	}
+
+	if (slot->data != NULL)
+	{
+		memcpy(slot->data, data, size);
+	}
+	else
+	{
+		/* The slot is published anyway so the consumer can skip it */
+		slot->callback = NULL;
+
+		if (async_data->overflow == LOG_POLICY_SCHEDULE_ASYNC_OVERFLOW_COUNT)
+		{
+			atomic_fetch_add_explicit(&async_data->dropped, 1, memory_order_relaxed);
+		}
+	}
+
+	/* Sequentially consistent so it is ordered against the sleeping flag of the writer */
+	atomic_store(&slot->sequence, position + 1);
 
 	return 0;
 }
 
-static int log_policy_schedule_async_execute(log_policy policy, log_policy_schedule_execute_cb callback, log_policy_schedule_data data)
+static int log_policy_schedule_async_execute(log_policy policy, log_policy_schedule_execute_cb callback, log_policy_schedule_data data, size_t size)
 {
-	(void)policy;
+	log_policy_schedule_async_data async_data = log_policy_instance(policy);
+
+	while (log_policy_schedule_async_enqueue(async_data, callback, data, size) != 0)
+	{
+		if (async_data->overflow != LOG_POLICY_SCHEDULE_ASYNC_OVERFLOW_BLOCK || atomic_load(&async_data->running) == 0)
+		{
+			if (async_data->overflow == LOG_POLICY_SCHEDULE_ASYNC_OVERFLOW_COUNT)
+			{
+				atomic_fetch_add_explicit(&async_data->dropped, 1, memory_order_relaxed);
+			}
 
-	return callback(policy, data);
+			return 1;
+		}
+
+		/* Wake up the writer and wait until it has released some space */
+		atomic_fetch_add(&async_data->blocked, 1);
+
+		threading_condition_notify(&async_data->condition);
+
+		threading_condition_wait(&async_data->space, 1);
+
+		atomic_fetch_sub(&async_data->blocked, 1);
+	}
+
+	/* Only the producer that clears the flag wakes up the writer */
+	if (atomic_load(&async_data->sleeping) != 0 && atomic_exchange(&async_data->sleeping, 0) != 0)
+	{
+		threading_condition_notify(&async_data->condition);
+	}
+
+	return 0;
 }
 
-static int log_policy_schedule_async_unlock(log_policy policy)
+static int log_policy_schedule_async_empty(log_policy_schedule_async_data async_data)
 {
-	(void)policy;
+	log_policy_schedule_async_slot slot = &async_data->slots[async_data->dequeue & async_data->mask];
 
-	/* mutex_unlock(mutex); */
+	return atomic_load(&slot->sequence) != async_data->dequeue + 1;
+}
 
-	return 0;
+static size_t log_policy_schedule_async_dequeue(log_policy_schedule_async_data async_data)
+{
+	size_t count = 0;
+
+	while (log_policy_schedule_async_empty(async_data) == 0)
+	{
+		log_policy_schedule_async_slot slot = &async_data->slots[async_data->dequeue & async_data->mask];
+
+		if (slot->callback != NULL)
+		{
+			slot->callback(async_data->policy, slot->data);
+
+			if (slot->data != slot->buffer.bytes)
+			{
+				free(slot->data);
+			}
+		}
+
+		atomic_store_explicit(&slot->sequence, async_data->dequeue + async_data->mask + 1, memory_order_release);
+
+		++async_data->dequeue;
+		++count;
+	}
+
+	return count;
+}
+
+static void log_policy_schedule_async_writer(void *data)
+{
+	log_policy_schedule_async_data async_data = data;
+
+	for (;;)
+	{
+		if (log_policy_schedule_async_dequeue(async_data) > 0)
+		{
+			if (atomic_load(&async_data->blocked) > 0)
+			{
+				threading_condition_notify(&async_data->space);
+			}
+
+			continue;
+		}
+
+		if (atomic_load(&async_data->running) == 0)
+		{
+			break;
+		}
+
+		/* Announce the sleep before checking the queue again so a publish in between is not missed */
+		atomic_store(&async_data->sleeping, 1);
+
+		if (log_policy_schedule_async_empty(async_data) != 0)
+		{
+			threading_condition_wait(&async_data->condition, LOG_POLICY_SCHEDULE_ASYNC_TIMEOUT);
+		}
+
+		atomic_store(&async_data->sleeping, 0);
+	}
+}
+
+static int log_policy_schedule_async_unlock(log_policy policy)
+{
+	log_policy_schedule_async_data async_data = log_policy_instance(policy);
+
+	return threading_mutex_unlock(&async_data->mutex);
 }
 
 static int log_policy_schedule_async_destroy(log_policy policy)
 {
 	log_policy_schedule_async_data async_data = log_policy_instance(policy);
 
-	if (async_data != NULL)
+	int result = 0;
+
+	if (async_data == NULL)
 	{
-		free(async_data);
+		return 0;
 	}
 
-	return 0;
+	atomic_store(&async_data->running, 0);
+
+	threading_condition_notify(&async_data->condition);
+
+	if (threading_thread_join(&async_data->thread) != 0)
+	{
+		result = 1;
+	}
+
+	/* The writer drains the queue before exiting, this catches any record enqueued meanwhile */
+	log_policy_schedule_async_dequeue(async_data);
+
+	threading_condition_destroy(&async_data->space);
+	threading_condition_destroy(&async_data->condition);
+	threading_mutex_destroy(&async_data->mutex);
+
+	free(async_data->slots);
+	free(async_data);
+
+	return result;
 }
@@ -17,7 +17,7 @@ static int log_policy_schedule_sync_create(log_policy policy, const log_policy_c
 
 static int log_policy_schedule_sync_lock(log_policy policy);
 
-static int log_policy_schedule_sync_execute(log_policy policy, log_policy_schedule_execute_cb cb, log_policy_schedule_data data);
+static int log_policy_schedule_sync_execute(log_policy policy, log_policy_schedule_execute_cb cb, log_policy_schedule_data data, size_t size);
 
 static int log_policy_schedule_sync_unlock(log_policy policy);
 
@@ -58,9 +58,9 @@ static int log_policy_schedule_sync_lock(log_policy policy)
 	return 0;
 }
 
-static int log_policy_schedule_sync_execute(log_policy policy, log_policy_schedule_execute_cb callback, log_policy_schedule_data data)
+static int log_policy_schedule_sync_execute(log_policy policy, log_policy_schedule_execute_cb callback, log_policy_schedule_data data, size_t size)
 {
-	(void)policy;
+	(void)size;
 
 	return callback(policy, data);
 }
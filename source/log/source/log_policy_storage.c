@@ -12,6 +12,14 @@
 #include <log/log_policy_storage_batch.h>
 #include <log/log_policy_storage_sequential.h>
 
+#include <log/log_aspect_stream.h>
+#include <log/log_impl.h>
+
+/* -- Definitions -- */
+
+#define LOG_POLICY_STORAGE_BATCH_LEVEL	  LOG_LEVEL_ERROR
+#define LOG_POLICY_STORAGE_BATCH_INTERVAL 1000
+
 /* -- Methods -- */
 
 log_policy_interface log_policy_storage(const log_policy_id policy_storage_id)
@@ -29,6 +37,19 @@ log_policy log_policy_storage_batch(size_t size)
 	struct log_policy_storage_batch_ctor_type batch_ctor;
 
 	batch_ctor.size = size;
+	batch_ctor.level = LOG_POLICY_STORAGE_BATCH_LEVEL;
+	batch_ctor.interval = LOG_POLICY_STORAGE_BATCH_INTERVAL;
+
+	return log_policy_create(LOG_ASPECT_STORAGE, log_policy_storage(LOG_POLICY_STORAGE_BATCH), &batch_ctor);
+}
+
+log_policy log_policy_storage_batch_threshold(size_t size, enum log_level_id level, unsigned int interval)
+{
+	struct log_policy_storage_batch_ctor_type batch_ctor;
+
+	batch_ctor.size = size;
+	batch_ctor.level = level;
+	batch_ctor.interval = interval;
 
 	return log_policy_create(LOG_ASPECT_STORAGE, log_policy_storage(LOG_POLICY_STORAGE_BATCH), &batch_ctor);
 }
@@ -37,3 +58,21 @@ log_policy log_policy_storage_sequential(void)
 {
 	return log_policy_create(LOG_ASPECT_STORAGE, log_policy_storage(LOG_POLICY_STORAGE_SEQUENTIAL), NULL);
 }
+
+int log_policy_storage_output(log_policy policy, const void *buffer, const size_t size)
+{
+	log_impl impl = log_aspect_parent(log_policy_aspect(policy));
+
+	log_aspect stream = log_impl_aspect(impl, LOG_ASPECT_STREAM);
+
+	log_aspect_stream_impl stream_impl;
+
+	if (stream == NULL)
+	{
+		return 1;
+	}
+
+	stream_impl = log_aspect_derived(stream);
+
+	return stream_impl->output(stream, buffer, size);
+}
@@ -11,10 +11,33 @@
 #include <log/log_policy_storage.h>
 #include <log/log_policy_storage_batch.h>
 
+#include <threading/threading_atomic.h>
+#include <threading/threading_condition.h>
+#include <threading/threading_mutex.h>
+#include <threading/threading_thread.h>
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64)
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+
+	#include <windows.h>
+#else
+	#include <time.h>
+#endif
+
 /* -- Definitions -- */
 
 #define LOG_POLICY_STORAGE_BATCH_MIN_SIZE ((size_t)0x00000200)
 #define LOG_POLICY_STORAGE_BATCH_MAX_SIZE ((size_t)0x00010000)
+#define LOG_POLICY_STORAGE_BATCH_MAX_WAIT ((uint64_t)UINT32_MAX)
 
 /* -- Forward Declarations -- */
 
@@ -28,19 +51,33 @@ typedef struct log_policy_storage_batch_data_type *log_policy_storage_batch_data
 
 struct log_policy_storage_batch_data_type
 {
-	void *buffer;
+	char *buffer;
 	size_t count;
 	size_t size;
+	enum log_level_id level;
+	uint64_t interval;
+	uint64_t time;
+	log_policy policy;
+	atomic_int running;
+	struct threading_condition_type timer;
+	struct threading_thread_type thread;
+	struct threading_mutex_type mutex;
 };
 
 /* -- Private Methods -- */
 
 static int log_policy_storage_batch_create(log_policy policy, const log_policy_ctor ctor);
 
-static int log_policy_storage_batch_append(log_policy policy, const log_record record);
+static int log_policy_storage_batch_append(log_policy policy, const enum log_level_id level, const void *buffer, const size_t size);
 
 static int log_policy_storage_batch_flush(log_policy policy);
 
+static int log_policy_storage_batch_flush_impl(log_policy policy, log_policy_storage_batch_data batch_data);
+
+static uint64_t log_policy_storage_batch_time(void);
+
+static void log_policy_storage_batch_timer(void *data);
+
 static int log_policy_storage_batch_destroy(log_policy policy);
 
 /* -- Methods -- */
@@ -73,6 +110,8 @@ static int log_policy_storage_batch_create(log_policy policy, const log_policy_c
 	}
 
 	batch_data->count = 0;
+	batch_data->level = LOG_LEVEL_ERROR;
+	batch_data->interval = 0;
 
 	if (batch_ctor != NULL && batch_ctor->size >= LOG_POLICY_STORAGE_BATCH_MIN_SIZE && batch_ctor->size <= LOG_POLICY_STORAGE_BATCH_MAX_SIZE)
 	{
@@ -83,6 +122,12 @@ static int log_policy_storage_batch_create(log_policy policy, const log_policy_c
 		batch_data->size = LOG_POLICY_STORAGE_BATCH_MIN_SIZE;
 	}
 
+	if (batch_ctor != NULL)
+	{
+		batch_data->level = batch_ctor->level;
+		batch_data->interval = (uint64_t)batch_ctor->interval;
+	}
+
 	batch_data->buffer = malloc(batch_data->size);
 
 	if (batch_data->buffer == NULL)
@@ -92,36 +137,212 @@ static int log_policy_storage_batch_create(log_policy policy, const log_policy_c
 		return 1;
 	}
 
+	if (threading_mutex_initialize(&batch_data->mutex) != 0)
+	{
+		goto mutex_error;
+	}
+
+	batch_data->time = log_policy_storage_batch_time();
+	batch_data->policy = policy;
+
+	atomic_init(&batch_data->running, 0);
+
+	/* Without a timer the interval is only checked when a record arrives, so an idle log would keep its records forever */
+	if (batch_data->interval > 0)
+	{
+		if (threading_condition_initialize(&batch_data->timer) != 0)
+		{
+			goto condition_error;
+		}
+
+		atomic_store(&batch_data->running, 1);
+
+		if (threading_thread_create(&batch_data->thread, &log_policy_storage_batch_timer, batch_data) != 0)
+		{
+			goto thread_error;
+		}
+	}
+
 	log_policy_instantiate(policy, batch_data, LOG_POLICY_STORAGE_BATCH);
 
 	return 0;
+
+thread_error:
+	threading_condition_destroy(&batch_data->timer);
+condition_error:
+	threading_mutex_destroy(&batch_data->mutex);
+mutex_error:
+	free(batch_data->buffer);
+	free(batch_data);
+	return 1;
+}
+
+static uint64_t log_policy_storage_batch_time(void)
+{
+#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64)
+	return (uint64_t)GetTickCount64();
+#else
+	struct timespec now;
+
+	if (clock_gettime(CLOCK_MONOTONIC, &now) != 0)
+	{
+		return 0;
+	}
+
+	return (uint64_t)now.tv_sec * 1000 + (uint64_t)now.tv_nsec / 1000000;
+#endif
 }
 
-static int log_policy_storage_batch_append(log_policy policy, const log_record record)
+static void log_policy_storage_batch_timer(void *data)
 {
-	(void)policy;
-	(void)record;
+	log_policy_storage_batch_data batch_data = data;
 
-	/* TODO */
+	uint64_t wait = batch_data->interval;
 
-	return 0;
+	if (wait > LOG_POLICY_STORAGE_BATCH_MAX_WAIT)
+	{
+		wait = LOG_POLICY_STORAGE_BATCH_MAX_WAIT;
+	}
+
+	while (atomic_load(&batch_data->running) != 0)
+	{
+		/* Woken up by the timeout or by the destructor */
+		threading_condition_wait(&batch_data->timer, (unsigned int)wait);
+
+		if (threading_mutex_lock(&batch_data->mutex) == 0)
+		{
+			uint64_t now = log_policy_storage_batch_time();
+
+			if (now - batch_data->time >= batch_data->interval)
+			{
+				log_policy_storage_batch_flush_impl(batch_data->policy, batch_data);
+
+				batch_data->time = now;
+			}
+
+			threading_mutex_unlock(&batch_data->mutex);
+		}
+	}
+}
+
+static int log_policy_storage_batch_flush_impl(log_policy policy, log_policy_storage_batch_data batch_data)
+{
+	int result = 0;
+
+	if (batch_data->count > 0)
+	{
+		/* Streams expect a null terminated buffer whose size includes the terminator */
+		batch_data->buffer[batch_data->count] = '\0';
+
+		result = log_policy_storage_output(policy, batch_data->buffer, batch_data->count + 1);
+
+		batch_data->count = 0;
+	}
+
+	return result;
+}
+
+static int log_policy_storage_batch_append(log_policy policy, const enum log_level_id level, const void *buffer, const size_t size)
+{
+	log_policy_storage_batch_data batch_data = log_policy_instance(policy);
+
+	/* The records are null terminated, the terminator is not stored in the batch */
+	size_t length = size > 0 ? size - 1 : 0;
+
+	int result = 0;
+
+	uint64_t now;
+
+	if (threading_mutex_lock(&batch_data->mutex) != 0)
+	{
+		return 1;
+	}
+
+	if (batch_data->count + length >= batch_data->size)
+	{
+		result |= log_policy_storage_batch_flush_impl(policy, batch_data);
+	}
+
+	if (length >= batch_data->size)
+	{
+		/* The record does not fit in the batch, write it directly */
+		result |= log_policy_storage_output(policy, buffer, size);
+	}
+	else
+	{
+		memcpy(&batch_data->buffer[batch_data->count], buffer, length);
+
+		batch_data->count += length;
+	}
+
+	now = log_policy_storage_batch_time();
+
+	/* A zero interval disables the timer, the batch is only written when it is full or by the level threshold */
+	if (level >= batch_data->level || (batch_data->interval > 0 && now - batch_data->time >= batch_data->interval))
+	{
+		result |= log_policy_storage_batch_flush_impl(policy, batch_data);
+
+		batch_data->time = now;
+	}
+
+	if (threading_mutex_unlock(&batch_data->mutex) != 0)
+	{
+		return 1;
+	}
+
+	return result;
 }
 
 static int log_policy_storage_batch_flush(log_policy policy)
 {
-	(void)policy;
+	log_policy_storage_batch_data batch_data = log_policy_instance(policy);
 
-	/* TODO */
+	int result;
 
-	return 0;
+	if (threading_mutex_lock(&batch_data->mutex) != 0)
+	{
+		return 1;
+	}
+
+	result = log_policy_storage_batch_flush_impl(policy, batch_data);
+
+	batch_data->time = log_policy_storage_batch_time();
+
+	if (threading_mutex_unlock(&batch_data->mutex) != 0)
+	{
+		return 1;
+	}
+
+	return result;
 }
 
 static int log_policy_storage_batch_destroy(log_policy policy)
 {
 	log_policy_storage_batch_data batch_data = log_policy_instance(policy);
 
+	int result = 0;
+
 	if (batch_data != NULL)
 	{
+		if (atomic_load(&batch_data->running) != 0)
+		{
+			atomic_store(&batch_data->running, 0);
+
+			threading_condition_notify(&batch_data->timer);
+
+			if (threading_thread_join(&batch_data->thread) != 0)
+			{
+				result = 1;
+			}
+
+			threading_condition_destroy(&batch_data->timer);
+		}
+
+		/* Write the pending records, the stream aspect is destroyed after the storage */
+		result |= log_policy_storage_batch_flush_impl(policy, batch_data);
+
+		threading_mutex_destroy(&batch_data->mutex);
+
 		if (batch_data->buffer != NULL)
 		{
 			free(batch_data->buffer);
@@ -130,5 +351,5 @@ static int log_policy_storage_batch_destroy(log_policy policy)
 		free(batch_data);
 	}
 
-	return 0;
+	return result;
 }
@@ -15,7 +15,7 @@
 
 static int log_policy_storage_sequential_create(log_policy policy, const log_policy_ctor ctor);
 
-static int log_policy_storage_sequential_append(log_policy policy, const log_record record);
+static int log_policy_storage_sequential_append(log_policy policy, const enum log_level_id level, const void *buffer, const size_t size);
 
 static int log_policy_storage_sequential_flush(log_policy policy);
 
@@ -48,21 +48,19 @@ static int log_policy_storage_sequential_create(log_policy policy, const log_pol
 	return 0;
 }
 
-static int log_policy_storage_sequential_append(log_policy policy, const log_record record)
+static int log_policy_storage_sequential_append(log_policy policy, const enum log_level_id level, const void *buffer, const size_t size)
 {
-	(void)policy;
-	(void)record;
-
-	/* TODO */
+	(void)level;
 
-	return 0;
+	/* Each record is written to the streams as soon as it arrives */
+	return log_policy_storage_output(policy, buffer, size);
 }
 
 static int log_policy_storage_sequential_flush(log_policy policy)
 {
 	(void)policy;
 
-	/* TODO */
+	/* Nothing is retained, so there is nothing to flush */
 
 	return 0;
 }
@@ -60,6 +60,18 @@ log_policy log_policy_stream_socket(const char *ip, uint16_t port)
 
 	socket_ctor.ip = ip;
 	socket_ctor.port = port;
+	socket_ctor.protocol = LOG_POLICY_STREAM_SOCKET_UDP;
+
+	return log_policy_create(LOG_ASPECT_STREAM, log_policy_stream(LOG_POLICY_STREAM_SOCKET), &socket_ctor);
+}
+
+log_policy log_policy_stream_socket_protocol(const char *ip, uint16_t port, enum log_policy_stream_socket_protocol_id protocol)
+{
+	struct log_policy_stream_socket_ctor_type socket_ctor;
+
+	socket_ctor.ip = ip;
+	socket_ctor.port = port;
+	socket_ctor.protocol = protocol;
 
 	return log_policy_create(LOG_ASPECT_STREAM, log_policy_stream(LOG_POLICY_STREAM_SOCKET), &socket_ctor);
 }
@@ -11,6 +11,68 @@
 #include <log/log_policy_stream.h>
 #include <log/log_policy_stream_socket.h>
 
+#include <threading/threading_mutex.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64)
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+
+	#include <winsock2.h>
+	#include <ws2tcpip.h>
+
+	#include <windows.h>
+#else
+	#include <arpa/inet.h>
+	#include <errno.h>
+	#include <fcntl.h>
+	#include <netinet/in.h>
+	#include <poll.h>
+	#include <sys/socket.h>
+	#include <time.h>
+	#include <unistd.h>
+#endif
+
+/* -- Definitions -- */
+
+#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64)
+typedef SOCKET log_policy_stream_socket_handle;
+
+	#define LOG_POLICY_STREAM_SOCKET_INVALID		  INVALID_SOCKET
+	#define log_policy_stream_socket_close(fd)		  closesocket(fd)
+	#define log_policy_stream_socket_error()		  WSAGetLastError()
+	#define log_policy_stream_socket_would_block(err) ((err) == WSAEWOULDBLOCK)
+	#define log_policy_stream_socket_in_progress(err) ((err) == WSAEWOULDBLOCK || (err) == WSAEINPROGRESS)
+#else
+typedef int log_policy_stream_socket_handle;
+
+	#define LOG_POLICY_STREAM_SOCKET_INVALID		  (-1)
+	#define log_policy_stream_socket_close(fd)		  close(fd)
+	#define log_policy_stream_socket_error()		  errno
+	#define log_policy_stream_socket_would_block(err) ((err) == EAGAIN || (err) == EWOULDBLOCK)
+	#define log_policy_stream_socket_in_progress(err) ((err) == EINPROGRESS)
+#endif
+
+#if defined(MSG_NOSIGNAL)
+	#define LOG_POLICY_STREAM_SOCKET_SEND_FLAGS MSG_NOSIGNAL
+#else
+	#define LOG_POLICY_STREAM_SOCKET_SEND_FLAGS 0
+#endif
+
+#define LOG_POLICY_STREAM_SOCKET_FRAME_HEADER_SIZE ((size_t)sizeof(uint32_t))
+#define LOG_POLICY_STREAM_SOCKET_BUFFER_MIN_SIZE   ((size_t)0x00001000)
+#define LOG_POLICY_STREAM_SOCKET_BUFFER_MAX_SIZE   ((size_t)0x00100000)
+#define LOG_POLICY_STREAM_SOCKET_BACKOFF_MIN	   ((uint64_t)100)
+#define LOG_POLICY_STREAM_SOCKET_BACKOFF_MAX	   ((uint64_t)30000)
+
 /* -- Forward Declarations -- */
 
 struct log_policy_stream_socket_data_type;
@@ -21,10 +83,39 @@ typedef struct log_policy_stream_socket_data_type *log_policy_stream_socket_data
 
 /* -- Member Data -- */
 
+enum log_policy_stream_socket_state_id
+{
+	LOG_POLICY_STREAM_SOCKET_DISCONNECTED = 0x00,
+	LOG_POLICY_STREAM_SOCKET_CONNECTING = 0x01,
+	LOG_POLICY_STREAM_SOCKET_CONNECTED = 0x02
+};
+
+/*
+* Records are stored in the buffer as frames (length followed by the record), the
+* buffer always starts at a frame boundary and sent counts the bytes of it already
+* written into the socket, so a partial TCP send can be resumed later on, the mutex
+* protects the buffer and the connection because records can arrive from any thread
+*/
 struct log_policy_stream_socket_data_type
 {
-	/* TODO */
-	void *socket;
+	log_policy_stream_socket_handle socket;
+	enum log_policy_stream_socket_protocol_id protocol;
+	enum log_policy_stream_socket_state_id state;
+	union
+	{
+		struct sockaddr base;
+		struct sockaddr_in v4;
+		struct sockaddr_in6 v6;
+		struct sockaddr_storage storage;
+	} address;
+	socklen_t address_length;
+	unsigned char *buffer;
+	size_t count;
+	size_t sent;
+	size_t size;
+	uint64_t backoff;
+	uint64_t retry;
+	struct threading_mutex_type mutex;
 };
 
 /* -- Private Methods -- */
@@ -37,6 +128,24 @@ static int log_policy_stream_socket_flush(log_policy policy);
 
 static int log_policy_stream_socket_destroy(log_policy policy);
 
+static uint64_t log_policy_stream_socket_time(void);
+
+static int log_policy_stream_socket_address(log_policy_stream_socket_data socket_data, const char *ip, uint16_t port);
+
+static int log_policy_stream_socket_open(log_policy_stream_socket_data socket_data);
+
+static void log_policy_stream_socket_disconnect(log_policy_stream_socket_data socket_data);
+
+static int log_policy_stream_socket_connected(log_policy_stream_socket_data socket_data);
+
+static size_t log_policy_stream_socket_frame_size(const unsigned char *frame);
+
+static int log_policy_stream_socket_append(log_policy_stream_socket_data socket_data, const void *buffer, size_t length);
+
+static void log_policy_stream_socket_consume(log_policy_stream_socket_data socket_data, size_t length);
+
+static int log_policy_stream_socket_send(log_policy_stream_socket_data socket_data);
+
 /* -- Methods -- */
 
 log_policy_interface log_policy_stream_socket_interface(void)
@@ -55,24 +164,413 @@ log_policy_interface log_policy_stream_socket_interface(void)
 	return &policy_interface_stream;
 }
 
+static uint64_t log_policy_stream_socket_time(void)
+{
+#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64)
+	return (uint64_t)GetTickCount64();
+#else
+	struct timespec now;
+
+	if (clock_gettime(CLOCK_MONOTONIC, &now) != 0)
+	{
+		return 0;
+	}
+
+	return (uint64_t)now.tv_sec * 1000 + (uint64_t)now.tv_nsec / 1000000;
+#endif
+}
+
+static int log_policy_stream_socket_address(log_policy_stream_socket_data socket_data, const char *ip, uint16_t port)
+{
+	memset(&socket_data->address, 0, sizeof(socket_data->address));
+
+	if (inet_pton(AF_INET, ip, &socket_data->address.v4.sin_addr) == 1)
+	{
+		socket_data->address.v4.sin_family = AF_INET;
+		socket_data->address.v4.sin_port = htons(port);
+		socket_data->address_length = (socklen_t)sizeof(struct sockaddr_in);
+
+		return 0;
+	}
+
+	if (inet_pton(AF_INET6, ip, &socket_data->address.v6.sin6_addr) == 1)
+	{
+		socket_data->address.v6.sin6_family = AF_INET6;
+		socket_data->address.v6.sin6_port = htons(port);
+		socket_data->address_length = (socklen_t)sizeof(struct sockaddr_in6);
+
+		return 0;
+	}
+
+	return 1;
+}
+
 static int log_policy_stream_socket_create(log_policy policy, const log_policy_ctor ctor)
 {
-	log_policy_stream_socket_data socket_data = malloc(sizeof(struct log_policy_stream_socket_data_type));
+	log_policy_stream_socket_data socket_data;
 
 	const log_policy_stream_socket_ctor socket_ctor = ctor;
 
+	if (socket_ctor == NULL || socket_ctor->ip == NULL || socket_ctor->protocol >= LOG_POLICY_STREAM_SOCKET_PROTOCOL_SIZE)
+	{
+		return 1;
+	}
+
+	socket_data = malloc(sizeof(struct log_policy_stream_socket_data_type));
+
 	if (socket_data == NULL)
 	{
 		return 1;
 	}
 
-/* TODO: open socket */
-#define socket_open(ip, port) /* NULL */ (void *)socket_ctor
+	if (log_policy_stream_socket_address(socket_data, socket_ctor->ip, socket_ctor->port) != 0)
+	{
+		goto address_error;
+	}
+
+#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64)
+	{
+		WSADATA wsa_data;
+
+		if (WSAStartup(MAKEWORD(2, 2), &wsa_data) != 0)
+		{
+			goto address_error;
+		}
+	}
+#endif
+
+	socket_data->buffer = malloc(LOG_POLICY_STREAM_SOCKET_BUFFER_MIN_SIZE);
 
-	socket_data->socket = socket_open(socket_ctor->ip, socket_ctor->port);
+	if (socket_data->buffer == NULL)
+	{
+		goto buffer_error;
+	}
+
+	if (threading_mutex_initialize(&socket_data->mutex) != 0)
+	{
+		goto mutex_error;
+	}
+
+	socket_data->socket = LOG_POLICY_STREAM_SOCKET_INVALID;
+	socket_data->protocol = socket_ctor->protocol;
+	socket_data->state = LOG_POLICY_STREAM_SOCKET_DISCONNECTED;
+	socket_data->count = 0;
+	socket_data->sent = 0;
+	socket_data->size = LOG_POLICY_STREAM_SOCKET_BUFFER_MIN_SIZE;
+	socket_data->backoff = LOG_POLICY_STREAM_SOCKET_BACKOFF_MIN;
+	socket_data->retry = 0;
+
+	/* The collector may not be listening yet, a failed connection is retried on the next write */
+	(void)log_policy_stream_socket_open(socket_data);
 
 	log_policy_instantiate(policy, socket_data, LOG_POLICY_STREAM_SOCKET);
 
+	return 0;
+
+mutex_error:
+	free(socket_data->buffer);
+buffer_error:
+#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64)
+	WSACleanup();
+#endif
+address_error:
+	free(socket_data);
+	return 1;
+}
+
+static int log_policy_stream_socket_open(log_policy_stream_socket_data socket_data)
+{
+	int type = socket_data->protocol == LOG_POLICY_STREAM_SOCKET_TCP ? SOCK_STREAM : SOCK_DGRAM;
+
+	socket_data->socket = socket(socket_data->address.base.sa_family, type, 0);
+
+	if (socket_data->socket == LOG_POLICY_STREAM_SOCKET_INVALID)
+	{
+		log_policy_stream_socket_disconnect(socket_data);
+
+		return 1;
+	}
+
+#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64)
+	{
+		u_long mode = 1;
+
+		if (ioctlsocket(socket_data->socket, FIONBIO, &mode) != 0)
+		{
+			log_policy_stream_socket_disconnect(socket_data);
+
+			return 1;
+		}
+	}
+#else
+	{
+		int flags = fcntl(socket_data->socket, F_GETFL, 0);
+
+		if (flags == -1 || fcntl(socket_data->socket, F_SETFL, flags | O_NONBLOCK) == -1)
+		{
+			log_policy_stream_socket_disconnect(socket_data);
+
+			return 1;
+		}
+	}
+
+	#if defined(SO_NOSIGPIPE)
+	{
+		int value = 1;
+
+		(void)setsockopt(socket_data->socket, SOL_SOCKET, SO_NOSIGPIPE, &value, sizeof(value));
+	}
+	#endif
+#endif
+
+	/* Connecting an UDP socket only sets the default destination of the datagrams */
+	if (connect(socket_data->socket, &socket_data->address.base, socket_data->address_length) == 0)
+	{
+		socket_data->state = LOG_POLICY_STREAM_SOCKET_CONNECTED;
+		socket_data->backoff = LOG_POLICY_STREAM_SOCKET_BACKOFF_MIN;
+
+		return 0;
+	}
+
+	if (socket_data->protocol == LOG_POLICY_STREAM_SOCKET_TCP && log_policy_stream_socket_in_progress(log_policy_stream_socket_error()))
+	{
+		socket_data->state = LOG_POLICY_STREAM_SOCKET_CONNECTING;
+
+		return 0;
+	}
+
+	log_policy_stream_socket_disconnect(socket_data);
+
+	return 1;
+}
+
+static void log_policy_stream_socket_disconnect(log_policy_stream_socket_data socket_data)
+{
+	if (socket_data->socket != LOG_POLICY_STREAM_SOCKET_INVALID)
+	{
+		log_policy_stream_socket_close(socket_data->socket);
+
+		socket_data->socket = LOG_POLICY_STREAM_SOCKET_INVALID;
+	}
+
+	/* The receiver cannot resync with a frame partially sent by the previous connection */
+	if (socket_data->sent > 0)
+	{
+		socket_data->sent = 0;
+
+		log_policy_stream_socket_consume(socket_data, log_policy_stream_socket_frame_size(socket_data->buffer));
+	}
+
+	socket_data->state = LOG_POLICY_STREAM_SOCKET_DISCONNECTED;
+	socket_data->retry = log_policy_stream_socket_time() + socket_data->backoff;
+
+	/* Exponential backoff between reconnections */
+	socket_data->backoff <<= 1;
+
+	if (socket_data->backoff > LOG_POLICY_STREAM_SOCKET_BACKOFF_MAX)
+	{
+		socket_data->backoff = LOG_POLICY_STREAM_SOCKET_BACKOFF_MAX;
+	}
+}
+
+static int log_policy_stream_socket_connected(log_policy_stream_socket_data socket_data)
+{
+	if (socket_data->state == LOG_POLICY_STREAM_SOCKET_DISCONNECTED)
+	{
+		if (log_policy_stream_socket_time() < socket_data->retry || log_policy_stream_socket_open(socket_data) != 0)
+		{
+			return 0;
+		}
+	}
+
+	if (socket_data->state == LOG_POLICY_STREAM_SOCKET_CONNECTING)
+	{
+		int error = 0;
+		socklen_t error_length = (socklen_t)sizeof(error);
+
+#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64)
+		fd_set write_set;
+		struct timeval timeout = { 0, 0 };
+
+		FD_ZERO(&write_set);
+		FD_SET(socket_data->socket, &write_set);
+
+		if (select(0, NULL, &write_set, NULL, &timeout) <= 0)
+		{
+			return 0;
+		}
+#else
+		struct pollfd poll_fd;
+
+		poll_fd.fd = socket_data->socket;
+		poll_fd.events = POLLOUT;
+		poll_fd.revents = 0;
+
+		if (poll(&poll_fd, 1, 0) <= 0)
+		{
+			return 0;
+		}
+#endif
+
+		if (getsockopt(socket_data->socket, SOL_SOCKET, SO_ERROR, (void *)&error, &error_length) != 0 || error != 0)
+		{
+			log_policy_stream_socket_disconnect(socket_data);
+
+			return 0;
+		}
+
+		socket_data->state = LOG_POLICY_STREAM_SOCKET_CONNECTED;
+		socket_data->backoff = LOG_POLICY_STREAM_SOCKET_BACKOFF_MIN;
+	}
+
+	return socket_data->state == LOG_POLICY_STREAM_SOCKET_CONNECTED;
+}
+
+static size_t log_policy_stream_socket_frame_size(const unsigned char *frame)
+{
+	size_t length = ((size_t)frame[0] << 24) | ((size_t)frame[1] << 16) | ((size_t)frame[2] << 8) | (size_t)frame[3];
+
+	return LOG_POLICY_STREAM_SOCKET_FRAME_HEADER_SIZE + length;
+}
+
+static int log_policy_stream_socket_append(log_policy_stream_socket_data socket_data, const void *buffer, size_t length)
+{
+	size_t frame_size = LOG_POLICY_STREAM_SOCKET_FRAME_HEADER_SIZE + length;
+	unsigned char *frame;
+
+	if (socket_data->count + frame_size > LOG_POLICY_STREAM_SOCKET_BUFFER_MAX_SIZE)
+	{
+		/* The collector is not keeping up, drop the record instead of growing without bounds */
+		return 1;
+	}
+
+	if (socket_data->count + frame_size > socket_data->size)
+	{
+		size_t size = socket_data->size;
+
+		unsigned char *data;
+
+		while (size < socket_data->count + frame_size)
+		{
+			size <<= 1;
+		}
+
+		data = realloc(socket_data->buffer, size);
+
+		if (data == NULL)
+		{
+			return 1;
+		}
+
+		socket_data->buffer = data;
+		socket_data->size = size;
+	}
+
+	frame = &socket_data->buffer[socket_data->count];
+
+	frame[0] = (unsigned char)(length >> 24);
+	frame[1] = (unsigned char)(length >> 16);
+	frame[2] = (unsigned char)(length >> 8);
+	frame[3] = (unsigned char)length;
+
+	memcpy(&frame[LOG_POLICY_STREAM_SOCKET_FRAME_HEADER_SIZE], buffer, length);
+
+	socket_data->count += frame_size;
+
+	return 0;
+}
+
+static void log_policy_stream_socket_consume(log_policy_stream_socket_data socket_data, size_t length)
+{
+	if (length >= socket_data->count)
+	{
+		socket_data->count = 0;
+	}
+	else
+	{
+		memmove(socket_data->buffer, &socket_data->buffer[length], socket_data->count - length);
+
+		socket_data->count -= length;
+	}
+}
+
+static int log_policy_stream_socket_send(log_policy_stream_socket_data socket_data)
+{
+	size_t offset = 0;
+
+	int result = 0;
+
+	if (socket_data->count == 0 || log_policy_stream_socket_connected(socket_data) == 0)
+	{
+		return 0;
+	}
+
+	if (socket_data->protocol == LOG_POLICY_STREAM_SOCKET_UDP)
+	{
+		/* Each frame goes in its own datagram without the length prefix */
+		while (offset < socket_data->count)
+		{
+			const unsigned char *frame = &socket_data->buffer[offset];
+
+			size_t frame_size = log_policy_stream_socket_frame_size(frame);
+
+			if (send(socket_data->socket, (const char *)&frame[LOG_POLICY_STREAM_SOCKET_FRAME_HEADER_SIZE], (int)(frame_size - LOG_POLICY_STREAM_SOCKET_FRAME_HEADER_SIZE), LOG_POLICY_STREAM_SOCKET_SEND_FLAGS) < 0)
+			{
+				if (log_policy_stream_socket_would_block(log_policy_stream_socket_error()))
+				{
+					break;
+				}
+
+				/* Datagrams that cannot be delivered (too big, no listener) are dropped */
+				result = 1;
+			}
+
+			offset += frame_size;
+		}
+
+		log_policy_stream_socket_consume(socket_data, offset);
+
+		return result;
+	}
+
+	while (socket_data->sent < socket_data->count)
+	{
+		int length = (int)(socket_data->count - socket_data->sent);
+
+		int written = (int)send(socket_data->socket, (const char *)&socket_data->buffer[socket_data->sent], length, LOG_POLICY_STREAM_SOCKET_SEND_FLAGS);
+
+		if (written < 0)
+		{
+			if (log_policy_stream_socket_would_block(log_policy_stream_socket_error()) == 0)
+			{
+				log_policy_stream_socket_disconnect(socket_data);
+
+				return 1;
+			}
+
+			break;
+		}
+
+		socket_data->sent += (size_t)written;
+	}
+
+	/* Release the frames that have been completely sent */
+	while (offset + LOG_POLICY_STREAM_SOCKET_FRAME_HEADER_SIZE <= socket_data->count)
+	{
+		size_t frame_size = log_policy_stream_socket_frame_size(&socket_data->buffer[offset]);
+
+		if (offset + frame_size > socket_data->sent)
+		{
+			break;
+		}
+
+		offset += frame_size;
+	}
+
+	socket_data->sent -= offset;
+
+	log_policy_stream_socket_consume(socket_data, offset);
+
 	return 0;
 }
 
@@ -80,22 +578,46 @@ static int log_policy_stream_socket_write(log_policy policy, const void *buffer,
 {
 	log_policy_stream_socket_data socket_data = log_policy_instance(policy);
 
-	/* TODO: write to socket */
-	(void)socket_data;
-	(void)buffer;
-	(void)size;
+	size_t length = size > 0 ? size - 1 : 0;
 
-	return 0;
+	int result = 0;
+
+	if (threading_mutex_lock(&socket_data->mutex) != 0)
+	{
+		return 1;
+	}
+
+	/* Do not write null character */
+	if (log_policy_stream_socket_append(socket_data, buffer, length) != 0)
+	{
+		result = 1;
+	}
+	else
+	{
+		/* Records that cannot be sent now stay in the buffer until the next write or flush */
+		(void)log_policy_stream_socket_send(socket_data);
+	}
+
+	if (threading_mutex_unlock(&socket_data->mutex) != 0)
+	{
+		return 1;
+	}
+
+	return result;
 }
 
 static int log_policy_stream_socket_flush(log_policy policy)
 {
 	log_policy_stream_socket_data socket_data = log_policy_instance(policy);
 
-	/* TODO: flush socket */
-	(void)socket_data;
+	if (threading_mutex_lock(&socket_data->mutex) != 0)
+	{
+		return 1;
+	}
+
+	(void)log_policy_stream_socket_send(socket_data);
 
-	return 0;
+	return threading_mutex_unlock(&socket_data->mutex);
 }
 
 static int log_policy_stream_socket_destroy(log_policy policy)
@@ -104,9 +626,23 @@ static int log_policy_stream_socket_destroy(log_policy policy)
 
 	if (socket_data != NULL)
 	{
-		/* TODO: close socket */
+		/* Last attempt to send the pending records, without blocking */
+		(void)log_policy_stream_socket_send(socket_data);
+
+		if (socket_data->socket != LOG_POLICY_STREAM_SOCKET_INVALID)
+		{
+			log_policy_stream_socket_close(socket_data->socket);
+		}
+
+		threading_mutex_destroy(&socket_data->mutex);
+
+		free(socket_data->buffer);
 
 		free(socket_data);
+
+#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64)
+		WSACleanup();
+#endif
 	}
 
 	return 0;
@@ -27,6 +27,7 @@
 
 #include <memory/memory_allocator.h>
 #include <memory/memory_allocator_nginx.h>
+#include <memory/memory_allocator_slab.h>
 #include <memory/memory_allocator_std.h>
 
 #ifdef __cplusplus
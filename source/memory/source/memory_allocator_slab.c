@@ -0,0 +1,34 @@
+/*
+ *	Memory Library by Parra Studios
+ *	A generic cross-platform memory utility.
+ *
+ *	Copyright (C) 2016 - 2022 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <memory/memory_allocator_slab.h>
+
+/* -- Methods -- */
+
+memory_allocator memory_allocator_slab(size_t chunk_size)
+{
+	struct memory_allocator_slab_ctx_type slab_ctx;
+
+	slab_ctx.chunk_size = chunk_size == 0 ? MEMORY_ALLOCATOR_SLAB_CHUNK_SIZE : chunk_size;
+
+	return memory_allocator_create(memory_allocator_slab_iface(), &slab_ctx);
+}
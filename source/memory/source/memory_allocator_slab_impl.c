@@ -0,0 +1,269 @@
+/*
+ *	Memory Library by Parra Studios
+ *	A generic cross-platform memory utility.
+ *
+ *	Copyright (C) 2016 - 2022 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <memory/memory_allocator_slab_impl.h>
+
+#include <stdint.h>
+#include <string.h>
+
+/* -- Definitions -- */
+
+#define MEMORY_ALLOCATOR_SLAB_ALIGNMENT	 16
+#define MEMORY_ALLOCATOR_SLAB_CLASS_MIN	 16
+#define MEMORY_ALLOCATOR_SLAB_CLASS_SIZE 6 /* 16, 32, 64, 128, 256 and 512 bytes */
+#define MEMORY_ALLOCATOR_SLAB_CLASS_NONE MEMORY_ALLOCATOR_SLAB_CLASS_SIZE
+
+/* -- Forward Declarations -- */
+
+struct memory_allocator_slab_impl_type;
+
+struct memory_allocator_slab_chunk_type;
+
+struct memory_allocator_slab_block_type;
+
+/* -- Type Definitions -- */
+
+typedef struct memory_allocator_slab_impl_type *memory_allocator_slab_impl;
+
+typedef struct memory_allocator_slab_chunk_type *memory_allocator_slab_chunk;
+
+typedef struct memory_allocator_slab_block_type *memory_allocator_slab_block;
+
+/* -- Member Data -- */
+
+struct memory_allocator_slab_chunk_type
+{
+	memory_allocator_slab_chunk next;
+};
+
+struct memory_allocator_slab_block_type
+{
+	/* The header keeps the alignment of malloc, the payload of a free block stores the next link */
+	union
+	{
+		size_t id;
+		char align[MEMORY_ALLOCATOR_SLAB_ALIGNMENT];
+	} header;
+};
+
+struct memory_allocator_slab_impl_type
+{
+	size_t chunk_size;
+	memory_allocator_slab_chunk chunks;
+	uintptr_t begin;
+	uintptr_t end;
+	void *free[MEMORY_ALLOCATOR_SLAB_CLASS_SIZE];
+};
+
+/* -- Private Methods -- */
+
+static size_t memory_allocator_slab_class(size_t size);
+
+static memory_allocator_impl memory_allocator_slab_create(void *ctx);
+
+static void *memory_allocator_slab_allocate(memory_allocator_impl impl, size_t size);
+
+static void *memory_allocator_slab_reallocate(memory_allocator_impl impl, void *data, size_t size, size_t new_size);
+
+static void memory_allocator_slab_deallocate(memory_allocator_impl impl, void *data);
+
+static void memory_allocator_slab_destroy(memory_allocator_impl impl);
+
+/* -- Methods -- */
+
+memory_allocator_iface memory_allocator_slab_iface(void)
+{
+	static struct memory_allocator_iface_type allocator_slab_iface = {
+		&memory_allocator_slab_create,
+		&memory_allocator_slab_allocate,
+		&memory_allocator_slab_reallocate,
+		&memory_allocator_slab_deallocate,
+		&memory_allocator_slab_destroy
+	};
+
+	return &allocator_slab_iface;
+}
+
+size_t memory_allocator_slab_class(size_t size)
+{
+	size_t id = 0, class_size = MEMORY_ALLOCATOR_SLAB_CLASS_MIN;
+
+	while (class_size < size)
+	{
+		class_size <<= 1;
+
+		if (++id == MEMORY_ALLOCATOR_SLAB_CLASS_NONE)
+		{
+			break;
+		}
+	}
+
+	return id;
+}
+
+memory_allocator_impl memory_allocator_slab_create(void *ctx)
+{
+	memory_allocator_slab_ctx slab_ctx = (memory_allocator_slab_ctx)ctx;
+
+	memory_allocator_slab_impl slab_impl = malloc(sizeof(struct memory_allocator_slab_impl_type));
+
+	size_t id;
+
+	if (slab_impl == NULL)
+	{
+		return NULL;
+	}
+
+	slab_impl->chunk_size = slab_ctx->chunk_size;
+	slab_impl->chunks = NULL;
+	slab_impl->begin = 0;
+	slab_impl->end = 0;
+
+	for (id = 0; id < MEMORY_ALLOCATOR_SLAB_CLASS_SIZE; ++id)
+	{
+		slab_impl->free[id] = NULL;
+	}
+
+	return (memory_allocator_impl)slab_impl;
+}
+
+void *memory_allocator_slab_allocate(memory_allocator_impl impl, size_t size)
+{
+	memory_allocator_slab_impl slab_impl = (memory_allocator_slab_impl)impl;
+
+	size_t id = memory_allocator_slab_class(size);
+
+	memory_allocator_slab_block block;
+
+	if (id == MEMORY_ALLOCATOR_SLAB_CLASS_NONE)
+	{
+		block = malloc(sizeof(struct memory_allocator_slab_block_type) + size);
+
+		if (block == NULL)
+		{
+			return NULL;
+		}
+	}
+	else if (slab_impl->free[id] != NULL)
+	{
+		void *data = slab_impl->free[id];
+
+		memcpy(&slab_impl->free[id], data, sizeof(void *));
+
+		return data;
+	}
+	else
+	{
+		size_t block_size = sizeof(struct memory_allocator_slab_block_type) + (MEMORY_ALLOCATOR_SLAB_CLASS_MIN << id);
+
+		if (slab_impl->end - slab_impl->begin < block_size)
+		{
+			/* The header of the chunk is padded so blocks keep the alignment */
+			size_t chunk_header = sizeof(struct memory_allocator_slab_block_type);
+
+			memory_allocator_slab_chunk chunk = malloc(chunk_header + slab_impl->chunk_size);
+
+			if (chunk == NULL)
+			{
+				return NULL;
+			}
+
+			/* The remaining space of the previous chunk is discarded */
+			chunk->next = slab_impl->chunks;
+			slab_impl->chunks = chunk;
+			slab_impl->begin = (uintptr_t)chunk + chunk_header;
+			slab_impl->end = slab_impl->begin + slab_impl->chunk_size;
+		}
+
+		block = (memory_allocator_slab_block)slab_impl->begin;
+
+		slab_impl->begin += block_size;
+	}
+
+	block->header.id = id;
+
+	return (void *)(block + 1);
+}
+
+void *memory_allocator_slab_reallocate(memory_allocator_impl impl, void *data, size_t size, size_t new_size)
+{
+	memory_allocator_slab_block block = ((memory_allocator_slab_block)data) - 1;
+
+	void *new_data;
+
+	if (block->header.id != MEMORY_ALLOCATOR_SLAB_CLASS_NONE && new_size <= (size_t)(MEMORY_ALLOCATOR_SLAB_CLASS_MIN << block->header.id))
+	{
+		return data;
+	}
+
+	new_data = memory_allocator_slab_allocate(impl, new_size);
+
+	if (new_data == NULL)
+	{
+		return NULL;
+	}
+
+	memcpy(new_data, data, size < new_size ? size : new_size);
+
+	memory_allocator_slab_deallocate(impl, data);
+
+	return new_data;
+}
+
+void memory_allocator_slab_deallocate(memory_allocator_impl impl, void *data)
+{
+	memory_allocator_slab_impl slab_impl = (memory_allocator_slab_impl)impl;
+
+	memory_allocator_slab_block block = ((memory_allocator_slab_block)data) - 1;
+
+	size_t id = block->header.id;
+
+	if (id == MEMORY_ALLOCATOR_SLAB_CLASS_NONE)
+	{
+		free(block);
+	}
+	else
+	{
+		memcpy(data, &slab_impl->free[id], sizeof(void *));
+
+		slab_impl->free[id] = data;
+	}
+}
+
+void memory_allocator_slab_destroy(memory_allocator_impl impl)
+{
+	memory_allocator_slab_impl slab_impl = (memory_allocator_slab_impl)impl;
+
+	memory_allocator_slab_chunk chunk = slab_impl->chunks;
+
+	/* Blocks that fall back to malloc must be deallocated before destroying the allocator */
+	while (chunk != NULL)
+	{
+		memory_allocator_slab_chunk next = chunk->next;
+
+		free(chunk);
+
+		chunk = next;
+	}
+
+	free(slab_impl);
+}
@@ -643,6 +643,77 @@ METACALL_API void *metacallfv(void *func, void *args[]);
 */
 METACALL_API void *metacallfv_s(void *func, void *args[], size_t size);
 
+/**
+*  @brief
+*    Prepare a call site for function @func with argument types @ids, the signature
+*    checking and the cast planning of the arguments and the return value are done
+*    once here instead of on each call
+*
+*  @param[in] func
+*    Reference to function to be prepared, it must outlive the prepared call
+*
+*  @param[in] ids
+*    Array of types of the arguments that will be passed on each call
+*
+*  @param[in] size
+*    Number of function arguments
+*
+*  @return
+*    Pointer to the prepared call, it must be destroyed with metacall_prepared_destroy, or null on error
+*/
+METACALL_API void *metacall_prepare(void *func, const enum metacall_value_id ids[], size_t size);
+
+/**
+*  @brief
+*    Call a prepared call site by value array @args, arguments are not validated,
+*    they must have the types that were passed to metacall_prepare
+*
+*  @param[in] prepared
+*    Pointer to the prepared call returned by metacall_prepare
+*
+*  @param[in] args
+*    Array of pointers to data
+*
+*  @return
+*    Pointer to value containing the result of the call
+*/
+METACALL_API void *metacall_prepared_call(void *prepared, void *args[]);
+
+/**
+*  @brief
+*    Destroy a prepared call site
+*
+*  @param[in] prepared
+*    Pointer to the prepared call returned by metacall_prepare
+*/
+METACALL_API void metacall_prepared_destroy(void *prepared);
+
+/**
+*  @brief
+*    Call a group of functions at once, the calls to functions of a loader with batch
+*    support (i.e. RPC) are sent together, the rest of calls are executed one by one,
+*    each call is validated and casted to its signature like in metacallfv_s
+*
+*  @param[in] funcs
+*    Array of references to the functions to be called
+*
+*  @param[in] args
+*    Array of argument arrays, one for each call, the arguments can be replaced by their casted value
+*
+*  @param[in] sizes
+*    Array with the number of arguments of each call
+*
+*  @param[in] count
+*    Number of calls
+*
+*  @param[out] rets
+*    Array where the result of each call is stored, null for the calls that failed
+*
+*  @return
+*    Zero if all the calls were executed, different from zero otherwise (including invalid arguments)
+*/
+METACALL_API int metacallfv_batch_s(void *funcs[], void **args[], size_t sizes[], size_t count, void *rets[]);
+
 /**
 *  @brief
 *    Call a function anonymously by variable arguments @va_args and function @func
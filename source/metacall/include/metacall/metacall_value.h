@@ -539,6 +539,24 @@ METACALL_API void **metacall_value_to_array(void *v);
 */
 METACALL_API void **metacall_value_to_map(void *v);
 
+/**
+*  @brief
+*    Get the value associated to the string @key in the map @v,
+*    big maps are indexed on the first lookup so next ones are
+*    constant time; the index is rebuilt after metacall_value_from_map
+*    but not after modifying the tuples returned by metacall_value_to_map
+*
+*  @param[in] v
+*    Reference to the map value
+*
+*  @param[in] key
+*    String key to be looked up
+*
+*  @return
+*    Value associated to @key (owned by the map) or null if not found
+*/
+METACALL_API void *metacall_value_map_get(void *v, const char *key);
+
 /**
 *  @brief
 *    Convert value @v to pointer
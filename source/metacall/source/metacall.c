@@ -43,10 +43,23 @@
 #define METACALL_ARGS_SIZE 0x10
 #define METACALL_SERIAL	   "rapid_json"
 
+/* -- Member Data -- */
+
+struct metacall_prepared_type
+{
+	function f;		  /* Function to be called by the call site */
+	size_t size;	  /* Number of arguments of the call site */
+	size_t cast_size; /* Number of arguments that must be casted before the call (zero in the fast path) */
+	type_id *args;	  /* Type to which each argument must be casted, or TYPE_INVALID if it already matches the signature */
+	type_id ret;	  /* Type of the return value defined by the signature, or TYPE_INVALID if it is not typed */
+};
+
 /* -- Type Definitions -- */
 
 typedef value (*method_invoke_ptr)(void *, method, void *[], size_t);
 
+typedef struct metacall_prepared_type *metacall_prepared;
+
 /* -- Global Variables -- */
 
 void *metacall_null_args[1] = { NULL };
@@ -66,6 +79,8 @@ static loader_path plugin_path = { 0 };
 static int metacall_plugin_extension_load(void);
 static void *metacallv_method(void *target, const char *name, method_invoke_ptr call, vector v, void *args[], size_t size);
 static type_id *metacall_type_ids(void *args[], size_t size);
+static int metacall_function_args_cast(function f, void *args[], size_t size, const char *caller);
+static value metacall_function_return_cast(function f, value ret);
 
 /* -- Methods -- */
 
@@ -369,28 +384,24 @@ int metacall_load_from_configuration(const char *path, void **handle, void *allo
 
 void *metacallv(const char *name, void *args[])
 {
-	value f_val = loader_get(name);
-	function f = NULL;
+	function f = loader_get_function(name);
+	void *ret = metacallfv(f, args);
 
-	if (value_type_id(f_val) == TYPE_FUNCTION)
-	{
-		f = value_to_function(f_val);
-	}
+	/* Release the reference taken by the lookup, the function may have been cleared meanwhile */
+	function_destroy(f);
 
-	return metacallfv(f, args);
+	return ret;
 }
 
 void *metacallv_s(const char *name, void *args[], size_t size)
 {
-	value f_val = loader_get(name);
-	function f = NULL;
+	function f = loader_get_function(name);
+	void *ret = metacallfv_s(f, args, size);
 
-	if (value_type_id(f_val) == TYPE_FUNCTION)
-	{
-		f = value_to_function(f_val);
-	}
+	/* Release the reference taken by the lookup, the function may have been cleared meanwhile */
+	function_destroy(f);
 
-	return metacallfv_s(f, args, size);
+	return ret;
 }
 
 void *metacallhv(void *handle, const char *name, void *args[])
@@ -402,15 +413,13 @@ void *metacallhv(void *handle, const char *name, void *args[])
 		return NULL;
 	}
 
-	value f_val = loader_handle_get(handle, name);
-	function f = NULL;
+	function f = loader_handle_get_function(handle, name);
+	void *ret = metacallfv(f, args);
 
-	if (value_type_id(f_val) == TYPE_FUNCTION)
-	{
-		f = value_to_function(f_val);
-	}
+	/* Release the reference taken by the lookup, the function may have been cleared meanwhile */
+	function_destroy(f);
 
-	return metacallfv(f, args);
+	return ret;
 }
 
 void *metacallhv_s(void *handle, const char *name, void *args[], size_t size)
@@ -422,26 +431,18 @@ void *metacallhv_s(void *handle, const char *name, void *args[], size_t size)
 		return NULL;
 	}
 
-	value f_val = loader_handle_get(handle, name);
-	function f = NULL;
+	function f = loader_handle_get_function(handle, name);
+	void *ret = metacallfv_s(f, args, size);
 
-	if (value_type_id(f_val) == TYPE_FUNCTION)
-	{
-		f = value_to_function(f_val);
-	}
+	/* Release the reference taken by the lookup, the function may have been cleared meanwhile */
+	function_destroy(f);
 
-	return metacallfv_s(f, args, size);
+	return ret;
 }
 
 void *metacall(const char *name, ...)
 {
-	value f_val = loader_get(name);
-	function f = NULL;
-
-	if (value_type_id(f_val) == TYPE_FUNCTION)
-	{
-		f = value_to_function(f_val);
-	}
+	function f = loader_get_function(name);
 
 	if (f != NULL)
 	{
@@ -529,11 +530,16 @@ void *metacall(const char *name, ...)
 				{
 					value cast_ret = value_type_cast(ret, id);
 
-					return (cast_ret == NULL) ? ret : cast_ret;
+					if (cast_ret != NULL)
+					{
+						ret = cast_ret;
+					}
 				}
 			}
 		}
 
+		function_destroy(f);
+
 		return ret;
 	}
 
@@ -542,13 +548,7 @@ void *metacall(const char *name, ...)
 
 void *metacallt(const char *name, const enum metacall_value_id ids[], ...)
 {
-	value f_val = loader_get(name);
-	function f = NULL;
-
-	if (value_type_id(f_val) == TYPE_FUNCTION)
-	{
-		f = value_to_function(f_val);
-	}
+	function f = loader_get_function(name);
 
 	if (f != NULL)
 	{
@@ -633,6 +633,8 @@ void *metacallt(const char *name, const enum metacall_value_id ids[], ...)
 			value_type_destroy(args[iterator]);
 		}
 
+		function_destroy(f);
+
 		return ret;
 	}
 
@@ -641,13 +643,7 @@ void *metacallt(const char *name, const enum metacall_value_id ids[], ...)
 
 void *metacallt_s(const char *name, const enum metacall_value_id ids[], size_t size, ...)
 {
-	value f_val = loader_get(name);
-	function f = NULL;
-
-	if (value_type_id(f_val) == TYPE_FUNCTION)
-	{
-		f = value_to_function(f_val);
-	}
+	function f = loader_get_function(name);
 
 	if (f != NULL)
 	{
@@ -732,6 +728,8 @@ void *metacallt_s(const char *name, const enum metacall_value_id ids[], size_t s
 			value_type_destroy(args[iterator]);
 		}
 
+		function_destroy(f);
+
 		return ret;
 	}
 
@@ -747,13 +745,7 @@ void *metacallht_s(void *handle, const char *name, const enum metacall_value_id
 		return NULL;
 	}
 
-	value f_val = loader_handle_get(handle, name);
-	function f = NULL;
-
-	if (value_type_id(f_val) == TYPE_FUNCTION)
-	{
-		f = value_to_function(f_val);
-	}
+	function f = loader_handle_get_function(handle, name);
 
 	if (f != NULL)
 	{
@@ -838,6 +830,8 @@ void *metacallht_s(void *handle, const char *name, const enum metacall_value_id
 			value_type_destroy(args[iterator]);
 		}
 
+		function_destroy(f);
+
 		return ret;
 	}
 
@@ -983,68 +977,260 @@ void *metacallfv(void *func, void *args[])
 	return NULL;
 }
 
+int metacall_function_args_cast(function f, void *args[], size_t size, const char *caller)
+{
+	signature s = function_signature(f);
+
+	size_t iterator;
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		if (value_validate(args[iterator]) != 0)
+		{
+			// TODO: Implement type error return a value
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid argument at position %" PRIuS " when calling to %s", iterator, caller);
+			return 1;
+		}
+
+		type t = signature_get_type(s, iterator);
+
+		if (t != NULL)
+		{
+			type_id id = type_index(t);
+
+			if (id != value_type_id((value)args[iterator]))
+			{
+				value cast_arg = value_type_cast((value)args[iterator], id);
+
+				if (cast_arg != NULL)
+				{
+					args[iterator] = cast_arg;
+				}
+			}
+		}
+	}
+
+	return 0;
+}
+
+value metacall_function_return_cast(function f, value ret)
+{
+	if (ret != NULL)
+	{
+		type t = signature_get_return(function_signature(f));
+
+		if (t != NULL)
+		{
+			type_id id = type_index(t);
+
+			if (id != value_type_id(ret))
+			{
+				value cast_ret = value_type_cast(ret, id);
+
+				return (cast_ret == NULL) ? ret : cast_ret;
+			}
+		}
+	}
+
+	return ret;
+}
+
 void *metacallfv_s(void *func, void *args[], size_t size)
 {
 	function f = (function)func;
 
 	if (f != NULL)
 	{
-		signature s = function_signature(f);
+		if (metacall_function_args_cast(f, args, size, "metacallfv_s") != 0)
+		{
+			return NULL;
+		}
 
-		size_t iterator;
+		return metacall_function_return_cast(f, function_call(f, args, size));
+	}
 
-		value ret;
+	return NULL;
+}
 
-		for (iterator = 0; iterator < size; ++iterator)
+void *metacall_prepare(void *func, const enum metacall_value_id ids[], size_t size)
+{
+	function f = (function)func;
+	metacall_prepared prepared;
+	signature s;
+	size_t iterator;
+
+	if (f == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid function when preparing the call");
+		return NULL;
+	}
+
+	prepared = malloc(sizeof(struct metacall_prepared_type));
+
+	if (prepared == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid prepared call allocation");
+		return NULL;
+	}
+
+	prepared->args = NULL;
+
+	if (size > 0)
+	{
+		prepared->args = malloc(sizeof(type_id) * size);
+
+		if (prepared->args == NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid prepared call arguments allocation");
+			free(prepared);
+			return NULL;
+		}
+	}
+
+	s = function_signature(f);
+
+	prepared->f = f;
+	prepared->size = size;
+	prepared->cast_size = 0;
+
+	/* Plan the casts of the arguments, only the ones whose type differs from the signature are casted on each call */
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		type t = signature_get_type(s, iterator);
+
+		if (type_id_invalid((type_id)ids[iterator]) == 0)
 		{
-			if (value_validate(args[iterator]) != 0)
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid argument type at position %" PRIuS " when preparing the call", iterator);
+			metacall_prepared_destroy(prepared);
+			return NULL;
+		}
+
+		prepared->args[iterator] = TYPE_INVALID;
+
+		if (t != NULL)
+		{
+			type_id id = type_index(t);
+
+			if (id != (type_id)ids[iterator])
 			{
-				// TODO: Implement type error return a value
-				log_write("metacall", LOG_LEVEL_ERROR, "Invalid argument at position %" PRIuS " when calling to metacallfv_s", iterator);
-				return NULL;
+				prepared->args[iterator] = id;
+				++prepared->cast_size;
 			}
+		}
+	}
 
-			type t = signature_get_type(s, iterator);
+	{
+		type t = signature_get_return(s);
 
-			if (t != NULL)
+		prepared->ret = (t != NULL) ? type_index(t) : TYPE_INVALID;
+	}
+
+	return prepared;
+}
+
+void *metacall_prepared_call(void *prepared, void *args[])
+{
+	metacall_prepared p = (metacall_prepared)prepared;
+	value ret;
+
+	if (p == NULL)
+	{
+		return NULL;
+	}
+
+	if (p->cast_size > 0)
+	{
+		size_t iterator;
+
+		for (iterator = 0; iterator < p->size; ++iterator)
+		{
+			if (p->args[iterator] != TYPE_INVALID)
 			{
-				type_id id = type_index(t);
+				value cast_arg = value_type_cast((value)args[iterator], p->args[iterator]);
 
-				if (id != value_type_id((value)args[iterator]))
+				if (cast_arg != NULL)
 				{
-					value cast_arg = value_type_cast((value)args[iterator], id);
-
-					if (cast_arg != NULL)
-					{
-						args[iterator] = cast_arg;
-					}
+					args[iterator] = cast_arg;
 				}
 			}
 		}
+	}
 
-		ret = function_call(f, args, size);
+	ret = function_call(p->f, args, p->size);
 
-		if (ret != NULL)
+	if (ret != NULL && p->ret != TYPE_INVALID && p->ret != value_type_id(ret))
+	{
+		value cast_ret = value_type_cast(ret, p->ret);
+
+		return (cast_ret == NULL) ? ret : cast_ret;
+	}
+
+	return ret;
+}
+
+void metacall_prepared_destroy(void *prepared)
+{
+	metacall_prepared p = (metacall_prepared)prepared;
+
+	if (p != NULL)
+	{
+		if (p->args != NULL)
 		{
-			type t = signature_get_return(s);
+			free(p->args);
+		}
 
-			if (t != NULL)
-			{
-				type_id id = type_index(t);
+		free(p);
+	}
+}
 
-				if (id != value_type_id(ret))
-				{
-					value cast_ret = value_type_cast(ret, id);
+int metacallfv_batch_s(void *funcs[], void **args[], size_t sizes[], size_t count, void *rets[])
+{
+	function *batch_funcs;
+	size_t iterator;
+	int result = 0;
 
-					return (cast_ret == NULL) ? ret : cast_ret;
-				}
-			}
+	if (funcs == NULL || args == NULL || sizes == NULL || rets == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid batch call, parameters are null");
+		return 1;
+	}
+
+	batch_funcs = malloc(sizeof(function) * count);
+
+	if (batch_funcs == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid batch call allocation");
+		return 1;
+	}
+
+	/* Each call is validated and casted like in metacallfv_s, the invalid ones are not sent to the loader */
+	for (iterator = 0; iterator < count; ++iterator)
+	{
+		batch_funcs[iterator] = (function)funcs[iterator];
+
+		if (batch_funcs[iterator] != NULL && metacall_function_args_cast(batch_funcs[iterator], args[iterator], sizes[iterator], "metacallfv_batch_s") != 0)
+		{
+			batch_funcs[iterator] = NULL;
+			result = 1;
 		}
+	}
 
-		return ret;
+	if (function_batch(batch_funcs, args, sizes, count, (function_return *)rets) != 0)
+	{
+		result = 1;
 	}
 
-	return NULL;
+	for (iterator = 0; iterator < count; ++iterator)
+	{
+		if (batch_funcs[iterator] != NULL)
+		{
+			rets[iterator] = metacall_function_return_cast(batch_funcs[iterator], rets[iterator]);
+		}
+	}
+
+	free(batch_funcs);
+
+	return result;
 }
 
 void *metacallf(void *func, ...)
@@ -1495,17 +1681,16 @@ int metacall_register_loaderv(void *loader, void *context, const char *name, voi
 
 void *metacall_await(const char *name, void *args[], void *(*resolve_callback)(void *, void *), void *(*reject_callback)(void *, void *), void *data)
 {
-	value f_val = loader_get(name);
-	function f = NULL;
-
-	if (value_type_id(f_val) == TYPE_FUNCTION)
-	{
-		f = value_to_function(f_val);
-	}
+	function f = loader_get_function(name);
+	void *ret;
 
 	signature s = function_signature(f);
 
-	return function_await(f, args, signature_count(s), resolve_callback, reject_callback, data);
+	ret = function_await(f, args, signature_count(s), resolve_callback, reject_callback, data);
+
+	function_destroy(f);
+
+	return ret;
 }
 
 void *metacall_await_future(void *f, void *(*resolve_callback)(void *, void *), void *(*reject_callback)(void *, void *), void *data)
@@ -1521,15 +1706,14 @@ void *metacall_await_future(void *f, void *(*resolve_callback)(void *, void *),
 
 void *metacall_await_s(const char *name, void *args[], size_t size, void *(*resolve_callback)(void *, void *), void *(*reject_callback)(void *, void *), void *data)
 {
-	value f_val = loader_get(name);
-	function f = NULL;
+	function f = loader_get_function(name);
+	void *ret;
 
-	if (value_type_id(f_val) == TYPE_FUNCTION)
-	{
-		f = value_to_function(f_val);
-	}
+	ret = function_await(f, args, size, resolve_callback, reject_callback, data);
+
+	function_destroy(f);
 
-	return function_await(f, args, size, resolve_callback, reject_callback, data);
+	return ret;
 }
 
 void *metacallfv_await(void *func, void *args[], void *(*resolve_callback)(void *, void *), void *(*reject_callback)(void *, void *), void *data)
@@ -2220,6 +2404,9 @@ int metacall_destroy(void)
 		/* Print stats from functions, classes, objects and exceptions */
 		reflect_memory_tracker_debug();
 
+		/* Return the cached values of this thread and release the value allocator */
+		value_cache_destroy();
+
 		/* Set to null the plugin extension */
 		plugin_extension_handle = NULL;
 	}
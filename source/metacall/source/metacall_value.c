@@ -305,6 +305,13 @@ void **metacall_value_to_map(void *v)
 	return value_to_map(v);
 }
 
+void *metacall_value_map_get(void *v, const char *key)
+{
+	assert(value_type_id(v) == TYPE_MAP);
+
+	return value_map_get(v, key);
+}
+
 void *metacall_value_to_ptr(void *v)
 {
 	assert(value_type_id(v) == TYPE_PTR);
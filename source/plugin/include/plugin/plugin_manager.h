@@ -30,6 +30,8 @@
 
 #include <adt/adt_set.h>
 
+#include <threading/threading_left_right.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -54,12 +56,13 @@ typedef struct plugin_manager_interface_type *plugin_manager_interface;
 
 struct plugin_manager_type
 {
-	char *name;						/* Defines the plugin manager name (a pointer to a static string defining the manager type) */
-	char *library_path;				/* Defines current library path */
-	set plugins;					/* Contains the plugins indexed by name */
-	plugin_manager_interface iface; /* Hooks into the plugin manager from the implementation */
-	void *impl;						/* User defined plugin manager data */
-	plugin_loader l;				/* Pointer to the loader, it defines the low level details for loading and unloading libraries */
+	char *name;								/* Defines the plugin manager name (a pointer to a static string defining the manager type) */
+	char *library_path;						/* Defines current library path */
+	set plugins[THREADING_LEFT_RIGHT_SIZE]; /* Contains the plugins indexed by name (one set per left-right instance) */
+	plugin_manager_interface iface;			/* Hooks into the plugin manager from the implementation */
+	void *impl;								/* User defined plugin manager data */
+	plugin_loader l;						/* Pointer to the loader, it defines the low level details for loading and unloading libraries */
+	threading_left_right lr;				/* Protects the plugins sets, lookups never wait and registrations are applied to each instance in turns */
 };
 
 struct plugin_manager_interface_type
@@ -82,6 +85,8 @@ PLUGIN_API size_t plugin_manager_size(plugin_manager manager);
 
 PLUGIN_API int plugin_manager_register(plugin_manager manager, plugin p);
 
+PLUGIN_API plugin plugin_manager_insert(plugin_manager manager, plugin p);
+
 PLUGIN_API plugin plugin_manager_create(plugin_manager manager, const char *name, void *impl, void (*dtor)(plugin));
 
 PLUGIN_API plugin plugin_manager_get(plugin_manager manager, const char *name);
@@ -39,11 +39,27 @@ struct plugin_manager_iterate_cb_type
 	void *data;
 };
 
+struct plugin_manager_register_cb_type
+{
+	plugin_manager manager;
+	plugin p;
+	plugin registered;
+};
+
+struct plugin_manager_unregister_cb_type
+{
+	plugin_manager manager;
+	plugin p;
+};
+
 /* -- Private Methods -- */
 
+static int plugin_manager_register_cb(size_t instance, void *data);
+static int plugin_manager_unregister_cb(size_t instance, void *data);
 static int plugin_manager_unregister(plugin_manager manager, plugin p);
 static int plugin_manager_iterate_cb(set s, set_key key, set_value val, set_cb_iterate_args args);
 static int plugin_manager_destroy_cb(set s, set_key key, set_value val, set_cb_iterate_args args);
+static void plugin_manager_destroy_plugins(plugin_manager manager);
 
 /* -- Methods -- */
 
@@ -83,14 +99,33 @@ int plugin_manager_initialize(plugin_manager manager, const char *name, const ch
 	manager->iface = iface;
 	manager->impl = impl;
 
-	/* Allocate the set which maps the plugins by their name */
-	if (manager->plugins == NULL)
+	/* Allocate the sets which map the plugins by their name (one per left-right instance) */
+	if (manager->plugins[0] == NULL)
 	{
-		manager->plugins = set_create(&hash_callback_str, &comparable_callback_str);
+		size_t iterator;
+
+		for (iterator = 0; iterator < THREADING_LEFT_RIGHT_SIZE; ++iterator)
+		{
+			manager->plugins[iterator] = set_create(&hash_callback_str, &comparable_callback_str);
 
-		if (manager->plugins == NULL)
+			if (manager->plugins[iterator] == NULL)
+			{
+				log_write("metacall", LOG_LEVEL_ERROR, "Invalid plugin manager set initialization");
+
+				plugin_manager_destroy_plugins(manager);
+
+				plugin_manager_destroy(manager);
+
+				return 1;
+			}
+		}
+
+		/* The left-right lives as long as the sets that it protects */
+		if (threading_left_right_create(&manager->lr) != 0)
 		{
-			log_write("metacall", LOG_LEVEL_ERROR, "Invalid plugin manager set initialization");
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid plugin manager lock initialization");
+
+			plugin_manager_destroy_plugins(manager);
 
 			plugin_manager_destroy(manager);
 
@@ -171,25 +206,78 @@ void *plugin_manager_impl(plugin_manager manager)
 
 size_t plugin_manager_size(plugin_manager manager)
 {
-	return set_size(manager->plugins);
+	size_t size, instance, version = threading_left_right_read_lock(manager->lr, &instance);
+
+	size = set_size(manager->plugins[instance]);
+
+	threading_left_right_read_unlock(manager->lr, version);
+
+	return size;
+}
+
+int plugin_manager_register_cb(size_t instance, void *data)
+{
+	struct plugin_manager_register_cb_type *args = (struct plugin_manager_register_cb_type *)data;
+	set plugins = args->manager->plugins[instance];
+	const char *name = plugin_name(args->p);
+
+	args->registered = set_get(plugins, (set_key)name);
+
+	/* A retry of the write finds the plugin inserted by the failed attempt */
+	if (args->registered == args->p)
+	{
+		return 0;
+	}
+
+	if (args->registered != NULL)
+	{
+		return 1;
+	}
+
+	if (set_insert(plugins, (set_key)name, args->p) != 0)
+	{
+		return 1;
+	}
+
+	args->registered = args->p;
+
+	return 0;
 }
 
 int plugin_manager_register(plugin_manager manager, plugin p)
 {
-	const char *name = plugin_name(p);
+	plugin registered = plugin_manager_insert(manager, p);
 
-	if (set_get(manager->plugins, (set_key)name) != NULL)
+	if (registered != p)
 	{
-		log_write("metacall", LOG_LEVEL_ERROR, "Failed to register plugin %s into manager %s, it already exists", name, manager->name);
+		if (registered != NULL)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Failed to register plugin %s into manager %s, it already exists", plugin_name(p), manager->name);
+		}
 
 		return 1;
 	}
 
-	return set_insert(manager->plugins, (set_key)name, p);
+	return 0;
+}
+
+plugin plugin_manager_insert(plugin_manager manager, plugin p)
+{
+	struct plugin_manager_register_cb_type args = {
+		manager,
+		p,
+		NULL
+	};
+
+	threading_left_right_write(manager->lr, &plugin_manager_register_cb, (void *)&args);
+
+	return args.registered;
 }
 
 plugin plugin_manager_create(plugin_manager manager, const char *name, void *impl, void (*dtor)(plugin))
 {
+	plugin registered;
+
 	/* Check if plugin is already loaded and return it */
 	plugin p = plugin_manager_get(manager, name);
 
@@ -206,19 +294,26 @@ plugin plugin_manager_create(plugin_manager manager, const char *name, void *imp
 		return NULL;
 	}
 
-	/* Register plugin into the plugin manager set */
-	if (plugin_manager_register(manager, p) != 0)
+	/* Register plugin into the plugin manager set, if another thread registered it meanwhile, destroy this one and use the registered one */
+	registered = plugin_manager_insert(manager, p);
+
+	if (registered != p)
 	{
 		plugin_destroy(p);
-		return NULL;
 	}
 
-	return p;
+	return registered;
 }
 
 plugin plugin_manager_get(plugin_manager manager, const char *name)
 {
-	return set_get(manager->plugins, (set_key)name);
+	size_t instance, version = threading_left_right_read_lock(manager->lr, &instance);
+
+	plugin p = set_get(manager->plugins[instance], (set_key)name);
+
+	threading_left_right_read_unlock(manager->lr, version);
+
+	return p;
 }
 
 int plugin_manager_iterate_cb(set s, set_key key, set_value val, set_cb_iterate_args args)
@@ -248,21 +343,37 @@ void plugin_manager_iterate(plugin_manager manager, int (*iterator)(plugin_manag
 		data
 	};
 
-	set_iterate(manager->plugins, &plugin_manager_iterate_cb, (void *)&args);
+	size_t instance, version = threading_left_right_read_lock(manager->lr, &instance);
+
+	set_iterate(manager->plugins[instance], &plugin_manager_iterate_cb, (void *)&args);
+
+	threading_left_right_read_unlock(manager->lr, version);
 }
 
-int plugin_manager_unregister(plugin_manager manager, plugin p)
+int plugin_manager_unregister_cb(size_t instance, void *data)
 {
-	const char *name = plugin_name(p);
+	struct plugin_manager_unregister_cb_type *args = (struct plugin_manager_unregister_cb_type *)data;
+	set plugins = args->manager->plugins[instance];
+	const char *name = plugin_name(args->p);
 
-	if (set_get(manager->plugins, (set_key)name) == NULL)
+	if (set_get(plugins, (set_key)name) != NULL && set_remove(plugins, (const set_key)name) == NULL)
 	{
-		return 0;
+		return 1;
 	}
 
-	if (set_remove(manager->plugins, (const set_key)name) == NULL)
+	return 0;
+}
+
+int plugin_manager_unregister(plugin_manager manager, plugin p)
+{
+	struct plugin_manager_unregister_cb_type args = {
+		manager,
+		p
+	};
+
+	if (threading_left_right_write(manager->lr, &plugin_manager_unregister_cb, (void *)&args) != 0)
 	{
-		log_write("metacall", LOG_LEVEL_ERROR, "Failed to unregister plugin %s from manager %s", name, manager->name);
+		log_write("metacall", LOG_LEVEL_ERROR, "Failed to unregister plugin %s from manager %s", plugin_name(p), manager->name);
 
 		return 1;
 	}
@@ -286,6 +397,20 @@ int plugin_manager_clear(plugin_manager manager, plugin p)
 	return result;
 }
 
+void plugin_manager_destroy_plugins(plugin_manager manager)
+{
+	size_t iterator;
+
+	for (iterator = 0; iterator < THREADING_LEFT_RIGHT_SIZE; ++iterator)
+	{
+		if (manager->plugins[iterator] != NULL)
+		{
+			set_destroy(manager->plugins[iterator]);
+			manager->plugins[iterator] = NULL;
+		}
+	}
+}
+
 int plugin_manager_destroy_cb(set s, set_key key, set_value val, set_cb_iterate_args args)
 {
 	int result = 0;
@@ -325,9 +450,10 @@ void plugin_manager_destroy(plugin_manager manager)
 
 	/* Unload and destroy each plugin. The destroy callback is executed before this so the user can clear the
 	* plugin set and this will do nothing if the set has been emptied before with plugin_manager_clear */
-	if (manager->plugins != NULL)
+	if (manager->plugins[0] != NULL)
 	{
-		set_iterate(manager->plugins, &plugin_manager_destroy_cb, NULL);
+		/* All the instances contain the same plugins, destroy them only once */
+		set_iterate(manager->plugins[0], &plugin_manager_destroy_cb, NULL);
 	}
 
 	/* Clear the name */
@@ -337,11 +463,12 @@ void plugin_manager_destroy(plugin_manager manager)
 		manager->name = NULL;
 	}
 
-	/* Destroy the plugin set */
-	if (manager->plugins != NULL)
+	/* Destroy the plugin sets */
+	if (manager->plugins[0] != NULL)
 	{
-		set_destroy(manager->plugins);
-		manager->plugins = NULL;
+		plugin_manager_destroy_plugins(manager);
+
+		threading_left_right_destroy(manager->lr);
 	}
 
 	/* Clear the library path */
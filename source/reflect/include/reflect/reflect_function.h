@@ -51,6 +51,8 @@ typedef function_return (*function_impl_interface_await)(function, function_impl
 
 typedef void (*function_impl_interface_destroy)(function, function_impl);
 
+typedef int (*function_impl_interface_batch)(function[], function_impl[], void **[], size_t[], size_t, function_return[]);
+
 typedef struct function_interface_type
 {
 	function_impl_interface_create create;
@@ -58,6 +60,13 @@ typedef struct function_interface_type
 	function_impl_interface_await await;
 	function_impl_interface_destroy destroy;
 
+	/*
+	* Optional, it is the last member so the interfaces that do not list it are zero initialized,
+	* when it is NULL the calls of a batch are invoked one by one. Loaders built as plugins
+	* against a version of this structure without it must be recompiled, the size has changed
+	*/
+	function_impl_interface_batch batch;
+
 } * function_interface;
 
 typedef function_interface (*function_impl_interface_singleton)(void);
@@ -86,6 +95,8 @@ REFLECT_API function_return function_call(function func, function_args args, siz
 
 REFLECT_API function_return function_await(function func, function_args args, size_t size, function_resolve_callback resolve_callback, function_reject_callback reject_callback, void *context);
 
+REFLECT_API int function_batch(function funcs[], void **args[], size_t sizes[], size_t count, function_return rets[]);
+
 REFLECT_API void function_stats_debug(void);
 
 REFLECT_API void function_destroy(function func);
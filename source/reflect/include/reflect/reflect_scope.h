@@ -48,6 +48,8 @@ REFLECT_API value scope_export(scope sp);
 
 REFLECT_API value scope_get(scope sp, const char *key);
 
+REFLECT_API function scope_get_function(scope sp, const char *key);
+
 REFLECT_API value scope_undef(scope sp, const char *key);
 
 REFLECT_API int scope_append(scope dest, scope src);
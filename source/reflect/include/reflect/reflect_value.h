@@ -125,7 +125,8 @@ REFLECT_API size_t value_size(value v);
 
 /**
 *  @brief
-*    Increment reference count of a value
+*    Increment reference count of a value, the counter
+*    is atomic when built with OPTION_THREAD_SAFE
 *
 *  @param[in] v
 *    Reference to the value
@@ -134,13 +135,55 @@ REFLECT_API void value_ref_inc(value v);
 
 /**
 *  @brief
-*    Decrement reference count of a value
+*    Decrement reference count of a value, and destroy it
+*    when the last reference is released
 *
 *  @param[in] v
 *    Reference to the value
 */
 REFLECT_API void value_ref_dec(value v);
 
+/**
+*  @brief
+*    Get the lookup index attached to a value
+*
+*  @param[in] v
+*    Reference to the value
+*
+*  @return
+*    Pointer to the index or null if there is none
+*/
+REFLECT_API void *value_index(value v);
+
+/**
+*  @brief
+*    Attach a lookup index to a value, the owner of the value
+*    must detach and destroy it before destroying the value
+*
+*  @param[in] v
+*    Reference to the value
+*
+*  @param[in] index
+*    Pointer to the index
+*
+*  @return
+*    Returns zero on success, different from zero if the value
+*    already has an index attached (i.e another thread won the race)
+*/
+REFLECT_API int value_index_attach(value v, void *index);
+
+/**
+*  @brief
+*    Detach the lookup index from a value
+*
+*  @param[in] v
+*    Reference to the value
+*
+*  @return
+*    Pointer to the detached index or null if there was none
+*/
+REFLECT_API void *value_index_detach(value v);
+
 /**
 *  @brief
 *    Set up the value finalizer, a callback that
@@ -157,6 +200,18 @@ REFLECT_API void value_ref_dec(value v);
 */
 REFLECT_API void value_finalizer(value v, value_finalizer_cb finalizer, void *finalizer_data);
 
+/**
+*  @brief
+*    Get the finalizer of the value
+*
+*  @param[in] v
+*    Reference to the value
+*
+*  @return
+*    Reference to the callback, null if the value has no finalizer
+*/
+REFLECT_API value_finalizer_cb value_finalizer_get(value v);
+
 /**
 *  @brief
 *    Get pointer reference to value data
@@ -204,13 +259,21 @@ REFLECT_API value value_from(value v, const void *data, size_t bytes);
 
 /**
 *  @brief
-*    Destroy a value from scope stack
+*    Destroy a value from scope stack, if the value is shared
+*    with value_ref_inc only the reference of the caller is released
 *
 *  @param[in] v
 *    Reference to the value
 */
 REFLECT_API void value_destroy(value v);
 
+/**
+*  @brief
+*    Return the values cached by the current thread to the shared depot and destroy it
+*    once all of its blocks have been released, other threads return their caches on exit
+*/
+REFLECT_API void value_cache_destroy(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -221,6 +221,31 @@ REFLECT_API value value_create_string(const char *str, size_t length);
 */
 REFLECT_API value value_create_buffer(const void *buffer, size_t size);
 
+/**
+*  @brief
+*    Create a value buffer that borrows the memory block @buffer
+*    instead of copying it, the memory must stay valid until
+*    @release is called when the value life ends, the copies of
+*    the value own their memory, and the value can not have
+*    another finalizer
+*
+*  @param[in] buffer
+*    Writable memory block shared with the value
+*
+*  @param[in] size
+*    Size in bytes of the memory block
+*
+*  @param[in] release
+*    Callback executed when the value is destroyed (it can be null)
+*
+*  @param[in] release_data
+*    Reference to additional data to be passed to @release
+*
+*  @return
+*    Pointer to value if success, null otherwhise
+*/
+REFLECT_API value value_create_buffer_borrow(void *buffer, size_t size, value_finalizer_cb release, void *release_data);
+
 /**
 *  @brief
 *    Create a value array from array of values @values
@@ -491,6 +516,24 @@ REFLECT_API value *value_to_array(value v);
 */
 REFLECT_API value *value_to_map(value v);
 
+/**
+*  @brief
+*    Get the value associated to the string @key in the map @v,
+*    big maps build a hash index lazily on the first lookup, which is
+*    invalidated by value_from_map; modifications done directly over
+*    the array returned by value_to_map are not tracked by the index
+*
+*  @param[in] v
+*    Reference to the map value
+*
+*  @param[in] key
+*    String key to be looked up
+*
+*  @return
+*    Value associated to @key (owned by the map) or null if not found
+*/
+REFLECT_API value value_map_get(value v, const char *key);
+
 /**
 *  @brief
 *    Convert value @v to pointer
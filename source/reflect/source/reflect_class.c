@@ -838,12 +838,23 @@ void class_destroy(klass cls)
 {
 	if (cls != NULL)
 	{
-		if (class_decrement_reference(cls) != 0)
+		int last = 0;
+
+		/* The decrement and the check must be done in one step, otherwise two threads releasing
+		* the last two references could both observe zero and destroy the class twice */
+		if (threading_atomic_ref_count_release(&cls->ref, &last) != 0)
 		{
 			log_write("metacall", LOG_LEVEL_ERROR, "Invalid reference counter in class: %s", cls->name ? cls->name : "<anonymous>");
+
+			/* A class without references has not been retained by any value, so it is destroyed directly */
+			last = 1;
+		}
+		else
+		{
+			reflect_memory_tracker_decrement(class_stats);
 		}
 
-		if (threading_atomic_ref_count_load(&cls->ref) == 0)
+		if (last != 0)
 		{
 			/* TODO: Disable logs here until log is completely thread safe and async signal safe */
 
@@ -630,6 +630,104 @@ function_return function_await(function func, function_args args, size_t size, f
 	return NULL;
 }
 
+int function_batch(function funcs[], void **args[], size_t sizes[], size_t count, function_return rets[])
+{
+	function *group_funcs;
+	function_impl *group_impls;
+	void ***group_args;
+	size_t *group_sizes, *group_index;
+	function_return *group_rets;
+	char *done;
+	size_t iterator;
+	int result = 0;
+
+	if (funcs == NULL || args == NULL || sizes == NULL || rets == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid function batch, parameters are null");
+
+		return 1;
+	}
+
+	group_funcs = malloc(sizeof(function) * count);
+	group_impls = malloc(sizeof(function_impl) * count);
+	group_args = malloc(sizeof(void **) * count);
+	group_sizes = malloc(sizeof(size_t) * count);
+	group_index = malloc(sizeof(size_t) * count);
+	group_rets = malloc(sizeof(function_return) * count);
+	done = calloc(count, sizeof(char));
+
+	if (group_funcs == NULL || group_impls == NULL || group_args == NULL || group_sizes == NULL || group_index == NULL || group_rets == NULL || done == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid function batch allocation");
+
+		result = 1;
+
+		goto free_groups;
+	}
+
+	for (iterator = 0; iterator < count; ++iterator)
+	{
+		rets[iterator] = NULL;
+	}
+
+	for (iterator = 0; iterator < count; ++iterator)
+	{
+		function func = funcs[iterator];
+		size_t group, group_size = 0;
+
+		if (done[iterator] != 0)
+		{
+			continue;
+		}
+
+		if (func == NULL || func->interface == NULL || func->interface->batch == NULL)
+		{
+			rets[iterator] = function_call(func, args[iterator], sizes[iterator]);
+			done[iterator] = 1;
+			continue;
+		}
+
+		/* Group the rest of calls with the same interface, they belong to the same loader */
+		for (group = iterator; group < count; ++group)
+		{
+			if (done[group] == 0 && funcs[group] != NULL && funcs[group]->interface == func->interface)
+			{
+				group_funcs[group_size] = funcs[group];
+				group_impls[group_size] = funcs[group]->impl;
+				group_args[group_size] = args[group];
+				group_sizes[group_size] = sizes[group];
+				group_rets[group_size] = NULL;
+				group_index[group_size] = group;
+				done[group] = 1;
+				++group_size;
+			}
+		}
+
+		if (func->interface->batch(group_funcs, group_impls, group_args, group_sizes, group_size, group_rets) != 0)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Invalid function batch of %" PRIuS " calls", group_size);
+
+			result = 1;
+		}
+
+		for (group = 0; group < group_size; ++group)
+		{
+			rets[group_index[group]] = group_rets[group];
+		}
+	}
+
+free_groups:
+	free(group_funcs);
+	free(group_impls);
+	free(group_args);
+	free(group_sizes);
+	free(group_index);
+	free(group_rets);
+	free(done);
+
+	return result;
+}
+
 void function_stats_debug(void)
 {
 	reflect_memory_tracker_print(function_stats, "FUNCTIONS");
@@ -639,12 +737,23 @@ void function_destroy(function func)
 {
 	if (func != NULL)
 	{
-		if (function_decrement_reference(func) != 0)
+		int last = 0;
+
+		/* The decrement and the check must be done in one step, the lookups of the calls hold
+		* references too, so the last reference can be released from any thread */
+		if (threading_atomic_ref_count_release(&func->ref, &last) != 0)
 		{
 			log_write("metacall", LOG_LEVEL_ERROR, "Invalid reference counter in function: %s", func->name ? func->name : "<anonymous>");
+
+			/* A function without references has not been retained by any value, so it is destroyed directly */
+			last = 1;
+		}
+		else
+		{
+			reflect_memory_tracker_decrement(function_stats);
 		}
 
-		if (threading_atomic_ref_count_load(&func->ref) == 0)
+		if (last != 0)
 		{
 			/* TODO: Disable logs here until log is completely thread safe and async signal safe */
 
@@ -389,12 +389,23 @@ void object_destroy(object obj)
 {
 	if (obj != NULL)
 	{
-		if (object_decrement_reference(obj) != 0)
+		int last = 0;
+
+		/* The decrement and the check must be done in one step, otherwise two threads releasing
+		* the last two references could both observe zero and destroy the object twice */
+		if (threading_atomic_ref_count_release(&obj->ref, &last) != 0)
 		{
 			log_write("metacall", LOG_LEVEL_ERROR, "Invalid reference counter in object: %s", obj->name ? obj->name : "<anonymous>");
+
+			/* A object without references has not been retained by any value, so it is destroyed directly */
+			last = 1;
+		}
+		else
+		{
+			reflect_memory_tracker_decrement(object_stats);
 		}
 
-		if (threading_atomic_ref_count_load(&obj->ref) == 0)
+		if (last != 0)
 		{
 			/* TODO: Disable logs here until log is completely thread safe and async signal safe */
 
@@ -25,6 +25,8 @@
 #include <adt/adt_set.h>
 #include <adt/adt_vector.h>
 
+#include <threading/threading_left_right.h>
+
 #include <log/log.h>
 
 #include <stdlib.h>
@@ -40,9 +42,30 @@ typedef struct scope_export_cb_iterator_type *scope_export_cb_iterator;
 
 struct scope_type
 {
-	char *name;		   /**< Scope name */
-	set objects;	   /**< Map of scope objects indexed by name string */
-	vector call_stack; /**< Scope call stack */
+	char *name;								/**< Scope name */
+	set objects[THREADING_LEFT_RIGHT_SIZE];	/**< Map of scope objects indexed by name string (one per left-right instance) */
+	vector call_stack;						/**< Scope call stack */
+	threading_left_right lr;				/**< Protects the objects, lookups never wait and definitions are applied to each instance in turns */
+};
+
+struct scope_define_cb_type
+{
+	scope sp;
+	const char *key;
+	value val;
+};
+
+struct scope_undef_cb_type
+{
+	scope sp;
+	const char *key;
+	value val;
+};
+
+struct scope_merge_cb_type
+{
+	scope dest;
+	set src;
 };
 
 struct scope_metadata_array_cb_iterator_type
@@ -72,6 +95,28 @@ static value scope_metadata_name(scope sp);
 
 static int scope_destroy_cb_iterate(set s, set_key key, set_value val, set_cb_iterate_args args);
 
+static void scope_objects_destroy(scope sp, size_t size);
+
+static int scope_define_cb(size_t instance, void *data);
+
+static int scope_undef_cb(size_t instance, void *data);
+
+static int scope_append_cb(size_t instance, void *data);
+
+static int scope_remove_cb(size_t instance, void *data);
+
+static int scope_merge(scope dest, scope src, threading_left_right_write_cb cb);
+
+void scope_objects_destroy(scope sp, size_t size)
+{
+	size_t iterator;
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		set_destroy(sp->objects[iterator]);
+	}
+}
+
 scope scope_create(const char *name)
 {
 	if (name != NULL)
@@ -84,6 +129,8 @@ scope scope_create(const char *name)
 
 			size_t *call_stack_head = NULL;
 
+			size_t iterator;
+
 			sp->name = malloc(sizeof(char) * sp_name_size);
 
 			if (sp->name == NULL)
@@ -97,17 +144,22 @@ scope scope_create(const char *name)
 
 			memcpy(sp->name, name, sp_name_size);
 
-			sp->objects = set_create(&hash_callback_str, &comparable_callback_str);
-
-			if (sp->objects == NULL)
+			for (iterator = 0; iterator < THREADING_LEFT_RIGHT_SIZE; ++iterator)
 			{
-				log_write("metacall", LOG_LEVEL_ERROR, "Scope create map bad allocation");
+				sp->objects[iterator] = set_create(&hash_callback_str, &comparable_callback_str);
 
-				free(sp->name);
+				if (sp->objects[iterator] == NULL)
+				{
+					log_write("metacall", LOG_LEVEL_ERROR, "Scope create map bad allocation");
 
-				free(sp);
+					scope_objects_destroy(sp, iterator);
 
-				return NULL;
+					free(sp->name);
+
+					free(sp);
+
+					return NULL;
+				}
 			}
 
 			sp->call_stack = vector_create(sizeof(char));
@@ -116,7 +168,7 @@ scope scope_create(const char *name)
 			{
 				log_write("metacall", LOG_LEVEL_ERROR, "Scope create call stack bad allocation");
 
-				set_destroy(sp->objects);
+				scope_objects_destroy(sp, THREADING_LEFT_RIGHT_SIZE);
 
 				free(sp->name);
 
@@ -131,7 +183,7 @@ scope scope_create(const char *name)
 
 				vector_destroy(sp->call_stack);
 
-				set_destroy(sp->objects);
+				scope_objects_destroy(sp, THREADING_LEFT_RIGHT_SIZE);
 
 				free(sp->name);
 
@@ -148,6 +200,21 @@ scope scope_create(const char *name)
 
 				memcpy(call_stack_head, &head_index, sizeof(size_t));
 
+				if (threading_left_right_create(&sp->lr) != 0)
+				{
+					log_write("metacall", LOG_LEVEL_ERROR, "Scope create lock initialization error");
+
+					vector_destroy(sp->call_stack);
+
+					scope_objects_destroy(sp, THREADING_LEFT_RIGHT_SIZE);
+
+					free(sp->name);
+
+					free(sp);
+
+					return NULL;
+				}
+
 				return sp;
 			}
 
@@ -170,24 +237,48 @@ size_t scope_size(scope sp)
 {
 	if (sp != NULL)
 	{
-		return set_size(sp->objects);
+		size_t size, instance, version = threading_left_right_read_lock(sp->lr, &instance);
+
+		size = set_size(sp->objects[instance]);
+
+		threading_left_right_read_unlock(sp->lr, version);
+
+		return size;
 	}
 
 	return 0;
 }
 
+int scope_define_cb(size_t instance, void *data)
+{
+	struct scope_define_cb_type *define = (struct scope_define_cb_type *)data;
+	set objects = define->sp->objects[instance];
+
+	value v = (value)set_get(objects, (set_key)define->key);
+
+	/* A retry of the write finds the value inserted by the failed attempt */
+	if (v == define->val)
+	{
+		return 0;
+	}
+
+	if (v != NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Scope failed to define a object with key '%s', this key as already been defined", define->key);
+
+		return 1;
+	}
+
+	return set_insert(objects, (set_key)define->key, (set_value)define->val);
+}
+
 int scope_define(scope sp, const char *key, value val)
 {
 	if (sp != NULL && key != NULL && val != NULL)
 	{
-		if (set_contains(sp->objects, (set_key)key) == 0)
-		{
-			log_write("metacall", LOG_LEVEL_ERROR, "Scope failed to define a object with key '%s', this key as already been defined", (char *)key);
+		struct scope_define_cb_type define = { sp, key, val };
 
-			return 1;
-		}
-
-		return set_insert(sp->objects, (set_key)key, (set_value)val);
+		return threading_left_right_write(sp->lr, &scope_define_cb, &define);
 	}
 
 	return 1;
@@ -249,12 +340,15 @@ int scope_metadata_array(scope sp, value v_array[3])
 		NULL, NULL, NULL, 0, 0, 0
 	};
 
-	set_iterate(sp->objects, &scope_metadata_array_cb_iterate_counter, (set_cb_iterate_args)&metadata_iterator);
+	size_t instance, version = threading_left_right_read_lock(sp->lr, &instance);
+
+	set_iterate(sp->objects[instance], &scope_metadata_array_cb_iterate_counter, (set_cb_iterate_args)&metadata_iterator);
 
 	value functions_val = value_create_array(NULL, metadata_iterator.functions_size);
 
 	if (functions_val == NULL)
 	{
+		threading_left_right_read_unlock(sp->lr, version);
 		return 1;
 	}
 
@@ -264,6 +358,7 @@ int scope_metadata_array(scope sp, value v_array[3])
 
 	if (classes_val == NULL)
 	{
+		threading_left_right_read_unlock(sp->lr, version);
 		value_destroy(functions_val);
 		return 1;
 	}
@@ -274,6 +369,7 @@ int scope_metadata_array(scope sp, value v_array[3])
 
 	if (objects_val == NULL)
 	{
+		threading_left_right_read_unlock(sp->lr, version);
 		value_destroy(functions_val);
 		value_destroy(classes_val);
 		return 1;
@@ -286,7 +382,9 @@ int scope_metadata_array(scope sp, value v_array[3])
 	metadata_iterator.functions_size = 0;
 	metadata_iterator.objects_size = 0;
 
-	set_iterate(sp->objects, &scope_metadata_array_cb_iterate, (set_cb_iterate_args)&metadata_iterator);
+	set_iterate(sp->objects[instance], &scope_metadata_array_cb_iterate, (set_cb_iterate_args)&metadata_iterator);
+
+	threading_left_right_read_unlock(sp->lr, version);
 
 	v_array[0] = functions_val;
 	v_array[1] = classes_val;
@@ -424,17 +522,25 @@ value scope_export(scope sp)
 {
 	struct scope_export_cb_iterator_type export_iterator;
 
-	value export = value_create_map(NULL, scope_size(sp));
+	value export;
+
+	size_t instance, version = threading_left_right_read_lock(sp->lr, &instance);
+
+	export = value_create_map(NULL, set_size(sp->objects[instance]));
 
 	if (export == NULL)
 	{
+		threading_left_right_read_unlock(sp->lr, version);
+
 		return NULL;
 	}
 
 	export_iterator.iterator = 0;
 	export_iterator.values = value_to_map(export);
 
-	set_iterate(sp->objects, &scope_export_cb_iterate, (set_cb_iterate_args)&export_iterator);
+	set_iterate(sp->objects[instance], &scope_export_cb_iterate, (set_cb_iterate_args)&export_iterator);
+
+	threading_left_right_read_unlock(sp->lr, version);
 
 	return export;
 }
@@ -443,35 +549,150 @@ value scope_get(scope sp, const char *key)
 {
 	if (sp != NULL && key != NULL)
 	{
-		return (value)set_get(sp->objects, (set_key)key);
+		size_t instance, version = threading_left_right_read_lock(sp->lr, &instance);
+
+		value v = (value)set_get(sp->objects[instance], (set_key)key);
+
+		threading_left_right_read_unlock(sp->lr, version);
+
+		return v;
+	}
+
+	return NULL;
+}
+
+function scope_get_function(scope sp, const char *key)
+{
+	if (sp != NULL && key != NULL)
+	{
+		size_t instance, version = threading_left_right_read_lock(sp->lr, &instance);
+
+		value v = (value)set_get(sp->objects[instance], (set_key)key);
+
+		function f = NULL;
+
+		/* The reference is taken before leaving the read section, an undefinition waits for it
+		* to finish before returning, so the function can not be destroyed in the meantime */
+		if (v != NULL && value_type_id(v) == TYPE_FUNCTION)
+		{
+			f = value_to_function(v);
+
+			if (function_increment_reference(f) != 0)
+			{
+				f = NULL;
+			}
+		}
+
+		threading_left_right_read_unlock(sp->lr, version);
+
+		return f;
 	}
 
 	return NULL;
 }
 
+int scope_undef_cb(size_t instance, void *data)
+{
+	struct scope_undef_cb_type *undef = (struct scope_undef_cb_type *)data;
+
+	undef->val = (value)set_remove(undef->sp->objects[instance], (set_key)undef->key);
+
+	return 0;
+}
+
 value scope_undef(scope sp, const char *key)
 {
 	if (sp != NULL && key != NULL)
 	{
-		return (value)set_remove(sp->objects, (set_key)key);
+		struct scope_undef_cb_type undef = { sp, key, NULL };
+
+		if (threading_left_right_write(sp->lr, &scope_undef_cb, &undef) != 0)
+		{
+			return NULL;
+		}
+
+		return undef.val;
 	}
 
 	return NULL;
 }
 
+int scope_append_cb(size_t instance, void *data)
+{
+	struct scope_merge_cb_type *merge = (struct scope_merge_cb_type *)data;
+
+	return set_append(merge->dest->objects[instance], merge->src);
+}
+
+/* Merges the source objects into the destination with the callback, the write of the destination waits for
+* its readers, so it must not be done inside a read section of the source, otherwise two merges in opposite
+* directions (A into B and B into A) would wait for each other. The source is copied in its own read section first */
+int scope_merge(scope dest, scope src, threading_left_right_write_cb cb)
+{
+	struct scope_merge_cb_type merge = { dest, NULL };
+	int result;
+
+#if defined(THREADING_THREAD_SAFE)
+	size_t instance, version;
+
+	merge.src = set_create(&hash_callback_str, &comparable_callback_str);
+
+	if (merge.src == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid scope merge allocation");
+
+		return 1;
+	}
+
+	version = threading_left_right_read_lock(src->lr, &instance);
+
+	result = set_append(merge.src, src->objects[instance]);
+
+	threading_left_right_read_unlock(src->lr, version);
+
+	if (result == 0)
+	{
+		result = threading_left_right_write(dest->lr, cb, &merge);
+	}
+
+	set_destroy(merge.src);
+#else
+	merge.src = src->objects[0];
+
+	result = threading_left_right_write(dest->lr, cb, &merge);
+#endif
+
+	return result;
+}
+
 int scope_append(scope dest, scope src)
 {
-	return set_append(dest->objects, src->objects);
+	return scope_merge(dest, src, &scope_append_cb);
 }
 
 int scope_contains(scope dest, scope src, char **duplicated)
 {
-	return set_contains_which(dest->objects, src->objects, (set_key *)duplicated);
+	size_t dest_instance, dest_version = threading_left_right_read_lock(dest->lr, &dest_instance);
+	size_t src_instance, src_version = threading_left_right_read_lock(src->lr, &src_instance);
+
+	int result = set_contains_which(dest->objects[dest_instance], src->objects[src_instance], (set_key *)duplicated);
+
+	threading_left_right_read_unlock(src->lr, src_version);
+	threading_left_right_read_unlock(dest->lr, dest_version);
+
+	return result;
+}
+
+int scope_remove_cb(size_t instance, void *data)
+{
+	struct scope_merge_cb_type *merge = (struct scope_merge_cb_type *)data;
+
+	return set_disjoint(merge->dest->objects[instance], merge->src);
 }
 
 int scope_remove(scope dest, scope src)
 {
-	return set_disjoint(dest->objects, src->objects);
+	return scope_merge(dest, src, &scope_remove_cb);
 }
 
 size_t *scope_stack_return(scope sp)
@@ -612,12 +833,15 @@ void scope_destroy(scope sp)
 {
 	if (sp != NULL)
 	{
-		set_iterate(sp->objects, &scope_destroy_cb_iterate, NULL);
+		/* All the instances contain the same values, destroy them only once */
+		set_iterate(sp->objects[0], &scope_destroy_cb_iterate, NULL);
 
-		set_destroy(sp->objects);
+		scope_objects_destroy(sp, THREADING_LEFT_RIGHT_SIZE);
 
 		vector_destroy(sp->call_stack);
 
+		threading_left_right_destroy(sp->lr);
+
 		free(sp->name);
 
 		free(sp);
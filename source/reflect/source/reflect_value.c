@@ -22,9 +22,51 @@
 
 #include <reflect/reflect_value.h>
 
+#if defined(THREADING_THREAD_SAFE)
+	#include <threading/threading_atomic_ref_count.h>
+#endif
+
+#include <threading/threading_atomic.h>
+
+#include <memory/memory_allocator_slab.h>
+
+#include <portability/portability_compiler_detection.h>
+
 #include <stdint.h>
 #include <string.h>
 
+/* -- Definitions -- */
+
+/* Sanitizers need each value to be allocated on its own for tracking invalid accesses */
+#if defined(PORTABILITY_THREAD_LOCAL) && !defined(__ADDRESS_SANITIZER__) && !defined(__MEMORY_SANITIZER__)
+	#define VALUE_CACHE 1
+#else
+	#define VALUE_CACHE 0
+#endif
+
+#if VALUE_CACHE == 1
+	#include <threading/threading_mutex.h>
+
+	#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64)
+		#include <windows.h>
+	#else
+		#include <pthread.h>
+	#endif
+#endif
+
+#define VALUE_CACHE_CLASS_MIN  64
+#define VALUE_CACHE_CLASS_SIZE 4 /* 64, 128, 256 and 512 bytes */
+#define VALUE_CACHE_CLASS_NONE VALUE_CACHE_CLASS_SIZE
+#define VALUE_CACHE_BATCH	   32
+#define VALUE_CACHE_CAPACITY   (VALUE_CACHE_BATCH * 2)
+
+#define VALUE_CACHE_STATE_NONE		 0 /* The thread has not registered its cache yet */
+#define VALUE_CACHE_STATE_REGISTERED 1 /* The cache is returned to the depot when the thread exits */
+#define VALUE_CACHE_STATE_EXITED	 2 /* The thread is exiting, blocks go straight to the depot */
+
+/* Cached blocks keep the link after the magic, so released values still fail to validate */
+#define VALUE_CACHE_LINK(block) ((void *)(((uintptr_t)(block)) + sizeof(uintptr_t)))
+
 /* -- Forward Declarations -- */
 
 struct value_impl_type;
@@ -39,16 +81,53 @@ struct value_impl_type
 {
 	uintptr_t magic;
 	size_t bytes;
+#if defined(THREADING_THREAD_SAFE)
+	struct threading_atomic_ref_count_type ref;
+#else
 	size_t ref_count;
+#endif
 	value_finalizer_cb finalizer;
 	void *finalizer_data;
+	atomic_uintptr_t index;
+};
+
+#if VALUE_CACHE == 1
+struct value_cache_type
+{
+	void *free[VALUE_CACHE_CLASS_SIZE];
+	size_t count[VALUE_CACHE_CLASS_SIZE];
+	int state;
+};
+
+struct value_cache_depot_type
+{
+	memory_allocator allocator;		   /* Slab shared by all the thread caches, created on demand */
+	size_t blocks;					   /* Blocks taken from the slab that have not been returned yet */
+	int destroy;					   /* Shutdown was requested, the slab is destroyed once all blocks are returned */
+	struct threading_mutex_type mutex; /* Protects the depot while moving batches from and to the thread caches */
 };
+#endif
 
 /* -- Private Member Data -- */
 
 static const char value_impl_magic_alloc[] = "value_impl_magic_alloc";
 static const char value_impl_magic_free[] = "value_impl_magic_free";
 
+#if VALUE_CACHE == 1
+/* Each thread recycles small values without locking, the depot is shared and only locked for moving batches */
+static PORTABILITY_THREAD_LOCAL struct value_cache_type value_cache = { { NULL }, { 0 }, VALUE_CACHE_STATE_NONE };
+static struct value_cache_depot_type value_cache_depot;
+
+	#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64)
+static INIT_ONCE value_cache_once = INIT_ONCE_STATIC_INIT;
+static DWORD value_cache_key = FLS_OUT_OF_INDEXES;
+	#else
+static pthread_once_t value_cache_once = PTHREAD_ONCE_INIT;
+static pthread_key_t value_cache_key;
+static int value_cache_key_created = 1;
+	#endif
+#endif
+
 /* -- Private Methods -- */
 
 /**
@@ -63,8 +142,312 @@ static const char value_impl_magic_free[] = "value_impl_magic_free";
 */
 value_impl value_descriptor(value v);
 
+/**
+*  @brief
+*    Allocate the header and the data of a value, small values
+*    are taken from the thread cache of size classes
+*
+*  @param[in] size
+*    Size in bytes of the header plus the data
+*
+*  @return
+*    Pointer to the header of a value
+*/
+static value_impl value_impl_allocate(size_t size);
+
+/**
+*  @brief
+*    Deallocate the header and the data of a value
+*
+*  @param[in] impl
+*    Pointer to the header of a value
+*
+*  @param[in] size
+*    Size in bytes of the header plus the data
+*/
+static void value_impl_deallocate(value_impl impl, size_t size);
+
+#if VALUE_CACHE == 1
+static size_t value_cache_class(size_t size);
+
+static void value_cache_initialize(void);
+
+static void value_cache_register(void);
+
+static void value_cache_depot_release(void *block);
+
+static void value_cache_refill(size_t id);
+
+static void value_cache_flush(size_t id, size_t keep);
+
+static void value_cache_drain(struct value_cache_type *cache);
+
+	#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64)
+static BOOL CALLBACK value_cache_once_cb(PINIT_ONCE once, PVOID param, PVOID *context);
+
+static VOID WINAPI value_cache_exit(PVOID data);
+	#else
+static void value_cache_once_cb(void);
+
+static void value_cache_exit(void *data);
+	#endif
+#endif
+
 /* -- Methods -- */
 
+#if VALUE_CACHE == 1
+size_t value_cache_class(size_t size)
+{
+	size_t id = 0, class_size = VALUE_CACHE_CLASS_MIN;
+
+	while (class_size < size)
+	{
+		class_size <<= 1;
+
+		if (++id == VALUE_CACHE_CLASS_NONE)
+		{
+			break;
+		}
+	}
+
+	return id;
+}
+
+	#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64)
+BOOL CALLBACK value_cache_once_cb(PINIT_ONCE once, PVOID param, PVOID *context)
+{
+	(void)once;
+	(void)param;
+	(void)context;
+
+	threading_mutex_initialize(&value_cache_depot.mutex);
+
+	value_cache_key = FlsAlloc(&value_cache_exit);
+
+	return TRUE;
+}
+
+VOID WINAPI value_cache_exit(PVOID data)
+{
+	if (data != NULL)
+	{
+		struct value_cache_type *cache = (struct value_cache_type *)data;
+
+		value_cache_drain(cache);
+
+		cache->state = VALUE_CACHE_STATE_EXITED;
+	}
+}
+	#else
+void value_cache_once_cb(void)
+{
+	threading_mutex_initialize(&value_cache_depot.mutex);
+
+	value_cache_key_created = pthread_key_create(&value_cache_key, &value_cache_exit);
+}
+
+void value_cache_exit(void *data)
+{
+	if (data != NULL)
+	{
+		struct value_cache_type *cache = (struct value_cache_type *)data;
+
+		value_cache_drain(cache);
+
+		cache->state = VALUE_CACHE_STATE_EXITED;
+	}
+}
+	#endif
+
+void value_cache_initialize(void)
+{
+	#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64)
+	InitOnceExecuteOnce(&value_cache_once, &value_cache_once_cb, NULL, NULL);
+	#else
+	pthread_once(&value_cache_once, &value_cache_once_cb);
+	#endif
+}
+
+void value_cache_register(void)
+{
+	value_cache_initialize();
+
+	/* The thread exit destructor receives the cache of the exiting thread, so it can return its blocks to the depot */
+	#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64)
+	if (value_cache_key != FLS_OUT_OF_INDEXES)
+	{
+		FlsSetValue(value_cache_key, &value_cache);
+	}
+	#else
+	if (value_cache_key_created == 0)
+	{
+		pthread_setspecific(value_cache_key, &value_cache);
+	}
+	#endif
+
+	value_cache.state = VALUE_CACHE_STATE_REGISTERED;
+}
+
+void value_cache_depot_release(void *block)
+{
+	/* Must be called with the depot locked */
+	memory_allocator_deallocate(value_cache_depot.allocator, block);
+
+	if (--value_cache_depot.blocks == 0 && value_cache_depot.destroy == 1)
+	{
+		memory_allocator_destroy(value_cache_depot.allocator);
+
+		value_cache_depot.allocator = NULL;
+		value_cache_depot.destroy = 0;
+	}
+}
+
+void value_cache_refill(size_t id)
+{
+	size_t class_size = ((size_t)VALUE_CACHE_CLASS_MIN) << id;
+
+	/* An exiting thread can not return its cache anymore, so it only takes the block that it needs */
+	size_t batch = value_cache.state == VALUE_CACHE_STATE_EXITED ? 1 : VALUE_CACHE_BATCH;
+
+	threading_mutex_lock(&value_cache_depot.mutex);
+
+	if (value_cache_depot.allocator == NULL)
+	{
+		value_cache_depot.allocator = memory_allocator_slab(0);
+	}
+
+	if (value_cache_depot.allocator != NULL)
+	{
+		while (value_cache.count[id] < batch)
+		{
+			void *block = memory_allocator_allocate(value_cache_depot.allocator, class_size);
+
+			if (block == NULL)
+			{
+				break;
+			}
+
+			memcpy(VALUE_CACHE_LINK(block), &value_cache.free[id], sizeof(void *));
+			value_cache.free[id] = block;
+			++value_cache.count[id];
+			++value_cache_depot.blocks;
+		}
+	}
+
+	threading_mutex_unlock(&value_cache_depot.mutex);
+}
+
+void value_cache_flush(size_t id, size_t keep)
+{
+	threading_mutex_lock(&value_cache_depot.mutex);
+
+	while (value_cache.count[id] > keep)
+	{
+		void *block = value_cache.free[id];
+
+		memcpy(&value_cache.free[id], VALUE_CACHE_LINK(block), sizeof(void *));
+		--value_cache.count[id];
+
+		value_cache_depot_release(block);
+	}
+
+	threading_mutex_unlock(&value_cache_depot.mutex);
+}
+
+void value_cache_drain(struct value_cache_type *cache)
+{
+	size_t id;
+
+	threading_mutex_lock(&value_cache_depot.mutex);
+
+	for (id = 0; id < VALUE_CACHE_CLASS_SIZE; ++id)
+	{
+		while (cache->count[id] > 0)
+		{
+			void *block = cache->free[id];
+
+			memcpy(&cache->free[id], VALUE_CACHE_LINK(block), sizeof(void *));
+			--cache->count[id];
+
+			value_cache_depot_release(block);
+		}
+	}
+
+	threading_mutex_unlock(&value_cache_depot.mutex);
+}
+#endif
+
+value_impl value_impl_allocate(size_t size)
+{
+#if VALUE_CACHE == 1
+	size_t id = value_cache_class(size);
+
+	if (id != VALUE_CACHE_CLASS_NONE)
+	{
+		void *block;
+
+		if (value_cache.state == VALUE_CACHE_STATE_NONE)
+		{
+			value_cache_register();
+		}
+
+		if (value_cache.count[id] == 0)
+		{
+			value_cache_refill(id);
+
+			if (value_cache.count[id] == 0)
+			{
+				return NULL;
+			}
+		}
+
+		block = value_cache.free[id];
+
+		memcpy(&value_cache.free[id], VALUE_CACHE_LINK(block), sizeof(void *));
+		--value_cache.count[id];
+
+		return (value_impl)block;
+	}
+#endif
+
+	return malloc(size);
+}
+
+void value_impl_deallocate(value_impl impl, size_t size)
+{
+#if VALUE_CACHE == 1
+	size_t id = value_cache_class(size);
+
+	if (id != VALUE_CACHE_CLASS_NONE)
+	{
+		if (value_cache.state == VALUE_CACHE_STATE_NONE)
+		{
+			value_cache_register();
+		}
+
+		/* Values released by a thread other than the allocator one move to the cache of the releaser */
+		memcpy(VALUE_CACHE_LINK(impl), &value_cache.free[id], sizeof(void *));
+		value_cache.free[id] = (void *)impl;
+		++value_cache.count[id];
+
+		if (value_cache.state == VALUE_CACHE_STATE_EXITED)
+		{
+			value_cache_flush(id, 0);
+		}
+		else if (value_cache.count[id] > VALUE_CACHE_CAPACITY)
+		{
+			value_cache_flush(id, VALUE_CACHE_BATCH);
+		}
+
+		return;
+	}
+#else
+	(void)size;
+#endif
+
+	free(impl);
+}
+
 value_impl value_descriptor(value v)
 {
 	if (v == NULL)
@@ -77,7 +460,7 @@ value_impl value_descriptor(value v)
 
 value value_alloc(size_t bytes)
 {
-	value_impl impl = malloc(sizeof(struct value_impl_type) + bytes);
+	value_impl impl = value_impl_allocate(sizeof(struct value_impl_type) + bytes);
 
 	if (impl == NULL)
 	{
@@ -86,9 +469,15 @@ value value_alloc(size_t bytes)
 
 	impl->magic = (uintptr_t)value_impl_magic_alloc;
 	impl->bytes = bytes;
+#if defined(THREADING_THREAD_SAFE)
+	threading_atomic_ref_count_initialize(&impl->ref);
+	threading_atomic_ref_count_store(&impl->ref, 1);
+#else
 	impl->ref_count = 1;
+#endif
 	impl->finalizer = NULL;
 	impl->finalizer_data = NULL;
+	atomic_init(&impl->index, (uintptr_t)NULL);
 
 	return (value)(((uintptr_t)impl) + sizeof(struct value_impl_type));
 }
@@ -163,34 +552,78 @@ void value_ref_inc(value v)
 
 	if (impl != NULL)
 	{
+#if defined(THREADING_THREAD_SAFE)
+		threading_atomic_ref_count_increment(&impl->ref);
+#else
 		++impl->ref_count;
+#endif
 	}
 }
 
 void value_ref_dec(value v)
+{
+	value_destroy(v);
+}
+
+void value_finalizer(value v, value_finalizer_cb finalizer, void *finalizer_data)
 {
 	value_impl impl = value_descriptor(v);
 
 	if (impl != NULL)
 	{
-		--impl->ref_count;
+		impl->finalizer = finalizer;
+		impl->finalizer_data = finalizer_data;
+	}
+}
 
-		if (impl->ref_count == 0)
-		{
-			value_destroy(v);
-		}
+value_finalizer_cb value_finalizer_get(value v)
+{
+	value_impl impl = value_descriptor(v);
+
+	if (impl == NULL)
+	{
+		return NULL;
 	}
+
+	return impl->finalizer;
 }
 
-void value_finalizer(value v, value_finalizer_cb finalizer, void *finalizer_data)
+void *value_index(value v)
 {
 	value_impl impl = value_descriptor(v);
 
-	if (impl != NULL)
+	if (impl == NULL)
 	{
-		impl->finalizer = finalizer;
-		impl->finalizer_data = finalizer_data;
+		return NULL;
+	}
+
+	return (void *)atomic_load_explicit(&impl->index, memory_order_acquire);
+}
+
+int value_index_attach(value v, void *index)
+{
+	value_impl impl = value_descriptor(v);
+
+	uintptr_t expected = (uintptr_t)NULL;
+
+	if (impl == NULL)
+	{
+		return 1;
+	}
+
+	return !atomic_compare_exchange_strong_explicit(&impl->index, &expected, (uintptr_t)index, memory_order_acq_rel, memory_order_acquire);
+}
+
+void *value_index_detach(value v)
+{
+	value_impl impl = value_descriptor(v);
+
+	if (impl == NULL)
+	{
+		return NULL;
 	}
+
+	return (void *)atomic_exchange_explicit(&impl->index, (uintptr_t)NULL, memory_order_acq_rel);
 }
 
 void *value_data(value v)
@@ -236,15 +669,67 @@ void value_destroy(value v)
 {
 	value_impl impl = value_descriptor(v);
 
-	if (impl != NULL && impl->ref_count <= 1)
+	if (impl == NULL)
+	{
+		return;
+	}
+
+	/* Shared values only drop the reference of the caller, the last owner releases the memory,
+	the decrement and the check are done in one step so two owners can not free it at the same time */
+#if defined(THREADING_THREAD_SAFE)
 	{
-		if (impl->finalizer != NULL)
+		int last = 0;
+
+		if (threading_atomic_ref_count_release(&impl->ref, &last) != 0 || last == 0)
 		{
-			impl->finalizer(v, impl->finalizer_data);
+			return;
 		}
+	}
+#else
+	if (impl->ref_count == 0 || --impl->ref_count > 0)
+	{
+		return;
+	}
+#endif
+
+	if (impl->finalizer != NULL)
+	{
+		impl->finalizer(v, impl->finalizer_data);
+	}
+
+	impl->magic = (uintptr_t)value_impl_magic_free;
 
-		impl->magic = (uintptr_t)value_impl_magic_free;
+#if defined(THREADING_THREAD_SAFE)
+	threading_atomic_ref_count_destroy(&impl->ref);
+#endif
 
-		free(impl);
+	value_impl_deallocate(impl, sizeof(struct value_impl_type) + impl->bytes);
+}
+
+void value_cache_destroy(void)
+{
+#if VALUE_CACHE == 1
+	value_cache_initialize();
+
+	value_cache_drain(&value_cache);
+
+	threading_mutex_lock(&value_cache_depot.mutex);
+
+	if (value_cache_depot.allocator != NULL)
+	{
+		if (value_cache_depot.blocks == 0)
+		{
+			memory_allocator_destroy(value_cache_depot.allocator);
+
+			value_cache_depot.allocator = NULL;
+		}
+		else
+		{
+			/* Values still alive or cached by other threads, the last block returned destroys the slab */
+			value_cache_depot.destroy = 1;
+		}
 	}
+
+	threading_mutex_unlock(&value_cache_depot.mutex);
+#endif
 }
@@ -22,12 +22,65 @@
 
 #include <reflect/reflect_value_type.h>
 
+#include <adt/adt_set.h>
+
 #include <log/log.h>
 
 #include <stdint.h>
+#include <string.h>
+
+/* -- Definitions -- */
+
+#define VALUE_MAP_INDEX_THRESHOLD 16 /* Smaller maps are faster to scan than to index */
+
+/* -- Member Data -- */
+
+/* Borrowed buffers store the reference to the memory block instead of the block itself */
+struct value_buffer_borrow_type
+{
+	void *buffer;
+	size_t size;
+	value_finalizer_cb release;
+	void *release_data;
+};
+
+/* -- Private Methods -- */
+
+static void value_buffer_borrow_finalize(value v, void *data);
+
+static struct value_buffer_borrow_type *value_buffer_borrow(value v);
+
+static value value_map_tuple_get(value tuple, const char **key);
+
+static set value_map_index(value v);
+
+static void value_map_index_destroy(value v);
 
 /* -- Methods -- */
 
+void value_buffer_borrow_finalize(value v, void *data)
+{
+	struct value_buffer_borrow_type *borrow = value_data(v);
+
+	(void)data;
+
+	if (borrow->release != NULL)
+	{
+		borrow->release(v, borrow->release_data);
+	}
+}
+
+struct value_buffer_borrow_type *value_buffer_borrow(value v)
+{
+	/* The finalizer identifies the borrowed buffers, it can not be set from outside of this module */
+	if (value_finalizer_get(v) != &value_buffer_borrow_finalize)
+	{
+		return NULL;
+	}
+
+	return value_data(v);
+}
+
 value value_type_create(const void *data, size_t bytes, type_id id)
 {
 	value v = value_alloc(bytes + sizeof(type_id));
@@ -143,6 +196,11 @@ value value_type_copy(value v)
 			/* Just create a new throwable from the previous one, it will get flattened after creation */
 			return value_create_throwable(v);
 		}
+		else if (type_id_buffer(id) == 0 && value_buffer_borrow(v) != NULL)
+		{
+			/* The copy of a borrowed buffer owns its memory, so it does not depend on the lifetime of the original */
+			return value_create_buffer(value_to_buffer(v), value_type_size(v));
+		}
 
 		if (type_id_invalid(id) != 0)
 		{
@@ -155,9 +213,20 @@ value value_type_copy(value v)
 
 size_t value_type_size(value v)
 {
-	size_t size = value_size(v);
+	size_t size = value_size(v) - sizeof(type_id);
+
+	/* Borrowed buffers report the size of the memory block they refer to */
+	if (size == sizeof(struct value_buffer_borrow_type))
+	{
+		struct value_buffer_borrow_type *borrow = value_buffer_borrow(v);
+
+		if (borrow != NULL)
+		{
+			return borrow->size;
+		}
+	}
 
-	return size - sizeof(type_id);
+	return size;
 }
 
 size_t value_type_count(void *v)
@@ -245,6 +314,31 @@ value value_create_buffer(const void *buffer, size_t size)
 	return value_type_create(buffer, sizeof(char) * size, TYPE_BUFFER);
 }
 
+value value_create_buffer_borrow(void *buffer, size_t size, value_finalizer_cb release, void *release_data)
+{
+	struct value_buffer_borrow_type borrow;
+	value v;
+
+	if (buffer == NULL || size == 0)
+	{
+		return NULL;
+	}
+
+	borrow.buffer = buffer;
+	borrow.size = size;
+	borrow.release = release;
+	borrow.release_data = release_data;
+
+	v = value_type_create(&borrow, sizeof(struct value_buffer_borrow_type), TYPE_BUFFER);
+
+	if (v != NULL)
+	{
+		value_finalizer(v, &value_buffer_borrow_finalize, NULL);
+	}
+
+	return v;
+}
+
 value value_create_array(const value *values, size_t size)
 {
 	return value_type_create(values, sizeof(const value) * size, TYPE_ARRAY);
@@ -410,6 +504,13 @@ char *value_to_string(value v)
 
 void *value_to_buffer(value v)
 {
+	struct value_buffer_borrow_type *borrow = value_buffer_borrow(v);
+
+	if (borrow != NULL)
+	{
+		return borrow->buffer;
+	}
+
 	return value_data(v);
 }
 
@@ -423,6 +524,118 @@ value *value_to_map(value v)
 	return value_data(v);
 }
 
+value value_map_tuple_get(value tuple, const char **key)
+{
+	value *pair;
+
+	if (tuple == NULL || type_id_array(value_type_id(tuple)) != 0 || value_type_count(tuple) != 2)
+	{
+		return NULL;
+	}
+
+	pair = value_to_array(tuple);
+
+	if (pair[0] == NULL || type_id_string(value_type_id(pair[0])) != 0)
+	{
+		return NULL;
+	}
+
+	*key = value_to_string(pair[0]);
+
+	return pair[1];
+}
+
+set value_map_index(value v)
+{
+	set index = value_index(v);
+	size_t iterator;
+	value *tuples;
+
+	if (index != NULL)
+	{
+		return index;
+	}
+
+	index = set_create(&hash_callback_str, &comparable_callback_str);
+
+	if (index == NULL)
+	{
+		return NULL;
+	}
+
+	tuples = value_to_map(v);
+
+	/* Insert in reverse order so the first occurrence of a duplicated key wins, as in a linear scan */
+	for (iterator = value_type_count(v); iterator > 0; --iterator)
+	{
+		const char *key = NULL;
+		value element = value_map_tuple_get(tuples[iterator - 1], &key);
+
+		if (element != NULL && set_insert(index, (set_key)key, element) != 0)
+		{
+			set_destroy(index);
+			return NULL;
+		}
+	}
+
+	if (value_index_attach(v, index) != 0)
+	{
+		/* Another thread attached its index meanwhile */
+		set_destroy(index);
+		index = value_index(v);
+	}
+
+	return index;
+}
+
+void value_map_index_destroy(value v)
+{
+	set index = value_index_detach(v);
+
+	if (index != NULL)
+	{
+		set_destroy(index);
+	}
+}
+
+value value_map_get(value v, const char *key)
+{
+	size_t iterator, size;
+	value *tuples;
+
+	if (v == NULL || key == NULL || type_id_map(value_type_id(v)) != 0)
+	{
+		return NULL;
+	}
+
+	size = value_type_count(v);
+
+	if (size >= VALUE_MAP_INDEX_THRESHOLD)
+	{
+		set index = value_map_index(v);
+
+		if (index != NULL)
+		{
+			return set_get(index, (set_key)key);
+		}
+	}
+
+	tuples = value_to_map(v);
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		const char *tuple_key = NULL;
+		value element = value_map_tuple_get(tuples[iterator], &tuple_key);
+
+		if (element != NULL && strcmp(tuple_key, key) == 0)
+		{
+			return element;
+		}
+	}
+
+	return NULL;
+}
+
 void *value_to_ptr(value v)
 {
 	uintptr_t *uint_ptr = value_data(v);
@@ -534,10 +747,20 @@ value value_from_buffer(value v, const void *buffer, size_t size)
 {
 	if (v != NULL && buffer != NULL && size > 0)
 	{
+		struct value_buffer_borrow_type *borrow = value_buffer_borrow(v);
+
 		size_t current_size = value_size(v);
 
 		size_t bytes = sizeof(char) * size;
 
+		if (borrow != NULL)
+		{
+			/* Borrowed buffers write into the memory block they refer to */
+			memcpy(borrow->buffer, buffer, (bytes <= borrow->size) ? bytes : borrow->size);
+
+			return v;
+		}
+
 		return value_from(v, buffer, (bytes <= current_size) ? bytes : current_size);
 	}
 
@@ -566,6 +789,8 @@ value value_from_map(value v, const value *tuples, size_t size)
 
 		size_t bytes = sizeof(const value) * size;
 
+		value_map_index_destroy(v);
+
 		return value_from(v, tuples, (bytes <= current_size) ? bytes : current_size);
 	}
 
@@ -641,6 +866,8 @@ void value_type_destroy(value v)
 
 			/* log_write("metacall", LOG_LEVEL_DEBUG, "Destroy map value <%p> of size %u", (void *)v, size); */
 
+			value_map_index_destroy(v);
+
 			for (index = 0; index < size; ++index)
 			{
 				value_type_destroy(v_map[index]);
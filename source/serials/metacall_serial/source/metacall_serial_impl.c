@@ -114,7 +114,7 @@ value metacall_serial_impl_deserialize_value(const char *buffer, size_t size)
 	{
 		metacall_deserialize_impl_ptr deserialize_ptr = metacall_serial_impl_deserialize_func(id);
 
-		if (deserialize_ptr(&v, buffer, size) == 0)
+		if (deserialize_ptr != NULL && deserialize_ptr(&v, buffer, size) == 0)
 		{
 			return v;
 		}
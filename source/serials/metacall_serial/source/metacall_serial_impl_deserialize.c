@@ -72,7 +72,9 @@ metacall_deserialize_impl_ptr metacall_serial_impl_deserialize_func(type_id id)
 		&metacall_serial_impl_deserialize_array,
 		&metacall_serial_impl_deserialize_map,
 		&metacall_serial_impl_deserialize_ptr,
-		metacall_serial_impl_deserialize_null
+		NULL, /* TODO: Future */
+		NULL, /* TODO: Function */
+		&metacall_serial_impl_deserialize_null
 	};
 
 	return deserialize_func[id];
@@ -0,0 +1,811 @@
+/*
+ *	Serial Library by Parra Studios
+ *	Copyright (C) 2016 - 2022 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	A cross-platform library for managing multiple serialization and deserialization formats.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <msgpack_serial/msgpack_serial_impl.h>
+
+#include <format/format_print.h>
+
+#include <log/log.h>
+
+#include <limits.h>
+#include <stdint.h>
+#include <string.h>
+
+/* -- Definitions -- */
+
+#define MSGPACK_SERIAL_IMPL_EXT_PTR	  0x01 /* Extension type used for raw pointers */
+#define MSGPACK_SERIAL_IMPL_MAX_DEPTH 512  /* Nesting limit when deserializing untrusted input */
+
+/* -- Type Definitions -- */
+
+typedef struct msgpack_serial_impl_writer_type
+{
+	uint8_t *data; /* Null while the length is being measured */
+	size_t length;
+
+} * msgpack_serial_impl_writer;
+
+typedef struct msgpack_serial_impl_reader_type
+{
+	const uint8_t *data;
+	size_t size;
+	size_t position;
+
+} * msgpack_serial_impl_reader;
+
+/* -- Private Methods -- */
+
+static void msgpack_serial_impl_write(msgpack_serial_impl_writer writer, const void *data, size_t size);
+
+static void msgpack_serial_impl_write_byte(msgpack_serial_impl_writer writer, uint8_t byte);
+
+static void msgpack_serial_impl_write_be(msgpack_serial_impl_writer writer, uint64_t number, size_t size);
+
+static int msgpack_serial_impl_write_length(msgpack_serial_impl_writer writer, size_t length, uint8_t fix, size_t fix_max, uint8_t marker8, uint8_t marker16, uint8_t marker32);
+
+static int msgpack_serial_impl_write_string(msgpack_serial_impl_writer writer, const char *str, size_t length);
+
+static int msgpack_serial_impl_serialize_value(msgpack_serial_impl_writer writer, value v);
+
+static int msgpack_serial_impl_read(msgpack_serial_impl_reader reader, size_t size, const uint8_t **data);
+
+static int msgpack_serial_impl_read_be(msgpack_serial_impl_reader reader, size_t size, uint64_t *number);
+
+static value msgpack_serial_impl_deserialize_value(msgpack_serial_impl_reader reader, size_t depth);
+
+/* -- Methods -- */
+
+const char *msgpack_serial_impl_extension(void)
+{
+	static const char extension[] = "msgpack";
+
+	return extension;
+}
+
+serial_handle msgpack_serial_impl_initialize(memory_allocator allocator)
+{
+	return allocator;
+}
+
+void msgpack_serial_impl_write(msgpack_serial_impl_writer writer, const void *data, size_t size)
+{
+	if (writer->data != NULL && size > 0)
+	{
+		memcpy(&writer->data[writer->length], data, size);
+	}
+
+	writer->length += size;
+}
+
+void msgpack_serial_impl_write_byte(msgpack_serial_impl_writer writer, uint8_t byte)
+{
+	msgpack_serial_impl_write(writer, &byte, sizeof(uint8_t));
+}
+
+void msgpack_serial_impl_write_be(msgpack_serial_impl_writer writer, uint64_t number, size_t size)
+{
+	uint8_t bytes[sizeof(uint64_t)];
+
+	size_t iterator;
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		bytes[iterator] = (uint8_t)(number >> ((size - iterator - 1) * 8));
+	}
+
+	msgpack_serial_impl_write(writer, bytes, size);
+}
+
+int msgpack_serial_impl_write_length(msgpack_serial_impl_writer writer, size_t length, uint8_t fix, size_t fix_max, uint8_t marker8, uint8_t marker16, uint8_t marker32)
+{
+	if (fix != 0 && length <= fix_max)
+	{
+		msgpack_serial_impl_write_byte(writer, (uint8_t)(fix | length));
+	}
+	else if (marker8 != 0 && length <= UINT8_MAX)
+	{
+		msgpack_serial_impl_write_byte(writer, marker8);
+		msgpack_serial_impl_write_be(writer, length, sizeof(uint8_t));
+	}
+	else if (length <= UINT16_MAX)
+	{
+		msgpack_serial_impl_write_byte(writer, marker16);
+		msgpack_serial_impl_write_be(writer, length, sizeof(uint16_t));
+	}
+	else if ((uint64_t)length <= UINT32_MAX)
+	{
+		msgpack_serial_impl_write_byte(writer, marker32);
+		msgpack_serial_impl_write_be(writer, length, sizeof(uint32_t));
+	}
+	else
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Serialization length %" PRIuS " exceeds MessagePack limits", length);
+
+		return 1;
+	}
+
+	return 0;
+}
+
+int msgpack_serial_impl_write_string(msgpack_serial_impl_writer writer, const char *str, size_t length)
+{
+	if (msgpack_serial_impl_write_length(writer, length, 0xa0, 0x1f, 0xd9, 0xda, 0xdb) != 0)
+	{
+		return 1;
+	}
+
+	msgpack_serial_impl_write(writer, str, length);
+
+	return 0;
+}
+
+int msgpack_serial_impl_serialize_value(msgpack_serial_impl_writer writer, value v)
+{
+	type_id id = value_type_id(v);
+
+	if (id == TYPE_BOOL)
+	{
+		msgpack_serial_impl_write_byte(writer, value_to_bool(v) == 0L ? 0xc2 : 0xc3);
+	}
+	else if (id == TYPE_CHAR)
+	{
+		msgpack_serial_impl_write_byte(writer, 0xd0);
+		msgpack_serial_impl_write_be(writer, (uint64_t)(int64_t)value_to_char(v), sizeof(int8_t));
+	}
+	else if (id == TYPE_SHORT)
+	{
+		msgpack_serial_impl_write_byte(writer, 0xd1);
+		msgpack_serial_impl_write_be(writer, (uint64_t)(int64_t)value_to_short(v), sizeof(int16_t));
+	}
+	else if (id == TYPE_INT)
+	{
+		msgpack_serial_impl_write_byte(writer, 0xd2);
+		msgpack_serial_impl_write_be(writer, (uint64_t)(int64_t)value_to_int(v), sizeof(int32_t));
+	}
+	else if (id == TYPE_LONG)
+	{
+		msgpack_serial_impl_write_byte(writer, 0xd3);
+		msgpack_serial_impl_write_be(writer, (uint64_t)(int64_t)value_to_long(v), sizeof(int64_t));
+	}
+	else if (id == TYPE_FLOAT)
+	{
+		float f = value_to_float(v);
+		uint32_t bits;
+
+		memcpy(&bits, &f, sizeof(uint32_t));
+
+		msgpack_serial_impl_write_byte(writer, 0xca);
+		msgpack_serial_impl_write_be(writer, bits, sizeof(uint32_t));
+	}
+	else if (id == TYPE_DOUBLE)
+	{
+		double d = value_to_double(v);
+		uint64_t bits;
+
+		memcpy(&bits, &d, sizeof(uint64_t));
+
+		msgpack_serial_impl_write_byte(writer, 0xcb);
+		msgpack_serial_impl_write_be(writer, bits, sizeof(uint64_t));
+	}
+	else if (id == TYPE_STRING)
+	{
+		size_t size = value_type_size(v);
+
+		return msgpack_serial_impl_write_string(writer, value_to_string(v), size > 0 ? size - 1 : 0);
+	}
+	else if (id == TYPE_BUFFER)
+	{
+		size_t size = value_type_size(v);
+
+		if (msgpack_serial_impl_write_length(writer, size, 0, 0, 0xc4, 0xc5, 0xc6) != 0)
+		{
+			return 1;
+		}
+
+		msgpack_serial_impl_write(writer, value_to_buffer(v), size);
+	}
+	else if (id == TYPE_ARRAY)
+	{
+		size_t iterator, size = value_type_count(v);
+
+		value *values = value_to_array(v);
+
+		if (msgpack_serial_impl_write_length(writer, size, 0x90, 0x0f, 0, 0xdc, 0xdd) != 0)
+		{
+			return 1;
+		}
+
+		for (iterator = 0; iterator < size; ++iterator)
+		{
+			if (msgpack_serial_impl_serialize_value(writer, values[iterator]) != 0)
+			{
+				return 1;
+			}
+		}
+	}
+	else if (id == TYPE_MAP)
+	{
+		size_t iterator, size = value_type_count(v);
+
+		value *tuples = value_to_map(v);
+
+		if (msgpack_serial_impl_write_length(writer, size, 0x80, 0x0f, 0, 0xde, 0xdf) != 0)
+		{
+			return 1;
+		}
+
+		for (iterator = 0; iterator < size; ++iterator)
+		{
+			value *tuple = value_to_array(tuples[iterator]);
+
+			if (msgpack_serial_impl_serialize_value(writer, tuple[0]) != 0 ||
+				msgpack_serial_impl_serialize_value(writer, tuple[1]) != 0)
+			{
+				return 1;
+			}
+		}
+	}
+	else if (id == TYPE_PTR)
+	{
+		msgpack_serial_impl_write_byte(writer, 0xd7);
+		msgpack_serial_impl_write_byte(writer, MSGPACK_SERIAL_IMPL_EXT_PTR);
+		msgpack_serial_impl_write_be(writer, (uint64_t)(uintptr_t)value_to_ptr(v), sizeof(uint64_t));
+	}
+	else if (id == TYPE_FUTURE)
+	{
+		static const char str[] = "[Future]";
+
+		return msgpack_serial_impl_write_string(writer, str, sizeof(str) - 1);
+	}
+	else if (id == TYPE_FUNCTION)
+	{
+		static const char str[] = "[Function]";
+
+		return msgpack_serial_impl_write_string(writer, str, sizeof(str) - 1);
+	}
+	else if (id == TYPE_NULL)
+	{
+		msgpack_serial_impl_write_byte(writer, 0xc0);
+	}
+	else if (id == TYPE_CLASS)
+	{
+		static const char str[] = "[Class]";
+
+		return msgpack_serial_impl_write_string(writer, str, sizeof(str) - 1);
+	}
+	else if (id == TYPE_OBJECT)
+	{
+		static const char str[] = "[Object]";
+
+		return msgpack_serial_impl_write_string(writer, str, sizeof(str) - 1);
+	}
+	else if (id == TYPE_EXCEPTION)
+	{
+		static const char message_str[] = "message";
+		static const char label_str[] = "label";
+		static const char code_str[] = "code";
+		static const char stacktrace_str[] = "stacktrace";
+
+		exception ex = value_to_exception(v);
+
+		const char *message = exception_message(ex);
+		const char *label = exception_label(ex);
+		const char *stacktrace = exception_stacktrace(ex);
+
+		if (message == NULL)
+		{
+			message = "";
+		}
+
+		if (label == NULL)
+		{
+			label = "";
+		}
+
+		if (stacktrace == NULL)
+		{
+			stacktrace = "";
+		}
+
+		msgpack_serial_impl_write_byte(writer, 0x84);
+
+		if (msgpack_serial_impl_write_string(writer, message_str, sizeof(message_str) - 1) != 0 ||
+			msgpack_serial_impl_write_string(writer, message, strlen(message)) != 0 ||
+			msgpack_serial_impl_write_string(writer, label_str, sizeof(label_str) - 1) != 0 ||
+			msgpack_serial_impl_write_string(writer, label, strlen(label)) != 0 ||
+			msgpack_serial_impl_write_string(writer, code_str, sizeof(code_str) - 1) != 0)
+		{
+			return 1;
+		}
+
+		msgpack_serial_impl_write_byte(writer, 0xd3);
+		msgpack_serial_impl_write_be(writer, (uint64_t)exception_error_code(ex), sizeof(int64_t));
+
+		if (msgpack_serial_impl_write_string(writer, stacktrace_str, sizeof(stacktrace_str) - 1) != 0 ||
+			msgpack_serial_impl_write_string(writer, stacktrace, strlen(stacktrace)) != 0)
+		{
+			return 1;
+		}
+	}
+	else if (id == TYPE_THROWABLE)
+	{
+		static const char str[] = "ExceptionThrown";
+
+		throwable th = value_to_throwable(v);
+
+		msgpack_serial_impl_write_byte(writer, 0x81);
+
+		if (msgpack_serial_impl_write_string(writer, str, sizeof(str) - 1) != 0)
+		{
+			return 1;
+		}
+
+		return msgpack_serial_impl_serialize_value(writer, throwable_value(th));
+	}
+	else
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Serialization unsupported value type (%d) in MessagePack implementation", (int)id);
+
+		return 1;
+	}
+
+	return 0;
+}
+
+char *msgpack_serial_impl_serialize(serial_handle handle, value v, size_t *size)
+{
+	memory_allocator allocator;
+
+	struct msgpack_serial_impl_writer_type writer = { NULL, 0 };
+
+	size_t length;
+
+	if (handle == NULL || v == NULL || size == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Serialization called with wrong arguments in MessagePack implementation");
+
+		return NULL;
+	}
+
+	allocator = (memory_allocator)handle;
+
+	/* Measure first so the buffer is allocated only once */
+	if (msgpack_serial_impl_serialize_value(&writer, v) != 0)
+	{
+		return NULL;
+	}
+
+	length = writer.length;
+
+	/* Keep a trailing null byte like the text serials, it is not part of the encoded value */
+	writer.data = memory_allocator_allocate(allocator, sizeof(uint8_t) * (length + 1));
+
+	if (writer.data == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Serialization invalid buffer allocation in MessagePack implementation");
+
+		*size = 0;
+
+		return NULL;
+	}
+
+	writer.length = 0;
+
+	if (msgpack_serial_impl_serialize_value(&writer, v) != 0 || writer.length != length)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Serialization invalid length "
+											   "(%" PRIuS " != %" PRIuS ") in MessagePack implementation",
+			writer.length, length);
+
+		memory_allocator_deallocate(allocator, writer.data);
+
+		*size = 0;
+
+		return NULL;
+	}
+
+	writer.data[length] = '\0';
+
+	*size = length + 1;
+
+	return (char *)writer.data;
+}
+
+int msgpack_serial_impl_read(msgpack_serial_impl_reader reader, size_t size, const uint8_t **data)
+{
+	if (size > reader->size - reader->position)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Deserialization unexpected end of buffer in MessagePack implementation");
+
+		return 1;
+	}
+
+	*data = &reader->data[reader->position];
+
+	reader->position += size;
+
+	return 0;
+}
+
+int msgpack_serial_impl_read_be(msgpack_serial_impl_reader reader, size_t size, uint64_t *number)
+{
+	const uint8_t *bytes;
+
+	size_t iterator;
+
+	if (msgpack_serial_impl_read(reader, size, &bytes) != 0)
+	{
+		return 1;
+	}
+
+	*number = 0;
+
+	for (iterator = 0; iterator < size; ++iterator)
+	{
+		*number = (*number << 8) | bytes[iterator];
+	}
+
+	return 0;
+}
+
+value msgpack_serial_impl_deserialize_value(msgpack_serial_impl_reader reader, size_t depth)
+{
+	const uint8_t *data;
+
+	uint8_t marker;
+
+	uint64_t length = 0, number;
+
+	size_t iterator;
+
+	if (depth > MSGPACK_SERIAL_IMPL_MAX_DEPTH)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Deserialization nesting deeper than %d levels in MessagePack implementation", MSGPACK_SERIAL_IMPL_MAX_DEPTH);
+
+		return NULL;
+	}
+
+	if (msgpack_serial_impl_read(reader, sizeof(uint8_t), &data) != 0)
+	{
+		return NULL;
+	}
+
+	marker = *data;
+
+	/* Positive and negative fixint */
+	if (marker <= 0x7f || marker >= 0xe0)
+	{
+		return value_create_int((int)(int8_t)marker);
+	}
+
+	switch (marker)
+	{
+		case 0xc0:
+			return value_create_null();
+
+		case 0xc2:
+			return value_create_bool(0L);
+
+		case 0xc3:
+			return value_create_bool(1L);
+
+		case 0xca: {
+			float f;
+
+			if (msgpack_serial_impl_read_be(reader, sizeof(uint32_t), &number) != 0)
+			{
+				return NULL;
+			}
+
+			{
+				uint32_t bits = (uint32_t)number;
+
+				memcpy(&f, &bits, sizeof(float));
+			}
+
+			return value_create_float(f);
+		}
+
+		case 0xcb: {
+			double d;
+
+			if (msgpack_serial_impl_read_be(reader, sizeof(uint64_t), &number) != 0)
+			{
+				return NULL;
+			}
+
+			memcpy(&d, &number, sizeof(double));
+
+			return value_create_double(d);
+		}
+
+		case 0xcc:
+		case 0xcd:
+		case 0xce:
+		case 0xcf: {
+			if (msgpack_serial_impl_read_be(reader, (size_t)1 << (marker - 0xcc), &number) != 0)
+			{
+				return NULL;
+			}
+
+			if (number <= INT_MAX)
+			{
+				return value_create_int((int)number);
+			}
+
+			return value_create_long((long)number);
+		}
+
+		case 0xd0:
+			if (msgpack_serial_impl_read_be(reader, sizeof(int8_t), &number) != 0)
+			{
+				return NULL;
+			}
+
+			return value_create_char((char)(int8_t)number);
+
+		case 0xd1:
+			if (msgpack_serial_impl_read_be(reader, sizeof(int16_t), &number) != 0)
+			{
+				return NULL;
+			}
+
+			return value_create_short((short)(int16_t)number);
+
+		case 0xd2:
+			if (msgpack_serial_impl_read_be(reader, sizeof(int32_t), &number) != 0)
+			{
+				return NULL;
+			}
+
+			return value_create_int((int)(int32_t)number);
+
+		case 0xd3:
+			if (msgpack_serial_impl_read_be(reader, sizeof(int64_t), &number) != 0)
+			{
+				return NULL;
+			}
+
+			return value_create_long((long)(int64_t)number);
+
+		case 0xd7: {
+			if (msgpack_serial_impl_read(reader, sizeof(uint8_t), &data) != 0)
+			{
+				return NULL;
+			}
+
+			if (*data != MSGPACK_SERIAL_IMPL_EXT_PTR)
+			{
+				break;
+			}
+
+			if (msgpack_serial_impl_read_be(reader, sizeof(uint64_t), &number) != 0)
+			{
+				return NULL;
+			}
+
+			return value_create_ptr((void *)(uintptr_t)number);
+		}
+
+		default:
+			break;
+	}
+
+	/* Strings */
+	if ((marker >= 0xa0 && marker <= 0xbf) || marker == 0xd9 || marker == 0xda || marker == 0xdb)
+	{
+		if (marker <= 0xbf)
+		{
+			length = marker & 0x1f;
+		}
+		else if (msgpack_serial_impl_read_be(reader, (size_t)1 << (marker - 0xd9), &length) != 0)
+		{
+			return NULL;
+		}
+
+		if (msgpack_serial_impl_read(reader, (size_t)length, &data) != 0)
+		{
+			return NULL;
+		}
+
+		/* The encoded string is not null terminated, create it zeroed and copy the bytes */
+		{
+			value v = value_create_string(NULL, (size_t)length);
+
+			if (v != NULL && length > 0)
+			{
+				memcpy(value_to_string(v), data, (size_t)length);
+			}
+
+			return v;
+		}
+	}
+
+	/* Binary */
+	if (marker == 0xc4 || marker == 0xc5 || marker == 0xc6)
+	{
+		if (msgpack_serial_impl_read_be(reader, (size_t)1 << (marker - 0xc4), &length) != 0 ||
+			msgpack_serial_impl_read(reader, (size_t)length, &data) != 0)
+		{
+			return NULL;
+		}
+
+		/* Buffers can not be empty, so an empty binary is decoded as an empty string */
+		if (length == 0)
+		{
+			return value_create_string("", 0);
+		}
+
+		return value_create_buffer(data, (size_t)length);
+	}
+
+	/* Arrays */
+	if ((marker >= 0x90 && marker <= 0x9f) || marker == 0xdc || marker == 0xdd)
+	{
+		value v;
+
+		value *values;
+
+		if (marker <= 0x9f)
+		{
+			length = marker & 0x0f;
+		}
+		else if (msgpack_serial_impl_read_be(reader, marker == 0xdc ? sizeof(uint16_t) : sizeof(uint32_t), &length) != 0)
+		{
+			return NULL;
+		}
+
+		/* Every element takes at least one byte, reject lengths the buffer can not hold */
+		if (length > reader->size - reader->position)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Deserialization invalid array length in MessagePack implementation");
+
+			return NULL;
+		}
+
+		v = value_create_array(NULL, (size_t)length);
+
+		if (v == NULL || length == 0)
+		{
+			return v;
+		}
+
+		values = value_to_array(v);
+
+		for (iterator = 0; iterator < (size_t)length; ++iterator)
+		{
+			values[iterator] = msgpack_serial_impl_deserialize_value(reader, depth + 1);
+
+			if (values[iterator] == NULL)
+			{
+				value_type_destroy(v);
+
+				return NULL;
+			}
+		}
+
+		return v;
+	}
+
+	/* Maps */
+	if ((marker >= 0x80 && marker <= 0x8f) || marker == 0xde || marker == 0xdf)
+	{
+		value v;
+
+		value *tuples;
+
+		if (marker <= 0x8f)
+		{
+			length = marker & 0x0f;
+		}
+		else if (msgpack_serial_impl_read_be(reader, marker == 0xde ? sizeof(uint16_t) : sizeof(uint32_t), &length) != 0)
+		{
+			return NULL;
+		}
+
+		/* Every pair takes at least two bytes, reject lengths the buffer can not hold */
+		if (length > (reader->size - reader->position) / 2)
+		{
+			log_write("metacall", LOG_LEVEL_ERROR, "Deserialization invalid map length in MessagePack implementation");
+
+			return NULL;
+		}
+
+		v = value_create_map(NULL, (size_t)length);
+
+		if (v == NULL || length == 0)
+		{
+			return v;
+		}
+
+		tuples = value_to_map(v);
+
+		for (iterator = 0; iterator < (size_t)length; ++iterator)
+		{
+			value tuple[2] = { NULL, NULL };
+
+			tuple[0] = msgpack_serial_impl_deserialize_value(reader, depth + 1);
+
+			if (tuple[0] != NULL)
+			{
+				tuple[1] = msgpack_serial_impl_deserialize_value(reader, depth + 1);
+			}
+
+			tuples[iterator] = (tuple[0] != NULL && tuple[1] != NULL) ? value_create_array(tuple, 2) : NULL;
+
+			if (tuples[iterator] == NULL)
+			{
+				if (tuple[0] != NULL)
+				{
+					value_type_destroy(tuple[0]);
+				}
+
+				if (tuple[1] != NULL)
+				{
+					value_type_destroy(tuple[1]);
+				}
+
+				value_type_destroy(v);
+
+				return NULL;
+			}
+		}
+
+		return v;
+	}
+
+	log_write("metacall", LOG_LEVEL_ERROR, "Deserialization unsupported marker (0x%02x) in MessagePack implementation", (unsigned int)marker);
+
+	return NULL;
+}
+
+value msgpack_serial_impl_deserialize(serial_handle handle, const char *buffer, size_t size)
+{
+	struct msgpack_serial_impl_reader_type reader;
+
+	value v;
+
+	if (handle == NULL || buffer == NULL || size == 0)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Deserialization called with wrong arguments in MessagePack implementation");
+
+		return NULL;
+	}
+
+	reader.data = (const uint8_t *)buffer;
+	reader.size = size;
+	reader.position = 0;
+
+	v = msgpack_serial_impl_deserialize_value(&reader, 0);
+
+	if (v == NULL)
+	{
+		return NULL;
+	}
+
+	/* Accept the trailing null byte appended by the serializer */
+	if (reader.position != size && !(reader.position + 1 == size && buffer[reader.position] == '\0'))
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Deserialization trailing data (%" PRIuS " bytes) in MessagePack implementation", size - reader.position);
+
+		value_type_destroy(v);
+
+		return NULL;
+	}
+
+	return v;
+}
+
+int msgpack_serial_impl_destroy(serial_handle handle)
+{
+	(void)handle;
+
+	return 0;
+}
@@ -19,28 +19,137 @@
 
 #include <sstream>
 
+/* -- Definitions -- */
+
+#define RAPID_JSON_SERIAL_IMPL_ARENA_SIZE  4096 /* Inline arena of each document, bigger documents spill into heap chunks */
+#define RAPID_JSON_SERIAL_IMPL_BUFFER_SIZE 256	/* Initial capacity of the serialization output */
+
+/* -- Classes -- */
+
+/* Output stream for rapidjson::Writer that writes straight into memory owned by the caller allocator */
+class rapid_json_serial_impl_stream
+{
+public:
+	typedef char Ch;
+
+	rapid_json_serial_impl_stream(memory_allocator allocator) :
+		allocator(allocator), buffer(NULL), length(0), capacity(0), error(false) {}
+
+	~rapid_json_serial_impl_stream()
+	{
+		if (buffer != NULL)
+		{
+			memory_allocator_deallocate(allocator, buffer);
+		}
+	}
+
+	void Put(Ch c)
+	{
+		if (length == capacity && reserve(1) == false)
+		{
+			return;
+		}
+
+		buffer[length++] = c;
+	}
+
+	void Flush() {}
+
+	/* Transfers the null terminated buffer to the caller, size includes the null terminator */
+	char *release(size_t *size)
+	{
+		char *result;
+
+		if (error == true || (length == capacity && reserve(1) == false))
+		{
+			return NULL;
+		}
+
+		buffer[length] = '\0';
+
+		*size = length + 1;
+
+		result = buffer;
+
+		buffer = NULL;
+
+		return result;
+	}
+
+private:
+	bool reserve(size_t count)
+	{
+		size_t new_capacity = capacity == 0 ? RAPID_JSON_SERIAL_IMPL_BUFFER_SIZE : capacity * 2;
+
+		char *new_buffer;
+
+		if (error == true)
+		{
+			return false;
+		}
+
+		while (new_capacity < length + count)
+		{
+			new_capacity *= 2;
+		}
+
+		if (buffer == NULL)
+		{
+			new_buffer = static_cast<char *>(memory_allocator_allocate(allocator, sizeof(char) * new_capacity));
+		}
+		else
+		{
+			new_buffer = static_cast<char *>(memory_allocator_reallocate(allocator, buffer, sizeof(char) * capacity, sizeof(char) * new_capacity));
+		}
+
+		if (new_buffer == NULL)
+		{
+			error = true;
+
+			return false;
+		}
+
+		buffer = new_buffer;
+		capacity = new_capacity;
+
+		return true;
+	}
+
+	memory_allocator allocator;
+	char *buffer;
+	size_t length;
+	size_t capacity;
+	bool error;
+};
+
 /* -- Type Definitions -- */
 
+/* Each handle lives for a single serialize or deserialize call, so the arena is released with it */
 typedef struct rapid_json_document_type
 {
+	void *arena[RAPID_JSON_SERIAL_IMPL_ARENA_SIZE / sizeof(void *)];
+	rapidjson::MemoryPoolAllocator<> pool;
 	rapidjson::Document impl;
 	memory_allocator allocator;
 
+	rapid_json_document_type(memory_allocator allocator) :
+		pool(arena, sizeof(arena)), impl(&pool), allocator(allocator) {}
+
 } * rapid_json_document;
 
+/* The writer keeps its nesting stack in the document arena too */
+typedef rapidjson::Writer<rapid_json_serial_impl_stream, rapidjson::UTF8<>, rapidjson::UTF8<>, rapidjson::MemoryPoolAllocator<>> rapid_json_serial_impl_writer;
+
 /* -- Private Methods -- */
 
-static void rapid_json_serial_impl_serialize_value(value v, rapidjson::Value *json_v);
+template <typename writer_type>
+static bool rapid_json_serial_impl_serialize_value(value v, writer_type &writer);
 
-static char *rapid_json_serial_impl_document_stringify(rapid_json_document document, size_t *size);
+template <typename writer_type>
+static bool rapid_json_serial_impl_serialize_key(value v, writer_type &writer);
 
 static value rapid_json_serial_impl_deserialize_value(const rapidjson::Value *v);
 
-/* -- Classes -- */
-
-// https://techoverflow.net/2020/01/13/how-to-fix-rapidjson-segmentation-faults-when-building-nested-documents/
-rapidjson::MemoryPoolAllocator<> rapid_json_allocator;
-
 /* -- Methods -- */
 
 const char *rapid_json_serial_impl_extension()
@@ -52,19 +161,40 @@ const char *rapid_json_serial_impl_extension()
 
 serial_handle rapid_json_serial_impl_initialize(memory_allocator allocator)
 {
-	rapid_json_document document = new rapid_json_document_type();
+	rapid_json_document document = new rapid_json_document_type(allocator);
 
 	if (document == nullptr)
 	{
 		return NULL;
 	}
 
-	document->allocator = allocator;
-
 	return (serial_handle)document;
 }
 
-void rapid_json_serial_impl_serialize_value(value v, rapidjson::Value *json_v)
+template <typename writer_type>
+bool rapid_json_serial_impl_serialize_key(value v, writer_type &writer)
+{
+	if (value_type_id(v) == TYPE_STRING)
+	{
+		size_t size = value_type_size(v);
+
+		return writer.Key(value_to_string(v), size > 0 ? (rapidjson::SizeType)(size - 1) : 0);
+	}
+
+	/* JSON keys must be strings, so other keys are written as their JSON text */
+	rapidjson::StringBuffer key_buffer;
+	rapidjson::Writer<rapidjson::StringBuffer> key_writer(key_buffer);
+
+	if (rapid_json_serial_impl_serialize_value(v, key_writer) == false)
+	{
+		return false;
+	}
+
+	return writer.Key(key_buffer.GetString(), (rapidjson::SizeType)key_buffer.GetSize());
+}
+
+template <typename writer_type>
+bool rapid_json_serial_impl_serialize_value(value v, writer_type &writer)
 {
 	type_id id = value_type_id(v);
 
@@ -72,7 +202,7 @@ void rapid_json_serial_impl_serialize_value(value v, rapidjson::Value *json_v)
 	{
 		boolean b = value_to_bool(v);
 
-		json_v->SetBool(b == 1L ? true : false);
+		return writer.Bool(b == 1L ? true : false);
 	}
 	else if (id == TYPE_CHAR)
 	{
@@ -82,7 +212,7 @@ void rapid_json_serial_impl_serialize_value(value v, rapidjson::Value *json_v)
 
 		str[0] = value_to_char(v);
 
-		json_v->SetString(str, length);
+		return writer.String(str, length);
 	}
 	else if (id == TYPE_SHORT)
 	{
@@ -90,13 +220,13 @@ void rapid_json_serial_impl_serialize_value(value v, rapidjson::Value *json_v)
 
 		int i = (int)s;
 
-		json_v->SetInt(i);
+		return writer.Int(i);
 	}
 	else if (id == TYPE_INT)
 	{
 		int i = value_to_int(v);
 
-		json_v->SetInt(i);
+		return writer.Int(i);
 	}
 	else if (id == TYPE_LONG)
 	{
@@ -104,19 +234,19 @@ void rapid_json_serial_impl_serialize_value(value v, rapidjson::Value *json_v)
 
 		log_write("metacall", LOG_LEVEL_WARNING, "Casting long to int64_t (posible incompatible types) in RapidJSON implementation");
 
-		json_v->SetInt64(l);
+		return writer.Int64(l);
 	}
 	else if (id == TYPE_FLOAT)
 	{
 		float f = value_to_float(v);
 
-		json_v->SetFloat(f);
+		return writer.Double((double)f);
 	}
 	else if (id == TYPE_DOUBLE)
 	{
 		double d = value_to_double(v);
 
-		json_v->SetDouble(d);
+		return writer.Double(d);
 	}
 	else if (id == TYPE_STRING)
 	{
@@ -126,188 +256,142 @@ void rapid_json_serial_impl_serialize_value(value v, rapidjson::Value *json_v)
 
 		rapidjson::SizeType length = size > 0 ? (rapidjson::SizeType)(size - 1) : 0;
 
-		json_v->SetString(str, length);
+		return writer.String(str, length);
 	}
 	else if (id == TYPE_BUFFER)
 	{
-		rapidjson::Value &json_map = json_v->SetObject();
-
-		rapidjson::Value json_array(rapidjson::kArrayType);
+		static const char data_str[] = "data";
+		static const char length_str[] = "length";
 
 		void *buffer = value_to_buffer(v);
 
 		size_t size = value_type_size(v);
 
-		for (size_t iterator = 0; iterator < size; ++iterator)
+		if (writer.StartObject() == false || writer.Key(data_str, (rapidjson::SizeType)(sizeof(data_str) - 1)) == false || writer.StartArray() == false)
 		{
-			const char *data = (const char *)(((uintptr_t)buffer) + iterator);
-
-			rapidjson::Value json_inner_value;
-
-			json_inner_value.SetUint((unsigned int)*data);
-
-			json_array.PushBack(json_inner_value, rapid_json_allocator);
+			return false;
 		}
 
-		// Set data
+		for (size_t iterator = 0; iterator < size; ++iterator)
 		{
-			rapidjson::Value json_member;
-
-			json_member.SetString("data");
+			const char *data = (const char *)(((uintptr_t)buffer) + iterator);
 
-			json_map.AddMember(json_member, json_array, rapid_json_allocator);
+			if (writer.Uint((unsigned int)*data) == false)
+			{
+				return false;
+			}
 		}
 
-		// Set length
-		{
-			rapidjson::Value json_member, json_inner_value;
-
-			json_member.SetString("length");
-
-			json_inner_value.SetUint64((uint64_t)size);
-
-			json_map.AddMember(json_member, json_inner_value, rapid_json_allocator);
-		}
+		return writer.EndArray((rapidjson::SizeType)size) &&
+			   writer.Key(length_str, (rapidjson::SizeType)(sizeof(length_str) - 1)) &&
+			   writer.Uint64((uint64_t)size) &&
+			   writer.EndObject(2);
 	}
 	else if (id == TYPE_ARRAY)
 	{
-		rapidjson::Value &json_array = json_v->SetArray();
-
 		value *value_array = value_to_array(v);
 
 		size_t array_size = value_type_count(v);
 
-		for (size_t iterator = 0; iterator < array_size; ++iterator)
+		if (writer.StartArray() == false)
 		{
-			value current_value = value_array[iterator];
-
-			rapidjson::Value json_inner_value;
-
-			rapid_json_serial_impl_serialize_value(current_value, &json_inner_value);
+			return false;
+		}
 
-			json_array.PushBack(json_inner_value, rapid_json_allocator);
+		for (size_t iterator = 0; iterator < array_size; ++iterator)
+		{
+			if (rapid_json_serial_impl_serialize_value(value_array[iterator], writer) == false)
+			{
+				return false;
+			}
 		}
+
+		return writer.EndArray((rapidjson::SizeType)array_size);
 	}
 	else if (id == TYPE_MAP)
 	{
-		rapidjson::Value &json_map = json_v->SetObject();
-
 		value *value_map = value_to_map(v);
 
 		size_t map_size = value_type_count(v);
 
+		if (writer.StartObject() == false)
+		{
+			return false;
+		}
+
 		for (size_t iterator = 0; iterator < map_size; ++iterator)
 		{
 			value tupla = value_map[iterator];
 
 			value *tupla_array = value_to_array(tupla);
 
-			rapidjson::Value json_member, json_inner_value;
-
-			rapid_json_serial_impl_serialize_value(tupla_array[0], &json_member);
-
-			rapid_json_serial_impl_serialize_value(tupla_array[1], &json_inner_value);
-
-			json_map.AddMember(json_member, json_inner_value, rapid_json_allocator);
+			if (rapid_json_serial_impl_serialize_key(tupla_array[0], writer) == false ||
+				rapid_json_serial_impl_serialize_value(tupla_array[1], writer) == false)
+			{
+				return false;
+			}
 		}
+
+		return writer.EndObject((rapidjson::SizeType)map_size);
 	}
 	else if (id == TYPE_FUTURE)
 	{
 		/* TODO: Improve future serialization */
 		static const char str[] = "[Future]";
 
-		size_t size = sizeof(str);
-
-		rapidjson::SizeType length = size > 0 ? (rapidjson::SizeType)(size - 1) : 0;
-
-		json_v->SetString(str, length);
+		return writer.String(str, (rapidjson::SizeType)(sizeof(str) - 1));
 	}
 	else if (id == TYPE_FUNCTION)
 	{
 		/* TODO: Improve function serialization */
 		static const char str[] = "[Function]";
 
-		size_t size = sizeof(str);
-
-		rapidjson::SizeType length = size > 0 ? (rapidjson::SizeType)(size - 1) : 0;
-
-		json_v->SetString(str, length);
+		return writer.String(str, (rapidjson::SizeType)(sizeof(str) - 1));
 	}
 	else if (id == TYPE_CLASS)
 	{
 		/* TODO: Improve class serialization */
 		static const char str[] = "[Class]";
 
-		size_t size = sizeof(str);
-
-		rapidjson::SizeType length = size > 0 ? (rapidjson::SizeType)(size - 1) : 0;
-
-		json_v->SetString(str, length);
+		return writer.String(str, (rapidjson::SizeType)(sizeof(str) - 1));
 	}
 	else if (id == TYPE_OBJECT)
 	{
 		/* TODO: Improve object serialization */
 		static const char str[] = "[Object]";
 
-		size_t size = sizeof(str);
-
-		rapidjson::SizeType length = size > 0 ? (rapidjson::SizeType)(size - 1) : 0;
-
-		json_v->SetString(str, length);
+		return writer.String(str, (rapidjson::SizeType)(sizeof(str) - 1));
 	}
 	else if (id == TYPE_EXCEPTION)
 	{
-		rapidjson::Value &json_map = json_v->SetObject();
-
-		exception ex = value_to_exception(v);
-
-		rapidjson::Value message_member, message_value;
 		static const char message_str[] = "message";
-
-		message_member.SetString(message_str, (rapidjson::SizeType)(sizeof(message_str) - 1));
-		message_value.SetString(exception_message(ex), strlen(exception_message(ex)));
-		json_map.AddMember(message_member, message_value, rapid_json_allocator);
-
-		rapidjson::Value label_member, label_value;
 		static const char label_str[] = "label";
-
-		label_member.SetString(label_str, (rapidjson::SizeType)(sizeof(label_str) - 1));
-		label_value.SetString(exception_label(ex), strlen(exception_label(ex)));
-		json_map.AddMember(label_member, label_value, rapid_json_allocator);
-
-		rapidjson::Value code_member, code_value;
 		static const char code_str[] = "code";
-
-		code_member.SetString(code_str, (rapidjson::SizeType)(sizeof(code_str) - 1));
-		code_value.SetInt64(exception_error_code(ex));
-		json_map.AddMember(code_member, code_value, rapid_json_allocator);
-
-		rapidjson::Value stacktrace_member, stacktrace_value;
 		static const char stacktrace_str[] = "stacktrace";
 
-		stacktrace_member.SetString(stacktrace_str, (rapidjson::SizeType)(sizeof(stacktrace_str) - 1));
-		stacktrace_value.SetString(exception_stacktrace(ex), strlen(exception_stacktrace(ex)));
-		json_map.AddMember(stacktrace_member, stacktrace_value, rapid_json_allocator);
+		exception ex = value_to_exception(v);
+
+		return writer.StartObject() &&
+			   writer.Key(message_str, (rapidjson::SizeType)(sizeof(message_str) - 1)) &&
+			   writer.String(exception_message(ex), (rapidjson::SizeType)strlen(exception_message(ex))) &&
+			   writer.Key(label_str, (rapidjson::SizeType)(sizeof(label_str) - 1)) &&
+			   writer.String(exception_label(ex), (rapidjson::SizeType)strlen(exception_label(ex))) &&
+			   writer.Key(code_str, (rapidjson::SizeType)(sizeof(code_str) - 1)) &&
+			   writer.Int64(exception_error_code(ex)) &&
+			   writer.Key(stacktrace_str, (rapidjson::SizeType)(sizeof(stacktrace_str) - 1)) &&
+			   writer.String(exception_stacktrace(ex), (rapidjson::SizeType)strlen(exception_stacktrace(ex))) &&
+			   writer.EndObject(4);
 	}
 	else if (id == TYPE_THROWABLE)
 	{
-		rapidjson::Value &json_map = json_v->SetObject();
-
-		throwable th = value_to_throwable(v);
-
 		static const char str[] = "ExceptionThrown";
 
-		size_t size = sizeof(str);
-
-		rapidjson::SizeType length = (rapidjson::SizeType)(size - 1);
-
-		rapidjson::Value json_member, json_inner_value;
-
-		json_member.SetString(str, length);
-
-		rapid_json_serial_impl_serialize_value(throwable_value(th), &json_inner_value);
+		throwable th = value_to_throwable(v);
 
-		json_map.AddMember(json_member, json_inner_value, rapid_json_allocator);
+		return writer.StartObject() &&
+			   writer.Key(str, (rapidjson::SizeType)(sizeof(str) - 1)) &&
+			   rapid_json_serial_impl_serialize_value(throwable_value(th), writer) &&
+			   writer.EndObject(1);
 	}
 	else if (id == TYPE_PTR)
 	{
@@ -317,36 +401,16 @@ void rapid_json_serial_impl_serialize_value(value v, rapidjson::Value *json_v)
 
 		std::string s = ostream.str();
 
-		json_v->SetString(s.c_str(), (rapidjson::SizeType)s.length());
+		return writer.String(s.c_str(), (rapidjson::SizeType)s.length());
 	}
 	else if (id == TYPE_NULL)
 	{
-		json_v->SetNull();
+		return writer.Null();
 	}
-}
-
-char *rapid_json_serial_impl_document_stringify(rapid_json_document document, size_t *size)
-{
-	rapidjson::StringBuffer buffer;
-	rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-	document->impl.Accept(writer);
-	size_t buffer_size = buffer.GetSize();
-	size_t buffer_str_size = buffer_size + 1;
-	char *buffer_str = static_cast<char *>(memory_allocator_allocate(document->allocator, sizeof(char) * buffer_str_size));
-
-	if (buffer_str == NULL)
-	{
-		log_write("metacall", LOG_LEVEL_ERROR, "Invalid string allocation for document stringifycation in RapidJSON implementation");
-		return NULL;
-	}
-
-	strncpy(buffer_str, buffer.GetString(), buffer_size);
 
-	buffer_str[buffer_size] = '\0';
+	log_write("metacall", LOG_LEVEL_ERROR, "Serialization unsupported value type (%d) in RapidJSON implementation", (int)id);
 
-	*size = buffer_str_size;
-
-	return buffer_str;
+	return false;
 }
 
 char *rapid_json_serial_impl_serialize(serial_handle handle, value v, size_t *size)
@@ -360,9 +424,26 @@ char *rapid_json_serial_impl_serialize(serial_handle handle, value v, size_t *si
 		return NULL;
 	}
 
-	rapid_json_serial_impl_serialize_value(v, &document->impl);
+	/* Stream the value into the caller allocator instead of building a DOM and copying its text */
+	rapid_json_serial_impl_stream stream(document->allocator);
+
+	rapid_json_serial_impl_writer writer(stream, &document->pool);
+
+	if (rapid_json_serial_impl_serialize_value(v, writer) == false || writer.IsComplete() == false)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid value serialization in RapidJSON implementation");
+
+		return NULL;
+	}
+
+	char *buffer = stream.release(size);
+
+	if (buffer == NULL)
+	{
+		log_write("metacall", LOG_LEVEL_ERROR, "Invalid string allocation for value serialization in RapidJSON implementation");
+	}
 
-	return rapid_json_serial_impl_document_stringify(document, size);
+	return buffer;
 }
 
 value rapid_json_serial_impl_deserialize_value(const rapidjson::Value *v)
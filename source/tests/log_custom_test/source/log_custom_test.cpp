@@ -25,6 +25,10 @@
 #include <log/log_handle.h>
 #include <log/log_level.h>
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 static const char format[] = "%.19s #%" PRIuS " %s:%" PRIuS " %s @%s ";
 
 class log_custom_test : public testing::Test
@@ -140,3 +144,78 @@ TEST_F(log_custom_test, DefaultConstructor)
 	/* Clear log */
 	EXPECT_EQ((int)0, (int)log_clear(name));
 }
+
+int stream_count(void *context, const char *buffer, const size_t size)
+{
+	std::atomic<size_t> *count = static_cast<std::atomic<size_t> *>(context);
+
+	(void)buffer;
+	(void)size;
+
+	++(*count);
+
+	return 0;
+}
+
+TEST_F(log_custom_test, BatchInterval)
+{
+	const char name[] = "custom_batch_log";
+
+	std::atomic<size_t> count(0);
+
+	/* Create logs */
+	EXPECT_EQ((int)0, (int)log_create(name));
+
+	/* Set policies, records below critical level are only written when the batch is full or the interval expires */
+	EXPECT_EQ((int)0, (int)log_configure(name,
+						  log_policy_format_custom(NULL, &format_size, &format_serialize, &format_deserialize),
+						  log_policy_schedule_sync(),
+						  log_policy_storage_batch_threshold(0x1000, LOG_LEVEL_CRITICAL, 50),
+						  log_policy_stream_custom(&count, &stream_count, &stream_flush)));
+
+	/* Write a single record and stay idle, the timer must flush it without waiting for another record */
+	EXPECT_EQ((int)0, (int)log_write(name, LOG_LEVEL_INFO, "hello world"));
+
+	for (size_t iterator = 0; iterator < 100 && count == 0; ++iterator)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+
+	EXPECT_EQ((size_t)1, (size_t)count);
+
+	/* Clear log */
+	EXPECT_EQ((int)0, (int)log_clear(name));
+}
+
+TEST_F(log_custom_test, BatchNoInterval)
+{
+	const char name[] = "custom_batch_no_interval_log";
+
+	std::atomic<size_t> count(0);
+
+	/* Create logs */
+	EXPECT_EQ((int)0, (int)log_create(name));
+
+	/* Set policies, without interval the records below critical level are only written when the batch is full */
+	EXPECT_EQ((int)0, (int)log_configure(name,
+						  log_policy_format_custom(NULL, &format_size, &format_serialize, &format_deserialize),
+						  log_policy_schedule_sync(),
+						  log_policy_storage_batch_threshold(0x1000, LOG_LEVEL_CRITICAL, 0),
+						  log_policy_stream_custom(&count, &stream_count, &stream_flush)));
+
+	/* Write several records, they must stay in the batch */
+	for (size_t iterator = 0; iterator < 5; ++iterator)
+	{
+		EXPECT_EQ((int)0, (int)log_write(name, LOG_LEVEL_INFO, "hello world"));
+	}
+
+	EXPECT_EQ((size_t)0, (size_t)count);
+
+	/* A record reaching the level threshold writes the whole batch at once */
+	EXPECT_EQ((int)0, (int)log_write(name, LOG_LEVEL_CRITICAL, "hello world"));
+
+	EXPECT_EQ((size_t)1, (size_t)count);
+
+	/* Clear log */
+	EXPECT_EQ((int)0, (int)log_clear(name));
+}
@@ -0,0 +1,346 @@
+/*
+ *	Logger Library by Parra Studios
+ *	A generic logger library providing application execution reports.
+ *
+ *	Copyright (C) 2016 - 2022 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <log/log.h>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+	#include <arpa/inet.h>
+	#include <netinet/in.h>
+	#include <poll.h>
+	#include <sys/socket.h>
+	#include <unistd.h>
+#endif
+
+class log_socket_test : public testing::Test
+{
+public:
+};
+
+#if !defined(_WIN32)
+static const int timeout_ms = 5000;
+
+static int listener_create(int type, uint16_t *port)
+{
+	struct sockaddr_in address;
+	socklen_t address_length = sizeof(address);
+	int fd = socket(AF_INET, type, 0);
+
+	if (fd == -1)
+	{
+		return -1;
+	}
+
+	memset(&address, 0, sizeof(address));
+	address.sin_family = AF_INET;
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	address.sin_port = 0;
+
+	if (bind(fd, (struct sockaddr *)&address, sizeof(address)) != 0 ||
+		(type == SOCK_STREAM && listen(fd, 1) != 0) ||
+		getsockname(fd, (struct sockaddr *)&address, &address_length) != 0)
+	{
+		close(fd);
+		return -1;
+	}
+
+	*port = ntohs(address.sin_port);
+
+	return fd;
+}
+
+static bool wait_readable(int fd, int timeout)
+{
+	struct pollfd poll_fd = { fd, POLLIN, 0 };
+
+	return poll(&poll_fd, 1, timeout) > 0;
+}
+
+static bool receive_all(int fd, void *buffer, size_t size)
+{
+	size_t offset = 0;
+
+	while (offset < size)
+	{
+		if (!wait_readable(fd, timeout_ms))
+		{
+			return false;
+		}
+
+		ssize_t length = recv(fd, (char *)buffer + offset, size - offset, 0);
+
+		if (length <= 0)
+		{
+			return false;
+		}
+
+		offset += (size_t)length;
+	}
+
+	return true;
+}
+
+static uint64_t decode_integer(const unsigned char *buffer, size_t bytes)
+{
+	uint64_t value = 0;
+
+	for (size_t iterator = 0; iterator < bytes; ++iterator)
+	{
+		value = (value << 8) | buffer[iterator];
+	}
+
+	return value;
+}
+
+/* Reads a length prefixed frame holding a binary record and returns its message */
+static bool receive_binary_record(int fd, std::string &message, enum log_level_id &level)
+{
+	unsigned char header[4];
+
+	if (!receive_all(fd, header, sizeof(header)))
+	{
+		return false;
+	}
+
+	std::string payload(decode_integer(header, sizeof(header)), '\0');
+
+	if (payload.size() < LOG_POLICY_FORMAT_BINARY_HEADER_SIZE || !receive_all(fd, &payload[0], payload.size()))
+	{
+		return false;
+	}
+
+	const unsigned char *record = (const unsigned char *)payload.data();
+
+	if (record[0] != LOG_POLICY_FORMAT_BINARY_VERSION)
+	{
+		return false;
+	}
+
+	size_t func_length = (size_t)decode_integer(&record[4], 4);
+	size_t file_length = (size_t)decode_integer(&record[8], 4);
+	size_t message_length = (size_t)decode_integer(&record[12], 4);
+	size_t message_offset = LOG_POLICY_FORMAT_BINARY_HEADER_SIZE + func_length + 1 + file_length + 1;
+
+	/* The last null character is not sent */
+	if (payload.size() != message_offset + message_length)
+	{
+		return false;
+	}
+
+	level = (enum log_level_id)record[1];
+	message = payload.substr(message_offset, message_length);
+
+	return true;
+}
+#endif
+
+TEST_F(log_socket_test, UDP)
+{
+#if !defined(_WIN32)
+	uint16_t port = 0;
+	int fd = listener_create(SOCK_DGRAM, &port);
+
+	ASSERT_NE((int)-1, (int)fd);
+
+	ASSERT_EQ((int)0, (int)log_configure("udp",
+						  log_policy_format_text(),
+						  log_policy_schedule_sync(),
+						  log_policy_storage_sequential(),
+						  log_policy_stream_socket("127.0.0.1", port)));
+
+	EXPECT_EQ((int)0, (int)log_write("udp", LOG_LEVEL_ERROR, "hello %s", "udp"));
+
+	char datagram[0x200];
+
+	ASSERT_EQ((bool)true, (bool)wait_readable(fd, timeout_ms));
+
+	ssize_t length = recv(fd, datagram, sizeof(datagram) - 1, 0);
+
+	ASSERT_GT((ssize_t)length, (ssize_t)0);
+
+	datagram[length] = '\0';
+
+	EXPECT_NE((char *)NULL, (char *)strstr(datagram, "hello udp"));
+
+	close(fd);
+#else
+	GTEST_SKIP();
+#endif
+}
+
+TEST_F(log_socket_test, TCP)
+{
+#if !defined(_WIN32)
+	uint16_t port = 0;
+	int fd = listener_create(SOCK_STREAM, &port);
+	std::string message;
+	enum log_level_id level;
+
+	ASSERT_NE((int)-1, (int)fd);
+
+	ASSERT_EQ((int)0, (int)log_configure("tcp",
+						  log_policy_format_binary(),
+						  log_policy_schedule_sync(),
+						  log_policy_storage_sequential(),
+						  log_policy_stream_socket_protocol("127.0.0.1", port, LOG_POLICY_STREAM_SOCKET_TCP)));
+
+	/* The first record may be retained until the connection is established */
+	EXPECT_EQ((int)0, (int)log_write("tcp", LOG_LEVEL_WARNING, "first record"));
+
+	ASSERT_EQ((bool)true, (bool)wait_readable(fd, timeout_ms));
+
+	int client = accept(fd, NULL, NULL);
+
+	ASSERT_NE((int)-1, (int)client);
+
+	EXPECT_EQ((int)0, (int)log_write("tcp", LOG_LEVEL_ERROR, "second record %d", 2));
+
+	ASSERT_EQ((bool)true, (bool)receive_binary_record(client, message, level));
+	EXPECT_EQ((std::string) "first record", (std::string)message);
+	EXPECT_EQ((enum log_level_id)LOG_LEVEL_WARNING, (enum log_level_id)level);
+
+	ASSERT_EQ((bool)true, (bool)receive_binary_record(client, message, level));
+	EXPECT_EQ((std::string) "second record 2", (std::string)message);
+	EXPECT_EQ((enum log_level_id)LOG_LEVEL_ERROR, (enum log_level_id)level);
+
+	/* Drop the connection, the stream must reconnect with backoff and keep shipping records */
+	close(client);
+
+	client = -1;
+
+	for (int iterator = 0; iterator < 100 && client == -1; ++iterator)
+	{
+		EXPECT_EQ((int)0, (int)log_write("tcp", LOG_LEVEL_ERROR, "reconnect"));
+
+		if (wait_readable(fd, 100))
+		{
+			client = accept(fd, NULL, NULL);
+		}
+	}
+
+	ASSERT_NE((int)-1, (int)client);
+
+	EXPECT_EQ((int)0, (int)log_write("tcp", LOG_LEVEL_ERROR, "after reconnect"));
+
+	do
+	{
+		ASSERT_EQ((bool)true, (bool)receive_binary_record(client, message, level));
+	} while (message != "after reconnect");
+
+	close(client);
+	close(fd);
+#else
+	GTEST_SKIP();
+#endif
+}
+
+TEST_F(log_socket_test, TCPMultithread)
+{
+#if !defined(_WIN32)
+	static const size_t thread_count = 8;
+	static const size_t record_count = 2000;
+
+	uint16_t port = 0;
+	int fd = listener_create(SOCK_STREAM, &port);
+	std::string message;
+	enum log_level_id level;
+
+	ASSERT_NE((int)-1, (int)fd);
+
+	ASSERT_EQ((int)0, (int)log_configure("tcp_multithread",
+						  log_policy_format_binary(),
+						  log_policy_schedule_sync(),
+						  log_policy_storage_sequential(),
+						  log_policy_stream_socket_protocol("127.0.0.1", port, LOG_POLICY_STREAM_SOCKET_TCP)));
+
+	EXPECT_EQ((int)0, (int)log_write("tcp_multithread", LOG_LEVEL_ERROR, "connect"));
+
+	ASSERT_EQ((bool)true, (bool)wait_readable(fd, timeout_ms));
+
+	int client = accept(fd, NULL, NULL);
+
+	ASSERT_NE((int)-1, (int)client);
+
+	/* The stream is written from all the threads at the same time, the frames must not be interleaved or lost */
+	std::vector<std::thread> writers;
+
+	for (size_t id = 0; id < thread_count; ++id)
+	{
+		writers.emplace_back([id]() {
+			for (size_t iterator = 0; iterator < record_count; ++iterator)
+			{
+				log_write("tcp_multithread", LOG_LEVEL_ERROR, "thread %" PRIuS " record %" PRIuS, id, iterator);
+			}
+		});
+	}
+
+	std::vector<size_t> received(thread_count, 0);
+	size_t total = 0;
+	bool valid = true;
+
+	while (valid && total < thread_count * record_count)
+	{
+		/* Records retained by a full socket buffer are sent on the next write */
+		if (!wait_readable(client, 100))
+		{
+			log_write("tcp_multithread", LOG_LEVEL_ERROR, "flush");
+			continue;
+		}
+
+		size_t id, iterator;
+
+		if (!receive_binary_record(client, message, level))
+		{
+			valid = false;
+		}
+		else if (sscanf(message.c_str(), "thread %zu record %zu", &id, &iterator) == 2)
+		{
+			/* Each thread writes its records in order */
+			valid = id < thread_count && received[id] == iterator;
+
+			if (valid)
+			{
+				++received[id];
+				++total;
+			}
+		}
+	}
+
+	for (std::thread &t : writers)
+	{
+		t.join();
+	}
+
+	EXPECT_EQ((bool)true, (bool)valid);
+	EXPECT_EQ((size_t)(thread_count * record_count), (size_t)total);
+
+	close(client);
+	close(fd);
+#else
+	GTEST_SKIP();
+#endif
+}
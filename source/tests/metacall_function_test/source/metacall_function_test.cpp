@@ -119,6 +119,44 @@ TEST_F(metacall_function_test, DefaultConstructor)
 	EXPECT_EQ((int)0, (int)metacall_function_async(metacall_function("c_callback_factorial")));
 	EXPECT_EQ((size_t)1, (size_t)metacall_function_size(metacall_function("c_callback_factorial")));
 
+	/* Test prepared calls */
+	{
+		const enum metacall_value_id ids[] = {
+			METACALL_INT, METACALL_LONG
+		};
+
+		void *prepared = metacall_prepare(metacall_function("c_callback_with_args"), ids, sizeof(ids) / sizeof(ids[0]));
+
+		ASSERT_NE((void *)NULL, (void *)prepared);
+
+		for (int iterator = 0; iterator < 3; ++iterator)
+		{
+			void *args[] = {
+				metacall_value_create_int(iterator),
+				metacall_value_create_long(5L)
+			};
+
+			void *ret = metacall_prepared_call(prepared, args);
+
+			EXPECT_NE((void *)NULL, (void *)ret);
+
+			EXPECT_EQ((enum metacall_value_id)METACALL_LONG, (enum metacall_value_id)metacall_value_id(args[0]));
+
+			EXPECT_EQ((long)(iterator + 5L), (long)metacall_value_to_long(ret));
+
+			metacall_value_destroy(ret);
+
+			for (void *arg : args)
+			{
+				metacall_value_destroy(arg);
+			}
+		}
+
+		metacall_prepared_destroy(prepared);
+
+		EXPECT_EQ((void *)NULL, (void *)metacall_prepare(NULL, ids, sizeof(ids) / sizeof(ids[0])));
+	}
+
 /* Python */
 #if defined(OPTION_BUILD_LOADERS_PY)
 	{
@@ -24,6 +24,8 @@
 #include <metacall/metacall_loaders.h>
 #include <metacall/metacall_value.h>
 
+#include <string>
+
 class metacall_map_test : public testing::Test
 {
 public:
@@ -212,3 +214,62 @@ TEST_F(metacall_map_test, DefaultConstructor)
 
 	EXPECT_EQ((int)0, (int)metacall_destroy());
 }
+
+TEST_F(metacall_map_test, MapGet)
+{
+	static const size_t sizes[] = { 3, 64 };
+
+	for (size_t size : sizes)
+	{
+		void *v = metacall_value_create_map(NULL, size);
+
+		void **tuples = metacall_value_to_map(v);
+
+		for (size_t iterator = 0; iterator < size; ++iterator)
+		{
+			std::string key = "key_" + std::to_string(iterator);
+
+			void *pair[] = {
+				metacall_value_create_string(key.c_str(), key.length()),
+				metacall_value_create_long((long)iterator)
+			};
+
+			tuples[iterator] = metacall_value_create_array((const void **)pair, sizeof(pair) / sizeof(pair[0]));
+		}
+
+		/* Duplicated keys resolve to the first occurrence */
+		void **last_pair = metacall_value_to_array(tuples[size - 1]);
+
+		metacall_value_destroy(last_pair[0]);
+
+		last_pair[0] = metacall_value_create_string("key_0", sizeof("key_0") - 1);
+
+		for (size_t iterator = 0; iterator < size - 1; ++iterator)
+		{
+			std::string key = "key_" + std::to_string(iterator);
+
+			void *element = metacall_value_map_get(v, key.c_str());
+
+			ASSERT_NE((void *)NULL, (void *)element);
+
+			EXPECT_EQ((long)iterator, (long)metacall_value_to_long(element));
+		}
+
+		EXPECT_EQ((void *)NULL, (void *)metacall_value_map_get(v, "key_missing"));
+		EXPECT_EQ((void *)NULL, (void *)metacall_value_map_get(v, std::string("key_" + std::to_string(size - 1)).c_str()));
+
+		/* Assigning the tuples invalidates the index */
+		void *first = tuples[0];
+
+		tuples[0] = tuples[size - 1];
+		tuples[size - 1] = first;
+
+		void *swapped[] = { tuples[0] };
+
+		metacall_value_from_map(v, (const void **)swapped, 1);
+
+		EXPECT_EQ((long)(size - 1), (long)metacall_value_to_long(metacall_value_map_get(v, "key_0")));
+
+		metacall_value_destroy(v);
+	}
+}
@@ -28,6 +28,12 @@
 
 std::atomic<int> success_callbacks{};
 
+std::atomic<int> pipelined_callbacks{};
+
+std::atomic<int> pipelined_future_callbacks{};
+
+static const int pipelined_size = 100;
+
 class metacall_node_async_test : public testing::Test
 {
 public:
@@ -186,6 +192,54 @@ TEST_F(metacall_node_async_test, DefaultConstructor)
 		metacall_value_destroy(last);
 
 		metacall_value_destroy(ret);
+
+		/* Test pipelined awaits, submitting from outside of the JavaScript thread returns without waiting for the JavaScript thread */
+		for (int iterator = 0; iterator < pipelined_size; ++iterator)
+		{
+			void *pipelined_args[] = {
+				metacall_value_create_double((double)iterator)
+			};
+
+			future = metacall_await(
+				"f", pipelined_args, [](void *result, void *) -> void * {
+				EXPECT_EQ((enum metacall_value_id) metacall_value_id(result), (enum metacall_value_id) METACALL_DOUBLE);
+
+				++pipelined_callbacks;
+
+				return NULL; }, [](void *, void *) -> void * {
+				int this_should_never_be_executed = 0;
+
+				EXPECT_EQ((int) 1, (int) this_should_never_be_executed);
+
+				return NULL; }, NULL);
+
+			EXPECT_NE((void *)NULL, (void *)future);
+
+			EXPECT_EQ((enum metacall_value_id)metacall_value_id(future), (enum metacall_value_id)METACALL_FUTURE);
+
+			/* The returned future is linked to the promise once it is created, the awaits registered before are applied then */
+			void *chain = metacall_await_future(
+				metacall_value_to_future(future), [](void *result, void *) -> void * {
+				EXPECT_EQ((enum metacall_value_id) metacall_value_id(result), (enum metacall_value_id) METACALL_DOUBLE);
+
+				++pipelined_future_callbacks;
+
+				return NULL; }, [](void *, void *) -> void * {
+				int this_should_never_be_executed = 0;
+
+				EXPECT_EQ((int) 1, (int) this_should_never_be_executed);
+
+				return NULL; }, NULL);
+
+			EXPECT_NE((void *)NULL, (void *)chain);
+
+			metacall_value_destroy(chain);
+
+			metacall_value_destroy(future);
+
+			/* The arguments are copied by the await, so they can be destroyed even if the promise has not been created yet */
+			metacall_value_destroy(pipelined_args[0]);
+		}
 	}
 #endif /* OPTION_BUILD_LOADERS_NODE */
 
@@ -196,6 +250,11 @@ TEST_F(metacall_node_async_test, DefaultConstructor)
 	{
 		/* Total amount of successful callbacks must be 3 */
 		EXPECT_EQ((int)success_callbacks, (int)3);
+
+		/* All the pipelined awaits must have been resolved before destroying */
+		EXPECT_EQ((int)pipelined_callbacks, (int)pipelined_size);
+
+		EXPECT_EQ((int)pipelined_future_callbacks, (int)pipelined_size);
 	}
 #endif /* OPTION_BUILD_LOADERS_NODE */
 }
@@ -0,0 +1,173 @@
+/*
+ *	MetaCall Library by Parra Studios
+ *	A library for providing a foreign function interface calls.
+ *
+ *	Copyright (C) 2016 - 2022 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <metacall/metacall.h>
+#include <metacall/metacall_loaders.h>
+
+class metacall_python_buffer_test : public testing::Test
+{
+public:
+};
+
+TEST_F(metacall_python_buffer_test, DefaultConstructor)
+{
+	metacall_print_info();
+
+	ASSERT_EQ((int)0, (int)metacall_initialize());
+
+/* Python */
+#if defined(OPTION_BUILD_LOADERS_PY)
+	{
+		const char python_script[] =
+			"#!/usr/bin/env python3\n"
+			"kept = None\n"
+			"def buffer_type(b):\n"
+			"	return type(b).__name__\n"
+			"def buffer_sum(b: bytes) -> int:\n"
+			"	return sum(b)\n"
+			"def buffer_keep(b):\n"
+			"	global kept\n"
+			"	kept = b\n"
+			"	return b\n"
+			"def buffer_kept_sum() -> int:\n"
+			"	return sum(kept)\n"
+			"def buffer_release():\n"
+			"	global kept\n"
+			"	kept = None\n"
+			"def buffer_bytearray() -> bytes:\n"
+			"	return bytearray(b'abcd')\n"
+			"shared = bytearray(b'abcd')\n"
+			"def buffer_shared():\n"
+			"	return shared\n"
+			"def buffer_shared_first() -> int:\n"
+			"	return shared[0]\n"
+			"def buffer_slice(b):\n"
+			"	return b[1:3]\n";
+
+		ASSERT_EQ((int)0, (int)metacall_load_from_memory("py", python_script, sizeof(python_script), NULL));
+
+		const char data[] = { 1, 2, 3, 4 };
+
+		void *args[] = {
+			metacall_value_create_buffer(data, sizeof(data))
+		};
+
+		/* Buffers are received as memory views of the value (enabled with buffer_memoryview in the configuration) */
+		void *ret = metacallv("buffer_type", args);
+
+		EXPECT_EQ((enum metacall_value_id)METACALL_STRING, (enum metacall_value_id)metacall_value_id(ret));
+
+		EXPECT_STREQ("memoryview", metacall_value_to_string(ret));
+
+		metacall_value_destroy(ret);
+
+		ret = metacallv("buffer_sum", args);
+
+		EXPECT_EQ((long)10, (long)metacall_value_to_long(ret));
+
+		metacall_value_destroy(ret);
+
+		/* Returning the same memory view shares the value instead of copying it */
+		ret = metacallv("buffer_keep", args);
+
+		EXPECT_EQ((enum metacall_value_id)METACALL_BUFFER, (enum metacall_value_id)metacall_value_id(ret));
+
+		EXPECT_EQ((size_t)sizeof(data), (size_t)metacall_value_size(ret));
+
+		EXPECT_EQ((void *)metacall_value_to_buffer(args[0]), (void *)metacall_value_to_buffer(ret));
+
+		/* The memory view kept by Python pins the value after the owners destroy it */
+		metacall_value_destroy(args[0]);
+		metacall_value_destroy(ret);
+
+		ret = metacall("buffer_kept_sum");
+
+		EXPECT_EQ((long)10, (long)metacall_value_to_long(ret));
+
+		metacall_value_destroy(ret);
+
+		ret = metacall("buffer_release");
+
+		EXPECT_EQ((enum metacall_value_id)METACALL_NULL, (enum metacall_value_id)metacall_value_id(ret));
+
+		metacall_value_destroy(ret);
+
+		/* Other exporters of the buffer protocol are converted into buffers that borrow their memory */
+		ret = metacall("buffer_bytearray");
+
+		EXPECT_EQ((enum metacall_value_id)METACALL_BUFFER, (enum metacall_value_id)metacall_value_id(ret));
+
+		EXPECT_EQ((size_t)4, (size_t)metacall_value_size(ret));
+
+		EXPECT_EQ((int)0, (int)memcmp(metacall_value_to_buffer(ret), "abcd", 4));
+
+		metacall_value_destroy(ret);
+
+		/* The memory of a writable exporter is shared with the value without copying it */
+		ret = metacall("buffer_shared");
+
+		EXPECT_EQ((enum metacall_value_id)METACALL_BUFFER, (enum metacall_value_id)metacall_value_id(ret));
+
+		EXPECT_EQ((size_t)4, (size_t)metacall_value_size(ret));
+
+		static_cast<char *>(metacall_value_to_buffer(ret))[0] = 'z';
+
+		void *first = metacall("buffer_shared_first");
+
+		EXPECT_EQ((long)'z', (long)metacall_value_to_long(first));
+
+		metacall_value_destroy(first);
+
+		/* The copies of a borrowed buffer own their memory */
+		void *copy = metacall_value_copy(ret);
+
+		EXPECT_EQ((size_t)4, (size_t)metacall_value_size(copy));
+
+		EXPECT_NE((void *)metacall_value_to_buffer(ret), (void *)metacall_value_to_buffer(copy));
+
+		EXPECT_EQ((int)0, (int)memcmp(metacall_value_to_buffer(copy), "zbcd", 4));
+
+		metacall_value_destroy(copy);
+
+		metacall_value_destroy(ret);
+
+		/* Slices refer to a part of the value, so they are copied */
+		args[0] = metacall_value_create_buffer(data, sizeof(data));
+
+		ret = metacallv("buffer_slice", args);
+
+		EXPECT_EQ((enum metacall_value_id)METACALL_BUFFER, (enum metacall_value_id)metacall_value_id(ret));
+
+		EXPECT_EQ((size_t)2, (size_t)metacall_value_size(ret));
+
+		EXPECT_NE((void *)metacall_value_to_buffer(args[0]), (void *)metacall_value_to_buffer(ret));
+
+		EXPECT_EQ((int)0, (int)memcmp(metacall_value_to_buffer(ret), &data[1], 2));
+
+		metacall_value_destroy(ret);
+
+		metacall_value_destroy(args[0]);
+	}
+#endif /* OPTION_BUILD_LOADERS_PY */
+
+	EXPECT_EQ((int)0, (int)metacall_destroy());
+}
@@ -0,0 +1,88 @@
+/*
+ *	MetaCall Library by Parra Studios
+ *	A library for providing a foreign function interface calls.
+ *
+ *	Copyright (C) 2016 - 2022 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <metacall/metacall.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+static const size_t thread_count = 4;
+static const size_t call_count = 1000;
+
+class metacall_python_thread_destroy_test : public testing::Test
+{
+public:
+};
+
+TEST_F(metacall_python_thread_destroy_test, DefaultConstructor)
+{
+	metacall_print_info();
+
+	ASSERT_EQ((int)0, (int)metacall_initialize());
+
+	static const char buffer[] =
+		"#!/usr/bin/env python3\n"
+		"def sum_thread(left: int, right: int) -> int:\n"
+		"\treturn left + right\n";
+
+	ASSERT_EQ((int)0, (int)metacall_load_from_memory("py", buffer, sizeof(buffer), NULL));
+
+	/* Native threads enter into Python concurrently, each call takes and releases its own thread state */
+	std::atomic<size_t> call_errors(0);
+	std::vector<std::thread> threads;
+
+	for (size_t id = 0; id < thread_count; ++id)
+	{
+		threads.emplace_back([id, &call_errors]() {
+			for (size_t iterator = 0; iterator < call_count; ++iterator)
+			{
+				void *ret = metacall("sum_thread", (long)id, (long)iterator);
+
+				if (ret == NULL || metacall_value_to_long(ret) != (long)(id + iterator))
+				{
+					++call_errors;
+				}
+
+				metacall_value_destroy(ret);
+			}
+		});
+	}
+
+	for (std::thread &t : threads)
+	{
+		t.join();
+	}
+
+	EXPECT_EQ((size_t)0, (size_t)call_errors);
+
+	/* Python must be finalized from a thread different from the one that initialized it */
+	int result = 1;
+
+	std::thread destroyer([&result]() {
+		result = metacall_destroy();
+	});
+
+	destroyer.join();
+
+	EXPECT_EQ((int)0, (int)result);
+}
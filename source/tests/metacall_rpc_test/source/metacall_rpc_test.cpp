@@ -24,6 +24,57 @@
 #include <metacall/metacall_loaders.h>
 #include <metacall/metacall_value.h>
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+static std::atomic<long> await_resolved(0);
+static std::atomic<long> await_rejected(0);
+
+static void *sum_await_resolve(void *result, void *data)
+{
+	long *expected = static_cast<long *>(data);
+
+	/* The result is owned by the loader, so it is read without casting it */
+	long value = metacall_value_id(result) == METACALL_INT ? (long)metacall_value_to_int(result) : metacall_value_to_long(result);
+
+	if (value == *expected)
+	{
+		++await_resolved;
+	}
+
+	delete expected;
+
+	return NULL;
+}
+
+static void *sum_await_reject(void *, void *data)
+{
+	delete static_cast<long *>(data);
+
+	++await_rejected;
+
+	return NULL;
+}
+
+static std::atomic<long> future_resolved(0);
+
+static void *sum_future_resolve(void *result, void *data)
+{
+	long expected = *static_cast<long *>(data);
+
+	long value = metacall_value_id(result) == METACALL_INT ? (long)metacall_value_to_int(result) : metacall_value_to_long(result);
+
+	if (value == expected)
+	{
+		++future_resolved;
+	}
+
+	/* The returned value resolves the future returned by metacall_await_future */
+	return metacall_value_create_long(value);
+}
+
 class metacall_rpc_test : public testing::Test
 {
 public:
@@ -67,6 +118,210 @@ TEST_F(metacall_rpc_test, DefaultConstructor)
 			metacall_allocator_destroy(allocator);
 		}
 
+		/* Concurrent calls, each thread has its own request in flight over the pooled connections */
+		{
+			const enum metacall_value_id sum_ids[] = {
+				METACALL_LONG, METACALL_LONG
+			};
+
+			const long thread_count = 8, call_count = 50;
+
+			std::atomic<long> success(0);
+
+			std::vector<std::thread> threads;
+
+			for (long t = 0; t < thread_count; ++t)
+			{
+				threads.emplace_back([handle, &sum_ids, &success, t]() {
+					for (long it = 0; it < call_count; ++it)
+					{
+						void *ret = metacallht_s(handle, "sum", sum_ids, 2, t, it);
+
+						if (ret != NULL)
+						{
+							if (metacall_value_cast_long(&ret) == t + it)
+							{
+								++success;
+							}
+
+							metacall_value_destroy(ret);
+						}
+					}
+				});
+			}
+
+			for (auto &thread : threads)
+			{
+				thread.join();
+			}
+
+			EXPECT_EQ((long)(thread_count * call_count), (long)success.load());
+		}
+
+		/* Asynchronous calls, all the requests are in flight at the same time from this thread */
+		{
+			void *func = metacall_handle_function(handle, "sum");
+
+			ASSERT_NE((void *)NULL, (void *)func);
+
+			const long await_count = 200;
+
+			for (long it = 0; it < await_count; ++it)
+			{
+				void *args[] = {
+					metacall_value_create_long(it),
+					metacall_value_create_long(1L)
+				};
+
+				void *future = metacallfv_await_s(func, args, 2, sum_await_resolve, sum_await_reject, static_cast<void *>(new long(it + 1L)));
+
+				EXPECT_NE((void *)NULL, (void *)future);
+
+				EXPECT_EQ((enum metacall_value_id)METACALL_FUTURE, (enum metacall_value_id)metacall_value_id(future));
+
+				metacall_value_destroy(future);
+
+				for (auto arg : args)
+				{
+					metacall_value_destroy(arg);
+				}
+			}
+
+			/* Wait for the callbacks, they are executed by the event loop of the loader */
+			for (int retry = 0; retry < 500 && await_resolved.load() + await_rejected.load() < await_count; ++retry)
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			}
+
+			EXPECT_EQ((long)await_count, (long)await_resolved.load());
+
+			EXPECT_EQ((long)0, (long)await_rejected.load());
+		}
+
+		/* Await the returned future, before and after the request has been completed */
+		{
+			void *func = metacall_handle_function(handle, "sum");
+
+			ASSERT_NE((void *)NULL, (void *)func);
+
+			void *args[] = {
+				metacall_value_create_long(3L),
+				metacall_value_create_long(4L)
+			};
+
+			long expected = 7L;
+
+			void *future = metacallfv_await_s(func, args, 2, NULL, NULL, NULL);
+
+			ASSERT_NE((void *)NULL, (void *)future);
+
+			EXPECT_EQ((enum metacall_value_id)METACALL_FUTURE, (enum metacall_value_id)metacall_value_id(future));
+
+			void *pending = metacall_await_future(metacall_value_to_future(future), sum_future_resolve, sum_await_reject, static_cast<void *>(&expected));
+
+			EXPECT_NE((void *)NULL, (void *)pending);
+
+			for (int retry = 0; retry < 500 && future_resolved.load() < 1; ++retry)
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			}
+
+			EXPECT_EQ((long)1, (long)future_resolved.load());
+
+			/* Once settled, the callbacks are executed immediately */
+			void *settled = metacall_await_future(metacall_value_to_future(future), sum_future_resolve, sum_await_reject, static_cast<void *>(&expected));
+
+			EXPECT_EQ((long)2, (long)future_resolved.load());
+
+			/* The future returned by the first await is resolved with the value returned by its callback */
+			void *chained = metacall_await_future(metacall_value_to_future(pending), sum_future_resolve, sum_await_reject, static_cast<void *>(&expected));
+
+			EXPECT_EQ((long)3, (long)future_resolved.load());
+
+			EXPECT_EQ((long)0, (long)await_rejected.load());
+
+			for (void *v : { chained, settled, pending, future, args[0], args[1] })
+			{
+				if (v != NULL)
+				{
+					metacall_value_destroy(v);
+				}
+			}
+		}
+
+		/* Batch calls, all of them are sent to the endpoint in a single request */
+		{
+			void *func = metacall_handle_function(handle, "sum");
+
+			ASSERT_NE((void *)NULL, (void *)func);
+
+			const size_t batch_count = 100;
+
+			std::vector<void *> funcs(batch_count, func), rets(batch_count, NULL);
+			std::vector<void **> args(batch_count);
+			std::vector<size_t> sizes(batch_count, 2);
+
+			/* The arguments are casted to the signature types, so the int values are sent as long */
+			for (size_t it = 0; it < batch_count; ++it)
+			{
+				args[it] = new void *[2] {
+					metacall_value_create_long((long)it),
+					it % 2 == 0 ? metacall_value_create_long(2L) : metacall_value_create_int(2)
+				};
+			}
+
+			EXPECT_EQ((int)0, (int)metacallfv_batch_s(funcs.data(), args.data(), sizes.data(), batch_count, rets.data()));
+
+			for (size_t it = 0; it < batch_count; ++it)
+			{
+				EXPECT_NE((void *)NULL, (void *)rets[it]);
+
+				if (rets[it] != NULL)
+				{
+					/* The results are casted to the return type of the signature */
+					EXPECT_EQ((enum metacall_value_id)METACALL_LONG, (enum metacall_value_id)metacall_value_id(rets[it]));
+
+					EXPECT_EQ((long)(it + 2), (long)metacall_value_to_long(rets[it]));
+
+					metacall_value_destroy(rets[it]);
+				}
+
+				metacall_value_destroy(args[it][0]);
+				metacall_value_destroy(args[it][1]);
+
+				delete[] args[it];
+			}
+		}
+
+		/* Batch calls whose results are omitted by the server must fail */
+		{
+			void *func = metacall_handle_function(handle, "sum");
+
+			ASSERT_NE((void *)NULL, (void *)func);
+
+			void *funcs[] = { func, func, func }, *rets[] = { NULL, NULL, NULL };
+			void *first[] = { metacall_value_create_long(3L), metacall_value_create_long(2L) };
+			void *omitted[] = { metacall_value_create_long(-1L), metacall_value_create_long(2L) };
+			void *last[] = { metacall_value_create_long(5L), metacall_value_create_long(2L) };
+			void **args[] = { first, omitted, last };
+			size_t sizes[] = { 2, 2, 2 };
+
+			EXPECT_NE((int)0, (int)metacallfv_batch_s(funcs, args, sizes, 3, rets));
+
+			EXPECT_EQ((void *)NULL, (void *)rets[1]);
+
+			for (size_t it = 0; it < 3; ++it)
+			{
+				if (rets[it] != NULL)
+				{
+					metacall_value_destroy(rets[it]);
+				}
+
+				metacall_value_destroy(args[it][0]);
+				metacall_value_destroy(args[it][1]);
+			}
+		}
+
 		const enum metacall_value_id divide_ids[] = {
 			METACALL_FLOAT, METACALL_FLOAT
 		};
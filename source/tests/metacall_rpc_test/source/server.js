@@ -1,6 +1,10 @@
 const http = require('http');
 const port = 6094;
 
+// Must match the default RPC_LOADER_IMPL_MAX_HOST_CONNECTIONS of the loader
+const maxHostConnections = 8;
+let sumConnections = 0;
+
 const server = http.createServer((req, res) => {
 	req.on('error', err => {
 		console.error(err);
@@ -48,6 +52,36 @@ const server = http.createServer((req, res) => {
 				}, 1000);
 			});
 			return;
+		} else if (req.url === '/viferga/example/v1/batch') {
+			data.then((body) => {
+				// Results are sent in reverse order, the loader must match them by id,
+				// calls with a negative first parameter are omitted from the response
+				const result = JSON.parse(body).filter(({ params }) => params[0] >= 0).map(({ id, method, params }) => {
+					if (method !== 'sum') {
+						return { id, error: `Invalid method ${method}` };
+					}
+					return { id, result: params[0] + params[1] };
+				}).reverse();
+				res.setHeader('Content-Type', 'application/json');
+				res.end(JSON.stringify(result));
+			});
+			return;
+		} else if (req.url === '/viferga/example/v1/call/sum') {
+			data.then((body) => {
+				const [left, right] = JSON.parse(body);
+				// Concurrent calls must share the pooled connections, bounded by the per host limit
+				if (req.socket.sumConnection !== true) {
+					req.socket.sumConnection = true;
+					req.socket.on('close', () => --sumConnections);
+					if (++sumConnections > maxHostConnections) {
+						console.error('Too many connections:', sumConnections);
+						process.exit(1);
+					}
+				}
+				res.setHeader('Content-Type', 'application/json');
+				res.end(JSON.stringify(left + right));
+			});
+			return;
 		}
 	}
 
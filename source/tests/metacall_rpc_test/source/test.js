@@ -81,6 +81,8 @@ process.on('uncaughtException', killTest);
 		if (code !== 0) {
 			killTest(`Error: Test exited with code ${code}`);
 		}
+		server.removeAllListeners('exit');
+		server.kill('SIGINT');
 		process.exit(0);
 	});
 })();
@@ -0,0 +1,236 @@
+/*
+ *	MetaCall Library by Parra Studios
+ *	A library for providing a foreign function interface calls.
+ *
+ *	Copyright (C) 2016 - 2022 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <metacall/metacall.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+static const size_t thread_count = 8;
+static const size_t call_count = 10000;
+static const size_t register_count = 100;
+static const size_t clear_count = 100;
+
+void *thread_safe_sum(size_t argc, void *args[], void *data)
+{
+	(void)argc;
+	(void)data;
+
+	return metacall_value_create_long(metacall_value_to_long(args[0]) + metacall_value_to_long(args[1]));
+}
+
+class metacall_thread_safe_test : public testing::Test
+{
+public:
+};
+
+TEST_F(metacall_thread_safe_test, DefaultConstructor)
+{
+	metacall_print_info();
+
+	metacall_log_stdio_type log_stdio = { stdout };
+
+	ASSERT_EQ((int)0, (int)metacall_log(METACALL_LOG_STDIO, (void *)&log_stdio));
+
+	ASSERT_EQ((int)0, (int)metacall_initialize());
+
+	ASSERT_EQ((int)0, (int)metacall_register("thread_safe_sum", thread_safe_sum, NULL, METACALL_LONG, 2, METACALL_LONG, METACALL_LONG));
+
+	std::atomic<size_t> call_errors(0), register_errors(0), duplicated_registers(0);
+	std::vector<std::thread> threads;
+
+	for (size_t id = 0; id < thread_count; ++id)
+	{
+		if (id % 2 == 0)
+		{
+			/* Callers, they look up and call the same function concurrently */
+			threads.emplace_back([id, &call_errors]() {
+				for (size_t iterator = 0; iterator < call_count; ++iterator)
+				{
+					void *args[] = {
+						metacall_value_create_long((long)id),
+						metacall_value_create_long((long)iterator)
+					};
+
+					void *ret = metacallv_s("thread_safe_sum", args, sizeof(args) / sizeof(args[0]));
+
+					if (ret == NULL || metacall_value_to_long(ret) != (long)(id + iterator))
+					{
+						++call_errors;
+					}
+
+					metacall_value_destroy(ret);
+
+					for (void *arg : args)
+					{
+						metacall_value_destroy(arg);
+					}
+				}
+			});
+		}
+		else
+		{
+			/* Writers, they register new functions into the global scope while the callers are reading it */
+			threads.emplace_back([id, &register_errors, &duplicated_registers]() {
+				for (size_t iterator = 0; iterator < register_count; ++iterator)
+				{
+					std::string name = "thread_safe_sum_" + std::to_string(id) + "_" + std::to_string(iterator);
+
+					if (metacall_register(name.c_str(), thread_safe_sum, NULL, METACALL_LONG, 2, METACALL_LONG, METACALL_LONG) != 0)
+					{
+						++register_errors;
+					}
+
+					/* All the writers race for the same name, only one of them must succeed */
+					if (iterator == 0 && metacall_register("thread_safe_sum_duplicated", thread_safe_sum, NULL, METACALL_LONG, 2, METACALL_LONG, METACALL_LONG) == 0)
+					{
+						++duplicated_registers;
+					}
+
+					void *args[] = {
+						metacall_value_create_long((long)id),
+						metacall_value_create_long((long)iterator)
+					};
+
+					void *ret = metacallv_s(name.c_str(), args, sizeof(args) / sizeof(args[0]));
+
+					if (ret == NULL || metacall_value_to_long(ret) != (long)(id + iterator))
+					{
+						++register_errors;
+					}
+
+					metacall_value_destroy(ret);
+
+					for (void *arg : args)
+					{
+						metacall_value_destroy(arg);
+					}
+				}
+			});
+		}
+	}
+
+	for (std::thread &t : threads)
+	{
+		t.join();
+	}
+
+	EXPECT_EQ((size_t)0, (size_t)call_errors);
+	EXPECT_EQ((size_t)0, (size_t)register_errors);
+	EXPECT_EQ((size_t)1, (size_t)duplicated_registers);
+
+	/* All the functions registered concurrently must be in the global scope */
+	for (size_t id = 1; id < thread_count; id += 2)
+	{
+		for (size_t iterator = 0; iterator < register_count; ++iterator)
+		{
+			std::string name = "thread_safe_sum_" + std::to_string(id) + "_" + std::to_string(iterator);
+
+			EXPECT_NE((void *)NULL, (void *)metacall_function(name.c_str()));
+		}
+	}
+
+	/* Call a function by name while another thread loads and clears the handle that contains it,
+	* the calls must either fail to find it or complete with the function alive until they return */
+	{
+		std::atomic<bool> clearing(true);
+		std::atomic<size_t> clear_errors(0), call_successes(0);
+		std::vector<std::thread> callers;
+
+		const char *mock_scripts[] = {
+			"empty.mock"
+		};
+
+		/* Initialize the mock loader from this thread, metacall_destroy only unloads the loaders initialized in its own thread,
+		* the script is loaded into the global scope so its functions can be found by name from the callers */
+		ASSERT_EQ((int)0, (int)metacall_load_from_file("mock", mock_scripts, sizeof(mock_scripts) / sizeof(mock_scripts[0]), NULL));
+
+		ASSERT_EQ((int)0, (int)metacall_clear(metacall_handle("mock", mock_scripts[0])));
+
+		std::thread clearer([&clearing, &clear_errors, &call_successes, &mock_scripts]() {
+			for (size_t iterator = 0; iterator < clear_count; ++iterator)
+			{
+				if (metacall_load_from_file("mock", mock_scripts, sizeof(mock_scripts) / sizeof(mock_scripts[0]), NULL) != 0)
+				{
+					++clear_errors;
+					continue;
+				}
+
+				/* Wait until a caller reaches the function, so the clear races with calls in flight */
+				size_t successes = call_successes;
+
+				for (size_t wait = 0; wait < 100000 && call_successes == successes; ++wait)
+				{
+					std::this_thread::yield();
+				}
+
+				if (metacall_clear(metacall_handle("mock", mock_scripts[0])) != 0)
+				{
+					++clear_errors;
+				}
+			}
+
+			clearing = false;
+		});
+
+		for (size_t id = 0; id < thread_count; ++id)
+		{
+			callers.emplace_back([&clearing, &call_successes]() {
+				while (clearing)
+				{
+					void *args[] = {
+						metacall_value_create_double(3.0),
+						metacall_value_create_double(6.0)
+					};
+
+					void *ret = metacallv_s("two_doubles", args, sizeof(args) / sizeof(args[0]));
+
+					if (ret != NULL)
+					{
+						++call_successes;
+
+						metacall_value_destroy(ret);
+					}
+
+					for (void *arg : args)
+					{
+						metacall_value_destroy(arg);
+					}
+				}
+			});
+		}
+
+		clearer.join();
+
+		for (std::thread &t : callers)
+		{
+			t.join();
+		}
+
+		EXPECT_EQ((size_t)0, (size_t)clear_errors);
+		EXPECT_LT((size_t)0, (size_t)call_successes);
+	}
+
+	EXPECT_EQ((int)0, (int)metacall_destroy());
+}
@@ -94,6 +94,105 @@ TEST_F(metacall_wasm_test, LoadTextFromMemory)
 	ASSERT_NE(0, metacall_load_from_memory("wasm", invalid_module, strlen(invalid_module), NULL));
 }
 
+TEST_F(metacall_wasm_test, PassBuffers)
+{
+	const char *buffers_module =
+		"(module\n"
+		"  (memory (export \"memory\") 1)\n"
+		"  (global $next (mut i32) (i32.const 1024))\n"
+		"  (global $invalid (mut i32) (i32.const 0))\n"
+		"  (func $alloc (export \"metacall_alloc\") (param $size i32) (result i32)\n"
+		"    (local $ptr i32)\n"
+		"    (i32.store8 (global.get $next) (i32.const 165))\n"
+		"    (local.set $ptr (i32.add (global.get $next) (i32.const 1)))\n"
+		"    (global.set $next (i32.add (local.get $ptr) (local.get $size)))\n"
+		"    (local.get $ptr))\n"
+		"  (func (export \"metacall_free\") (param $ptr i32) (param $size i32)\n"
+		"    (if (i32.ne (i32.load8_u (i32.sub (local.get $ptr) (i32.const 1))) (i32.const 165))\n"
+		"      (then (global.set $invalid (i32.add (global.get $invalid) (i32.const 1))))\n"
+		"      (else (i32.store8 (i32.sub (local.get $ptr) (i32.const 1)) (i32.const 0)))))\n"
+		"  (func (export \"invalid_frees\") (result i32)\n"
+		"    (global.get $invalid))\n"
+		"  (func (export \"sum_bytes\") (param $ptr i32) (param $len i32) (result i32)\n"
+		"    (local $sum i32)\n"
+		"    (block $done\n"
+		"      (loop $loop\n"
+		"        (br_if $done (i32.eqz (local.get $len)))\n"
+		"        (local.set $sum (i32.add (local.get $sum) (i32.load8_u (local.get $ptr))))\n"
+		"        (local.set $ptr (i32.add (local.get $ptr) (i32.const 1)))\n"
+		"        (local.set $len (i32.sub (local.get $len) (i32.const 1)))\n"
+		"        (br $loop)))\n"
+		"    (local.get $sum))\n"
+		"  (func $reverse (export \"reverse\") (param $ptr i32) (param $len i32) (result i32 i32)\n"
+		"    (local $out i32) (local $i i32)\n"
+		"    (local.set $out (call $alloc (local.get $len)))\n"
+		"    (block $done\n"
+		"      (loop $loop\n"
+		"        (br_if $done (i32.ge_u (local.get $i) (local.get $len)))\n"
+		"        (i32.store8 (i32.add (local.get $out) (local.get $i))\n"
+		"          (i32.load8_u (i32.sub (i32.add (local.get $ptr) (local.get $len)) (i32.add (local.get $i) (i32.const 1)))))\n"
+		"        (local.set $i (i32.add (local.get $i) (i32.const 1)))\n"
+		"        (br $loop)))\n"
+		"    (local.get $out) (local.get $len))\n"
+		"  (export \"metacall_buffer:reverse\" (func $reverse))\n"
+		"  (func $tail (export \"tail\") (param $ptr i32) (param $len i32) (result i32 i32)\n"
+		"    (i32.add (local.get $ptr) (i32.const 1)) (i32.sub (local.get $len) (i32.const 1)))\n"
+		"  (export \"metacall_buffer:tail\" (func $tail))\n"
+		"  (func (export \"stats\") (param $ptr i32) (param $len i32) (result i32 i32)\n"
+		"    (local.get $len) (i32.load8_u (local.get $ptr))))\n";
+
+	ASSERT_EQ(0, metacall_load_from_memory("wasm", buffers_module, strlen(buffers_module), NULL));
+
+	// Buffers and strings take two parameters (pointer and size) in the linear memory
+	const char bytes[] = { 1, 2, 3, 4 };
+	void *args[] = { metacall_value_create_buffer(bytes, sizeof(bytes)) };
+
+	void *ret = metacallv_s("sum_bytes", args, 1);
+	ASSERT_EQ(METACALL_INT, metacall_value_id(ret));
+	ASSERT_EQ(10, metacall_value_to_int(ret));
+	metacall_value_destroy(ret);
+	metacall_value_destroy(args[0]);
+
+	// Functions exported again as "metacall_buffer:name" return (pointer, size) pairs as buffers
+	const char *str = "hello";
+	args[0] = metacall_value_create_string(str, strlen(str));
+
+	ret = metacallv_s("reverse", args, 1);
+	ASSERT_EQ(METACALL_BUFFER, metacall_value_id(ret));
+	ASSERT_EQ((size_t)5, metacall_value_size(ret));
+	ASSERT_EQ(0, memcmp("olleh", metacall_value_to_buffer(ret), 5));
+	metacall_value_destroy(ret);
+
+	// A slice of an argument is copied but only the argument is released
+	ret = metacallv_s("tail", args, 1);
+	ASSERT_EQ(METACALL_BUFFER, metacall_value_id(ret));
+	ASSERT_EQ((size_t)4, metacall_value_size(ret));
+	ASSERT_EQ(0, memcmp("ello", metacall_value_to_buffer(ret), 4));
+	metacall_value_destroy(ret);
+
+	// Other (i32, i32) results are not buffers
+	ret = metacallv_s("stats", args, 1);
+	ASSERT_EQ(METACALL_ARRAY, metacall_value_id(ret));
+	void **stats = metacall_value_to_array(ret);
+	ASSERT_EQ(5, metacall_value_to_int(stats[0]));
+	ASSERT_EQ('h', metacall_value_to_int(stats[1]));
+	metacall_value_destroy(ret);
+	metacall_value_destroy(args[0]);
+
+	// The markers are not functions and every region has been released once
+	ASSERT_EQ(NULL, metacall_function("metacall_buffer:reverse"));
+
+	ret = metacallv_s("invalid_frees", metacall_null_args, 0);
+	ASSERT_EQ(METACALL_INT, metacall_value_id(ret));
+	ASSERT_EQ(0, metacall_value_to_int(ret));
+	metacall_value_destroy(ret);
+
+	// Missing the second parameter of the pair
+	args[0] = metacall_value_create_int(0);
+	ASSERT_EQ(NULL, metacallv_s("reverse", args, 1));
+	metacall_value_destroy(args[0]);
+}
+
 #if defined(BUILD_SCRIPT_TESTS)
 TEST_F(metacall_wasm_test, LoadFromFile)
 {
@@ -106,7 +106,8 @@ function_interface function_example_singleton()
 		&function_example_interface_create,
 		&function_example_interface_invoke,
 		&function_example_interface_await,
-		&function_example_interface_destroy
+		&function_example_interface_destroy,
+		NULL
 	};
 
 	return &example_interface;
@@ -162,6 +163,22 @@ TEST_F(reflect_function_test, DefaultConstructor)
 				function_call(f, args, sizeof(args) / sizeof(args[0]));
 			}
 
+			/* function batch example, without batch support in the interface the calls are invoked one by one */
+			{
+				char c = 'b';
+				int i = 987654321;
+				struct example_arg_type e = { 7, 1.1f, "IHGFEDCBA" };
+
+				function_args args = { &c, &i, &e };
+
+				function funcs[] = { f, f };
+				void **batch_args[] = { args, args };
+				size_t sizes[] = { 3, 3 };
+				function_return rets[] = { NULL, NULL };
+
+				EXPECT_EQ((int)0, (int)function_batch(funcs, batch_args, sizes, sizeof(funcs) / sizeof(funcs[0]), rets));
+			}
+
 			function_destroy(f);
 		}
 
@@ -26,6 +26,13 @@
 
 #include <log/log.h>
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
+static std::atomic<int> hello_world_class_destroyed(0);
+static std::atomic<int> hello_world_object_destroyed(0);
+
 typedef struct hello_world_class_type
 {
 	// These are static attributes that belong to the class
@@ -146,6 +153,8 @@ void hello_world_object_impl_interface_destroy(object obj, object_impl impl)
 	(void)obj;
 
 	delete hello_world_obj;
+
+	++hello_world_object_destroyed;
 }
 
 object_interface hello_world_object_impl_interface_singleton()
@@ -306,6 +315,8 @@ void hello_world_class_impl_interface_destroy(klass cls, class_impl impl)
 	(void)cls;
 
 	delete hellow_world_cls;
+
+	++hello_world_class_destroyed;
 }
 
 class_interface hello_world_class_impl_interface_singleton()
@@ -574,3 +585,54 @@ TEST_F(reflect_object_class_test, DefaultConstructor)
 
 	class_destroy(cls);
 }
+
+TEST_F(reflect_object_class_test, ConcurrentRelease)
+{
+	static const size_t thread_size = 4;
+	static const int iterations = 1000;
+
+	const int class_destroyed = hello_world_class_destroyed.load();
+	const int object_destroyed = hello_world_object_destroyed.load();
+
+	// Release the last references of a class and an object from multiple threads at once, they must be destroyed only once
+	for (int iterator = 0; iterator < iterations; ++iterator)
+	{
+		klass cls = class_create("HelloWorld", ACCESSOR_TYPE_STATIC, new hello_world_class_type(), &hello_world_class_impl_interface_singleton);
+		object obj = object_create("helloWorld", ACCESSOR_TYPE_STATIC, new hello_world_object_type(), &hello_world_object_impl_interface_singleton, cls);
+
+		ASSERT_NE((klass)NULL, (klass)cls);
+		ASSERT_NE((object)NULL, (object)obj);
+
+		for (size_t reference = 0; reference < thread_size; ++reference)
+		{
+			EXPECT_EQ((int)0, (int)class_increment_reference(cls));
+			EXPECT_EQ((int)0, (int)object_increment_reference(obj));
+		}
+
+		std::atomic<bool> start(false);
+		std::vector<std::thread> threads;
+
+		for (size_t thread = 0; thread < thread_size; ++thread)
+		{
+			threads.push_back(std::thread([&]() {
+				while (start.load() == false)
+				{
+					std::this_thread::yield();
+				}
+
+				object_destroy(obj);
+				class_destroy(cls);
+			}));
+		}
+
+		start.store(true);
+
+		for (std::thread &t : threads)
+		{
+			t.join();
+		}
+	}
+
+	EXPECT_EQ((int)(class_destroyed + iterations), (int)hello_world_class_destroyed.load());
+	EXPECT_EQ((int)(object_destroyed + iterations), (int)hello_world_object_destroyed.load());
+}
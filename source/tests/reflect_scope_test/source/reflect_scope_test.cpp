@@ -30,6 +30,10 @@
 
 #include <cstdlib>
 
+#if defined(OPTION_THREAD_SAFE)
+	#include <thread>
+#endif
+
 typedef struct example_arg_type
 {
 	int a;
@@ -110,7 +114,8 @@ function_interface function_example_singleton()
 		&function_example_interface_create,
 		&function_example_interface_invoke,
 		&function_example_interface_await,
-		&function_example_interface_destroy
+		&function_example_interface_destroy,
+		NULL
 	};
 
 	return &example_interface;
@@ -318,3 +323,47 @@ TEST_F(reflect_scope_test, DefaultConstructor)
 	// Destroy serial
 	serial_destroy();
 }
+
+#if defined(OPTION_THREAD_SAFE)
+TEST_F(reflect_scope_test, OppositeMerge)
+{
+	static const size_t merge_count = 200000;
+
+	scope a = scope_create("a");
+	scope b = scope_create("b");
+
+	ASSERT_NE((scope)NULL, (scope)a);
+	ASSERT_NE((scope)NULL, (scope)b);
+
+	ASSERT_EQ((int)0, (int)scope_define(a, "a", value_create_int(1)));
+	ASSERT_EQ((int)0, (int)scope_define(b, "b", value_create_int(2)));
+
+	// Merge each scope into the other one at the same time, it must not deadlock
+	std::thread a_into_b([a, b]() {
+		for (size_t iterator = 0; iterator < merge_count; ++iterator)
+		{
+			EXPECT_EQ((int)0, (int)scope_append(b, a));
+		}
+	});
+
+	std::thread b_into_a([a, b]() {
+		for (size_t iterator = 0; iterator < merge_count; ++iterator)
+		{
+			EXPECT_EQ((int)0, (int)scope_append(a, b));
+		}
+	});
+
+	a_into_b.join();
+	b_into_a.join();
+
+	EXPECT_EQ((size_t)2, (size_t)scope_size(a));
+	EXPECT_EQ((size_t)2, (size_t)scope_size(b));
+
+	// Both scopes share the values now, undefine the borrowed ones so each value is destroyed once
+	EXPECT_NE((value)NULL, (value)scope_undef(a, "b"));
+	EXPECT_NE((value)NULL, (value)scope_undef(b, "a"));
+
+	scope_destroy(a);
+	scope_destroy(b);
+}
+#endif /* OPTION_THREAD_SAFE */
@@ -26,6 +26,10 @@
 
 #include <log/log.h>
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 class serial_test : public testing::Test
 {
 public:
@@ -56,6 +60,14 @@ public:
 	{
 		return "meta";
 	}
+	const char *msgpack_name()
+	{
+		return "msgpack";
+	}
+	const char *msgpack_extension()
+	{
+		return "msgpack";
+	}
 };
 
 TEST_F(serial_test, DefaultConstructor)
@@ -74,13 +86,20 @@ TEST_F(serial_test, DefaultConstructor)
 	// Initialize serial
 	EXPECT_EQ((int)0, (int)serial_initialize());
 
+/* RapidJSON */
+#if defined(OPTION_BUILD_SERIALS_RAPID_JSON)
 	// Create RapidJSON serial
 	create_serial(rapid_json_name(), rapid_json_extension());
+#endif /* OPTION_BUILD_SERIALS_RAPID_JSON */
 
 	// Create MetaCall serial
 	create_serial(metacall_name(), metacall_extension());
 
-	// RapidJSON
+	// Create MessagePack serial
+	create_serial(msgpack_name(), msgpack_extension());
+
+/* RapidJSON */
+#if defined(OPTION_BUILD_SERIALS_RAPID_JSON)
 	{
 		static const char hello_world[] = "hello world";
 
@@ -288,7 +307,89 @@ TEST_F(serial_test, DefaultConstructor)
 		EXPECT_EQ((int)0, (int)strncmp(value_to_string(v), json_string_value, sizeof(json_string_value) - 1));
 
 		value_destroy(v);
+
+		// Serialize the same nested document from multiple threads, each call must own its allocation state
+		static const char json_nested_map[] = "{\"abc\":[1,2.5,\"asdf\"],\"cde\":{\"efg\":null}}";
+
+		v = serial_deserialize(s, json_nested_map, sizeof(json_nested_map), allocator);
+
+		ASSERT_NE((value)NULL, (value)v);
+
+		std::atomic<int> mismatches(0);
+		std::vector<std::thread> threads;
+
+		for (size_t thread = 0; thread < 4; ++thread)
+		{
+			threads.push_back(std::thread([&]() {
+				for (size_t iterator = 0; iterator < 1000; ++iterator)
+				{
+					size_t thread_size = 0;
+
+					char *thread_buffer = serial_serialize(s, v, &thread_size, allocator);
+
+					if (thread_buffer == NULL || thread_size != sizeof(json_nested_map) || strcmp(thread_buffer, json_nested_map) != 0)
+					{
+						++mismatches;
+					}
+
+					if (thread_buffer != NULL)
+					{
+						memory_allocator_deallocate(allocator, thread_buffer);
+					}
+				}
+			}));
+		}
+
+		for (std::thread &t : threads)
+		{
+			t.join();
+		}
+
+		EXPECT_EQ((int)0, (int)mismatches.load());
+
+		value_type_destroy(v);
+
+		// Round trip a document bigger than the inline arena, so it spills into heap chunks
+		static const size_t json_big_array_size = 512;
+		static const char json_big_string[] = "the quick brown fox jumps over the lazy dog";
+
+		v = value_create_array(NULL, json_big_array_size);
+
+		ASSERT_NE((value)NULL, (value)v);
+
+		v_array = value_to_array(v);
+
+		for (size_t iterator = 0; iterator < json_big_array_size; ++iterator)
+		{
+			v_array[iterator] = value_create_string(json_big_string, sizeof(json_big_string) - 1);
+		}
+
+		buffer = serial_serialize(s, v, &serialize_size, allocator);
+
+		ASSERT_NE((char *)NULL, (char *)buffer);
+		EXPECT_EQ((size_t)(json_big_array_size * (sizeof(json_big_string) + 2) + 2), (size_t)serialize_size);
+
+		value_type_destroy(v);
+
+		v = serial_deserialize(s, buffer, serialize_size, allocator);
+
+		memory_allocator_deallocate(allocator, buffer);
+
+		ASSERT_NE((value)NULL, (value)v);
+		EXPECT_EQ((type_id)TYPE_ARRAY, (type_id)value_type_id(v));
+		EXPECT_EQ((size_t)json_big_array_size, (size_t)value_type_count(v));
+
+		v_array = value_to_array(v);
+
+		for (size_t iterator = 0; iterator < json_big_array_size; ++iterator)
+		{
+			EXPECT_EQ((type_id)TYPE_STRING, (type_id)value_type_id(v_array[iterator]));
+			EXPECT_EQ((int)0, (int)strcmp(value_to_string(v_array[iterator]), json_big_string));
+		}
+
+		value_type_destroy(v);
 	}
+#endif /* OPTION_BUILD_SERIALS_RAPID_JSON */
 
 	// MetaCall
 	{
@@ -437,12 +538,178 @@ TEST_F(serial_test, DefaultConstructor)
 		}
 	}
 
+	// MessagePack
+	{
+		static const char hello_world[] = "hello world";
+		static const char map_key[] = "key";
+
+		static const char char_array[] = {
+			0x05, 0x06, 0x07, 0x08
+		};
+
+		/* [1,"a"] */
+		static const char msgpack_buffer_array[] = {
+			(char)0x92, 0x01, (char)0xa1, 'a'
+		};
+
+		serial s = serial_create(msgpack_name());
+
+		size_t serialize_size = 0;
+
+		// Serialize and deserialize a nested array with every serializable primitive
+		const value value_map_tupla[] = {
+			value_create_string(map_key, sizeof(map_key) - 1),
+			value_create_long(-251251251L)
+		};
+
+		const value value_map[] = {
+			value_create_array(value_map_tupla, sizeof(value_map_tupla) / sizeof(value_map_tupla[0]))
+		};
+
+		const value value_inner[] = {
+			value_create_int(-1),
+			value_create_map(value_map, sizeof(value_map) / sizeof(value_map[0]))
+		};
+
+		const value value_list[] = {
+			value_create_bool(1),
+			value_create_char('A'),
+			value_create_short(-12345),
+			value_create_int(56464),
+			value_create_long(251251251L),
+			value_create_float(13.545f),
+			value_create_double(545.3453),
+			value_create_string(hello_world, sizeof(hello_world) - 1),
+			value_create_buffer(char_array, sizeof(char_array)),
+			value_create_array(value_inner, sizeof(value_inner) / sizeof(value_inner[0])),
+			value_create_ptr((void *)0x000A7EF2),
+			value_create_null(),
+			value_create_exception(exception_create_const("message", "label", 33, "stacktrace")),
+			value_create_throwable(throwable_create(value_create_int(7)))
+		};
+
+		value v = value_create_array(value_list, sizeof(value_list) / sizeof(value_list[0]));
+
+		ASSERT_NE((value)NULL, (value)v);
+
+		char *buffer = serial_serialize(s, v, &serialize_size, allocator);
+
+		ASSERT_NE((char *)NULL, (char *)buffer);
+		EXPECT_GT((size_t)serialize_size, (size_t)1);
+
+		value_type_destroy(v);
+
+		v = serial_deserialize(s, buffer, serialize_size, allocator);
+
+		memory_allocator_deallocate(allocator, buffer);
+
+		ASSERT_NE((value)NULL, (value)v);
+		ASSERT_EQ((type_id)TYPE_ARRAY, (type_id)value_type_id(v));
+		ASSERT_EQ((size_t)(sizeof(value_list) / sizeof(value_list[0])), (size_t)value_type_count(v));
+
+		value *v_array = value_to_array(v);
+
+		EXPECT_EQ((type_id)TYPE_BOOL, (type_id)value_type_id(v_array[0]));
+		EXPECT_EQ((boolean)1L, (boolean)value_to_bool(v_array[0]));
+
+		EXPECT_EQ((type_id)TYPE_CHAR, (type_id)value_type_id(v_array[1]));
+		EXPECT_EQ((char)'A', (char)value_to_char(v_array[1]));
+
+		EXPECT_EQ((type_id)TYPE_SHORT, (type_id)value_type_id(v_array[2]));
+		EXPECT_EQ((short)-12345, (short)value_to_short(v_array[2]));
+
+		EXPECT_EQ((type_id)TYPE_INT, (type_id)value_type_id(v_array[3]));
+		EXPECT_EQ((int)56464, (int)value_to_int(v_array[3]));
+
+		EXPECT_EQ((type_id)TYPE_LONG, (type_id)value_type_id(v_array[4]));
+		EXPECT_EQ((long)251251251L, (long)value_to_long(v_array[4]));
+
+		EXPECT_EQ((type_id)TYPE_FLOAT, (type_id)value_type_id(v_array[5]));
+		EXPECT_EQ((float)13.545f, (float)value_to_float(v_array[5]));
+
+		EXPECT_EQ((type_id)TYPE_DOUBLE, (type_id)value_type_id(v_array[6]));
+		EXPECT_EQ((double)545.3453, (double)value_to_double(v_array[6]));
+
+		EXPECT_EQ((type_id)TYPE_STRING, (type_id)value_type_id(v_array[7]));
+		EXPECT_EQ((size_t)sizeof(hello_world), (size_t)value_type_size(v_array[7]));
+		EXPECT_EQ((int)0, (int)strcmp(value_to_string(v_array[7]), hello_world));
+
+		EXPECT_EQ((type_id)TYPE_BUFFER, (type_id)value_type_id(v_array[8]));
+		EXPECT_EQ((size_t)sizeof(char_array), (size_t)value_type_size(v_array[8]));
+		EXPECT_EQ((int)0, (int)memcmp(value_to_buffer(v_array[8]), char_array, sizeof(char_array)));
+
+		EXPECT_EQ((type_id)TYPE_ARRAY, (type_id)value_type_id(v_array[9]));
+		EXPECT_EQ((size_t)2, (size_t)value_type_count(v_array[9]));
+
+		value *v_inner = value_to_array(v_array[9]);
+
+		EXPECT_EQ((type_id)TYPE_INT, (type_id)value_type_id(v_inner[0]));
+		EXPECT_EQ((int)-1, (int)value_to_int(v_inner[0]));
+
+		EXPECT_EQ((type_id)TYPE_MAP, (type_id)value_type_id(v_inner[1]));
+		EXPECT_EQ((size_t)1, (size_t)value_type_count(v_inner[1]));
+
+		value *tupla = value_to_array(value_to_map(v_inner[1])[0]);
+
+		EXPECT_EQ((int)0, (int)strcmp(value_to_string(tupla[0]), map_key));
+		EXPECT_EQ((type_id)TYPE_LONG, (type_id)value_type_id(tupla[1]));
+		EXPECT_EQ((long)-251251251L, (long)value_to_long(tupla[1]));
+
+		EXPECT_EQ((type_id)TYPE_PTR, (type_id)value_type_id(v_array[10]));
+		EXPECT_EQ((void *)0x000A7EF2, (void *)value_to_ptr(v_array[10]));
+
+		EXPECT_EQ((type_id)TYPE_NULL, (type_id)value_type_id(v_array[11]));
+
+		// Exceptions and throwables are serialized as maps, like in RapidJSON
+		EXPECT_EQ((type_id)TYPE_MAP, (type_id)value_type_id(v_array[12]));
+		EXPECT_EQ((size_t)4, (size_t)value_type_count(v_array[12]));
+
+		tupla = value_to_array(value_to_map(v_array[12])[2]);
+
+		EXPECT_EQ((int)0, (int)strcmp(value_to_string(tupla[0]), "code"));
+		EXPECT_EQ((long)33L, (long)value_to_long(tupla[1]));
+
+		EXPECT_EQ((type_id)TYPE_MAP, (type_id)value_type_id(v_array[13]));
+
+		tupla = value_to_array(value_to_map(v_array[13])[0]);
+
+		EXPECT_EQ((int)0, (int)strcmp(value_to_string(tupla[0]), "ExceptionThrown"));
+		EXPECT_EQ((int)7, (int)value_to_int(tupla[1]));
+
+		value_type_destroy(v);
+
+		// Deserialize a buffer encoded by another MessagePack implementation
+		v = serial_deserialize(s, msgpack_buffer_array, sizeof(msgpack_buffer_array), allocator);
+
+		ASSERT_NE((value)NULL, (value)v);
+		EXPECT_EQ((type_id)TYPE_ARRAY, (type_id)value_type_id(v));
+		EXPECT_EQ((size_t)2, (size_t)value_type_count(v));
+
+		v_array = value_to_array(v);
+
+		EXPECT_EQ((type_id)TYPE_INT, (type_id)value_type_id(v_array[0]));
+		EXPECT_EQ((int)1, (int)value_to_int(v_array[0]));
+		EXPECT_EQ((type_id)TYPE_STRING, (type_id)value_type_id(v_array[1]));
+		EXPECT_EQ((int)0, (int)strcmp(value_to_string(v_array[1]), "a"));
+
+		value_type_destroy(v);
+
+		// Truncated input must fail instead of reading past the end
+		EXPECT_EQ((value)NULL, (value)serial_deserialize(s, msgpack_buffer_array, sizeof(msgpack_buffer_array) - 1, allocator));
+	}
+
+/* RapidJSON */
+#if defined(OPTION_BUILD_SERIALS_RAPID_JSON)
 	// Clear RapidJSON serial
 	EXPECT_EQ((int)0, (int)serial_clear(serial_create(rapid_json_name())));
+#endif /* OPTION_BUILD_SERIALS_RAPID_JSON */
 
 	// Clear MetaCall serial
 	EXPECT_EQ((int)0, (int)serial_clear(serial_create(metacall_name())));
 
+	// Clear MessagePack serial
+	EXPECT_EQ((int)0, (int)serial_clear(serial_create(msgpack_name())));
+
 	// Destroy serial
 	serial_destroy();
 
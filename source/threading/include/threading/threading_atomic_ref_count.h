@@ -142,6 +142,43 @@ static inline int threading_atomic_ref_count_decrement(threading_atomic_ref_coun
 	return 0;
 }
 
+static inline int threading_atomic_ref_count_release(threading_atomic_ref_count ref, int *last)
+{
+#if defined(__THREAD_SANITIZER__)
+	threading_mutex_lock(&ref->m);
+	{
+		if (ref->count == THREADING_ATOMIC_REF_COUNT_MIN)
+		{
+			threading_mutex_unlock(&ref->m);
+
+			return 1;
+		}
+
+		*last = (--ref->count == THREADING_ATOMIC_REF_COUNT_MIN);
+	}
+	threading_mutex_unlock(&ref->m);
+#else
+	uintmax_t old_ref_count = atomic_load_explicit(&ref->count, memory_order_relaxed);
+
+	do
+	{
+		if (old_ref_count == THREADING_ATOMIC_REF_COUNT_MIN)
+		{
+			return 1;
+		}
+	} while (!atomic_compare_exchange_weak_explicit(&ref->count, &old_ref_count, old_ref_count - 1, memory_order_release, memory_order_relaxed));
+
+	*last = (old_ref_count == THREADING_ATOMIC_REF_COUNT_MIN + 1);
+
+	if (*last)
+	{
+		atomic_thread_fence(memory_order_acquire);
+	}
+#endif
+
+	return 0;
+}
+
 static inline void threading_atomic_ref_count_destroy(threading_atomic_ref_count ref)
 {
 #if defined(__THREAD_SANITIZER__)
@@ -0,0 +1,84 @@
+/*
+ *	Abstract Data Type Library by Parra Studios
+ *	A abstract data type library providing generic containers.
+ *
+ *	Copyright (C) 2016 - 2022 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef THREADING_CONDITION_H
+#define THREADING_CONDITION_H 1
+
+/* -- Headers -- */
+
+#include <threading/threading_api.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Type Definitions -- */
+
+#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64)
+	#include <windows.h>
+typedef CONDITION_VARIABLE threading_condition_impl_type;
+typedef CRITICAL_SECTION threading_condition_mutex_impl_type;
+#elif (defined(linux) || defined(__linux) || defined(__linux__) || defined(__gnu_linux) || defined(__gnu_linux__) || defined(__TOS_LINUX__)) || \
+	defined(__FreeBSD__) ||                                                                                                                     \
+	defined(__NetBSD__) ||                                                                                                                      \
+	defined(__OpenBSD__) ||                                                                                                                     \
+	(defined(bsdi) || defined(__bsdi__)) ||                                                                                                     \
+	defined(__DragonFly__) ||                                                                                                                   \
+	(defined(__MACOS__) || defined(macintosh) || defined(Macintosh) || defined(__TOS_MACOS__)) ||                                               \
+	(defined(__APPLE__) && defined(__MACH__)) || defined(__MACOSX__)
+	#include <pthread.h>
+typedef pthread_cond_t threading_condition_impl_type;
+typedef pthread_mutex_t threading_condition_mutex_impl_type;
+#else
+	#error "Platform not supported for condition implementation"
+#endif
+
+/* -- Member Data -- */
+
+struct threading_condition_type
+{
+	threading_condition_impl_type impl;
+	threading_condition_mutex_impl_type mutex;
+	int signaled;
+};
+
+/* -- Type Definitions -- */
+
+typedef struct threading_condition_type *threading_condition;
+
+/* -- Methods -- */
+
+/*
+* The condition behaves as an auto reset event, a notification done while nobody
+* is waiting is not lost, it wakes up the next wait, which consumes it
+*/
+THREADING_API int threading_condition_initialize(threading_condition c);
+
+THREADING_API int threading_condition_wait(threading_condition c, unsigned int timeout_ms);
+
+THREADING_API int threading_condition_notify(threading_condition c);
+
+THREADING_API int threading_condition_destroy(threading_condition c);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* THREADING_CONDITION_H */
@@ -0,0 +1,121 @@
+/*
+ *	Thrading Library by Parra Studios
+ *	A threading library providing utilities for lock-free data structures and more.
+ *
+ *	Copyright (C) 2016 - 2022 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef THREADING_LEFT_RIGHT_H
+#define THREADING_LEFT_RIGHT_H 1
+
+/* -- Headers -- */
+
+#include <threading/threading_api.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Headers -- */
+
+#include <stddef.h>
+
+/* -- Definitions -- */
+
+/*
+* Number of instances of the protected data structure, the writers modify each instance
+* in turns while the readers keep reading the other one, so the readers never wait
+*/
+#if defined(THREADING_THREAD_SAFE)
+	#define THREADING_LEFT_RIGHT_SIZE 2
+#else
+	#define THREADING_LEFT_RIGHT_SIZE 1
+#endif
+
+/* -- Forward Declarations -- */
+
+struct threading_left_right_type;
+
+/* -- Type Definitions -- */
+
+typedef struct threading_left_right_type *threading_left_right;
+
+typedef int (*threading_left_right_write_cb)(size_t, void *);
+
+/* -- Methods -- */
+
+/*
+* Left-Right concurrency control, the readers only announce themselves into a read indicator
+* and read the instance pointed by left_right, so lookups are wait-free. The writers are serialized,
+* they modify the instance that is not being read, switch the readers to it, wait until no reader
+* is in the old instance and then apply the same modification to it. It is used for the registries
+* (scopes and plugin managers) which are read on each call and only written when loading or clearing,
+* it is only enabled with OPTION_THREAD_SAFE, otherwise there is a single instance and no synchronization.
+* The write callback must be idempotent, if it fails on the second instance it is applied again, and if it
+* keeps failing the error is returned with the instances left different. A writer must not hold a read
+* section of another left-right while writing, because it waits for the readers of the one it writes
+*/
+#if defined(THREADING_THREAD_SAFE)
+
+THREADING_API int threading_left_right_create(threading_left_right *lr);
+
+THREADING_API size_t threading_left_right_read_lock(threading_left_right lr, size_t *instance);
+
+THREADING_API void threading_left_right_read_unlock(threading_left_right lr, size_t version);
+
+THREADING_API int threading_left_right_write(threading_left_right lr, threading_left_right_write_cb cb, void *data);
+
+THREADING_API void threading_left_right_destroy(threading_left_right lr);
+
+#else
+
+static inline int threading_left_right_create(threading_left_right *lr)
+{
+	*lr = NULL;
+	return 0;
+}
+
+static inline size_t threading_left_right_read_lock(threading_left_right lr, size_t *instance)
+{
+	(void)lr;
+	*instance = 0;
+	return 0;
+}
+
+static inline void threading_left_right_read_unlock(threading_left_right lr, size_t version)
+{
+	(void)lr;
+	(void)version;
+}
+
+static inline int threading_left_right_write(threading_left_right lr, threading_left_right_write_cb cb, void *data)
+{
+	(void)lr;
+	return cb(0, data);
+}
+
+static inline void threading_left_right_destroy(threading_left_right lr)
+{
+	(void)lr;
+}
+
+#endif /* THREADING_THREAD_SAFE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* THREADING_LEFT_RIGHT_H */
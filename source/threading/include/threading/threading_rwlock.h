@@ -0,0 +1,127 @@
+/*
+ *	Thrading Library by Parra Studios
+ *	A threading library providing utilities for lock-free data structures and more.
+ *
+ *	Copyright (C) 2016 - 2022 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef THREADING_RWLOCK_H
+#define THREADING_RWLOCK_H 1
+
+/* -- Headers -- */
+
+#include <threading/threading_api.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Type Definitions -- */
+
+#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64)
+	#include <windows.h>
+typedef SRWLOCK threading_rwlock_impl_type;
+#elif (defined(linux) || defined(__linux) || defined(__linux__) || defined(__gnu_linux) || defined(__gnu_linux__) || defined(__TOS_LINUX__)) || \
+	defined(__FreeBSD__) ||                                                                                                                     \
+	defined(__NetBSD__) ||                                                                                                                      \
+	defined(__OpenBSD__) ||                                                                                                                     \
+	(defined(bsdi) || defined(__bsdi__)) ||                                                                                                     \
+	defined(__DragonFly__) ||                                                                                                                   \
+	(defined(__MACOS__) || defined(macintosh) || defined(Macintosh) || defined(__TOS_MACOS__)) ||                                               \
+	(defined(__APPLE__) && defined(__MACH__)) || defined(__MACOSX__)
+	#include <pthread.h>
+typedef pthread_rwlock_t threading_rwlock_impl_type;
+#else
+	#error "Platform not supported for read-write lock implementation"
+#endif
+
+/* -- Member Data -- */
+
+struct threading_rwlock_type
+{
+	threading_rwlock_impl_type impl;
+};
+
+/* -- Type Definitions -- */
+
+typedef struct threading_rwlock_type *threading_rwlock;
+
+/* -- Methods -- */
+
+/*
+* The read-write lock protects the registries (scopes, plugin managers and loaders) which are read
+* on each call and only written when loading or clearing, it is only enabled with OPTION_THREAD_SAFE,
+* otherwise all the methods are empty so single threaded builds do not pay the cost of the locking
+*/
+#if defined(THREADING_THREAD_SAFE)
+
+THREADING_API int threading_rwlock_initialize(threading_rwlock l);
+
+THREADING_API int threading_rwlock_read_lock(threading_rwlock l);
+
+THREADING_API int threading_rwlock_read_unlock(threading_rwlock l);
+
+THREADING_API int threading_rwlock_write_lock(threading_rwlock l);
+
+THREADING_API int threading_rwlock_write_unlock(threading_rwlock l);
+
+THREADING_API int threading_rwlock_destroy(threading_rwlock l);
+
+#else
+
+static inline int threading_rwlock_initialize(threading_rwlock l)
+{
+	(void)l;
+	return 0;
+}
+
+static inline int threading_rwlock_read_lock(threading_rwlock l)
+{
+	(void)l;
+	return 0;
+}
+
+static inline int threading_rwlock_read_unlock(threading_rwlock l)
+{
+	(void)l;
+	return 0;
+}
+
+static inline int threading_rwlock_write_lock(threading_rwlock l)
+{
+	(void)l;
+	return 0;
+}
+
+static inline int threading_rwlock_write_unlock(threading_rwlock l)
+{
+	(void)l;
+	return 0;
+}
+
+static inline int threading_rwlock_destroy(threading_rwlock l)
+{
+	(void)l;
+	return 0;
+}
+
+#endif /* THREADING_THREAD_SAFE */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* THREADING_RWLOCK_H */
@@ -0,0 +1,80 @@
+/*
+ *	Abstract Data Type Library by Parra Studios
+ *	A abstract data type library providing generic containers.
+ *
+ *	Copyright (C) 2016 - 2022 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+#ifndef THREADING_THREAD_H
+#define THREADING_THREAD_H 1
+
+/* -- Headers -- */
+
+#include <threading/threading_api.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -- Type Definitions -- */
+
+#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64)
+	#include <windows.h>
+typedef HANDLE threading_thread_impl_type;
+#elif (defined(linux) || defined(__linux) || defined(__linux__) || defined(__gnu_linux) || defined(__gnu_linux__) || defined(__TOS_LINUX__)) || \
+	defined(__FreeBSD__) ||                                                                                                                     \
+	defined(__NetBSD__) ||                                                                                                                      \
+	defined(__OpenBSD__) ||                                                                                                                     \
+	(defined(bsdi) || defined(__bsdi__)) ||                                                                                                     \
+	defined(__DragonFly__) ||                                                                                                                   \
+	(defined(__MACOS__) || defined(macintosh) || defined(Macintosh) || defined(__TOS_MACOS__)) ||                                               \
+	(defined(__APPLE__) && defined(__MACH__)) || defined(__MACOSX__)
+	#include <pthread.h>
+typedef pthread_t threading_thread_impl_type;
+#else
+	#error "Platform not supported for thread implementation"
+#endif
+
+typedef void (*threading_thread_cb)(void *);
+
+/* -- Member Data -- */
+
+struct threading_thread_type
+{
+	threading_thread_impl_type impl;
+	threading_thread_cb cb;
+	void *data;
+};
+
+/* -- Type Definitions -- */
+
+typedef struct threading_thread_type *threading_thread;
+
+/* -- Methods -- */
+
+/*
+* The thread structure is owned by the caller and it must
+* stay alive until threading_thread_join has been called
+*/
+THREADING_API int threading_thread_create(threading_thread t, threading_thread_cb cb, void *data);
+
+THREADING_API int threading_thread_join(threading_thread t);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* THREADING_THREAD_H */
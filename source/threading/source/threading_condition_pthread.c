@@ -0,0 +1,104 @@
+/*
+ *	Abstract Data Type Library by Parra Studios
+ *	A abstract data type library providing generic containers.
+ *
+ *	Copyright (C) 2016 - 2022 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <threading/threading_condition.h>
+
+#include <time.h>
+
+/* -- Methods -- */
+
+int threading_condition_initialize(threading_condition c)
+{
+	c->signaled = 0;
+
+	if (pthread_mutex_init(&c->mutex, NULL) != 0)
+	{
+		return 1;
+	}
+
+	if (pthread_cond_init(&c->impl, NULL) != 0)
+	{
+		pthread_mutex_destroy(&c->mutex);
+		return 1;
+	}
+
+	return 0;
+}
+
+int threading_condition_wait(threading_condition c, unsigned int timeout_ms)
+{
+	struct timespec deadline;
+	int result = 0;
+
+	clock_gettime(CLOCK_REALTIME, &deadline);
+
+	deadline.tv_sec += timeout_ms / 1000;
+	deadline.tv_nsec += (long)(timeout_ms % 1000) * 1000000L;
+
+	if (deadline.tv_nsec >= 1000000000L)
+	{
+		deadline.tv_sec += 1;
+		deadline.tv_nsec -= 1000000000L;
+	}
+
+	pthread_mutex_lock(&c->mutex);
+
+	while (c->signaled == 0 && result == 0)
+	{
+		result = pthread_cond_timedwait(&c->impl, &c->mutex, &deadline);
+	}
+
+	result = (c->signaled == 0);
+
+	c->signaled = 0;
+
+	pthread_mutex_unlock(&c->mutex);
+
+	return result;
+}
+
+int threading_condition_notify(threading_condition c)
+{
+	int result;
+
+	pthread_mutex_lock(&c->mutex);
+
+	c->signaled = 1;
+
+	result = pthread_cond_signal(&c->impl);
+
+	pthread_mutex_unlock(&c->mutex);
+
+	return result;
+}
+
+int threading_condition_destroy(threading_condition c)
+{
+	int result = pthread_cond_destroy(&c->impl);
+
+	if (pthread_mutex_destroy(&c->mutex) != 0)
+	{
+		return 1;
+	}
+
+	return result;
+}
@@ -0,0 +1,78 @@
+/*
+ *	Abstract Data Type Library by Parra Studios
+ *	A abstract data type library providing generic containers.
+ *
+ *	Copyright (C) 2016 - 2022 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <threading/threading_condition.h>
+
+/* -- Methods -- */
+
+int threading_condition_initialize(threading_condition c)
+{
+	c->signaled = 0;
+
+	InitializeCriticalSection(&c->mutex);
+	InitializeConditionVariable(&c->impl);
+
+	return 0;
+}
+
+int threading_condition_wait(threading_condition c, unsigned int timeout_ms)
+{
+	int result = 0;
+
+	EnterCriticalSection(&c->mutex);
+
+	while (c->signaled == 0 && result == 0)
+	{
+		if (SleepConditionVariableCS(&c->impl, &c->mutex, (DWORD)timeout_ms) == 0)
+		{
+			result = 1;
+		}
+	}
+
+	result = (c->signaled == 0);
+
+	c->signaled = 0;
+
+	LeaveCriticalSection(&c->mutex);
+
+	return result;
+}
+
+int threading_condition_notify(threading_condition c)
+{
+	EnterCriticalSection(&c->mutex);
+
+	c->signaled = 1;
+
+	WakeConditionVariable(&c->impl);
+
+	LeaveCriticalSection(&c->mutex);
+
+	return 0;
+}
+
+int threading_condition_destroy(threading_condition c)
+{
+	DeleteCriticalSection(&c->mutex);
+
+	return 0;
+}
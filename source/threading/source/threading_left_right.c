@@ -0,0 +1,163 @@
+/*
+ *	Thrading Library by Parra Studios
+ *	A threading library providing utilities for lock-free data structures and more.
+ *
+ *	Copyright (C) 2016 - 2022 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <threading/threading_left_right.h>
+
+#include <threading/threading_atomic.h>
+#include <threading/threading_mutex.h>
+
+#include <stdlib.h>
+
+#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64)
+	#include <windows.h>
+#else
+	#include <sched.h>
+#endif
+
+/* -- Definitions -- */
+
+#define THREADING_LEFT_RIGHT_RETRY_SIZE 16 /* Attempts to apply a modification to the old instance once the readers left it */
+
+/* -- Member Data -- */
+
+struct threading_left_right_type
+{
+	atomic_uint left_right;				/* Index of the instance that new readers must read */
+	atomic_uint version_index;			/* Index of the read indicator where new readers arrive */
+	atomic_uintmax_t readers[2];		/* Read indicators, number of readers that arrived to each version */
+	struct threading_mutex_type writer; /* Serializes the writers between them */
+};
+
+/* -- Private Methods -- */
+
+static void threading_left_right_yield(void)
+{
+#if defined(_WIN32) || defined(__WIN32__) || defined(_WIN64)
+	SwitchToThread();
+#else
+	sched_yield();
+#endif
+}
+
+static void threading_left_right_wait(threading_left_right lr, unsigned int version)
+{
+	/* The readers only perform lookups, so they leave the read indicator shortly */
+	while (atomic_load(&lr->readers[version]) != 0)
+	{
+		threading_left_right_yield();
+	}
+}
+
+/* -- Methods -- */
+
+int threading_left_right_create(threading_left_right *lr)
+{
+	threading_left_right result = malloc(sizeof(struct threading_left_right_type));
+
+	if (result == NULL)
+	{
+		return 1;
+	}
+
+	atomic_store(&result->left_right, 0);
+	atomic_store(&result->version_index, 0);
+	atomic_store(&result->readers[0], 0);
+	atomic_store(&result->readers[1], 0);
+
+	if (threading_mutex_initialize(&result->writer) != 0)
+	{
+		free(result);
+		return 1;
+	}
+
+	*lr = result;
+
+	return 0;
+}
+
+size_t threading_left_right_read_lock(threading_left_right lr, size_t *instance)
+{
+	unsigned int version = atomic_load(&lr->version_index);
+
+	atomic_fetch_add(&lr->readers[version], 1);
+
+	*instance = (size_t)atomic_load(&lr->left_right);
+
+	return (size_t)version;
+}
+
+void threading_left_right_read_unlock(threading_left_right lr, size_t version)
+{
+	atomic_fetch_sub(&lr->readers[version], 1);
+}
+
+int threading_left_right_write(threading_left_right lr, threading_left_right_write_cb cb, void *data)
+{
+	unsigned int left_right, version;
+	size_t retry;
+	int result;
+
+	if (threading_mutex_lock(&lr->writer) != 0)
+	{
+		return 1;
+	}
+
+	left_right = atomic_load(&lr->left_right);
+
+	/* Modify the instance that nobody is reading */
+	result = cb((size_t)!left_right, data);
+
+	if (result == 0)
+	{
+		/* Move the new readers into the modified instance */
+		atomic_store(&lr->left_right, !left_right);
+
+		/* Toggle the read indicator and wait until the readers of both versions leave the old instance */
+		version = atomic_load(&lr->version_index);
+
+		threading_left_right_wait(lr, !version);
+
+		atomic_store(&lr->version_index, !version);
+
+		threading_left_right_wait(lr, version);
+
+		/* Apply the same modification to the old instance so both of them are equal again, the new readers
+		* already see it so it can not be undone, the callback is retried and the error returned if it keeps failing */
+		for (retry = 0; (result = cb((size_t)left_right, data)) != 0 && retry < THREADING_LEFT_RIGHT_RETRY_SIZE; ++retry)
+		{
+			threading_left_right_yield();
+		}
+	}
+
+	threading_mutex_unlock(&lr->writer);
+
+	return result;
+}
+
+void threading_left_right_destroy(threading_left_right lr)
+{
+	if (lr != NULL)
+	{
+		threading_mutex_destroy(&lr->writer);
+		free(lr);
+	}
+}
@@ -0,0 +1,53 @@
+/*
+ *	Thrading Library by Parra Studios
+ *	A threading library providing utilities for lock-free data structures and more.
+ *
+ *	Copyright (C) 2016 - 2022 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <threading/threading_rwlock.h>
+
+int threading_rwlock_initialize(threading_rwlock l)
+{
+	return pthread_rwlock_init(&l->impl, NULL);
+}
+
+int threading_rwlock_read_lock(threading_rwlock l)
+{
+	return pthread_rwlock_rdlock(&l->impl);
+}
+
+int threading_rwlock_read_unlock(threading_rwlock l)
+{
+	return pthread_rwlock_unlock(&l->impl);
+}
+
+int threading_rwlock_write_lock(threading_rwlock l)
+{
+	return pthread_rwlock_wrlock(&l->impl);
+}
+
+int threading_rwlock_write_unlock(threading_rwlock l)
+{
+	return pthread_rwlock_unlock(&l->impl);
+}
+
+int threading_rwlock_destroy(threading_rwlock l)
+{
+	return pthread_rwlock_destroy(&l->impl);
+}
@@ -0,0 +1,62 @@
+/*
+ *	Abstract Data Type Library by Parra Studios
+ *	A abstract data type library providing generic containers.
+ *
+ *	Copyright (C) 2016 - 2022 Vicente Eduardo Ferrer Garcia <vic798@gmail.com>
+ *
+ *	Licensed under the Apache License, Version 2.0 (the "License");
+ *	you may not use this file except in compliance with the License.
+ *	You may obtain a copy of the License at
+ *
+ *		http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *	Unless required by applicable law or agreed to in writing, software
+ *	distributed under the License is distributed on an "AS IS" BASIS,
+ *	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *	See the License for the specific language governing permissions and
+ *	limitations under the License.
+ *
+ */
+
+/* -- Headers -- */
+
+#include <threading/threading_thread.h>
+
+/* -- Private Methods -- */
+
+static DWORD WINAPI threading_thread_start(LPVOID arg)
+{
+	threading_thread t = arg;
+
+	t->cb(t->data);
+
+	return 0;
+}
+
+/* -- Methods -- */
+
+int threading_thread_create(threading_thread t, threading_thread_cb cb, void *data)
+{
+	t->cb = cb;
+	t->data = data;
+	t->impl = CreateThread(NULL, 0, &threading_thread_start, t, 0, NULL);
+
+	if (t->impl == NULL)
+	{
+		return 1;
+	}
+
+	return 0;
+}
+
+int threading_thread_join(threading_thread t)
+{
+	if (WaitForSingleObject(t->impl, INFINITE) != WAIT_OBJECT_0)
+	{
+		return 1;
+	}
+
+	CloseHandle(t->impl);
+
+	return 0;
+}